@@ -31,12 +31,25 @@
  */
 #define CONFIG_MEM_POOL_MAX_CHUNKS_NUMBER_LOG (8)
 
+/**
+ * Use 32-bit compressed pointers
+ *
+ * By default, compressed pointers are 16-bit and can address heap of at most 256 KB.
+ * The option widens compressed pointers, so that heaps of tens of megabytes can be addressed,
+ * at cost of increased size of ECMA Object Model's data types (see also: CONFIG_MEM_POOL_CHUNK_SIZE).
+ */
+// #define CONFIG_MEM_CPOINTER_32BIT
+
 /**
  * Size of pool chunk
  *
  * Should not be less than size of any of ECMA Object Model's data types.
  */
-#define CONFIG_MEM_POOL_CHUNK_SIZE (8)
+#ifndef CONFIG_MEM_CPOINTER_32BIT
+# define CONFIG_MEM_POOL_CHUNK_SIZE (8)
+#else /* !CONFIG_MEM_CPOINTER_32BIT */
+# define CONFIG_MEM_POOL_CHUNK_SIZE (16)
+#endif /* CONFIG_MEM_CPOINTER_32BIT */
 
 /**
  * Minimum number of chunks in a pool allocated by pools' manager.
@@ -52,7 +65,11 @@
  * Size of heap
  */
 #ifndef CONFIG_MEM_HEAP_AREA_SIZE
-# define CONFIG_MEM_HEAP_AREA_SIZE (256 * 1024)
+# ifndef CONFIG_MEM_CPOINTER_32BIT
+#  define CONFIG_MEM_HEAP_AREA_SIZE (256 * 1024)
+# else /* !CONFIG_MEM_CPOINTER_32BIT */
+#  define CONFIG_MEM_HEAP_AREA_SIZE (32 * 1024 * 1024)
+# endif /* CONFIG_MEM_CPOINTER_32BIT */
 #endif /* !CONFIG_MEM_HEAP_AREA_SIZE */
 
 /**
@@ -60,6 +77,13 @@
  */
 #define CONFIG_MEM_HEAP_DESIRED_LIMIT (CONFIG_MEM_HEAP_AREA_SIZE / 32)
 
+/**
+ * Size of scratch stack, used for short-term temporary buffers (see also: MEM_DEFINE_LOCAL_ARRAY)
+ *
+ * Buffers that don't fit into the scratch stack are allocated on the heap.
+ */
+#define CONFIG_MEM_SCRATCH_AREA_SIZE (1024)
+
 /**
  * Log2 of maximum possible offset in the heap
  *
@@ -69,8 +93,15 @@
  * In any case size of any of the types should not exceed CONFIG_MEM_POOL_CHUNK_SIZE.
  *
  * On the other hand, value 2 ^ CONFIG_MEM_HEAP_OFFSET_LOG should not be less than CONFIG_MEM_HEAP_AREA_SIZE.
+ *
+ * With 32-bit compressed pointers, the offset is limited by width of ecma-value's pointer field
+ * and of completion value's value field (see also: ECMA_VALUE_SIZE, ECMA_COMPLETION_VALUE_SIZE).
  */
-#define CONFIG_MEM_HEAP_OFFSET_LOG (18)
+#ifndef CONFIG_MEM_CPOINTER_32BIT
+# define CONFIG_MEM_HEAP_OFFSET_LOG (18)
+#else /* !CONFIG_MEM_CPOINTER_32BIT */
+# define CONFIG_MEM_HEAP_OFFSET_LOG (25)
+#endif /* CONFIG_MEM_CPOINTER_32BIT */
 
 /**
  * Number of lower bits in key of literal hash table.
@@ -95,6 +126,22 @@
  */
 #define CONFIG_ECMA_STRING_MAX_CONCATENATION_LENGTH (1048576)
 
+/**
+ * Minimum size of a non-literal string's characters, starting from which the characters are stored contiguously
+ * in a heap block, instead of a chain of pool chunks
+ *
+ * Heap blocks are allocated with CONFIG_MEM_HEAP_CHUNK_SIZE granularity, so shorter strings
+ * are more compact in the chains.
+ */
+#define CONFIG_ECMA_STRING_HEAP_BLOCK_MIN_SIZE (40)
+
+/**
+ * Distance, in code units, between entries of code unit index of non-ASCII strings, stored in heap blocks
+ *
+ * The index is used for access to a code unit by its position without decoding the whole string's prefix.
+ */
+#define CONFIG_ECMA_STRING_CODE_UNIT_INDEX_STEP (64)
+
 /**
  * Use 32-bit/64-bit float for ecma-numbers
  */
@@ -137,6 +184,30 @@
  */
 // #define CONFIG_ECMA_LCACHE_DISABLE
 
+/**
+ * Log2 of number of rows in ECMA lookup cache
+ *
+ * Rows are selected by hash of (object, property name) pair.
+ */
+#define CONFIG_ECMA_LCACHE_HASH_ROWS_COUNT_LOG (7)
+
+/**
+ * Number of entries in a row of ECMA lookup cache (associativity of the cache)
+ *
+ * Entries of a row are replaced in least recently used order.
+ */
+#define CONFIG_ECMA_LCACHE_HASH_ROW_LENGTH (4)
+
+/**
+ * Disable cache of enumerable property names of prototype chains, used by for-in
+ */
+// #define CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+
+/**
+ * Number of entries in cache of enumerable property names of prototype chains
+ */
+#define CONFIG_ECMA_FOR_IN_CACHE_ENTRIES_NUMBER (4)
+
 /**
  * Link Global Environment to an empty declarative lexical environment
  * instead of lexical environment bound to Global Object.
@@ -158,11 +229,59 @@
 // #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_DATE_BUILTIN
 // #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_JSON_BUILTIN
 // #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
+// #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
 #endif /* CONFIG_ECMA_COMPACT_PROFILE */
 
+/**
+ * Disable cache of byte-code, generated for eval and Function constructor
+ */
+// #define CONFIG_PARSER_EVAL_CACHE_DISABLE
+
+/**
+ * Number of entries in cache of byte-code, generated for eval and Function constructor
+ */
+#define CONFIG_PARSER_EVAL_CACHE_ENTRIES_NUMBER (32)
+
+/**
+ * Maximum size of source code, for which generated byte-code is put into the eval cache
+ *
+ * The cache keeps copy of the source code on the heap, so the limit bounds heap usage of the cache.
+ */
+#define CONFIG_PARSER_EVAL_CACHE_MAX_SOURCE_SIZE (1024)
+
+/**
+ * Size of chunk, requested by lexer from script source reader at once
+ *
+ * See also:
+ *          jerry_parse_from_reader
+ */
+#define CONFIG_PARSER_SOURCE_READER_CHUNK_SIZE (256)
+
+/**
+ * Size of chunks of the parser's region allocator (see also: jsp_mm_alloc)
+ */
+#define CONFIG_PARSER_MM_ARENA_CHUNK_SIZE (1024)
+
+/**
+ * Disable peephole optimization of byte-code (constant folding, jump threading, etc.)
+ */
+// #define CONFIG_PARSER_BYTECODE_OPTIMIZER_DISABLE
+
 /**
  * Run GC after execution of each opcode
  */
 // #define CONFIG_VM_RUN_GC_AFTER_EACH_OPCODE
 
+/**
+ * Log2 of number of entries in the VM profiler's table of per-instruction counters (see also: VM_PROFILE)
+ *
+ * Executions of instructions, that don't fit into the table, are only accounted in per-opcode counters.
+ */
+#define CONFIG_VM_PROFILE_INSTRUCTIONS_NUMBER_LOG (12)
+
+/**
+ * Number of the most expensive instructions, listed in the VM profiler's report
+ */
+#define CONFIG_VM_PROFILE_REPORT_HOT_SPOTS_NUMBER (32)
+
 #endif /* !CONFIG_H */
@@ -0,0 +1,249 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-for-in-cache.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "jrt-libc-includes.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaforincache Cache of for-in enumeration results
+ * @{
+ *
+ * The cache maps a prototype object to collection of enumerable property names of the object's prototype chain,
+ * so that for-in loops over objects with same prototype only enumerate own properties of the objects.
+ *
+ * Objects, participating in a cached enumeration (iterated objects and all objects of cached prototype chains),
+ * are marked with 'for-in cached' flag. Change of set of properties or of enumerability of a property
+ * in a marked object invalidates the whole cache and increments the cache's generation counter.
+ *
+ * The generation counter is also used by for-in loops to check, whether the iterated object
+ * could have lost a property since the enumeration.
+ */
+
+/**
+ * Generation of the for-in cache
+ *
+ * The counter is incremented upon each change of properties of an object, marked with 'for-in cached' flag.
+ */
+static uint32_t ecma_for_in_cache_generation;
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+/**
+ * Entry of the for-in cache
+ */
+typedef struct
+{
+  mem_cpointer_t prototype_cp; /**< compressed pointer to prototype object
+                                *   (ECMA_NULL_POINTER marks entry empty) */
+  mem_cpointer_t names_cp; /**< compressed pointer to collection of enumerable property names
+                            *   of the prototype chain (ECMA_NULL_POINTER - if there are no such names) */
+} ecma_for_in_cache_entry_t;
+
+/**
+ * The for-in cache's entries
+ */
+static ecma_for_in_cache_entry_t ecma_for_in_cache_entries[CONFIG_ECMA_FOR_IN_CACHE_ENTRIES_NUMBER];
+
+/**
+ * Index of entry to be replaced upon next insertion to the full cache (entries are replaced in round-robin order)
+ */
+static uint32_t ecma_for_in_cache_next_evicted_entry_index;
+
+/**
+ * Free the entry's names collection and mark the entry empty
+ */
+static void
+ecma_for_in_cache_free_entry (ecma_for_in_cache_entry_t *entry_p) /**< entry */
+{
+  if (entry_p->names_cp != ECMA_NULL_POINTER)
+  {
+    ecma_free_values_collection (ECMA_GET_NON_NULL_POINTER (ecma_collection_header_t, entry_p->names_cp), true);
+  }
+
+  entry_p->prototype_cp = ECMA_NULL_POINTER;
+  entry_p->names_cp = ECMA_NULL_POINTER;
+} /* ecma_for_in_cache_free_entry */
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+
+/**
+ * Initialize the for-in cache
+ */
+void
+ecma_for_in_cache_init (void)
+{
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  memset (ecma_for_in_cache_entries, 0, sizeof (ecma_for_in_cache_entries));
+  ecma_for_in_cache_next_evicted_entry_index = 0;
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+} /* ecma_for_in_cache_init */
+
+/**
+ * Invalidate all entries of the for-in cache
+ */
+void
+ecma_for_in_cache_invalidate_all (void)
+{
+  ecma_for_in_cache_generation++;
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  for (uint32_t i = 0; i < CONFIG_ECMA_FOR_IN_CACHE_ENTRIES_NUMBER; i++)
+  {
+    ecma_for_in_cache_free_entry (&ecma_for_in_cache_entries[i]);
+  }
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+} /* ecma_for_in_cache_invalidate_all */
+
+/**
+ * Notify the for-in cache about change of the object's set of properties or of enumerability of a property
+ */
+void
+ecma_for_in_cache_invalidate_object (ecma_object_t *object_p) /**< object or lexical environment */
+{
+  if (!ecma_is_lexical_environment (object_p)
+      && ecma_get_object_is_for_in_cached (object_p))
+  {
+    ecma_for_in_cache_invalidate_all ();
+  }
+} /* ecma_for_in_cache_invalidate_object */
+
+/**
+ * Remove entries, keyed by the object, from the for-in cache
+ *
+ * Note:
+ *      the procedure is called for objects that are being freed, so the generation counter is not changed
+ */
+void
+ecma_for_in_cache_remove_object (ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  if (!ecma_get_object_is_for_in_cached (object_p))
+  {
+    return;
+  }
+
+  mem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  for (uint32_t i = 0; i < CONFIG_ECMA_FOR_IN_CACHE_ENTRIES_NUMBER; i++)
+  {
+    if (ecma_for_in_cache_entries[i].prototype_cp == object_cp)
+    {
+      ecma_for_in_cache_free_entry (&ecma_for_in_cache_entries[i]);
+    }
+  }
+#endif /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+} /* ecma_for_in_cache_remove_object */
+
+/**
+ * Get current generation of the for-in cache
+ *
+ * Note:
+ *      if the generation is not changed since some moment, then no property
+ *      was deleted since the moment from objects, marked with 'for-in cached' flag
+ *
+ * @return generation counter's value
+ */
+uint32_t
+ecma_for_in_cache_get_generation (void)
+{
+  return ecma_for_in_cache_generation;
+} /* ecma_for_in_cache_get_generation */
+
+/**
+ * Lookup collection of enumerable property names of the prototype chain in the for-in cache
+ *
+ * @return true - if the prototype chain is cached (collection is returned through out_names_p,
+ *                and NULL is returned if there are no enumerable properties in the chain),
+ *         false - otherwise.
+ */
+bool
+ecma_for_in_cache_lookup (ecma_object_t *prototype_p, /**< first object of the prototype chain */
+                          ecma_collection_header_t **out_names_p) /**< out: collection of names,
+                                                                   *        owned by the cache */
+{
+  JERRY_ASSERT (prototype_p != NULL);
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  if (ecma_get_object_is_for_in_cached (prototype_p))
+  {
+    mem_cpointer_t prototype_cp;
+    ECMA_SET_NON_NULL_POINTER (prototype_cp, prototype_p);
+
+    for (uint32_t i = 0; i < CONFIG_ECMA_FOR_IN_CACHE_ENTRIES_NUMBER; i++)
+    {
+      if (ecma_for_in_cache_entries[i].prototype_cp == prototype_cp)
+      {
+        *out_names_p = ECMA_GET_POINTER (ecma_collection_header_t, ecma_for_in_cache_entries[i].names_cp);
+
+        return true;
+      }
+    }
+  }
+#else /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+  (void) prototype_p;
+  (void) out_names_p;
+#endif /* CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+
+  return false;
+} /* ecma_for_in_cache_lookup */
+
+/**
+ * Put collection of enumerable property names of the prototype chain to the for-in cache
+ *
+ * @return true - if the collection was put to the cache (the cache takes ownership of the collection),
+ *         false - otherwise (the cache is disabled, the caller should free the collection).
+ */
+bool
+ecma_for_in_cache_insert (ecma_object_t *prototype_p, /**< first object of the prototype chain */
+                          ecma_collection_header_t *names_p) /**< collection of the chain's enumerable
+                                                              *   property names (or NULL, if there are none) */
+{
+  JERRY_ASSERT (prototype_p != NULL);
+
+  /* objects of the chain are marked even if the cache is disabled, as for-in loops rely on the generation counter */
+  for (ecma_object_t *iter_p = prototype_p;
+       iter_p != NULL;
+       iter_p = ecma_get_object_prototype (iter_p))
+  {
+    ecma_set_object_is_for_in_cached (iter_p, true);
+  }
+
+#ifndef CONFIG_ECMA_FOR_IN_CACHE_DISABLE
+  ecma_for_in_cache_entry_t *entry_p = &ecma_for_in_cache_entries[ecma_for_in_cache_next_evicted_entry_index];
+  ecma_for_in_cache_next_evicted_entry_index = ((ecma_for_in_cache_next_evicted_entry_index + 1u)
+                                                % CONFIG_ECMA_FOR_IN_CACHE_ENTRIES_NUMBER);
+
+  ecma_for_in_cache_free_entry (entry_p);
+
+  ECMA_SET_NON_NULL_POINTER (entry_p->prototype_cp, prototype_p);
+  ECMA_SET_POINTER (entry_p->names_cp, names_p);
+
+  return true;
+#else /* !CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+  (void) names_p;
+
+  return false;
+#endif /* CONFIG_ECMA_FOR_IN_CACHE_DISABLE */
+} /* ecma_for_in_cache_insert */
+
+/**
+ * @}
+ * @}
+ */
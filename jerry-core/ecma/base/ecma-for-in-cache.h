@@ -0,0 +1,41 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_FOR_IN_CACHE_H
+#define ECMA_FOR_IN_CACHE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaforincache Cache of for-in enumeration results
+ * @{
+ */
+
+extern void ecma_for_in_cache_init (void);
+extern void ecma_for_in_cache_invalidate_all (void);
+extern void ecma_for_in_cache_invalidate_object (ecma_object_t *object_p);
+extern void ecma_for_in_cache_remove_object (ecma_object_t *object_p);
+extern uint32_t ecma_for_in_cache_get_generation (void);
+extern bool ecma_for_in_cache_lookup (ecma_object_t *prototype_p, ecma_collection_header_t **out_names_p);
+extern bool ecma_for_in_cache_insert (ecma_object_t *prototype_p, ecma_collection_header_t *names_p);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* ECMA_FOR_IN_CACHE_H */
@@ -26,6 +26,7 @@
 
 #include "ecma-alloc.h"
 #include "ecma-globals.h"
+#include "ecma-for-in-cache.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
@@ -78,7 +79,7 @@ ecma_gc_get_object_refs (ecma_object_t *object_p) /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  return (uint32_t) jrt_extract_bit_field (object_p->container,
+  return (uint32_t) ecma_get_object_field (object_p,
                                            ECMA_OBJECT_GC_REFS_POS,
                                            ECMA_OBJECT_GC_REFS_WIDTH);
 } /* ecma_gc_get_object_refs */
@@ -92,10 +93,10 @@ ecma_gc_set_object_refs (ecma_object_t *object_p, /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 refs,
-                                                 ECMA_OBJECT_GC_REFS_POS,
-                                                 ECMA_OBJECT_GC_REFS_WIDTH);
+  ecma_set_object_field (object_p,
+                         refs,
+                         ECMA_OBJECT_GC_REFS_POS,
+                         ECMA_OBJECT_GC_REFS_WIDTH);
 } /* ecma_gc_set_object_refs */
 
 /**
@@ -107,7 +108,7 @@ ecma_gc_get_object_next (ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (object_p != NULL);
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_GC_NEXT_CP_WIDTH);
-  uintptr_t next_cp = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t next_cp = (uintptr_t) ecma_get_object_field (object_p,
                                                          ECMA_OBJECT_GC_NEXT_CP_POS,
                                                          ECMA_OBJECT_GC_NEXT_CP_WIDTH);
 
@@ -128,10 +129,10 @@ ecma_gc_set_object_next (ecma_object_t *object_p, /**< object */
   ECMA_SET_POINTER (next_cp, next_object_p);
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_GC_NEXT_CP_WIDTH);
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 next_cp,
-                                                 ECMA_OBJECT_GC_NEXT_CP_POS,
-                                                 ECMA_OBJECT_GC_NEXT_CP_WIDTH);
+  ecma_set_object_field (object_p,
+                         next_cp,
+                         ECMA_OBJECT_GC_NEXT_CP_POS,
+                         ECMA_OBJECT_GC_NEXT_CP_WIDTH);
 } /* ecma_gc_set_object_next */
 
 /**
@@ -142,7 +143,7 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
 {
   JERRY_ASSERT (object_p != NULL);
 
-  bool flag_value = (bool) jrt_extract_bit_field (object_p->container,
+  bool flag_value = (bool) ecma_get_object_field (object_p,
                                                   ECMA_OBJECT_GC_VISITED_POS,
                                                   ECMA_OBJECT_GC_VISITED_WIDTH);
 
@@ -163,10 +164,10 @@ ecma_gc_set_object_visited (ecma_object_t *object_p, /**< object */
     is_visited = !is_visited;
   }
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 is_visited,
-                                                 ECMA_OBJECT_GC_VISITED_POS,
-                                                 ECMA_OBJECT_GC_VISITED_WIDTH);
+  ecma_set_object_field (object_p,
+                         is_visited,
+                         ECMA_OBJECT_GC_VISITED_POS,
+                         ECMA_OBJECT_GC_VISITED_WIDTH);
 } /* ecma_gc_set_object_visited */
 
 /**
@@ -213,6 +214,33 @@ ecma_gc_init (void)
   ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
 } /* ecma_gc_init */
 
+/**
+ * Save garbage collector's state to a heap snapshot
+ */
+void
+ecma_gc_save_snapshot_state (ecma_gc_snapshot_state_t *out_state_p) /**< out: garbage collector's state */
+{
+  out_state_p->white_gray_objects = mem_heap_get_snapshot_pointer (ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY]);
+  out_state_p->black_objects = mem_heap_get_snapshot_pointer (ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK]);
+  out_state_p->visited_flip_flag = ecma_gc_visited_flip_flag;
+} /* ecma_gc_save_snapshot_state */
+
+/**
+ * Initialize garbage collector from a heap snapshot
+ *
+ * Note:
+ *      the heap should be already restored from the snapshot
+ */
+void
+ecma_gc_init_from_snapshot (const ecma_gc_snapshot_state_t *state_p) /**< garbage collector's state */
+{
+  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = (ecma_object_t *) mem_heap_get_pointer_from_snapshot (
+    state_p->white_gray_objects);
+  ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = (ecma_object_t *) mem_heap_get_pointer_from_snapshot (
+    state_p->black_objects);
+  ecma_gc_visited_flip_flag = state_p->visited_flip_flag;
+} /* ecma_gc_init_from_snapshot */
+
 /**
  * Mark objects as visited starting from specified object as root
  */
@@ -323,6 +351,7 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
             case ECMA_INTERNAL_PROPERTY_CODE_BYTECODE: /* compressed pointer to a bytecode array */
             case ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET: /* an integer */
             case ECMA_INTERNAL_PROPERTY_NATIVE_CODE: /* an external pointer */
+            case ECMA_INTERNAL_PROPERTY_NATIVE_NUMBER_CODE: /* an external pointer */
             case ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE: /* an external pointer */
             case ECMA_INTERNAL_PROPERTY_FREE_CALLBACK: /* an object's native free callback */
             case ECMA_INTERNAL_PROPERTY_BUILT_IN_ID: /* an integer */
@@ -331,12 +360,19 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
             case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_0_31: /* an integer (bit-mask) */
             case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_32_63: /* an integer (bit-mask) */
             case ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE:
+            case ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_BYTE_LENGTH: /* an integer */
+            case ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_DATA: /* compressed pointer to a heap block */
+            case ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_EXTERNAL_DATA: /* an external pointer */
+            case ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_TYPE: /* an enum */
+            case ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_BYTE_OFFSET: /* an integer */
+            case ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_LENGTH: /* an integer */
             {
               break;
             }
 
             case ECMA_INTERNAL_PROPERTY_SCOPE: /* a lexical environment */
             case ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP: /* an object */
+            case ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_BUFFER: /* an object */
             {
               ecma_object_t *obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, property_value);
 
@@ -365,6 +401,8 @@ ecma_gc_sweep (ecma_object_t *object_p) /**< object to free */
 
   if (!ecma_is_lexical_environment (object_p))
   {
+    ecma_for_in_cache_remove_object (object_p);
+
     /* if the object provides free callback, invoke it with handle stored in the object */
 
     ecma_external_pointer_t freecb_p;
@@ -26,7 +26,19 @@
 #include "ecma-globals.h"
 #include "mem-allocator.h"
 
+/**
+ * Garbage collector's state, stored in a heap snapshot
+ */
+typedef struct
+{
+  mem_heap_snapshot_pointer_t white_gray_objects; /**< list of white / gray objects */
+  mem_heap_snapshot_pointer_t black_objects; /**< list of black objects */
+  bool visited_flip_flag; /**< current state of objects' visited flag */
+} ecma_gc_snapshot_state_t;
+
 extern void ecma_gc_init (void);
+extern void ecma_gc_save_snapshot_state (ecma_gc_snapshot_state_t *out_state_p);
+extern void ecma_gc_init_from_snapshot (const ecma_gc_snapshot_state_t *state_p);
 extern void ecma_init_gc_info (ecma_object_t *object_p);
 extern void ecma_ref_object (ecma_object_t *object_p);
 extern void ecma_deref_object (ecma_object_t *object_p);
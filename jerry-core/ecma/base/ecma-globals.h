@@ -156,9 +156,9 @@ typedef uint32_t ecma_value_t;
  *
  * See also: ECMA-262 v5, 8.9.
  *
- *                                               value (16)
- * Bit-field structure: type (8) | padding (8) <
- *                                               break / continue target
+ *                                 padding (8) | value (16)
+ * Bit-field structure: type (8) <
+ *                                 break / continue target (24)
  */
 typedef uint32_t ecma_completion_value_t;
 
@@ -174,7 +174,7 @@ typedef uint32_t ecma_completion_value_t;
  * Break / continue jump target
  */
 #define ECMA_COMPLETION_VALUE_TARGET_POS (0)
-#define ECMA_COMPLETION_VALUE_TARGET_WIDTH ((uint32_t) sizeof (opcode_counter_t) * JERRY_BITSINBYTE)
+#define ECMA_COMPLETION_VALUE_TARGET_WIDTH (24)
 
 /**
  * Type (ecma_completion_type_t)
@@ -221,6 +221,8 @@ typedef enum
   ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET, /**< second part of [[Code]] - offset in bytecode array and code flags
                                                  *   (see also: ecma_pack_code_internal_property_value) */
   ECMA_INTERNAL_PROPERTY_NATIVE_CODE, /**< native handler location descriptor */
+  ECMA_INTERNAL_PROPERTY_NATIVE_NUMBER_CODE, /**< location descriptor of native handler,
+                                              *   accepting and returning numbers */
   ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE, /**< native handle associated with an object */
   ECMA_INTERNAL_PROPERTY_FREE_CALLBACK, /**< object's native free callback */
   ECMA_INTERNAL_PROPERTY_FORMAL_PARAMETERS, /**< [[FormalParameters]] */
@@ -260,6 +262,16 @@ typedef enum
    */
   ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE,
 
+  ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_BYTE_LENGTH, /**< size of ArrayBuffer's data, in bytes */
+  ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_DATA, /**< compressed pointer to ArrayBuffer's data, allocated on the heap
+                                             *   (ECMA_NULL_POINTER - if the data is empty) */
+  ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_EXTERNAL_DATA, /**< pointer to ArrayBuffer's data, owned by the host */
+
+  ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_BUFFER, /**< typed array's ArrayBuffer object */
+  ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_TYPE, /**< type of typed array's elements (ecma_typed_array_type_t) */
+  ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_BYTE_OFFSET, /**< offset of typed array's first element in the ArrayBuffer */
+  ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_LENGTH, /**< number of typed array's elements */
+
   /**
    * Number of internal properties' types
    */
@@ -401,13 +413,30 @@ typedef enum
   ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION, /** One of built-in functions described in section 15
                                           of ECMA-262 v5 specification */
   ECMA_OBJECT_TYPE_ARGUMENTS, /**< Arguments object (10.6) */
-  ECMA_OBJECT_TYPE_ARRAY /**< Array object (15.4) */
+  ECMA_OBJECT_TYPE_ARRAY, /**< Array object (15.4) */
+  ECMA_OBJECT_TYPE_TYPED_ARRAY /**< Typed array object (view of an ArrayBuffer's binary data) */
   // ECMA_OBJECT_TYPE_HOST /**< Host object */
 } ecma_object_type_t;
 
+/**
+ * Width of a word of ecma-object's container
+ */
+#define ECMA_OBJECT_CONTAINER_WORD_WIDTH (sizeof (uint64_t) * JERRY_BITSINBYTE)
+
+/**
+ * Number of words in ecma-object's container
+ */
+#ifndef CONFIG_MEM_CPOINTER_32BIT
+# define ECMA_OBJECT_CONTAINER_WORDS_NUMBER (1)
+#else /* !CONFIG_MEM_CPOINTER_32BIT */
+# define ECMA_OBJECT_CONTAINER_WORDS_NUMBER (2)
+#endif /* CONFIG_MEM_CPOINTER_32BIT */
+
 /**
  * Description of ECMA-object or lexical environment
  * (depending on is_lexical_environment).
+ *
+ * Fields are accessed through ecma_get_object_field / ecma_set_object_field.
  */
 typedef struct ecma_object_t
 {
@@ -449,14 +478,27 @@ typedef struct ecma_object_t
                                     ECMA_OBJECT_GC_NEXT_CP_WIDTH)
 #define ECMA_OBJECT_GC_VISITED_WIDTH (1)
 
+/**
+ * Position of the first field of objects' / lexical environments' only parts
+ *
+ * With 32-bit compressed pointers the fields don't fit into one 64-bit word,
+ * so the type-specific parts start from the second word of the container
+ * (no field crosses boundary of the container's words).
+ */
+#ifndef CONFIG_MEM_CPOINTER_32BIT
+# define ECMA_OBJECT_TYPE_SPECIFIC_PART_POS (ECMA_OBJECT_GC_VISITED_POS + \
+                                             ECMA_OBJECT_GC_VISITED_WIDTH)
+#else /* !CONFIG_MEM_CPOINTER_32BIT */
+# define ECMA_OBJECT_TYPE_SPECIFIC_PART_POS (ECMA_OBJECT_CONTAINER_WORD_WIDTH)
+#endif /* CONFIG_MEM_CPOINTER_32BIT */
+
 
 /* Objects' only part */
 
 /**
  * Attribute 'Extensible'
  */
-#define ECMA_OBJECT_OBJ_EXTENSIBLE_POS (ECMA_OBJECT_GC_VISITED_POS + \
-                                        ECMA_OBJECT_GC_VISITED_WIDTH)
+#define ECMA_OBJECT_OBJ_EXTENSIBLE_POS (ECMA_OBJECT_TYPE_SPECIFIC_PART_POS)
 #define ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH (1)
 
 /**
@@ -480,11 +522,19 @@ typedef struct ecma_object_t
                                         ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH)
 #define ECMA_OBJECT_OBJ_IS_BUILTIN_WIDTH (1)
 
+/**
+ * Flag indicating whether the object's properties are (or were) enumerated with the for-in cache,
+ * so that changes of the object's set of properties should invalidate the cache
+ */
+#define ECMA_OBJECT_OBJ_IS_FOR_IN_CACHED_POS (ECMA_OBJECT_OBJ_IS_BUILTIN_POS + \
+                                              ECMA_OBJECT_OBJ_IS_BUILTIN_WIDTH)
+#define ECMA_OBJECT_OBJ_IS_FOR_IN_CACHED_WIDTH (1)
+
 /**
  * Size of structure for objects
  */
-#define ECMA_OBJECT_OBJ_TYPE_SIZE (ECMA_OBJECT_OBJ_IS_BUILTIN_POS + \
-                                   ECMA_OBJECT_OBJ_IS_BUILTIN_WIDTH)
+#define ECMA_OBJECT_OBJ_TYPE_SIZE (ECMA_OBJECT_OBJ_IS_FOR_IN_CACHED_POS + \
+                                   ECMA_OBJECT_OBJ_IS_FOR_IN_CACHED_WIDTH)
 
 
 /* Lexical environments' only part */
@@ -492,8 +542,7 @@ typedef struct ecma_object_t
 /**
  * Type of lexical environment (ecma_lexical_environment_type_t).
  */
-#define ECMA_OBJECT_LEX_ENV_TYPE_POS (ECMA_OBJECT_GC_VISITED_POS + \
-                                        ECMA_OBJECT_GC_VISITED_WIDTH)
+#define ECMA_OBJECT_LEX_ENV_TYPE_POS (ECMA_OBJECT_TYPE_SPECIFIC_PART_POS)
 #define ECMA_OBJECT_LEX_ENV_TYPE_WIDTH (1)
 
 /**
@@ -516,7 +565,7 @@ typedef struct ecma_object_t
 #define ECMA_OBJECT_LEX_ENV_TYPE_SIZE (ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS + \
                                        ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH)
 
-  uint64_t container; /**< container for fields described above */
+  uint64_t container[ECMA_OBJECT_CONTAINER_WORDS_NUMBER]; /**< container for fields described above */
 } ecma_object_t;
 
 
@@ -703,7 +752,7 @@ typedef struct
   mem_cpointer_t next_chunk_cp;
 
   /** Place for the collection's data */
-  uint8_t data[ sizeof (uint64_t) - sizeof (mem_cpointer_t) - sizeof (ecma_length_t) ];
+  uint8_t data[ MEM_POOL_CHUNK_SIZE - sizeof (mem_cpointer_t) - sizeof (ecma_length_t) ];
 } ecma_collection_header_t;
 
 /**
@@ -715,7 +764,7 @@ typedef struct
   mem_cpointer_t next_chunk_cp;
 
   /** Characters */
-  lit_utf8_byte_t data[ sizeof (uint64_t) - sizeof (mem_cpointer_t) ];
+  lit_utf8_byte_t data[ MEM_POOL_CHUNK_SIZE - sizeof (mem_cpointer_t) ];
 } ecma_collection_chunk_t;
 
 /**
@@ -726,12 +775,16 @@ typedef enum
   ECMA_STRING_CONTAINER_LIT_TABLE, /**< actual data is in literal table */
   ECMA_STRING_CONTAINER_HEAP_CHUNKS, /**< actual data is on the heap
                                           in a ecma_collection_chunk_t chain */
+  ECMA_STRING_CONTAINER_HEAP_BLOCK, /**< actual data is placed contiguously in a heap block,
+                                         right after ecma_string_heap_block_t header */
   ECMA_STRING_CONTAINER_HEAP_NUMBER, /**< actual data is on the heap as a ecma_number_t */
   ECMA_STRING_CONTAINER_UINT32_IN_DESC, /**< actual data is UInt32-represeneted Number
                                              stored locally in the string's descriptor */
   ECMA_STRING_CONTAINER_CONCATENATION, /**< the ecma-string is concatenation of two specified ecma-strings */
   ECMA_STRING_CONTAINER_MAGIC_STRING, /**< the ecma-string is equal to one of ECMA magic strings */
-  ECMA_STRING_CONTAINER_MAGIC_STRING_EX /**< the ecma-string is equal to one of external magic strings */
+  ECMA_STRING_CONTAINER_MAGIC_STRING_EX, /**< the ecma-string is equal to one of external magic strings */
+  ECMA_STRING_CONTAINER_EXTERNAL /**< actual data is in an immutable buffer, owned by the engine's embedder
+                                      and described by ecma_external_string_t */
 } ecma_string_container_t;
 
 FIXME (Move to library that should define the type (literal.h /* ? */))
@@ -774,6 +827,12 @@ typedef struct ecma_string_t
     /** Compressed pointer to an ecma_number_t */
     mem_cpointer_t number_cp : ECMA_POINTER_FIELD_WIDTH;
 
+    /** Compressed pointer to an ecma_string_heap_block_t */
+    mem_cpointer_t heap_block_cp : ECMA_POINTER_FIELD_WIDTH;
+
+    /** Compressed pointer to an ecma_external_string_t */
+    mem_cpointer_t external_string_cp : ECMA_POINTER_FIELD_WIDTH;
+
     /** UInt32-represented number placed locally in the descriptor */
     uint32_t uint32_number;
 
@@ -791,7 +850,11 @@ typedef struct ecma_string_t
     lit_magic_string_ex_id_t magic_string_ex_id;
 
     /** For zeroing and comparison in some cases */
+#ifndef CONFIG_MEM_CPOINTER_32BIT
     uint32_t common_field;
+#else /* !CONFIG_MEM_CPOINTER_32BIT */
+    uint64_t common_field;
+#endif /* CONFIG_MEM_CPOINTER_32BIT */
   } u;
 } ecma_string_t;
 
@@ -800,6 +863,39 @@ typedef struct ecma_string_t
  */
 typedef uintptr_t ecma_external_pointer_t;
 
+/**
+ * Header of heap block, containing string's characters (see also: ECMA_STRING_CONTAINER_HEAP_BLOCK)
+ *
+ * The characters are placed in the block right after the header. For non-ASCII strings (i.e. strings
+ * with size not equal to length) the characters are followed by code unit index - an array
+ * of ecma_string_code_unit_index_entry_t, describing each CONFIG_ECMA_STRING_CODE_UNIT_INDEX_STEP'th code unit.
+ */
+typedef struct
+{
+  lit_utf8_size_t size; /**< size of the characters, in bytes */
+  ecma_length_t length; /**< number of code units in the string */
+} ecma_string_heap_block_t;
+
+/**
+ * Entry of a string's code unit index
+ */
+typedef struct
+{
+  lit_utf8_size_t byte_offset; /**< offset of first byte of a character */
+  ecma_length_t code_unit_pos; /**< position of the character's first code unit */
+} ecma_string_code_unit_index_entry_t;
+
+/**
+ * Description of external string's buffer (see also: ECMA_STRING_CONTAINER_EXTERNAL)
+ */
+typedef struct
+{
+  const lit_utf8_byte_t *chars_p; /**< utf-8 characters */
+  lit_utf8_size_t size; /**< size of the buffer, in bytes */
+  ecma_length_t length; /**< number of code units in the string */
+  ecma_external_pointer_t free_cb; /**< callback, releasing the buffer (or 0, if the buffer should not be released) */
+} ecma_external_string_t;
+
 /**
  * @}
  */
@@ -24,12 +24,21 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 
+/**
+ * Number of existing internal properties that hold external pointers
+ *
+ * See also:
+ *          jerry_save_heap_snapshot
+ */
+static uint32_t ecma_external_pointer_properties_number = 0;
+
 /**
  * Create internal property with specified identifier and store external pointer in the property.
  *
  * Note:
  *      property identifier should be one of the following:
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_CODE;
+ *        - ECMA_INTERNAL_PROPERTY_NATIVE_NUMBER_CODE;
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE;
  *        - ECMA_INTERNAL_PROPERTY_FREE_CALLBACK.
  *
@@ -43,8 +52,10 @@ ecma_create_external_pointer_property (ecma_object_t *obj_p, /**< object to crea
                                        ecma_external_pointer_t ptr_value) /**< value to store in the property */
 {
   JERRY_ASSERT (id == ECMA_INTERNAL_PROPERTY_NATIVE_CODE
+                || id == ECMA_INTERNAL_PROPERTY_NATIVE_NUMBER_CODE
                 || id == ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE
-                || id == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK);
+                || id == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK
+                || id == ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_EXTERNAL_DATA);
 
   bool ret_val;
   ecma_property_t *prop_p = ecma_find_internal_property (obj_p, id);
@@ -52,6 +63,7 @@ ecma_create_external_pointer_property (ecma_object_t *obj_p, /**< object to crea
   if (prop_p == NULL)
   {
     prop_p = ecma_create_internal_property (obj_p, id);
+    ecma_external_pointer_properties_number++;
 
     ret_val = true;
   }
@@ -83,6 +95,7 @@ ecma_create_external_pointer_property (ecma_object_t *obj_p, /**< object to crea
  * Note:
  *      property identifier should be one of the following:
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_CODE;
+ *        - ECMA_INTERNAL_PROPERTY_NATIVE_NUMBER_CODE;
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE;
  *        - ECMA_INTERNAL_PROPERTY_FREE_CALLBACK.
  *
@@ -96,8 +109,10 @@ ecma_get_external_pointer_value (ecma_object_t *obj_p, /**< object to get proper
                                  ecma_external_pointer_t *out_pointer_p) /**< out: value of the external pointer */
 {
   JERRY_ASSERT (id == ECMA_INTERNAL_PROPERTY_NATIVE_CODE
+                || id == ECMA_INTERNAL_PROPERTY_NATIVE_NUMBER_CODE
                 || id == ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE
-                || id == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK);
+                || id == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK
+                || id == ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_EXTERNAL_DATA);
 
   ecma_property_t* prop_p = ecma_find_internal_property (obj_p, id);
 
@@ -130,6 +145,7 @@ ecma_get_external_pointer_value (ecma_object_t *obj_p, /**< object to get proper
  * Note:
  *      property identifier should be one of the following:
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_CODE;
+ *        - ECMA_INTERNAL_PROPERTY_NATIVE_NUMBER_CODE;
  *        - ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE;
  *        - ECMA_INTERNAL_PROPERTY_FREE_CALLBACK.
  */
@@ -137,8 +153,13 @@ void
 ecma_free_external_pointer_in_property (ecma_property_t *prop_p) /**< internal property */
 {
   JERRY_ASSERT (prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_NATIVE_CODE
+                || prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_NATIVE_NUMBER_CODE
                 || prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE
-                || prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK);
+                || prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_FREE_CALLBACK
+                || prop_p->u.internal_property.type == ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_EXTERNAL_DATA);
+
+  JERRY_ASSERT (ecma_external_pointer_properties_number > 0);
+  ecma_external_pointer_properties_number--;
 
   if (sizeof (ecma_external_pointer_t) == sizeof (uint32_t))
   {
@@ -153,6 +174,17 @@ ecma_free_external_pointer_in_property (ecma_property_t *prop_p) /**< internal p
   }
 } /* ecma_free_external_pointer_in_property */
 
+/**
+ * Get number of existing internal properties that hold external pointers
+ *
+ * @return number of the properties
+ */
+uint32_t
+ecma_get_external_pointer_properties_number (void)
+{
+  return ecma_external_pointer_properties_number;
+} /* ecma_get_external_pointer_properties_number */
+
 /**
  * @}
  * @}
@@ -31,6 +31,9 @@
 #include "serializer.h"
 #include "vm.h"
 
+#define JERRY_INTERNAL
+#include "jerry-internal.h"
+
 /**
  * Maximum length of strings' concatenation
  */
@@ -42,6 +45,21 @@
 JERRY_STATIC_ASSERT ((uint32_t) ((int32_t) ECMA_STRING_MAX_CONCATENATION_LENGTH) ==
                      ECMA_STRING_MAX_CONCATENATION_LENGTH);
 
+/**
+ * Minimum size of characters of a string, stored in a heap block
+ */
+#define ECMA_STRING_HEAP_BLOCK_MIN_SIZE (CONFIG_ECMA_STRING_HEAP_BLOCK_MIN_SIZE)
+
+/**
+ * Distance, in code units, between entries of code unit index of strings, stored in heap blocks
+ */
+#define ECMA_STRING_CODE_UNIT_INDEX_STEP (CONFIG_ECMA_STRING_CODE_UNIT_INDEX_STEP)
+
+/**
+ * Number of currently existing external strings (ECMA_STRING_CONTAINER_EXTERNAL)
+ */
+static uint32_t ecma_external_strings_number = 0;
+
 static void
 ecma_init_ecma_string_from_lit_cp (ecma_string_t *string_p,
                                    lit_cpointer_t lit_index,
@@ -314,6 +332,229 @@ ecma_free_chars_collection (ecma_collection_header_t* collection_p) /**< collect
   ecma_dealloc_collection_header (collection_p);
 } /* ecma_free_chars_collection */
 
+/**
+ * Get characters, placed in a string's heap block
+ *
+ * @return pointer to the characters (not zero-terminated)
+ */
+static lit_utf8_byte_t*
+ecma_get_string_heap_block_chars (const ecma_string_heap_block_t *block_p) /**< block's header */
+{
+  return (lit_utf8_byte_t *) (block_p + 1);
+} /* ecma_get_string_heap_block_chars */
+
+/**
+ * Get number of entries in code unit index of a string, stored in a heap block
+ *
+ * @return number of entries (zero - for ASCII strings, as their characters can be accessed directly)
+ */
+static ecma_length_t
+ecma_get_string_heap_block_index_entries_number (lit_utf8_size_t chars_size, /**< size of the characters */
+                                                 ecma_length_t length) /**< number of code units */
+{
+  if (chars_size == length)
+  {
+    return 0;
+  }
+
+  JERRY_ASSERT (length > 0);
+
+  return (length - 1u) / ECMA_STRING_CODE_UNIT_INDEX_STEP;
+} /* ecma_get_string_heap_block_index_entries_number */
+
+/**
+ * Get offset of code unit index in a string's heap block
+ *
+ * @return offset from start of the block's header
+ */
+static size_t
+ecma_get_string_heap_block_index_offset (lit_utf8_size_t chars_size) /**< size of the characters */
+{
+  return JERRY_ALIGNUP (sizeof (ecma_string_heap_block_t) + chars_size, sizeof (ecma_string_code_unit_index_entry_t));
+} /* ecma_get_string_heap_block_index_offset */
+
+/**
+ * Get size of a string's heap block
+ *
+ * @return size of the block, in bytes
+ */
+static size_t
+ecma_get_string_heap_block_size (lit_utf8_size_t chars_size, /**< size of the characters */
+                                 ecma_length_t length) /**< number of code units */
+{
+  ecma_length_t index_entries_number = ecma_get_string_heap_block_index_entries_number (chars_size, length);
+
+  if (index_entries_number == 0)
+  {
+    return sizeof (ecma_string_heap_block_t) + chars_size;
+  }
+
+  return (ecma_get_string_heap_block_index_offset (chars_size)
+          + index_entries_number * sizeof (ecma_string_code_unit_index_entry_t));
+} /* ecma_get_string_heap_block_size */
+
+/**
+ * Get code unit index of a string, stored in a heap block
+ *
+ * Note:
+ *      entry i of the index describes the character, containing code unit
+ *      at position (i + 1) * ECMA_STRING_CODE_UNIT_INDEX_STEP
+ *
+ * @return pointer to the index' first entry
+ */
+static ecma_string_code_unit_index_entry_t*
+ecma_get_string_heap_block_index (const ecma_string_heap_block_t *block_p) /**< block's header */
+{
+  JERRY_ASSERT (ecma_get_string_heap_block_index_entries_number (block_p->size, block_p->length) != 0);
+
+  return (ecma_string_code_unit_index_entry_t *) ((uint8_t *) block_p
+                                                  + ecma_get_string_heap_block_index_offset (block_p->size));
+} /* ecma_get_string_heap_block_index */
+
+/**
+ * Allocate a heap block for characters of a string
+ *
+ * Note:
+ *      the characters should be put to the block, and then the block's index should be built
+ *      with ecma_init_string_heap_block_index
+ *
+ * @return pointer to the block's header
+ */
+static ecma_string_heap_block_t*
+ecma_alloc_string_heap_block (lit_utf8_size_t chars_size, /**< size of the characters */
+                              ecma_length_t length) /**< number of code units */
+{
+  JERRY_ASSERT (chars_size > 0);
+
+  ecma_string_heap_block_t *block_p;
+  block_p = (ecma_string_heap_block_t *) mem_heap_alloc_block (ecma_get_string_heap_block_size (chars_size, length),
+                                                               MEM_HEAP_ALLOC_LONG_TERM);
+
+  block_p->size = chars_size;
+  block_p->length = length;
+
+  return block_p;
+} /* ecma_alloc_string_heap_block */
+
+/**
+ * Build code unit index of the characters, placed in a string's heap block
+ */
+static void
+ecma_init_string_heap_block_index (ecma_string_heap_block_t *block_p) /**< block's header */
+{
+  const lit_utf8_size_t chars_size = block_p->size;
+  const ecma_length_t index_entries_number = ecma_get_string_heap_block_index_entries_number (chars_size,
+                                                                                              block_p->length);
+
+  if (index_entries_number == 0)
+  {
+    return;
+  }
+
+  const lit_utf8_byte_t *chars_p = ecma_get_string_heap_block_chars (block_p);
+  ecma_string_code_unit_index_entry_t *index_p = ecma_get_string_heap_block_index (block_p);
+
+  lit_utf8_size_t byte_offset = 0;
+  ecma_length_t code_unit_pos = 0;
+  ecma_length_t next_indexed_pos = ECMA_STRING_CODE_UNIT_INDEX_STEP;
+
+  for (ecma_length_t entry_index = 0; entry_index < index_entries_number;)
+  {
+    JERRY_ASSERT (byte_offset < chars_size);
+
+    const lit_utf8_size_t char_size = lit_get_unicode_char_size_by_utf8_first_byte (chars_p[byte_offset]);
+    const ecma_length_t char_code_units = (char_size == 4) ? 2 : 1;
+
+    if (code_unit_pos + char_code_units > next_indexed_pos)
+    {
+      /* the character contains the indexed code unit */
+      index_p[entry_index].byte_offset = byte_offset;
+      index_p[entry_index].code_unit_pos = code_unit_pos;
+
+      entry_index++;
+      next_indexed_pos += ECMA_STRING_CODE_UNIT_INDEX_STEP;
+    }
+
+    byte_offset += char_size;
+    code_unit_pos += char_code_units;
+  }
+} /* ecma_init_string_heap_block_index */
+
+/**
+ * Allocate a heap block and put the characters to the block
+ *
+ * @return pointer to the block's header
+ */
+static ecma_string_heap_block_t*
+ecma_new_string_heap_block (const lit_utf8_byte_t chars_buffer[], /**< utf-8 chars */
+                            lit_utf8_size_t chars_size) /**< size of buffer with chars */
+{
+  JERRY_ASSERT (chars_buffer != NULL);
+
+  ecma_string_heap_block_t *block_p;
+  block_p = ecma_alloc_string_heap_block (chars_size, lit_utf8_string_length (chars_buffer, chars_size));
+
+  memcpy (ecma_get_string_heap_block_chars (block_p), chars_buffer, chars_size);
+
+  ecma_init_string_heap_block_index (block_p);
+
+  return block_p;
+} /* ecma_new_string_heap_block */
+
+/**
+ * Copy a string's heap block
+ *
+ * @return pointer to the new block's header
+ */
+static ecma_string_heap_block_t*
+ecma_copy_string_heap_block (const ecma_string_heap_block_t *block_p) /**< block's header */
+{
+  const size_t block_size = ecma_get_string_heap_block_size (block_p->size, block_p->length);
+
+  ecma_string_heap_block_t *new_block_p;
+  new_block_p = (ecma_string_heap_block_t *) mem_heap_alloc_block (block_size, MEM_HEAP_ALLOC_LONG_TERM);
+
+  memcpy (new_block_p, block_p, block_size);
+
+  return new_block_p;
+} /* ecma_copy_string_heap_block */
+
+/**
+ * Get code unit at the specified position of a string, stored in a heap block
+ *
+ * @return code unit value
+ */
+static ecma_char_t
+ecma_get_string_heap_block_code_unit_at (const ecma_string_heap_block_t *block_p, /**< block's header */
+                                         ecma_length_t pos) /**< position of the code unit */
+{
+  JERRY_ASSERT (pos < block_p->length);
+
+  const lit_utf8_byte_t *chars_p = ecma_get_string_heap_block_chars (block_p);
+
+  if (block_p->size == block_p->length)
+  {
+    /* ASCII string */
+    return chars_p[pos];
+  }
+
+  lit_utf8_size_t byte_offset = 0;
+  ecma_length_t code_unit_pos = 0;
+
+  if (pos >= ECMA_STRING_CODE_UNIT_INDEX_STEP)
+  {
+    const ecma_string_code_unit_index_entry_t *entry_p;
+    entry_p = ecma_get_string_heap_block_index (block_p) + (pos / ECMA_STRING_CODE_UNIT_INDEX_STEP - 1u);
+
+    byte_offset = entry_p->byte_offset;
+    code_unit_pos = entry_p->code_unit_pos;
+  }
+
+  JERRY_ASSERT (code_unit_pos <= pos);
+
+  return lit_utf8_string_code_unit_at (chars_p + byte_offset, block_p->size - byte_offset, pos - code_unit_pos);
+} /* ecma_get_string_heap_block_code_unit_at */
+
 /**
  * Initialize ecma-string descriptor with string described by index in literal table
  */
@@ -432,16 +673,108 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
   ecma_string_t* string_desc_p = ecma_alloc_string ();
   string_desc_p->refs = 1;
   string_desc_p->is_stack_var = false;
-  string_desc_p->container = ECMA_STRING_CONTAINER_HEAP_CHUNKS;
   string_desc_p->hash = lit_utf8_string_calc_hash_last_bytes (string_p, string_size);
 
   string_desc_p->u.common_field = 0;
-  ecma_collection_header_t *collection_p = ecma_new_chars_collection (string_p, string_size);
-  ECMA_SET_NON_NULL_POINTER (string_desc_p->u.collection_cp, collection_p);
+
+  if (string_size >= ECMA_STRING_HEAP_BLOCK_MIN_SIZE)
+  {
+    string_desc_p->container = ECMA_STRING_CONTAINER_HEAP_BLOCK;
+
+    ecma_string_heap_block_t *block_p = ecma_new_string_heap_block (string_p, string_size);
+    ECMA_SET_NON_NULL_POINTER (string_desc_p->u.heap_block_cp, block_p);
+  }
+  else
+  {
+    string_desc_p->container = ECMA_STRING_CONTAINER_HEAP_CHUNKS;
+
+    ecma_collection_header_t *collection_p = ecma_new_chars_collection (string_p, string_size);
+    ECMA_SET_NON_NULL_POINTER (string_desc_p->u.collection_cp, collection_p);
+  }
 
   return string_desc_p;
 } /* ecma_new_ecma_string_from_utf8 */
 
+/**
+ * Allocate new ecma-string, referencing characters in an immutable buffer owned by the engine's embedder
+ *
+ * Note:
+ *      the buffer should remain valid and unchanged until the free callback is invoked;
+ *      the callback can be invoked immediately, if the engine doesn't need the buffer
+ *      (i.e. if the string is equal to a magic string).
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_new_ecma_string_from_external_utf8 (const lit_utf8_byte_t *chars_p, /**< utf-8 string */
+                                         lit_utf8_size_t size, /**< string size */
+                                         ecma_external_pointer_t free_cb) /**< callback, releasing the buffer,
+                                                                           *   or 0 - if the buffer outlives
+                                                                           *          the string */
+{
+  JERRY_ASSERT (chars_p != NULL || size == 0);
+  JERRY_ASSERT (lit_is_utf8_string_valid (chars_p, size));
+
+  ecma_string_t *string_desc_p;
+
+  lit_magic_string_id_t magic_string_id;
+  lit_magic_string_ex_id_t magic_string_ex_id;
+
+  if (lit_is_utf8_string_magic (chars_p, size, &magic_string_id))
+  {
+    string_desc_p = ecma_get_magic_string (magic_string_id);
+  }
+  else if (lit_is_ex_utf8_string_magic (chars_p, size, &magic_string_ex_id))
+  {
+    string_desc_p = ecma_get_magic_string_ex (magic_string_ex_id);
+  }
+  else
+  {
+    JERRY_ASSERT (size > 0);
+
+    ecma_external_string_t *external_string_p;
+    external_string_p = (ecma_external_string_t *) mem_heap_alloc_block (sizeof (ecma_external_string_t),
+                                                                         MEM_HEAP_ALLOC_LONG_TERM);
+
+    external_string_p->chars_p = chars_p;
+    external_string_p->size = size;
+    external_string_p->length = lit_utf8_string_length (chars_p, size);
+    external_string_p->free_cb = free_cb;
+
+    string_desc_p = ecma_alloc_string ();
+    string_desc_p->refs = 1;
+    string_desc_p->is_stack_var = false;
+    string_desc_p->container = ECMA_STRING_CONTAINER_EXTERNAL;
+    string_desc_p->hash = lit_utf8_string_calc_hash_last_bytes (chars_p, size);
+
+    string_desc_p->u.common_field = 0;
+    ECMA_SET_NON_NULL_POINTER (string_desc_p->u.external_string_cp, external_string_p);
+
+    ecma_external_strings_number++;
+
+    return string_desc_p;
+  }
+
+  /* the buffer is not referenced by the magic string */
+  if (free_cb != 0)
+  {
+    jerry_dispatch_external_string_free_callback (free_cb, chars_p, size);
+  }
+
+  return string_desc_p;
+} /* ecma_new_ecma_string_from_external_utf8 */
+
+/**
+ * Get number of currently existing external strings
+ *
+ * @return number of strings, referencing buffers owned by the engine's embedder
+ */
+uint32_t
+ecma_get_external_strings_number (void)
+{
+  return ecma_external_strings_number;
+} /* ecma_get_external_strings_number */
+
 /**
  * Allocate new ecma-string and fill it with utf-8 character which represents specified code unit
  *
@@ -651,10 +984,40 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
   ecma_string_t* string_desc_p = ecma_alloc_string ();
   string_desc_p->refs = 1;
   string_desc_p->is_stack_var = false;
-  string_desc_p->container = ECMA_STRING_CONTAINER_CONCATENATION;
 
   string_desc_p->u.common_field = 0;
 
+  if (length >= ECMA_STRING_HEAP_BLOCK_MIN_SIZE)
+  {
+    /*
+     * Long concatenations are flattened, so that their characters are contiguous
+     * and code units can be accessed by position through the block's index.
+     */
+    const lit_utf8_size_t size = (lit_utf8_size_t) length;
+
+    ecma_string_heap_block_t *block_p;
+    block_p = ecma_alloc_string_heap_block (size,
+                                            ecma_string_get_length (string1_p) + ecma_string_get_length (string2_p));
+
+    lit_utf8_byte_t *chars_p = ecma_get_string_heap_block_chars (block_p);
+
+    ssize_t bytes_copied = ecma_string_to_utf8_string (string1_p, chars_p, (ssize_t) str1_size);
+    JERRY_ASSERT (bytes_copied == (ssize_t) str1_size);
+
+    bytes_copied = ecma_string_to_utf8_string (string2_p, chars_p + str1_size, (ssize_t) str2_size);
+    JERRY_ASSERT (bytes_copied == (ssize_t) str2_size);
+
+    ecma_init_string_heap_block_index (block_p);
+
+    string_desc_p->container = ECMA_STRING_CONTAINER_HEAP_BLOCK;
+    string_desc_p->hash = lit_utf8_string_calc_hash_last_bytes (chars_p, size);
+    ECMA_SET_NON_NULL_POINTER (string_desc_p->u.heap_block_cp, block_p);
+
+    return string_desc_p;
+  }
+
+  string_desc_p->container = ECMA_STRING_CONTAINER_CONCATENATION;
+
   string1_p = ecma_copy_or_ref_ecma_string (string1_p);
   string2_p = ecma_copy_or_ref_ecma_string (string2_p);
 
@@ -731,6 +1094,17 @@ ecma_copy_ecma_string (ecma_string_t *string_desc_p) /**< string descriptor */
       break;
     }
 
+    case ECMA_STRING_CONTAINER_EXTERNAL:
+    {
+      /* the external buffer is released exactly once, so the copy holds its own characters */
+      const ecma_external_string_t *external_string_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                                   string_desc_p->u.external_string_cp);
+
+      new_str_p = ecma_new_ecma_string_from_utf8 (external_string_p->chars_p, external_string_p->size);
+
+      break;
+    }
+
     case ECMA_STRING_CONTAINER_HEAP_CHUNKS:
     {
       new_str_p = ecma_alloc_string ();
@@ -746,6 +1120,20 @@ ecma_copy_ecma_string (ecma_string_t *string_desc_p) /**< string descriptor */
       break;
     }
 
+    case ECMA_STRING_CONTAINER_HEAP_BLOCK:
+    {
+      new_str_p = ecma_alloc_string ();
+      *new_str_p = *string_desc_p;
+
+      const ecma_string_heap_block_t *block_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_block_t,
+                                                                           string_desc_p->u.heap_block_cp);
+      ecma_string_heap_block_t *new_block_p = ecma_copy_string_heap_block (block_p);
+
+      ECMA_SET_NON_NULL_POINTER (new_str_p->u.heap_block_cp, new_block_p);
+
+      break;
+    }
+
     default:
     {
       JERRY_UNREACHABLE ();
@@ -837,6 +1225,15 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
 
       break;
     }
+    case ECMA_STRING_CONTAINER_HEAP_BLOCK:
+    {
+      ecma_string_heap_block_t *block_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_block_t,
+                                                                     string_p->u.heap_block_cp);
+
+      mem_heap_free_block (block_p);
+
+      break;
+    }
     case ECMA_STRING_CONTAINER_HEAP_NUMBER:
     {
       ecma_number_t *num_p = ECMA_GET_NON_NULL_POINTER (ecma_number_t,
@@ -846,6 +1243,25 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
 
       break;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL:
+    {
+      ecma_external_string_t *external_string_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                             string_p->u.external_string_cp);
+
+      if (external_string_p->free_cb != 0)
+      {
+        jerry_dispatch_external_string_free_callback (external_string_p->free_cb,
+                                                      external_string_p->chars_p,
+                                                      external_string_p->size);
+      }
+
+      mem_heap_free_block (external_string_p);
+
+      JERRY_ASSERT (ecma_external_strings_number > 0);
+      ecma_external_strings_number--;
+
+      break;
+    }
     case ECMA_STRING_CONTAINER_CONCATENATION:
     {
       ecma_string_t *string1_p, *string2_p;
@@ -930,6 +1346,8 @@ ecma_string_to_number (const ecma_string_t *str_p) /**< ecma-string */
 
     case ECMA_STRING_CONTAINER_LIT_TABLE:
     case ECMA_STRING_CONTAINER_HEAP_CHUNKS:
+    case ECMA_STRING_CONTAINER_HEAP_BLOCK:
+    case ECMA_STRING_CONTAINER_EXTERNAL:
     case ECMA_STRING_CONTAINER_CONCATENATION:
     case ECMA_STRING_CONTAINER_MAGIC_STRING:
     case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
@@ -998,6 +1416,28 @@ ecma_string_to_utf8_string (const ecma_string_t *string_desc_p, /**< ecma-string
 
       break;
     }
+    case ECMA_STRING_CONTAINER_HEAP_BLOCK:
+    {
+      const ecma_string_heap_block_t *block_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_block_t,
+                                                                           string_desc_p->u.heap_block_cp);
+
+      JERRY_ASSERT (required_buffer_size == (ssize_t) block_p->size);
+
+      memcpy (buffer_p, ecma_get_string_heap_block_chars (block_p), block_p->size);
+
+      break;
+    }
+    case ECMA_STRING_CONTAINER_EXTERNAL:
+    {
+      const ecma_external_string_t *external_string_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                                   string_desc_p->u.external_string_cp);
+
+      JERRY_ASSERT (required_buffer_size == (ssize_t) external_string_p->size);
+
+      memcpy (buffer_p, external_string_p->chars_p, external_string_p->size);
+
+      break;
+    }
     case ECMA_STRING_CONTAINER_LIT_TABLE:
     {
       literal_t lit = lit_get_literal_by_cp (string_desc_p->u.lit_cp);
@@ -1076,6 +1516,96 @@ ecma_string_to_utf8_string (const ecma_string_t *string_desc_p, /**< ecma-string
   return required_buffer_size;
 } /* ecma_string_to_utf8_string */
 
+/**
+ * Get pointer to the ecma-string's utf-8 characters, if the characters are already stored contiguously
+ *
+ * Note:
+ *      the pointer remains valid while the string descriptor is alive
+ *
+ * @return pointer to the characters (not zero-terminated) - if the string's characters are contiguous
+ *                                                           (size of the string is returned through out_size_p),
+ *         NULL - otherwise (ecma_string_to_utf8_string should be used to retrieve the characters).
+ */
+const lit_utf8_byte_t *
+ecma_string_get_contiguous_chars (const ecma_string_t *string_p, /**< ecma-string descriptor */
+                                  lit_utf8_size_t *out_size_p) /**< out: size of the string, in bytes */
+{
+  JERRY_ASSERT (string_p != NULL);
+  JERRY_ASSERT (string_p->refs > 0);
+
+  const lit_utf8_byte_t *chars_p = NULL;
+
+  switch ((ecma_string_container_t) string_p->container)
+  {
+    case ECMA_STRING_CONTAINER_LIT_TABLE:
+    {
+      literal_t lit = lit_get_literal_by_cp (string_p->u.lit_cp);
+
+      chars_p = lit_charset_record_get_contiguous_charset (lit);
+      *out_size_p = lit_charset_record_get_size (lit);
+
+      break;
+    }
+    case ECMA_STRING_CONTAINER_HEAP_CHUNKS:
+    {
+      const ecma_collection_header_t *chars_collection_p = ECMA_GET_NON_NULL_POINTER (ecma_collection_header_t,
+                                                                                      string_p->u.collection_cp);
+
+      if (chars_collection_p->unit_number <= sizeof (chars_collection_p->data))
+      {
+        /* all characters are placed in the collection's header */
+        chars_p = chars_collection_p->data;
+        *out_size_p = chars_collection_p->unit_number;
+      }
+
+      break;
+    }
+    case ECMA_STRING_CONTAINER_HEAP_BLOCK:
+    {
+      const ecma_string_heap_block_t *block_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_block_t,
+                                                                           string_p->u.heap_block_cp);
+
+      chars_p = ecma_get_string_heap_block_chars (block_p);
+      *out_size_p = block_p->size;
+
+      break;
+    }
+    case ECMA_STRING_CONTAINER_EXTERNAL:
+    {
+      const ecma_external_string_t *external_string_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                                   string_p->u.external_string_cp);
+
+      chars_p = external_string_p->chars_p;
+      *out_size_p = external_string_p->size;
+
+      break;
+    }
+    case ECMA_STRING_CONTAINER_MAGIC_STRING:
+    {
+      chars_p = lit_get_magic_string_utf8 (string_p->u.magic_string_id);
+      *out_size_p = lit_get_magic_string_size (string_p->u.magic_string_id);
+
+      break;
+    }
+    case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
+    {
+      chars_p = lit_get_magic_string_ex_utf8 (string_p->u.magic_string_ex_id);
+      *out_size_p = lit_get_magic_string_ex_size (string_p->u.magic_string_ex_id);
+
+      break;
+    }
+    case ECMA_STRING_CONTAINER_HEAP_NUMBER:
+    case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
+    case ECMA_STRING_CONTAINER_CONCATENATION:
+    {
+      /* characters are not materialized */
+      break;
+    }
+  }
+
+  return chars_p;
+} /* ecma_string_get_contiguous_chars */
+
 /**
  * Long path part of ecma-string to ecma-string comparison routine
  *
@@ -1159,6 +1689,26 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /* ecma-stri
 
         return ecma_compare_chars_collection (chars_collection1_p, chars_collection2_p);
       }
+      case ECMA_STRING_CONTAINER_HEAP_BLOCK:
+      {
+        const ecma_string_heap_block_t *block1_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_block_t,
+                                                                              string1_p->u.heap_block_cp);
+        const ecma_string_heap_block_t *block2_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_block_t,
+                                                                              string2_p->u.heap_block_cp);
+
+        return (memcmp (ecma_get_string_heap_block_chars (block1_p),
+                        ecma_get_string_heap_block_chars (block2_p),
+                        strings_size) == 0);
+      }
+      case ECMA_STRING_CONTAINER_EXTERNAL:
+      {
+        const ecma_external_string_t *external_string1_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                                      string1_p->u.external_string_cp);
+        const ecma_external_string_t *external_string2_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                                      string2_p->u.external_string_cp);
+
+        return (memcmp (external_string1_p->chars_p, external_string2_p->chars_p, strings_size) == 0);
+      }
       case ECMA_STRING_CONTAINER_CONCATENATION:
       {
         /* long path */
@@ -1292,46 +1842,57 @@ ecma_compare_ecma_strings_relational (const ecma_string_t *string1_p, /**< ecma-
   lit_utf8_byte_t utf8_string2_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
   lit_utf8_size_t utf8_string2_size;
 
-  ssize_t req_size = ecma_string_to_utf8_string (string1_p, utf8_string1_buffer, sizeof (utf8_string1_buffer));
+  /* contiguous characters are compared in place, and other strings are copied to temporary buffers */
+  utf8_string1_p = ecma_string_get_contiguous_chars (string1_p, &utf8_string1_size);
 
-  if (req_size < 0)
+  if (utf8_string1_p == NULL)
   {
-    lit_utf8_byte_t *heap_buffer_p = (lit_utf8_byte_t *) mem_heap_alloc_block ((size_t) -req_size,
-                                                                               MEM_HEAP_ALLOC_SHORT_TERM);
+    ssize_t req_size = ecma_string_to_utf8_string (string1_p, utf8_string1_buffer, sizeof (utf8_string1_buffer));
 
-    ssize_t bytes_copied = ecma_string_to_utf8_string (string1_p, heap_buffer_p, -req_size);
-    utf8_string1_size = (lit_utf8_size_t) bytes_copied;
+    if (req_size < 0)
+    {
+      lit_utf8_byte_t *heap_buffer_p = (lit_utf8_byte_t *) mem_heap_alloc_block ((size_t) -req_size,
+                                                                                 MEM_HEAP_ALLOC_SHORT_TERM);
 
-    JERRY_ASSERT (bytes_copied > 0);
+      ssize_t bytes_copied = ecma_string_to_utf8_string (string1_p, heap_buffer_p, -req_size);
+      utf8_string1_size = (lit_utf8_size_t) bytes_copied;
 
-    utf8_string1_p = heap_buffer_p;
-    is_utf8_string1_on_heap = true;
-  }
-  else
-  {
-    utf8_string1_p = utf8_string1_buffer;
-    utf8_string1_size = (lit_utf8_size_t) req_size;
+      JERRY_ASSERT (bytes_copied > 0);
+
+      utf8_string1_p = heap_buffer_p;
+      is_utf8_string1_on_heap = true;
+    }
+    else
+    {
+      utf8_string1_p = utf8_string1_buffer;
+      utf8_string1_size = (lit_utf8_size_t) req_size;
+    }
   }
 
-  req_size = ecma_string_to_utf8_string (string2_p, utf8_string2_buffer, sizeof (utf8_string2_buffer));
+  utf8_string2_p = ecma_string_get_contiguous_chars (string2_p, &utf8_string2_size);
 
-  if (req_size < 0)
+  if (utf8_string2_p == NULL)
   {
-    lit_utf8_byte_t *heap_buffer_p = (lit_utf8_byte_t *) mem_heap_alloc_block ((size_t) -req_size,
-                                                                               MEM_HEAP_ALLOC_SHORT_TERM);
+    ssize_t req_size = ecma_string_to_utf8_string (string2_p, utf8_string2_buffer, sizeof (utf8_string2_buffer));
 
-    ssize_t bytes_copied = ecma_string_to_utf8_string (string2_p, heap_buffer_p, -req_size);
-    utf8_string2_size = (lit_utf8_size_t) bytes_copied;
+    if (req_size < 0)
+    {
+      lit_utf8_byte_t *heap_buffer_p = (lit_utf8_byte_t *) mem_heap_alloc_block ((size_t) -req_size,
+                                                                                 MEM_HEAP_ALLOC_SHORT_TERM);
 
-    JERRY_ASSERT (bytes_copied > 0);
+      ssize_t bytes_copied = ecma_string_to_utf8_string (string2_p, heap_buffer_p, -req_size);
+      utf8_string2_size = (lit_utf8_size_t) bytes_copied;
 
-    utf8_string2_p = heap_buffer_p;
-    is_utf8_string2_on_heap = true;
-  }
-  else
-  {
-    utf8_string2_p = utf8_string2_buffer;
-    utf8_string2_size = (lit_utf8_size_t) req_size;
+      JERRY_ASSERT (bytes_copied > 0);
+
+      utf8_string2_p = heap_buffer_p;
+      is_utf8_string2_on_heap = true;
+    }
+    else
+    {
+      utf8_string2_p = utf8_string2_buffer;
+      utf8_string2_size = (lit_utf8_size_t) req_size;
+    }
   }
 
   bool is_first_less_than_second = lit_compare_utf8_strings_relational (utf8_string1_p,
@@ -1425,6 +1986,20 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
 
     return ecma_get_chars_collection_length (collection_header_p);
   }
+  else if (container == ECMA_STRING_CONTAINER_HEAP_BLOCK)
+  {
+    const ecma_string_heap_block_t *block_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_block_t,
+                                                                         string_p->u.heap_block_cp);
+
+    return block_p->length;
+  }
+  else if (container == ECMA_STRING_CONTAINER_EXTERNAL)
+  {
+    const ecma_external_string_t *external_string_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                                 string_p->u.external_string_cp);
+
+    return external_string_p->length;
+  }
   else
   {
     JERRY_ASSERT (container == ECMA_STRING_CONTAINER_CONCATENATION);
@@ -1511,6 +2086,20 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
 
     return collection_header_p->unit_number;
   }
+  else if (container == ECMA_STRING_CONTAINER_HEAP_BLOCK)
+  {
+    const ecma_string_heap_block_t *block_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_block_t,
+                                                                         string_p->u.heap_block_cp);
+
+    return block_p->size;
+  }
+  else if (container == ECMA_STRING_CONTAINER_EXTERNAL)
+  {
+    const ecma_external_string_t *external_string_p = ECMA_GET_NON_NULL_POINTER (ecma_external_string_t,
+                                                                                 string_p->u.external_string_cp);
+
+    return external_string_p->size;
+  }
   else
   {
     JERRY_ASSERT (container == ECMA_STRING_CONTAINER_CONCATENATION);
@@ -1536,6 +2125,28 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
   ecma_length_t string_length = ecma_string_get_length (string_p);
   JERRY_ASSERT (index < string_length);
 
+  if (string_p->container == ECMA_STRING_CONTAINER_HEAP_BLOCK)
+  {
+    const ecma_string_heap_block_t *block_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_block_t,
+                                                                         string_p->u.heap_block_cp);
+
+    return ecma_get_string_heap_block_code_unit_at (block_p, index);
+  }
+
+  lit_utf8_size_t contiguous_size;
+  const lit_utf8_byte_t *contiguous_chars_p = ecma_string_get_contiguous_chars (string_p, &contiguous_size);
+
+  if (contiguous_chars_p != NULL)
+  {
+    if (contiguous_size == string_length)
+    {
+      /* ASCII string */
+      return contiguous_chars_p[index];
+    }
+
+    return lit_utf8_string_code_unit_at (contiguous_chars_p, contiguous_size, index);
+  }
+
   lit_utf8_size_t buffer_size = ecma_string_get_size (string_p);
 
   ecma_char_t ch;
@@ -1563,6 +2174,14 @@ ecma_string_get_byte_at_pos (const ecma_string_t *string_p, /**< ecma-string */
   lit_utf8_size_t buffer_size = ecma_string_get_size (string_p);
   JERRY_ASSERT (index < (lit_utf8_size_t) buffer_size);
 
+  lit_utf8_size_t contiguous_size;
+  const lit_utf8_byte_t *contiguous_chars_p = ecma_string_get_contiguous_chars (string_p, &contiguous_size);
+
+  if (contiguous_chars_p != NULL)
+  {
+    return contiguous_chars_p[index];
+  }
+
   lit_utf8_byte_t byte;
 
   MEM_DEFINE_LOCAL_ARRAY (utf8_str_p, buffer_size, lit_utf8_byte_t);
@@ -1764,10 +2383,17 @@ ecma_string_substr (const ecma_string_t *string_p, /**< pointer to an ecma strin
      */
     MEM_DEFINE_LOCAL_ARRAY (utf8_substr_buffer, utf8_str_size, lit_utf8_byte_t);
 
+    lit_utf8_iterator_t iter = lit_utf8_iterator_create (utf8_str_p, buffer_size);
+
+    for (ecma_length_t idx = 0; idx < start_pos; idx++)
+    {
+      lit_utf8_iterator_read_code_unit_and_increment (&iter);
+    }
+
     lit_utf8_size_t utf8_substr_buffer_offset = 0;
     for (ecma_length_t idx = 0; idx < span; idx++)
     {
-      ecma_char_t code_unit = lit_utf8_string_code_unit_at (utf8_str_p, buffer_size, start_pos + idx);
+      ecma_char_t code_unit = lit_utf8_iterator_read_code_unit_and_increment (&iter);
 
       JERRY_ASSERT (utf8_str_size >= utf8_substr_buffer_offset + LIT_UTF8_MAX_BYTES_IN_CODE_UNIT);
       utf8_substr_buffer_offset += lit_code_unit_to_utf8 (code_unit, utf8_substr_buffer + utf8_substr_buffer_offset);
@@ -29,6 +29,7 @@
 
 JERRY_STATIC_ASSERT (sizeof (ecma_value_t) * JERRY_BITSINBYTE >= ECMA_VALUE_SIZE);
 JERRY_STATIC_ASSERT (sizeof (ecma_completion_value_t) * JERRY_BITSINBYTE >= ECMA_COMPLETION_VALUE_SIZE);
+JERRY_STATIC_ASSERT (MAX_OPCODES < (1ull << ECMA_COMPLETION_VALUE_TARGET_WIDTH));
 
 /**
  * Get type field of ecma-value
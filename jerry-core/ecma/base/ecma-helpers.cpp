@@ -21,12 +21,59 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-for-in-cache.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
 #include "jrt-bit-fields.h"
 
+/**
+ * Get value of a bit-field of the object's container
+ *
+ * Note:
+ *      the bit-field should be placed in a single word of the container
+ *
+ * @return bit-field's value
+ */
+uint64_t __attr_pure___
+ecma_get_object_field (const ecma_object_t *object_p, /**< object or lexical environment */
+                       uint32_t pos, /**< bit-field's position in the container */
+                       uint32_t width) /**< bit-field's width */
+{
+  const uint32_t word_index = pos / ECMA_OBJECT_CONTAINER_WORD_WIDTH;
+  const uint32_t pos_in_word = pos % ECMA_OBJECT_CONTAINER_WORD_WIDTH;
+
+  JERRY_ASSERT (word_index < ECMA_OBJECT_CONTAINER_WORDS_NUMBER);
+  JERRY_ASSERT (pos_in_word + width <= ECMA_OBJECT_CONTAINER_WORD_WIDTH);
+
+  return jrt_extract_bit_field (object_p->container[word_index], pos_in_word, width);
+} /* ecma_get_object_field */
+
+/**
+ * Set value of a bit-field of the object's container
+ *
+ * Note:
+ *      the bit-field should be placed in a single word of the container
+ */
+void
+ecma_set_object_field (ecma_object_t *object_p, /**< object or lexical environment */
+                       uint64_t value, /**< new value of the bit-field */
+                       uint32_t pos, /**< bit-field's position in the container */
+                       uint32_t width) /**< bit-field's width */
+{
+  const uint32_t word_index = pos / ECMA_OBJECT_CONTAINER_WORD_WIDTH;
+  const uint32_t pos_in_word = pos % ECMA_OBJECT_CONTAINER_WORD_WIDTH;
+
+  JERRY_ASSERT (word_index < ECMA_OBJECT_CONTAINER_WORDS_NUMBER);
+  JERRY_ASSERT (pos_in_word + width <= ECMA_OBJECT_CONTAINER_WORD_WIDTH);
+
+  object_p->container[word_index] = jrt_set_bit_field_value (object_p->container[word_index],
+                                                             value,
+                                                             pos_in_word,
+                                                             width);
+} /* ecma_set_object_field */
+
 /**
  * Create an object with specified prototype object
  * (or NULL prototype if there is not prototype for the object)
@@ -45,32 +92,33 @@ ecma_create_object (ecma_object_t *prototype_object_p, /**< pointer to prototybe
 
   ecma_init_gc_info (object_p);
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 ECMA_NULL_POINTER,
-                                                 ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                 ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 false,
-                                                 ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
-                                                 ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 is_extensible,
-                                                 ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
-                                                 ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 type,
-                                                 ECMA_OBJECT_OBJ_TYPE_POS,
-                                                 ECMA_OBJECT_OBJ_TYPE_WIDTH);
+  ecma_set_object_field (object_p,
+                         ECMA_NULL_POINTER,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  ecma_set_object_field (object_p,
+                         false,
+                         ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
+                         ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
+  ecma_set_object_field (object_p,
+                         is_extensible,
+                         ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
+                         ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
+  ecma_set_object_field (object_p,
+                         type,
+                         ECMA_OBJECT_OBJ_TYPE_POS,
+                         ECMA_OBJECT_OBJ_TYPE_WIDTH);
 
   uint64_t prototype_object_cp;
   ECMA_SET_POINTER (prototype_object_cp, prototype_object_p);
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 prototype_object_cp,
-                                                 ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS,
-                                                 ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
+  ecma_set_object_field (object_p,
+                         prototype_object_cp,
+                         ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS,
+                         ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
 
   ecma_set_object_is_builtin (object_p, false);
+  ecma_set_object_is_for_in_cached (object_p, false);
 
   return object_p;
 } /* ecma_create_object */
@@ -92,35 +140,35 @@ ecma_create_decl_lex_env (ecma_object_t *outer_lexical_environment_p) /**< outer
 
   ecma_init_gc_info (new_lexical_environment_p);
 
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  ECMA_NULL_POINTER,
-                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  true,
-                                                                  ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
-                                                                  ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
-
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE,
-                                                                  ECMA_OBJECT_LEX_ENV_TYPE_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
+  ecma_set_object_field (new_lexical_environment_p,
+                         ECMA_NULL_POINTER,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  ecma_set_object_field (new_lexical_environment_p,
+                         true,
+                         ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
+                         ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
+
+  ecma_set_object_field (new_lexical_environment_p,
+                         ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE,
+                         ECMA_OBJECT_LEX_ENV_TYPE_POS,
+                         ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
 
   uint64_t outer_reference_cp;
   ECMA_SET_POINTER (outer_reference_cp, outer_lexical_environment_p);
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  outer_reference_cp,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
+  ecma_set_object_field (new_lexical_environment_p,
+                         outer_reference_cp,
+                         ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
+                         ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
 
   /*
    * Declarative lexical environments do not really have the flag,
    * but to not leave the value initialized, setting the flag to false.
    */
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  false,
-                                                                  ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
+  ecma_set_object_field (new_lexical_environment_p,
+                         false,
+                         ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
+                         ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
 
   return new_lexical_environment_p;
 } /* ecma_create_decl_lex_env */
@@ -147,34 +195,34 @@ ecma_create_object_lex_env (ecma_object_t *outer_lexical_environment_p, /**< out
 
   ecma_init_gc_info (new_lexical_environment_p);
 
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  true,
-                                                                  ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
-                                                                  ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
+  ecma_set_object_field (new_lexical_environment_p,
+                         true,
+                         ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
+                         ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
 
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND,
-                                                                  ECMA_OBJECT_LEX_ENV_TYPE_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
+  ecma_set_object_field (new_lexical_environment_p,
+                         ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND,
+                         ECMA_OBJECT_LEX_ENV_TYPE_POS,
+                         ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
 
   uint64_t outer_reference_cp;
   ECMA_SET_POINTER (outer_reference_cp, outer_lexical_environment_p);
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  outer_reference_cp,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
+  ecma_set_object_field (new_lexical_environment_p,
+                         outer_reference_cp,
+                         ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
+                         ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
 
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  provide_this,
-                                                                  ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
-                                                                  ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
+  ecma_set_object_field (new_lexical_environment_p,
+                         provide_this,
+                         ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
+                         ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH);
 
   uint64_t bound_object_cp;
   ECMA_SET_NON_NULL_POINTER (bound_object_cp, binding_obj_p);
-  new_lexical_environment_p->container = jrt_set_bit_field_value (new_lexical_environment_p->container,
-                                                                  bound_object_cp,
-                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                                  ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  ecma_set_object_field (new_lexical_environment_p,
+                         bound_object_cp,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
 
   return new_lexical_environment_p;
 } /* ecma_create_object_lex_env */
@@ -187,7 +235,7 @@ ecma_is_lexical_environment (const ecma_object_t *object_p) /**< object or lexic
 {
   JERRY_ASSERT (object_p != NULL);
 
-  return (bool) jrt_extract_bit_field (object_p->container,
+  return (bool) ecma_get_object_field (object_p,
                                        ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_POS,
                                        ECMA_OBJECT_IS_LEXICAL_ENVIRONMENT_WIDTH);
 } /* ecma_is_lexical_environment */
@@ -201,7 +249,7 @@ ecma_get_object_extensible (const ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  return (bool) jrt_extract_bit_field (object_p->container,
+  return (bool) ecma_get_object_field (object_p,
                                        ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
                                        ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
 } /* ecma_get_object_extensible */
@@ -216,10 +264,10 @@ ecma_set_object_extensible (ecma_object_t *object_p, /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 is_extensible,
-                                                 ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
-                                                 ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
+  ecma_set_object_field (object_p,
+                         is_extensible,
+                         ECMA_OBJECT_OBJ_EXTENSIBLE_POS,
+                         ECMA_OBJECT_OBJ_EXTENSIBLE_WIDTH);
 } /* ecma_set_object_extensible */
 
 /**
@@ -231,7 +279,7 @@ ecma_get_object_type (const ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  return (ecma_object_type_t) jrt_extract_bit_field (object_p->container,
+  return (ecma_object_type_t) ecma_get_object_field (object_p,
                                                      ECMA_OBJECT_OBJ_TYPE_POS,
                                                      ECMA_OBJECT_OBJ_TYPE_WIDTH);
 } /* ecma_get_object_type */
@@ -246,10 +294,10 @@ ecma_set_object_type (ecma_object_t *object_p, /**< object */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 type,
-                                                 ECMA_OBJECT_OBJ_TYPE_POS,
-                                                 ECMA_OBJECT_OBJ_TYPE_WIDTH);
+  ecma_set_object_field (object_p,
+                         type,
+                         ECMA_OBJECT_OBJ_TYPE_POS,
+                         ECMA_OBJECT_OBJ_TYPE_WIDTH);
 } /* ecma_set_object_type */
 
 /**
@@ -262,7 +310,7 @@ ecma_get_object_prototype (const ecma_object_t *object_p) /**< object */
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
-  uintptr_t prototype_object_cp = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t prototype_object_cp = (uintptr_t) ecma_get_object_field (object_p,
                                                                      ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_POS,
                                                                      ECMA_OBJECT_OBJ_PROTOTYPE_OBJECT_CP_WIDTH);
   return ECMA_GET_POINTER (ecma_object_t,
@@ -285,7 +333,7 @@ ecma_get_object_is_builtin (const ecma_object_t *object_p) /**< object */
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= width);
 
-  uintptr_t flag_value = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t flag_value = (uintptr_t) ecma_get_object_field (object_p,
                                                             offset,
                                                             width);
 
@@ -305,12 +353,49 @@ ecma_set_object_is_builtin (ecma_object_t *object_p, /**< object */
   const uint32_t offset = ECMA_OBJECT_OBJ_IS_BUILTIN_POS;
   const uint32_t width = ECMA_OBJECT_OBJ_IS_BUILTIN_WIDTH;
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 (uintptr_t) is_builtin,
-                                                 offset,
-                                                 width);
+  ecma_set_object_field (object_p,
+                         (uintptr_t) is_builtin,
+                         offset,
+                         width);
 } /* ecma_set_object_is_builtin */
 
+/**
+ * Check if the object's properties are enumerated with the for-in cache
+ *
+ * @return true - if the object's properties are enumerated with the cache,
+ *         false - otherwise.
+ */
+bool __attr_pure___
+ecma_get_object_is_for_in_cached (const ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
+
+  const uint32_t offset = ECMA_OBJECT_OBJ_IS_FOR_IN_CACHED_POS;
+  const uint32_t width = ECMA_OBJECT_OBJ_IS_FOR_IN_CACHED_WIDTH;
+
+  return (bool) ecma_get_object_field (object_p, offset, width);
+} /* ecma_get_object_is_for_in_cached */
+
+/**
+ * Set flag indicating whether the object's properties are enumerated with the for-in cache
+ */
+void
+ecma_set_object_is_for_in_cached (ecma_object_t *object_p, /**< object */
+                                  bool is_for_in_cached) /**< value of flag */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (!ecma_is_lexical_environment (object_p));
+
+  const uint32_t offset = ECMA_OBJECT_OBJ_IS_FOR_IN_CACHED_POS;
+  const uint32_t width = ECMA_OBJECT_OBJ_IS_FOR_IN_CACHED_WIDTH;
+
+  ecma_set_object_field (object_p,
+                         (uintptr_t) is_for_in_cached,
+                         offset,
+                         width);
+} /* ecma_set_object_is_for_in_cached */
+
 /**
  * Get type of lexical environment.
  */
@@ -320,7 +405,7 @@ ecma_get_lex_env_type (const ecma_object_t *object_p) /**< lexical environment *
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (ecma_is_lexical_environment (object_p));
 
-  return (ecma_lexical_environment_type_t) jrt_extract_bit_field (object_p->container,
+  return (ecma_lexical_environment_type_t) ecma_get_object_field (object_p,
                                                                   ECMA_OBJECT_LEX_ENV_TYPE_POS,
                                                                   ECMA_OBJECT_LEX_ENV_TYPE_WIDTH);
 } /* ecma_get_lex_env_type */
@@ -335,7 +420,7 @@ ecma_get_lex_env_outer_reference (const ecma_object_t *object_p) /**< lexical en
   JERRY_ASSERT (ecma_is_lexical_environment (object_p));
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
-  uintptr_t outer_reference_cp = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t outer_reference_cp = (uintptr_t) ecma_get_object_field (object_p,
                                                                     ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_POS,
                                                                     ECMA_OBJECT_LEX_ENV_OUTER_REFERENCE_CP_WIDTH);
   return ECMA_GET_POINTER (ecma_object_t,
@@ -353,7 +438,7 @@ ecma_get_property_list (const ecma_object_t *object_p) /**< object or lexical en
                 ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  uintptr_t properties_cp = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t properties_cp = (uintptr_t) ecma_get_object_field (object_p,
                                                                ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
                                                                ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
   return ECMA_GET_POINTER (ecma_property_t,
@@ -374,10 +459,10 @@ ecma_set_property_list (ecma_object_t *object_p, /**< object or lexical environm
   uint64_t properties_cp;
   ECMA_SET_POINTER (properties_cp, property_list_p);
 
-  object_p->container = jrt_set_bit_field_value (object_p->container,
-                                                 properties_cp,
-                                                 ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
-                                                 ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
+  ecma_set_object_field (object_p,
+                         properties_cp,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
+                         ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
 } /* ecma_set_property_list */
 
 /**
@@ -391,7 +476,7 @@ ecma_get_lex_env_provide_this (const ecma_object_t *object_p) /**< object-bound
                 ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND);
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  bool provide_this = (jrt_extract_bit_field (object_p->container,
+  bool provide_this = (ecma_get_object_field (object_p,
                                               ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_POS,
                                               ECMA_OBJECT_LEX_ENV_PROVIDE_THIS_WIDTH) != 0);
 
@@ -409,7 +494,7 @@ ecma_get_lex_env_binding_object (const ecma_object_t *object_p) /**< object-boun
                 ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_OBJECTBOUND);
 
   JERRY_ASSERT (sizeof (uintptr_t) * JERRY_BITSINBYTE >= ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
-  uintptr_t object_cp = (uintptr_t) jrt_extract_bit_field (object_p->container,
+  uintptr_t object_cp = (uintptr_t) ecma_get_object_field (object_p,
                                                            ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_POS,
                                                            ECMA_OBJECT_PROPERTIES_OR_BOUND_OBJECT_CP_WIDTH);
   return ECMA_GET_NON_NULL_POINTER (ecma_object_t, object_cp);
@@ -531,6 +616,7 @@ ecma_create_named_data_property (ecma_object_t *obj_p, /**< object */
   ecma_set_property_list (obj_p, prop_p);
 
   ecma_lcache_invalidate (obj_p, name_p, NULL);
+  ecma_for_in_cache_invalidate_object (obj_p);
 
   return prop_p;
 } /* ecma_create_named_data_property */
@@ -579,6 +665,7 @@ ecma_create_named_accessor_property (ecma_object_t *obj_p, /**< object */
   ecma_set_named_accessor_property_setter (obj_p, prop_p, set_p);
 
   ecma_lcache_invalidate (obj_p, name_p, NULL);
+  ecma_for_in_cache_invalidate_object (obj_p);
 
   return prop_p;
 } /* ecma_create_named_accessor_property */
@@ -779,8 +866,10 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
     }
 
     case ECMA_INTERNAL_PROPERTY_NATIVE_CODE: /* an external pointer */
+    case ECMA_INTERNAL_PROPERTY_NATIVE_NUMBER_CODE: /* an external pointer */
     case ECMA_INTERNAL_PROPERTY_NATIVE_HANDLE: /* an external pointer */
     case ECMA_INTERNAL_PROPERTY_FREE_CALLBACK: /* an external pointer */
+    case ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_EXTERNAL_DATA: /* an external pointer */
     {
       ecma_free_external_pointer_in_property (property_p);
 
@@ -800,7 +889,22 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
     case ECMA_INTERNAL_PROPERTY_EXTENSION_ID: /* an integer */
     case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_0_31: /* an integer (bit-mask) */
     case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_32_63: /* an integer (bit-mask) */
+    case ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_BYTE_LENGTH: /* an integer */
+    case ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_BUFFER: /* an object */
+    case ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_TYPE: /* an enum */
+    case ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_BYTE_OFFSET: /* an integer */
+    case ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_LENGTH: /* an integer */
+    {
+      break;
+    }
+
+    case ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_DATA: /* compressed pointer to a heap block, or ECMA_NULL_POINTER */
     {
+      if (property_value != ECMA_NULL_POINTER)
+      {
+        mem_heap_free_block (ECMA_GET_NON_NULL_POINTER (void, property_value));
+      }
+
       break;
     }
 
@@ -869,6 +973,7 @@ ecma_delete_property (ecma_object_t *obj_p, /**< object */
 
     if (cur_prop_p == prop_p)
     {
+      ecma_for_in_cache_invalidate_object (obj_p);
       ecma_free_property (obj_p, prop_p);
 
       if (prev_prop_p == NULL)
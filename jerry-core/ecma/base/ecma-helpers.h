@@ -120,6 +120,10 @@ extern void ecma_new_ecma_string_on_stack_from_magic_string_id (ecma_string_t *s
                                                                 lit_magic_string_id_t id);
 extern ecma_string_t* ecma_new_ecma_string_from_magic_string_id (lit_magic_string_id_t id);
 extern ecma_string_t* ecma_new_ecma_string_from_magic_string_ex_id (lit_magic_string_ex_id_t id);
+extern ecma_string_t* ecma_new_ecma_string_from_external_utf8 (const lit_utf8_byte_t *chars_p,
+                                                               lit_utf8_size_t size,
+                                                               ecma_external_pointer_t free_cb);
+extern uint32_t ecma_get_external_strings_number (void);
 extern ecma_string_t* ecma_concat_ecma_strings (ecma_string_t *string1_p, ecma_string_t *string2_p);
 extern ecma_string_t* ecma_copy_or_ref_ecma_string (ecma_string_t *string_desc_p);
 extern void ecma_deref_ecma_string (ecma_string_t *string_p);
@@ -128,6 +132,8 @@ extern ecma_number_t ecma_string_to_number (const ecma_string_t *str_p);
 extern ssize_t ecma_string_to_utf8_string (const ecma_string_t *string_desc_p,
                                            lit_utf8_byte_t *buffer_p,
                                            ssize_t buffer_size);
+extern const lit_utf8_byte_t *ecma_string_get_contiguous_chars (const ecma_string_t *string_p,
+                                                                lit_utf8_size_t *out_size_p);
 extern bool ecma_compare_ecma_strings_equal_hashes (const ecma_string_t *string1_p,
                                                     const ecma_string_t *string2_p);
 extern bool ecma_compare_ecma_strings (const ecma_string_t *string1_p,
@@ -214,6 +220,8 @@ extern bool
 ecma_collection_iterator_next (ecma_collection_iterator_t *iterator_p);
 
 /* ecma-helpers.cpp */
+extern uint64_t __attr_pure___ ecma_get_object_field (const ecma_object_t *object_p, uint32_t pos, uint32_t width);
+extern void ecma_set_object_field (ecma_object_t *object_p, uint64_t value, uint32_t pos, uint32_t width);
 extern ecma_object_t* ecma_create_object (ecma_object_t *prototype_object_p,
                                           bool is_extensible,
                                           ecma_object_type_t type);
@@ -230,6 +238,9 @@ extern ecma_object_t* __attr_pure___ ecma_get_object_prototype (const ecma_objec
 extern bool __attr_pure___ ecma_get_object_is_builtin (const ecma_object_t *object_p);
 extern void ecma_set_object_is_builtin (ecma_object_t *object_p,
                                         bool is_builtin);
+extern bool __attr_pure___ ecma_get_object_is_for_in_cached (const ecma_object_t *object_p);
+extern void ecma_set_object_is_for_in_cached (ecma_object_t *object_p,
+                                              bool is_for_in_cached);
 extern ecma_lexical_environment_type_t __attr_pure___ ecma_get_lex_env_type (const ecma_object_t *object_p);
 extern ecma_object_t* __attr_pure___ ecma_get_lex_env_outer_reference (const ecma_object_t *object_p);
 extern ecma_property_t* __attr_pure___ ecma_get_property_list (const ecma_object_t *object_p);
@@ -305,6 +316,8 @@ ecma_get_external_pointer_value (ecma_object_t *obj_p,
                                  ecma_external_pointer_t *out_pointer_p);
 extern void
 ecma_free_external_pointer_in_property (ecma_property_t *prop_p);
+extern uint32_t
+ecma_get_external_pointer_properties_number (void);
 
 /* ecma-helpers-conversion.cpp */
 extern ecma_number_t ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, lit_utf8_size_t str_size);
@@ -14,6 +14,7 @@
  */
 
 #include "ecma-builtins.h"
+#include "ecma-for-in-cache.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
@@ -37,12 +38,65 @@ ecma_init (void)
 {
   ecma_init_builtins ();
   ecma_lcache_init ();
+  ecma_for_in_cache_init ();
   ecma_stack_init ();
   ecma_init_environment ();
 
   mem_register_a_try_give_memory_back_callback (ecma_try_to_give_back_some_memory);
 } /* ecma_init */
 
+/**
+ * Save ECMA components' state to a heap snapshot
+ *
+ * Note:
+ *      the lookup and for-in caches are invalidated and garbage collection is performed,
+ *      so that only objects, reachable from the engine's roots, are stored in the snapshot
+ *
+ * @return true - if the state was saved,
+ *         false - otherwise (some object or string holds an external pointer, that can't be stored
+ *                 in the snapshot).
+ */
+bool
+ecma_save_snapshot_state (ecma_snapshot_state_t *out_state_p) /**< out: ECMA components' state */
+{
+  JERRY_ASSERT (ecma_stack_get_top_frame () == NULL);
+
+  ecma_lcache_invalidate_all ();
+  ecma_for_in_cache_invalidate_all ();
+  ecma_gc_run ();
+
+  if (ecma_get_external_pointer_properties_number () != 0
+      || ecma_get_external_strings_number () != 0)
+  {
+    return false;
+  }
+
+  ecma_builtins_save_snapshot_state (out_state_p->builtin_objects);
+  out_state_p->global_lex_env = ecma_environment_save_snapshot_state ();
+  ecma_gc_save_snapshot_state (&out_state_p->gc);
+
+  return true;
+} /* ecma_save_snapshot_state */
+
+/**
+ * Initialize ECMA components from a heap snapshot
+ *
+ * Note:
+ *      the heap should be already restored from the snapshot
+ */
+void
+ecma_init_from_snapshot (const ecma_snapshot_state_t *state_p) /**< ECMA components' state */
+{
+  ecma_init_builtins_from_snapshot (state_p->builtin_objects);
+  ecma_gc_init_from_snapshot (&state_p->gc);
+  ecma_lcache_init ();
+  ecma_for_in_cache_init ();
+  ecma_stack_init ();
+  ecma_init_environment_from_snapshot (state_p->global_lex_env);
+
+  mem_register_a_try_give_memory_back_callback (ecma_try_to_give_back_some_memory);
+} /* ecma_init_from_snapshot */
+
 /**
  * Finalize ECMA components
  */
@@ -55,6 +109,7 @@ ecma_finalize (void)
   ecma_stack_finalize ();
   ecma_finalize_builtins ();
   ecma_lcache_invalidate_all ();
+  ecma_for_in_cache_invalidate_all ();
   ecma_gc_run ();
 } /* ecma_finalize */
 
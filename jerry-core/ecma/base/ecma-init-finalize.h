@@ -25,8 +25,23 @@
  * @{
  */
 
+#include "ecma-builtins.h"
+#include "ecma-gc.h"
+
+/**
+ * ECMA components' state, stored in a heap snapshot
+ */
+typedef struct
+{
+  mem_heap_snapshot_pointer_t builtin_objects[ECMA_BUILTIN_ID__COUNT]; /**< instantiated built-in objects */
+  mem_heap_snapshot_pointer_t global_lex_env; /**< Global environment */
+  ecma_gc_snapshot_state_t gc; /**< garbage collector's state */
+} ecma_snapshot_state_t;
+
 extern void ecma_init (void);
 extern void ecma_finalize (void);
+extern bool ecma_save_snapshot_state (ecma_snapshot_state_t *out_state_p);
+extern void ecma_init_from_snapshot (const ecma_snapshot_state_t *state_p);
 
 /**
  * @}
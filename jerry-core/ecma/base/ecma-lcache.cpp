@@ -41,31 +41,86 @@ typedef struct
   /** Compressed pointer to a property of the object */
   mem_cpointer_t prop_cp;
 
+#ifndef CONFIG_MEM_CPOINTER_32BIT
   /** Padding structure to 8 bytes size */
   uint16_t padding;
+#endif /* !CONFIG_MEM_CPOINTER_32BIT */
 } ecma_lcache_hash_entry_t;
 
+#ifndef CONFIG_MEM_CPOINTER_32BIT
 JERRY_STATIC_ASSERT (sizeof (ecma_lcache_hash_entry_t) == sizeof (uint64_t));
+#endif /* !CONFIG_MEM_CPOINTER_32BIT */
 
 /**
- * LCache hash value length, in bits
+ * Length of property name's hash value, in bits
  */
-#define ECMA_LCACHE_HASH_BITS (sizeof (lit_string_hash_t) * JERRY_BITSINBYTE)
+#define ECMA_LCACHE_NAME_HASH_BITS (sizeof (lit_string_hash_t) * JERRY_BITSINBYTE)
+
+/**
+ * Log2 of number of rows in LCache's hash table
+ */
+#define ECMA_LCACHE_HASH_ROWS_COUNT_LOG (CONFIG_ECMA_LCACHE_HASH_ROWS_COUNT_LOG)
 
 /**
  * Number of rows in LCache's hash table
  */
-#define ECMA_LCACHE_HASH_ROWS_COUNT (1ull << ECMA_LCACHE_HASH_BITS)
+#define ECMA_LCACHE_HASH_ROWS_COUNT (1u << ECMA_LCACHE_HASH_ROWS_COUNT_LOG)
 
 /**
  * Number of entries in a row of LCache's hash table
+ *
+ * Entries of a row are kept in order of their last use, so the last entry is the least recently used one.
  */
-#define ECMA_LCACHE_HASH_ROW_LENGTH (2)
+#define ECMA_LCACHE_HASH_ROW_LENGTH (CONFIG_ECMA_LCACHE_HASH_ROW_LENGTH)
+
+JERRY_STATIC_ASSERT (ECMA_LCACHE_HASH_ROWS_COUNT_LOG > 0 && ECMA_LCACHE_HASH_ROWS_COUNT_LOG < 32);
+JERRY_STATIC_ASSERT (MEM_CP_WIDTH + ECMA_LCACHE_NAME_HASH_BITS <= 32);
 
 /**
  * LCache's hash table
  */
 static ecma_lcache_hash_entry_t ecma_lcache_hash_table[ ECMA_LCACHE_HASH_ROWS_COUNT ][ ECMA_LCACHE_HASH_ROW_LENGTH ];
+
+#ifdef MEM_STATS
+/**
+ * LCache's usage statistics
+ */
+static ecma_lcache_stats_t ecma_lcache_stats;
+#endif /* MEM_STATS */
+
+/**
+ * Get index of LCache's hash table row, corresponding to given (object, property name) pair
+ *
+ * @return row index
+ */
+static uint32_t __attr_always_inline___
+ecma_lcache_row_index (unsigned int object_cp, /**< compressed pointer to an object */
+                       lit_string_hash_t prop_name_hash) /**< hash of property's name */
+{
+  /* Fibonacci hashing of the pair, so that same names of different objects are spread over the table */
+  uint32_t key = (((uint32_t) object_cp) << ECMA_LCACHE_NAME_HASH_BITS) | prop_name_hash;
+
+  return (uint32_t) ((key * 2654435761u) >> (32u - ECMA_LCACHE_HASH_ROWS_COUNT_LOG));
+} /* ecma_lcache_row_index */
+
+/**
+ * Move specified entry of LCache's row to the row's beginning, marking it as the most recently used
+ */
+static void
+ecma_lcache_move_entry_to_front (ecma_lcache_hash_entry_t *row_p, /**< row */
+                                 uint32_t entry_index) /**< index of the entry in the row */
+{
+  JERRY_ASSERT (entry_index < ECMA_LCACHE_HASH_ROW_LENGTH);
+
+  ecma_lcache_hash_entry_t entry = row_p[entry_index];
+
+  for (uint32_t i = entry_index; i > 0; i--)
+  {
+    row_p[i] = row_p[i - 1];
+  }
+
+  row_p[0] = entry;
+} /* ecma_lcache_move_entry_to_front */
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 
 /**
@@ -76,6 +131,10 @@ ecma_lcache_init (void)
 {
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
   memset (ecma_lcache_hash_table, 0, sizeof (ecma_lcache_hash_table));
+
+#ifdef MEM_STATS
+  memset (&ecma_lcache_stats, 0, sizeof (ecma_lcache_stats));
+#endif /* MEM_STATS */
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 } /* ecma_lcache_init */
 
@@ -130,7 +189,7 @@ ecma_lcache_invalidate_all (void)
  * Invalidate entries of LCache's row that correspond to given (object, property) pair
  */
 static void
-ecma_lcache_invalidate_row_for_object_property_pair (uint32_t row_index, /**< index of the row */
+ecma_lcache_invalidate_row_for_object_property_pair (ecma_lcache_hash_entry_t *row_p, /**< row */
                                                      unsigned int object_cp, /**< compressed pointer
                                                                               *   to an object */
                                                      unsigned property_cp) /**< compressed pointer
@@ -139,10 +198,10 @@ ecma_lcache_invalidate_row_for_object_property_pair (uint32_t row_index, /**< in
 {
   for (uint32_t entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
   {
-    if (ecma_lcache_hash_table[ row_index ][ entry_index ].object_cp == object_cp
-        && ecma_lcache_hash_table[ row_index ][ entry_index ].prop_cp == property_cp)
+    if (row_p[entry_index].object_cp == object_cp
+        && row_p[entry_index].prop_cp == property_cp)
     {
-      ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[ row_index ][ entry_index ]);
+      ecma_lcache_invalidate_entry (&row_p[entry_index]);
     }
   }
 } /* ecma_lcache_invalidate_row_for_object_property_pair */
@@ -164,7 +223,11 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
   prop_name_p = ecma_copy_or_ref_ecma_string (prop_name_p);
 
-  lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
+  unsigned int object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  ecma_lcache_hash_entry_t *row_p = ecma_lcache_hash_table[ecma_lcache_row_index (object_cp,
+                                                                                 ecma_string_hash (prop_name_p))];
 
   if (prop_p != NULL)
   {
@@ -173,34 +236,29 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
       mem_cpointer_t prop_cp;
       ECMA_SET_NON_NULL_POINTER (prop_cp, prop_p);
 
-      int32_t entry_index;
+      uint32_t entry_index;
       for (entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
       {
-        if (ecma_lcache_hash_table[hash_key][entry_index].object_cp != ECMA_NULL_POINTER
-            && ecma_lcache_hash_table[hash_key][entry_index].prop_cp == prop_cp)
+        if (row_p[entry_index].object_cp != ECMA_NULL_POINTER
+            && row_p[entry_index].prop_cp == prop_cp)
         {
-#ifndef JERRY_NDEBUG
-          ecma_object_t* obj_in_entry_p;
-          obj_in_entry_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
-                                                      ecma_lcache_hash_table[hash_key][entry_index].object_cp);
-          JERRY_ASSERT (obj_in_entry_p == object_p);
-#endif /* !JERRY_NDEBUG */
+          JERRY_ASSERT (row_p[entry_index].object_cp == object_cp);
           break;
         }
       }
 
       JERRY_ASSERT (entry_index != ECMA_LCACHE_HASH_ROW_LENGTH);
-      ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[hash_key][entry_index]);
+      ecma_lcache_invalidate_entry (&row_p[entry_index]);
     }
 
     JERRY_ASSERT (!ecma_is_property_lcached (prop_p));
     ecma_set_property_lcached (prop_p, true);
   }
 
-  int32_t entry_index;
+  uint32_t entry_index;
   for (entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
   {
-    if (ecma_lcache_hash_table[hash_key][entry_index].object_cp == ECMA_NULL_POINTER)
+    if (row_p[entry_index].object_cp == ECMA_NULL_POINTER)
     {
       break;
     }
@@ -208,19 +266,25 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
 
   if (entry_index == ECMA_LCACHE_HASH_ROW_LENGTH)
   {
-    /* No empty entry was found, invalidating the whole row */
-    for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH; i++)
-    {
-      ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[hash_key][i]);
-    }
+    /* No empty entry was found, evicting the least recently used one */
+    entry_index = ECMA_LCACHE_HASH_ROW_LENGTH - 1;
+    ecma_lcache_invalidate_entry (&row_p[entry_index]);
 
-    entry_index = 0;
+#ifdef MEM_STATS
+    ecma_lcache_stats.evictions++;
+#endif /* MEM_STATS */
   }
 
+  ecma_lcache_move_entry_to_front (row_p, entry_index);
+
   ecma_ref_object (object_p);
-  ECMA_SET_NON_NULL_POINTER (ecma_lcache_hash_table[ hash_key ][ entry_index ].object_cp, object_p);
-  ECMA_SET_NON_NULL_POINTER (ecma_lcache_hash_table[ hash_key ][ entry_index ].prop_name_cp, prop_name_p);
-  ECMA_SET_POINTER (ecma_lcache_hash_table[ hash_key ][ entry_index ].prop_cp, prop_p);
+  row_p[0].object_cp = (mem_cpointer_t) object_cp;
+  ECMA_SET_NON_NULL_POINTER (row_p[0].prop_name_cp, prop_name_p);
+  ECMA_SET_POINTER (row_p[0].prop_cp, prop_p);
+
+#ifdef MEM_STATS
+  ecma_lcache_stats.insertions++;
+#endif /* MEM_STATS */
 #else /* CONFIG_ECMA_LCACHE_DISABLE */
   (void) prop_p;
 #endif /* CONFIG_ECMA_LCACHE_DISABLE */
@@ -243,25 +307,36 @@ ecma_lcache_lookup (ecma_object_t *object_p, /**< object */
                                                  *         then the output parameter is not set */
 {
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
-  lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
-
   unsigned int object_cp;
   ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
 
+  lit_string_hash_t prop_name_hash = ecma_string_hash (prop_name_p);
+  ecma_lcache_hash_entry_t *row_p = ecma_lcache_hash_table[ecma_lcache_row_index (object_cp, prop_name_hash)];
+
   for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH; i++)
   {
-    if (ecma_lcache_hash_table[hash_key][i].object_cp == object_cp)
+    if (row_p[i].object_cp == object_cp)
     {
-      ecma_string_t *entry_prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
-                                                                    ecma_lcache_hash_table[hash_key][i].prop_name_cp);
+      ecma_string_t *entry_prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, row_p[i].prop_name_cp);
 
-      if (ecma_compare_ecma_strings_equal_hashes (prop_name_p, entry_prop_name_p))
+      /* the row is shared by names with different hashes */
+      if (ecma_string_hash (entry_prop_name_p) == prop_name_hash
+          && ecma_compare_ecma_strings_equal_hashes (prop_name_p, entry_prop_name_p))
       {
-        ecma_property_t *prop_p = ECMA_GET_POINTER (ecma_property_t, ecma_lcache_hash_table[hash_key][i].prop_cp);
+        ecma_property_t *prop_p = ECMA_GET_POINTER (ecma_property_t, row_p[i].prop_cp);
         JERRY_ASSERT (prop_p == NULL || ecma_is_property_lcached (prop_p));
 
         *prop_p_p = prop_p;
 
+        if (i != 0)
+        {
+          ecma_lcache_move_entry_to_front (row_p, i);
+        }
+
+#ifdef MEM_STATS
+        ecma_lcache_stats.hits++;
+#endif /* MEM_STATS */
+
         return true;
       }
       else
@@ -270,6 +345,10 @@ ecma_lcache_lookup (ecma_object_t *object_p, /**< object */
       }
     }
   }
+
+#ifdef MEM_STATS
+  ecma_lcache_stats.misses++;
+#endif /* MEM_STATS */
 #else /* CONFIG_ECMA_LCACHE_DISABLE */
   (void) object_p;
   (void) prop_name_p;
@@ -333,15 +412,67 @@ ecma_lcache_invalidate (ecma_object_t *object_p, /**< object */
   ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
   ECMA_SET_POINTER (prop_cp, prop_p);
 
-  lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
+  /* Given (object, property name) pair should be in the row corresponding to the pair's hash */
+  uint32_t row_index = ecma_lcache_row_index (object_cp, ecma_string_hash (prop_name_p));
 
-  /* Property's name has was computed.
-   * Given (object, property name) pair should be in the row corresponding to computed hash.
-   */
-  ecma_lcache_invalidate_row_for_object_property_pair (hash_key, object_cp, prop_cp);
+  ecma_lcache_invalidate_row_for_object_property_pair (ecma_lcache_hash_table[row_index], object_cp, prop_cp);
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 } /* ecma_lcache_invalidate */
 
+#ifdef MEM_STATS
+/**
+ * Get LCache usage statistics
+ */
+void
+ecma_lcache_get_stats (ecma_lcache_stats_t *out_stats_p) /**< out: statistics */
+{
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+  *out_stats_p = ecma_lcache_stats;
+
+  out_stats_p->entries = 0;
+  for (uint32_t row_index = 0; row_index < ECMA_LCACHE_HASH_ROWS_COUNT; row_index++)
+  {
+    for (uint32_t entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
+    {
+      if (ecma_lcache_hash_table[ row_index ][ entry_index ].object_cp != ECMA_NULL_POINTER)
+      {
+        out_stats_p->entries++;
+      }
+    }
+  }
+#else /* CONFIG_ECMA_LCACHE_DISABLE */
+  memset (out_stats_p, 0, sizeof (*out_stats_p));
+#endif /* CONFIG_ECMA_LCACHE_DISABLE */
+} /* ecma_lcache_get_stats */
+
+/**
+ * Print LCache usage statistics
+ */
+void
+ecma_lcache_stats_print (void)
+{
+  ecma_lcache_stats_t stats;
+  ecma_lcache_get_stats (&stats);
+
+  printf ("Property lookup cache stats:\n");
+  printf ("  Entries: %zu / %zu\n"
+          "  Hits: %zu\n"
+          "  Misses: %zu\n"
+          "  Insertions: %zu\n"
+          "  Evictions: %zu\n\n",
+          stats.entries,
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+          (size_t) (ECMA_LCACHE_HASH_ROWS_COUNT * ECMA_LCACHE_HASH_ROW_LENGTH),
+#else /* CONFIG_ECMA_LCACHE_DISABLE */
+          (size_t) 0,
+#endif /* CONFIG_ECMA_LCACHE_DISABLE */
+          stats.hits,
+          stats.misses,
+          stats.insertions,
+          stats.evictions);
+} /* ecma_lcache_stats_print */
+#endif /* MEM_STATS */
+
 /**
  * @}
  * @}
@@ -26,6 +26,23 @@
 extern void ecma_lcache_init (void);
 extern void ecma_lcache_invalidate_all (void);
 extern void ecma_lcache_insert (ecma_object_t *object_p, ecma_string_t *prop_name_p, ecma_property_t *prop_p);
+
+#ifdef MEM_STATS
+/**
+ * LCache usage statistics
+ */
+typedef struct
+{
+  size_t entries; /**< number of occupied entries */
+  size_t hits; /**< number of lookups, that found (object, property name) pair in the cache */
+  size_t misses; /**< number of lookups, that didn't find the pair in the cache */
+  size_t insertions; /**< number of registered pairs */
+  size_t evictions; /**< number of entries, replaced with newer entries because of full row */
+} ecma_lcache_stats_t;
+
+extern void ecma_lcache_get_stats (ecma_lcache_stats_t *out_stats_p);
+extern void ecma_lcache_stats_print (void);
+#endif /* MEM_STATS */
 extern bool ecma_lcache_lookup (ecma_object_t *object_p, const ecma_string_t *prop_name_p, ecma_property_t **prop_p_p);
 extern void ecma_lcache_invalidate (ecma_object_t *object_p, ecma_string_t *prop_name_arg_p, ecma_property_t *prop_p);
 
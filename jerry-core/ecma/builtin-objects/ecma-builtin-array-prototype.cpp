@@ -1099,7 +1099,93 @@ ecma_builtin_array_prototype_object_last_index_of (ecma_value_t this_arg, /**< t
 } /* ecma_builtin_array_prototype_object_last_index_of */
 
 /**
- * SortCompare abstract method
+ * Minimum length of runs, merged by Array.prototype.sort
+ *
+ * Shorter natural runs are extended with binary insertion sort.
+ */
+#define ECMA_BUILTIN_ARRAY_SORT_MIN_RUN_LENGTH (16)
+
+/**
+ * Element of array being sorted by Array.prototype.sort
+ */
+typedef struct
+{
+  ecma_value_t value; /**< element's value */
+  ecma_value_t key; /**< sort key: the value's string representation, if the default comparison
+                     *   is performed on strings, or the value itself, otherwise */
+} ecma_builtin_array_sort_entry_t;
+
+/**
+ * Check if a number is integer in the uint32 range, so that its string representation
+ * is the uint32's decimal representation
+ *
+ * @return true / false
+ */
+static bool
+ecma_builtin_array_prototype_object_sort_is_uint32_number (ecma_value_t value) /**< ecma-value */
+{
+  if (!ecma_is_value_number (value))
+  {
+    return false;
+  }
+
+  ecma_number_t num = *ecma_get_number_from_value (value);
+
+  return (!ecma_number_is_nan (num)
+          && num >= ECMA_NUMBER_ZERO
+          && num == ((ecma_number_t) ecma_number_to_uint32 (num)));
+} /* ecma_builtin_array_prototype_object_sort_is_uint32_number */
+
+/**
+ * Compare decimal representations of uint32 numbers, as strings
+ *
+ * @return true - if the first number's representation is greater than the second number's representation,
+ *         false - otherwise.
+ */
+static bool
+ecma_builtin_array_prototype_object_sort_is_uint32_string_greater (uint32_t left, /**< left number */
+                                                                   uint32_t right) /**< right number */
+{
+  /* scale the number with less digits, so that both have the same number of digits */
+  uint64_t left_scaled = left, right_scaled = right;
+  uint32_t left_digits = left, right_digits = right;
+
+  while (left_digits >= 10 || right_digits >= 10)
+  {
+    if (left_digits < 10)
+    {
+      left_scaled *= 10;
+    }
+    else
+    {
+      left_digits /= 10;
+    }
+
+    if (right_digits < 10)
+    {
+      right_scaled *= 10;
+    }
+    else
+    {
+      right_digits /= 10;
+    }
+  }
+
+  if (left_scaled != right_scaled)
+  {
+    return (left_scaled > right_scaled);
+  }
+
+  /* one representation is prefix of the other: the longer is greater */
+  return (left > right);
+} /* ecma_builtin_array_prototype_object_sort_is_uint32_string_greater */
+
+/**
+ * SortCompare abstract method for defined values
+ *
+ * Note:
+ *      undefined values and non-existent properties are not passed to the helper,
+ *      as Array.prototype.sort puts them at the end of the result without comparison
  *
  * See also:
  *          ECMA-262 v5, 15.4.4.11
@@ -1108,249 +1194,434 @@ ecma_builtin_array_prototype_object_last_index_of (ecma_value_t this_arg, /**< t
  *         Returned value must be freed with ecma_free_completion_value.
  */
 static ecma_completion_value_t
-ecma_builtin_array_prototype_object_sort_compare_helper (ecma_value_t j, /**< left value */
-                                                         ecma_value_t k, /**< right value */
-                                                         ecma_value_t comparefn) /**< compare function */
+ecma_builtin_array_prototype_object_sort_compare_helper (const ecma_builtin_array_sort_entry_t *left_p, /**< left
+                                                                                                        *   element */
+                                                         const ecma_builtin_array_sort_entry_t *right_p, /**< right
+                                                                                                         *   element */
+                                                         ecma_value_t comparefn, /**< compare function */
+                                                         bool *out_is_greater_p) /**< out: true - if left element
+                                                                                  *        is greater than right,
+                                                                                  *        false - otherwise */
 {
-  /*
-   * ECMA-262 v5, 15.4.4.11 NOTE1: Because non-existent property values always
-   * compare greater than undefined property values, and undefined always
-   * compares greater than any other value, undefined property values always
-   * sort to the end of the result, followed by non-existent property values.
-   */
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
-  ecma_number_t *result_p = ecma_alloc_number ();
 
-  bool j_is_undef = ecma_is_value_undefined (j);
-  bool k_is_undef = ecma_is_value_undefined (k);
-
-  if (j_is_undef)
+  if (ecma_is_value_undefined (comparefn))
   {
-    if (k_is_undef)
+    /* Default comparison when no comparefn is passed. */
+    if (ecma_is_value_number (left_p->key))
     {
-      *result_p = ecma_int32_to_number (0);
+      JERRY_ASSERT (ecma_is_value_number (right_p->key));
+
+      *out_is_greater_p = ecma_builtin_array_prototype_object_sort_is_uint32_string_greater (
+                            ecma_number_to_uint32 (*ecma_get_number_from_value (left_p->key)),
+                            ecma_number_to_uint32 (*ecma_get_number_from_value (right_p->key)));
     }
     else
     {
-      *result_p = ecma_int32_to_number (1);
+      *out_is_greater_p = ecma_compare_ecma_strings_relational (ecma_get_string_from_value (right_p->key),
+                                                               ecma_get_string_from_value (left_p->key));
     }
+
+    ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
   }
   else
   {
-    if (k_is_undef)
-    {
-      *result_p = ecma_int32_to_number (-1);
-    }
-    else
-    {
-      if (ecma_is_value_undefined (comparefn))
-      {
-        /* Default comparison when no comparefn is passed. */
-        ECMA_TRY_CATCH (j_value, ecma_op_to_string (j), ret_value);
-        ECMA_TRY_CATCH (k_value, ecma_op_to_string (k), ret_value);
-        ecma_string_t *j_str_p = ecma_get_string_from_value (j_value);
-        ecma_string_t *k_str_p = ecma_get_string_from_value (k_value);
+    /*
+     * comparefn, if not undefined, will always contain a callable function object.
+     * We checked this previously, before this function was called.
+     */
+    JERRY_ASSERT (ecma_op_is_callable (comparefn));
+    ecma_object_t *comparefn_obj_p = ecma_get_object_from_value (comparefn);
 
-        if (ecma_compare_ecma_strings_relational (j_str_p, k_str_p))
-        {
-          *result_p = ecma_int32_to_number (-1);
-        }
-        else if (!ecma_compare_ecma_strings (j_str_p, k_str_p))
-        {
-          *result_p = ecma_int32_to_number (1);
-        }
-        else
-        {
-          *result_p = ecma_int32_to_number (0);
-        }
+    ecma_value_t compare_args[] = {left_p->value, right_p->value};
+
+    ECMA_TRY_CATCH (call_value,
+                    ecma_op_function_call (comparefn_obj_p,
+                                           ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED),
+                                           compare_args,
+                                           2),
+                    ret_value);
+
+    ECMA_OP_TO_NUMBER_TRY_CATCH (ret_num, call_value, ret_value);
+
+    *out_is_greater_p = (ret_num > ECMA_NUMBER_ZERO);
+    ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+
+    ECMA_OP_TO_NUMBER_FINALIZE (ret_num);
+    ECMA_FINALIZE (call_value);
+  }
 
-        ECMA_FINALIZE (k_value);
-        ECMA_FINALIZE (j_value);
+  return ret_value;
+} /* ecma_builtin_array_prototype_object_sort_compare_helper */
+
+/**
+ * Extend sorted range of elements with following elements, using binary insertion sort
+ *
+ * Note:
+ *      if comparison fails, the elements are kept in some permutation of the initial order
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_array_prototype_object_sort_insertion_helper (ecma_builtin_array_sort_entry_t *entries_p, /**< elements */
+                                                           uint32_t start, /**< start of sorted range */
+                                                           uint32_t sorted_end, /**< end of sorted range */
+                                                           uint32_t end, /**< end of range to sort */
+                                                           ecma_value_t comparefn) /**< compare function */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  for (uint32_t index = sorted_end; index < end && ecma_is_completion_value_empty (ret_value); index++)
+  {
+    const ecma_builtin_array_sort_entry_t pivot = entries_p[index];
+
+    /* find position after the last element, that is not greater than the pivot (keeps the sort stable) */
+    uint32_t lower = start, upper = index;
+
+    while (lower < upper && ecma_is_completion_value_empty (ret_value))
+    {
+      const uint32_t middle = lower + (upper - lower) / 2;
+      bool is_greater;
+
+      ECMA_TRY_CATCH (compare_value,
+                      ecma_builtin_array_prototype_object_sort_compare_helper (&entries_p[middle],
+                                                                               &pivot,
+                                                                               comparefn,
+                                                                               &is_greater),
+                      ret_value);
+
+      if (is_greater)
+      {
+        upper = middle;
       }
       else
       {
-        /*
-         * comparefn, if not undefined, will always contain a callable function object.
-         * We checked this previously, before this function was called.
-         */
-        JERRY_ASSERT (ecma_op_is_callable (comparefn));
-        ecma_object_t *comparefn_obj_p = ecma_get_object_from_value (comparefn);
-
-        ecma_value_t compare_args[] = {j, k};
-
-        ECMA_TRY_CATCH (call_value,
-                        ecma_op_function_call (comparefn_obj_p,
-                                               ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED),
-                                               compare_args,
-                                               2),
-                        ret_value);
+        lower = middle + 1;
+      }
 
-        if (!ecma_is_value_number (call_value))
-        {
-          ECMA_OP_TO_NUMBER_TRY_CATCH (ret_num, call_value, ret_value);
-          *result_p = ret_num;
-          ECMA_OP_TO_NUMBER_FINALIZE (ret_num);
-        }
-        else
-        {
-          *result_p = *ecma_get_number_from_value (call_value);
-        }
+      ECMA_FINALIZE (compare_value);
+    }
 
-        ECMA_FINALIZE (call_value);
-      }
+    if (ecma_is_completion_value_empty (ret_value))
+    {
+      memmove (entries_p + lower + 1, entries_p + lower, (index - lower) * sizeof (ecma_builtin_array_sort_entry_t));
+      entries_p[lower] = pivot;
     }
   }
 
   if (ecma_is_completion_value_empty (ret_value))
   {
-    ret_value = ecma_make_normal_completion_value (ecma_make_number_value (result_p));
+    ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
   }
-  else
+
+  return ret_value;
+} /* ecma_builtin_array_prototype_object_sort_insertion_helper */
+
+/**
+ * Find end of natural run of elements, starting at specified position
+ *
+ * Non-descending runs are detected as is, and strictly descending runs are reversed
+ * (strictness is required to keep the sort stable).
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_array_prototype_object_sort_run_helper (ecma_builtin_array_sort_entry_t *entries_p, /**< elements */
+                                                     uint32_t start, /**< start of the run */
+                                                     uint32_t end, /**< end of elements range */
+                                                     ecma_value_t comparefn, /**< compare function */
+                                                     uint32_t *out_run_end_p) /**< out: end of the run */
+{
+  JERRY_ASSERT (start < end);
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  uint32_t run_end = start + 1;
+  bool is_descending = false;
+
+  while (run_end < end && ecma_is_completion_value_empty (ret_value))
   {
-    ecma_dealloc_number (result_p);
+    bool is_greater;
+
+    ECMA_TRY_CATCH (compare_value,
+                    ecma_builtin_array_prototype_object_sort_compare_helper (&entries_p[run_end - 1],
+                                                                             &entries_p[run_end],
+                                                                             comparefn,
+                                                                             &is_greater),
+                    ret_value);
+
+    if (run_end == start + 1)
+    {
+      is_descending = is_greater;
+    }
+
+    if (is_greater == is_descending)
+    {
+      run_end++;
+    }
+    else
+    {
+      /* the run is over */
+      ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    }
+
+    ECMA_FINALIZE (compare_value);
+  }
+
+  if (!ecma_is_completion_value_throw (ret_value))
+  {
+    if (is_descending)
+    {
+      for (uint32_t left = start, right = run_end - 1; left < right; left++, right--)
+      {
+        ecma_builtin_array_sort_entry_t swap = entries_p[left];
+        entries_p[left] = entries_p[right];
+        entries_p[right] = swap;
+      }
+    }
+
+    *out_run_end_p = run_end;
+
+    ecma_free_completion_value (ret_value);
+    ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
   }
 
   return ret_value;
-} /* ecma_builtin_array_prototype_object_sort_compare_helper */
+} /* ecma_builtin_array_prototype_object_sort_run_helper */
+
+/**
+ * Maximum number of pending runs of Array.prototype.sort
+ *
+ * Each pending run is more than twice longer than the run, following it, so lengths of 32 pending runs
+ * sum up to at least 2^32 - 1 elements; one more run is pushed before the invariant is restored.
+ */
+#define ECMA_BUILTIN_ARRAY_SORT_MAX_PENDING_RUNS (33)
 
 /**
- * Function used to reconstruct the ordered binary tree.
- * Shifts 'index' down in the tree until it is in the correct position.
+ * Merge two adjacent sorted ranges of elements
+ *
+ * The shorter range is moved to the buffer, so the buffer should have space
+ * for half of the elements of both ranges.
+ *
+ * Note:
+ *      if comparison fails, the elements are kept in some permutation of the initial order
  *
  * @return completion value
  *         Returned value must be freed with ecma_free_completion_value.
  */
 static ecma_completion_value_t
-ecma_builtin_array_prototype_object_array_to_heap_helper (ecma_value_t array[], /**< heap data array */
-                                                          int index, /**< current item index */
-                                                          int right, /**< right index is a maximum index */
-                                                          ecma_value_t comparefn) /**< compare function */
+ecma_builtin_array_prototype_object_sort_merge_helper (ecma_builtin_array_sort_entry_t *entries_p, /**< elements */
+                                                       uint32_t start, /**< start of the left range */
+                                                       uint32_t middle, /**< end of the left range
+                                                                         *   and start of the right range */
+                                                       uint32_t end, /**< end of the right range */
+                                                       ecma_builtin_array_sort_entry_t *buffer_p, /**< buffer for
+                                                                                                   *   the shorter
+                                                                                                   *   range */
+                                                       ecma_value_t comparefn) /**< compare function */
 {
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
-  /* Left child of the current index. */
-  int child = index * 2 + 1;
-  ecma_value_t swap = array[index];
-  bool should_break = false;
+  bool is_greater;
 
-  while (child <= right && ecma_is_completion_value_empty (ret_value) && !should_break)
+  /* ranges that are already in order (for example, parts of a natural run) are not moved */
+  ECMA_TRY_CATCH (compare_value,
+                  ecma_builtin_array_prototype_object_sort_compare_helper (&entries_p[middle - 1],
+                                                                           &entries_p[middle],
+                                                                           comparefn,
+                                                                           &is_greater),
+                  ret_value);
+
+  if (!is_greater)
+  {
+    ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  ECMA_FINALIZE (compare_value);
+
+  if (!ecma_is_completion_value_empty (ret_value))
+  {
+    return ret_value;
+  }
+
+  uint32_t left_num = middle - start;
+  uint32_t right_num = end - middle;
+
+  if (left_num <= right_num)
   {
-    if (child < right)
+    /* the left range is merged from the buffer, front to back; rest of the right range is already in place */
+    memcpy (buffer_p, entries_p + start, left_num * sizeof (ecma_builtin_array_sort_entry_t));
+
+    uint32_t left = 0, right = middle, dest = start;
+
+    while (left < left_num && right < end && ecma_is_completion_value_empty (ret_value))
     {
-      /* Compare the two child nodes. */
-      ECMA_TRY_CATCH (child_compare_value,
-                      ecma_builtin_array_prototype_object_sort_compare_helper (array[child],
-                                                                               array[child + 1],
-                                                                               comparefn),
+      ECMA_TRY_CATCH (compare_value,
+                      ecma_builtin_array_prototype_object_sort_compare_helper (&buffer_p[left],
+                                                                               &entries_p[right],
+                                                                               comparefn,
+                                                                               &is_greater),
                       ret_value);
 
-      JERRY_ASSERT (ecma_is_value_number (child_compare_value));
-
-      /* Use the child that is greater. */
-      if (*ecma_get_number_from_value (child_compare_value) < ECMA_NUMBER_ZERO)
+      /* elements of the left range are taken first among equal elements, so the sort is stable */
+      if (is_greater)
       {
-        child++;
+        entries_p[dest++] = entries_p[right++];
+      }
+      else
+      {
+        entries_p[dest++] = buffer_p[left++];
       }
 
-      ECMA_FINALIZE (child_compare_value);
+      ECMA_FINALIZE (compare_value);
     }
 
-    if (ecma_is_completion_value_empty (ret_value))
-    {
-      JERRY_ASSERT (child <= right);
+    memcpy (entries_p + dest, buffer_p + left, (left_num - left) * sizeof (ecma_builtin_array_sort_entry_t));
+  }
+  else
+  {
+    /* the right range is merged from the buffer, back to front; rest of the left range is already in place */
+    memcpy (buffer_p, entries_p + middle, right_num * sizeof (ecma_builtin_array_sort_entry_t));
 
-      /* Compare current child node with the swap (tree top). */
-      ECMA_TRY_CATCH (swap_compare_value,
-                      ecma_builtin_array_prototype_object_sort_compare_helper (array[child],
-                                                                               swap,
-                                                                               comparefn),
+    uint32_t left = middle, right = right_num, dest = end;
+
+    while (left > start && right > 0 && ecma_is_completion_value_empty (ret_value))
+    {
+      ECMA_TRY_CATCH (compare_value,
+                      ecma_builtin_array_prototype_object_sort_compare_helper (&entries_p[left - 1],
+                                                                               &buffer_p[right - 1],
+                                                                               comparefn,
+                                                                               &is_greater),
                       ret_value);
-      JERRY_ASSERT (ecma_is_value_number (swap_compare_value));
 
-      if (*ecma_get_number_from_value (swap_compare_value) <= ECMA_NUMBER_ZERO)
+      /* elements of the right range are taken first (from the back) among equal elements, so the sort is stable */
+      if (is_greater)
       {
-        /* Break from loop if current child is less than swap (tree top) */
-        should_break = true;
+        entries_p[--dest] = entries_p[--left];
       }
       else
       {
-        /* We have to move 'swap' lower in the tree, so shift current child up in the hierarchy. */
-        int parent = (child - 1) / 2;
-        JERRY_ASSERT (parent >= 0 && parent <= right);
-        array[parent] = array[child];
-
-        /* Update child to be the left child of the current node. */
-        child = child * 2 + 1;
+        entries_p[--dest] = buffer_p[--right];
       }
 
-      ECMA_FINALIZE (swap_compare_value);
+      ECMA_FINALIZE (compare_value);
     }
+
+    memcpy (entries_p + left, buffer_p, right * sizeof (ecma_builtin_array_sort_entry_t));
   }
 
   if (ecma_is_completion_value_empty (ret_value))
   {
-    /*
-     * Loop ended, either current child does not exist, or is less than swap.
-     * This means that 'swap' should be placed in the parent node.
-     */
-    int parent = (child - 1) / 2;
-    JERRY_ASSERT (parent >= 0 && parent <= right);
-    array[parent] = swap;
-
     ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
   }
 
   return ret_value;
-} /* ecma_builtin_array_prototype_object_array_to_heap_helper */
+} /* ecma_builtin_array_prototype_object_sort_merge_helper */
 
 /**
- * Heapsort function
+ * Stable sort of elements: natural runs (extended to minimum length with insertion sort) are merged
+ *
+ * Found runs are pushed to a stack of pending runs, and the two last pending runs are merged while the previous run
+ * is not more than twice longer than the last one. So merged runs are of similar lengths,
+ * and number of pending runs is logarithmic.
+ *
+ * Note:
+ *      if comparison fails, the elements are kept in some permutation of the initial order
  *
  * @return completion value
  *         Returned value must be freed with ecma_free_completion_value.
  */
 static ecma_completion_value_t
-ecma_builtin_array_prototype_object_array_heap_sort_helper (ecma_value_t array[], /**< array to sort */
-                                                            int right, /**< right index */
+ecma_builtin_array_prototype_object_sort_merge_sort_helper (ecma_builtin_array_sort_entry_t *entries_p, /**< elements */
+                                                            uint32_t entries_num, /**< number of elements */
                                                             ecma_value_t comparefn) /**< compare function */
 {
+  JERRY_ASSERT (entries_num > 1);
+
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
-  /* First, construct the ordered binary tree from the array. */
-  for (int i = right / 2; i >= 0 && ecma_is_completion_value_empty (ret_value); i--)
+  /* starts of pending runs; the last pending run ends at the start of unsorted part of the elements */
+  uint32_t run_starts[ECMA_BUILTIN_ARRAY_SORT_MAX_PENDING_RUNS];
+  uint32_t runs_num = 0;
+
+  /* a merge moves the shorter of two ranges to the buffer */
+  MEM_DEFINE_LOCAL_ARRAY (buffer_p, entries_num / 2, ecma_builtin_array_sort_entry_t);
+
+  for (uint32_t start = 0; start < entries_num && ecma_is_completion_value_empty (ret_value);)
   {
-    ECMA_TRY_CATCH (value,
-                    ecma_builtin_array_prototype_object_array_to_heap_helper (array,
-                                                                              i,
-                                                                              right,
-                                                                              comparefn),
+    uint32_t run_end = start;
+
+    ECMA_TRY_CATCH (run_value,
+                    ecma_builtin_array_prototype_object_sort_run_helper (entries_p,
+                                                                         start,
+                                                                         entries_num,
+                                                                         comparefn,
+                                                                         &run_end),
                     ret_value);
-    ECMA_FINALIZE (value);
+
+    if (run_end - start < ECMA_BUILTIN_ARRAY_SORT_MIN_RUN_LENGTH)
+    {
+      const uint32_t extended_run_end = JERRY_MIN (start + ECMA_BUILTIN_ARRAY_SORT_MIN_RUN_LENGTH, entries_num);
+
+      ECMA_TRY_CATCH (insertion_value,
+                      ecma_builtin_array_prototype_object_sort_insertion_helper (entries_p,
+                                                                                 start,
+                                                                                 run_end,
+                                                                                 extended_run_end,
+                                                                                 comparefn),
+                      ret_value);
+
+      run_end = extended_run_end;
+
+      ECMA_FINALIZE (insertion_value);
+    }
+
+    if (ecma_is_completion_value_empty (ret_value))
+    {
+      JERRY_ASSERT (runs_num < ECMA_BUILTIN_ARRAY_SORT_MAX_PENDING_RUNS);
+      run_starts[runs_num++] = start;
+      start = run_end;
+
+      /* all pending runs are merged after the last run is found */
+      while (runs_num > 1 && ecma_is_completion_value_empty (ret_value))
+      {
+        const uint32_t last_run_length = start - run_starts[runs_num - 1];
+        const uint32_t prev_run_length = run_starts[runs_num - 1] - run_starts[runs_num - 2];
+
+        if (start < entries_num && prev_run_length / 2 > last_run_length)
+        {
+          break;
+        }
+
+        ECMA_TRY_CATCH (merge_value,
+                        ecma_builtin_array_prototype_object_sort_merge_helper (entries_p,
+                                                                               run_starts[runs_num - 2],
+                                                                               run_starts[runs_num - 1],
+                                                                               start,
+                                                                               buffer_p,
+                                                                               comparefn),
+                        ret_value);
+
+        runs_num--;
+
+        ECMA_FINALIZE (merge_value);
+      }
+    }
+
+    ECMA_FINALIZE (run_value);
   }
 
-  /* Sorting elements. */
-  for (int i = right; i > 0 && ecma_is_completion_value_empty (ret_value); i--)
+  MEM_FINALIZE_LOCAL_ARRAY (buffer_p);
+
+  if (ecma_is_completion_value_empty (ret_value))
   {
-    /*
-     * The top element will always contain the largest value.
-     * Move top to the end, and remove it from the tree.
-     */
-    ecma_value_t swap = array[0];
-    array[0] = array[i];
-    array[i] = swap;
-
-    /* Rebuild binary tree from the remaining elements. */
-    ECMA_TRY_CATCH (value,
-                    ecma_builtin_array_prototype_object_array_to_heap_helper (array,
-                                                                              0,
-                                                                              i - 1,
-                                                                              comparefn),
-                    ret_value);
-    ECMA_FINALIZE (value);
+    ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
   }
 
   return ret_value;
-} /* ecma_builtin_array_prototype_object_array_heap_sort_helper */
+} /* ecma_builtin_array_prototype_object_sort_merge_sort_helper */
 
 /**
  * The Array.prototype object's 'sort' routine
@@ -1388,53 +1659,119 @@ ecma_builtin_array_prototype_object_sort (ecma_value_t this_arg, /**< this argum
 
   uint32_t len = ecma_number_to_uint32 (len_number);
 
-  MEM_DEFINE_LOCAL_ARRAY (values_buffer, len, ecma_value_t);
-  uint32_t copied_num = 0;
+  MEM_DEFINE_LOCAL_ARRAY (entries_p, len, ecma_builtin_array_sort_entry_t);
+  uint32_t defined_num = 0;
+  uint32_t undefined_num = 0;
+
+  /*
+   * Default comparison of uint32 numbers is performed without conversion to strings,
+   * if all defined values are such numbers.
+   */
+  bool are_keys_values = true;
 
-  /* Copy unsorted array into a native c array. */
+  /*
+   * Copy defined values into a native c array.
+   *
+   * Undefined values and non-existent properties are just counted, as they are put at the end of the result.
+   */
   for (uint32_t index = 0; index < len && ecma_is_completion_value_empty (ret_value); index++)
   {
     ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
-    ECMA_TRY_CATCH (index_value, ecma_op_object_get (obj_p, index_string_p), ret_value);
 
-    values_buffer[index] = ecma_copy_value (index_value, true);
-    copied_num++;
+    if (ecma_op_object_get_property (obj_p, index_string_p) != NULL)
+    {
+      ECMA_TRY_CATCH (index_value, ecma_op_object_get (obj_p, index_string_p), ret_value);
+
+      if (ecma_is_value_undefined (index_value))
+      {
+        undefined_num++;
+      }
+      else
+      {
+        entries_p[defined_num].value = ecma_copy_value (index_value, true);
+        entries_p[defined_num].key = entries_p[defined_num].value;
+
+        if (!ecma_builtin_array_prototype_object_sort_is_uint32_number (index_value))
+        {
+          are_keys_values = false;
+        }
+
+        defined_num++;
+      }
+
+      ECMA_FINALIZE (index_value);
+    }
 
-    ECMA_FINALIZE (index_value);
     ecma_deref_ecma_string (index_string_p);
   }
 
-  JERRY_ASSERT (copied_num == len || !ecma_is_completion_value_empty (ret_value));
+  /* Default comparison is performed on string representations, which are computed once for each value. */
+  uint32_t string_keys_num = 0;
+
+  if (ecma_is_value_undefined (arg1) && !are_keys_values)
+  {
+    for (uint32_t index = 0; index < defined_num && ecma_is_completion_value_empty (ret_value); index++)
+    {
+      ECMA_TRY_CATCH (key_value, ecma_op_to_string (entries_p[index].value), ret_value);
+
+      entries_p[index].key = ecma_copy_value (key_value, true);
+      string_keys_num++;
+
+      ECMA_FINALIZE (key_value);
+    }
+  }
 
   /* Sorting. */
-  if (len > 1 && ecma_is_completion_value_empty (ret_value))
+  if (defined_num > 1 && ecma_is_completion_value_empty (ret_value))
   {
     ECMA_TRY_CATCH (sort_value,
-                    ecma_builtin_array_prototype_object_array_heap_sort_helper (values_buffer,
-                                                                                (int)(len - 1),
+                    ecma_builtin_array_prototype_object_sort_merge_sort_helper (entries_p,
+                                                                                defined_num,
                                                                                 arg1),
                     ret_value);
     ECMA_FINALIZE (sort_value);
   }
 
+  /* Put the sorted values back, followed by undefined values, and delete rest of the properties. */
+  for (uint32_t index = 0; index < len && ecma_is_completion_value_empty (ret_value); index++)
+  {
+    ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+
+    if (index < defined_num + undefined_num)
+    {
+      ecma_value_t value = ((index < defined_num) ? entries_p[index].value
+                                                  : ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+
+      ECMA_TRY_CATCH (put_value, ecma_op_object_put (obj_p, index_string_p, value, true), ret_value);
+      ECMA_FINALIZE (put_value);
+    }
+    else
+    {
+      ECMA_TRY_CATCH (del_value, ecma_op_object_delete (obj_p, index_string_p, true), ret_value);
+      ECMA_FINALIZE (del_value);
+    }
+
+    ecma_deref_ecma_string (index_string_p);
+  }
+
   if (ecma_is_completion_value_empty (ret_value))
   {
-    /*
-     * FIXME: Casting len to ecma_length_t may overflow, but since ecma_length_t is still at least
-     * 16 bits long, with an array of that size, we would run out of memory way before this happens.
-     */
-    JERRY_ASSERT ((ecma_length_t) len == len);
-    /* Copy the sorted array into a new array. */
-    ret_value = ecma_op_create_array_object (values_buffer, (ecma_length_t) len, false);
+    ret_value = ecma_make_normal_completion_value (ecma_copy_value (obj_this, true));
+  }
+
+  /* Free values and keys that were copied to the local array. */
+  for (uint32_t index = 0; index < defined_num; index++)
+  {
+    ecma_free_value (entries_p[index].value, true);
   }
 
-  /* Free values that were copied to the local array. */
-  for (uint32_t index = 0; index < copied_num; index++)
+  /* If not all keys were computed, the values were not sorted, so the computed keys are at their initial places. */
+  for (uint32_t index = 0; index < string_keys_num; index++)
   {
-    ecma_free_value (values_buffer[index], true);
+    ecma_free_value (entries_p[index].key, true);
   }
 
-  MEM_FINALIZE_LOCAL_ARRAY (values_buffer);
+  MEM_FINALIZE_LOCAL_ARRAY (entries_p);
 
   ECMA_OP_TO_NUMBER_FINALIZE (len_number);
   ECMA_FINALIZE (len_value);
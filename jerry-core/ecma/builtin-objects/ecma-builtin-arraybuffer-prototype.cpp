@@ -0,0 +1,112 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-arraybuffer-object.h"
+#include "ecma-builtin-helpers.h"
+#include "ecma-builtins.h"
+#include "ecma-conversion.h"
+#include "ecma-exceptions.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-try-catch-macro.h"
+#include "jrt.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-arraybuffer-prototype.inc.h"
+#define BUILTIN_UNDERSCORED_ID array_buffer_prototype
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup arraybufferprototype ECMA ArrayBuffer.prototype object built-in
+ * @{
+ */
+
+/**
+ * The ArrayBuffer.prototype object's 'slice' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.1.4.3
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_array_buffer_prototype_object_slice (ecma_value_t this_arg, /**< 'this' argument */
+                                                  ecma_value_t arg1, /**< start */
+                                                  ecma_value_t arg2) /**< end */
+{
+  if (!ecma_op_is_array_buffer (this_arg))
+  {
+    return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_TYPE));
+  }
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ecma_object_t *obj_p = ecma_get_object_from_value (this_arg);
+  const uint32_t len = ecma_op_array_buffer_get_byte_length (obj_p);
+
+  uint32_t start = 0, end = len;
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (start_num, arg1, ret_value);
+
+  start = ecma_builtin_helper_array_index_normalize (start_num, len);
+
+  if (!ecma_is_value_undefined (arg2))
+  {
+    ECMA_OP_TO_NUMBER_TRY_CATCH (end_num, arg2, ret_value);
+
+    end = ecma_builtin_helper_array_index_normalize (end_num, len);
+
+    ECMA_OP_TO_NUMBER_FINALIZE (end_num);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (start_num);
+
+  if (ecma_is_completion_value_empty (ret_value))
+  {
+    JERRY_ASSERT (start <= len && end <= len);
+
+    const uint32_t new_len = (end > start) ? end - start : 0;
+    ecma_object_t *new_buffer_p = ecma_op_create_array_buffer_object (new_len);
+
+    if (new_len != 0)
+    {
+      memcpy (ecma_op_array_buffer_get_data (new_buffer_p), ecma_op_array_buffer_get_data (obj_p) + start, new_len);
+    }
+
+    ret_value = ecma_make_normal_completion_value (ecma_make_object_value (new_buffer_p));
+  }
+
+  return ret_value;
+} /* ecma_builtin_array_buffer_prototype_object_slice */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
@@ -0,0 +1,81 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-builtins.h"
+#include "ecma-exceptions.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-typedarray-object.h"
+#include "jrt.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-float64array.inc.h"
+#define BUILTIN_UNDERSCORED_ID float64_array
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup float64array ECMA Float64Array object built-in
+ * @{
+ */
+
+/**
+ * Handle calling [[Call]] of built-in Float64Array object
+ *
+ * Note:
+ *      the constructor can't be called as a function (ECMA-262 v6, 22.2.4.5)
+ *
+ * @return completion-value
+ */
+ecma_completion_value_t
+ecma_builtin_float64_array_dispatch_call (const ecma_value_t *arguments_list_p, /**< arguments list */
+                                          ecma_length_t arguments_list_len) /**< number of arguments */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+
+  return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_TYPE));
+} /* ecma_builtin_float64_array_dispatch_call */
+
+/**
+ * Handle calling [[Construct]] of built-in Float64Array object
+ *
+ * @return completion-value
+ */
+ecma_completion_value_t
+ecma_builtin_float64_array_dispatch_construct (const ecma_value_t *arguments_list_p, /**< arguments list */
+                                               ecma_length_t arguments_list_len) /**< number of arguments */
+{
+  return ecma_op_create_typed_array_object_from_arguments (ECMA_TYPED_ARRAY_FLOAT64,
+                                                           arguments_list_p,
+                                                           arguments_list_len);
+} /* ecma_builtin_float64_array_dispatch_construct */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
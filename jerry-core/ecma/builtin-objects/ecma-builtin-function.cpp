@@ -135,7 +135,7 @@ ecma_builtin_function_dispatch_construct (const ecma_value_t *arguments_list_p,
       utf8_string_buffer_pos += sz;
     }
 
-    const opcode_t* opcodes_p;
+    const opcode_compact_t* opcodes_p;
     bool is_syntax_correct;
 
     is_syntax_correct = parser_parse_new_function ((const jerry_api_char_t **) utf8_string_params_p,
@@ -193,6 +193,78 @@ OBJECT_VALUE (LIT_MAGIC_STRING_URI_ERROR_UL,
               ECMA_PROPERTY_CONFIGURABLE)
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ERROR_BUILTINS */
 
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+// ECMA-262 v6, 24.1.2
+OBJECT_VALUE (LIT_MAGIC_STRING_ARRAY_BUFFER_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_ARRAY_BUFFER),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_INT8_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_INT8_ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_UINT8_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_UINT8_ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_UINT8_CLAMPED_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_UINT8_CLAMPED_ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_INT16_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_INT16_ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_UINT16_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_UINT16_ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_INT32_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_INT32_ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_UINT32_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_UINT32_ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_FLOAT32_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_FLOAT32_ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.4
+OBJECT_VALUE (LIT_MAGIC_STRING_FLOAT64_ARRAY_UL,
+              ecma_builtin_get (ECMA_BUILTIN_ID_FLOAT64_ARRAY),
+              ECMA_PROPERTY_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_CONFIGURABLE)
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_MATH_BUILTIN
 // ECMA-262 v5, 15.1.5.1
 OBJECT_VALUE (LIT_MAGIC_STRING_MATH_UL,
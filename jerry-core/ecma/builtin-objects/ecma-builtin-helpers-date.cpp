@@ -154,6 +154,63 @@ ecma_date_time_from_year (ecma_number_t year) /**< year value */
   return ECMA_DATE_MS_PER_DAY * (ecma_number_t) ecma_date_day_from_year (year);
 } /* ecma_date_time_from_year */
 
+/**
+ * Cache of the last day number split into civil date fields.
+ *
+ * Date getters usually query several fields of the same time value in a row,
+ * so the last decomposition is kept to answer the subsequent queries.
+ */
+static struct
+{
+  bool is_valid; /**< whether the cache holds a decomposed day */
+  int day; /**< day number */
+  int year; /**< year of the day */
+  int month; /**< month of the day (0 - 11) */
+  int date; /**< date of the day (1 - 31) */
+} ecma_date_split_day_cache = { false, 0, 0, 0, 0 };
+
+/**
+ * Helper function to split day number into year, month and date values.
+ *
+ * The conversion uses closed-form arithmetic on 400-year eras of
+ * the proleptic Gregorian calendar with years starting from March,
+ * so it runs in constant time for any day number.
+ */
+static void
+ecma_date_split_day (int day, /**< day number */
+                     int *out_year_p, /**< out: year value */
+                     int *out_month_p, /**< out: month value (0 - 11) */
+                     int *out_date_p) /**< out: date value (1 - 31) */
+{
+  if (!ecma_date_split_day_cache.is_valid
+      || ecma_date_split_day_cache.day != day)
+  {
+    /* Days from 0000-03-01 to 1970-01-01. */
+    const int days_shift = 719468;
+    /* Days in a 400-year era. */
+    const int days_per_era = 146097;
+
+    int days = day + days_shift;
+    int era = (days >= 0 ? days : days - (days_per_era - 1)) / days_per_era;
+    int day_of_era = days - era * days_per_era;
+    int year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    int day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    int month_from_march = (5 * day_of_year + 2) / 153;
+
+    int month = (month_from_march < 10) ? month_from_march + 2 : month_from_march - 10;
+
+    ecma_date_split_day_cache.day = day;
+    ecma_date_split_day_cache.year = year_of_era + era * 400 + (month <= 1 ? 1 : 0);
+    ecma_date_split_day_cache.month = month;
+    ecma_date_split_day_cache.date = day_of_year - (153 * month_from_march + 2) / 5 + 1;
+    ecma_date_split_day_cache.is_valid = true;
+  }
+
+  *out_year_p = ecma_date_split_day_cache.year;
+  *out_month_p = ecma_date_split_day_cache.month;
+  *out_date_p = ecma_date_split_day_cache.date;
+} /* ecma_date_split_day */
+
 /**
  * Helper function to determine a year value from the time value.
  *
@@ -169,19 +226,8 @@ ecma_date_year_from_time (ecma_number_t time) /**< time value */
 {
   JERRY_ASSERT (!ecma_number_is_nan (time));
 
-  /* ECMA-262 v5, 15.9.1.1 define the largest year that is
-   * representable (285616) forward from 01 January, 1970 UTC.
-   */
-  int year = 285616 + 1970;
-
-  while (ecma_date_time_from_year ((ecma_number_t) year) > time)
-  {
-    if (ecma_date_time_from_year ((ecma_number_t) (year / 2)) > time)
-    {
-      year = year / 2;
-    }
-    year--;
-  }
+  int year, month, date;
+  ecma_date_split_day (ecma_date_day (time), &year, &month, &date);
 
   return year;
 } /* ecma_date_year_from_time */
@@ -200,7 +246,7 @@ int __attr_always_inline___
 ecma_date_in_leap_year (ecma_number_t time) /**< time value */
 {
   JERRY_ASSERT (!ecma_number_is_nan (time));
-  return ecma_date_days_in_year (ecma_date_time_from_year (time)) - 365;
+  return ecma_date_days_in_year ((ecma_number_t) ecma_date_year_from_time (time)) - 365;
 } /* ecma_date_in_leap_year */
 
 /**
@@ -235,57 +281,10 @@ ecma_date_month_from_time (ecma_number_t time) /**< time value */
 {
   JERRY_ASSERT (!ecma_number_is_nan (time));
 
-  int in_leap_year = ecma_date_in_leap_year (time);
-  int day_within_year = ecma_date_day_within_year (time);
+  int year, month, date;
+  ecma_date_split_day (ecma_date_day (time), &year, &month, &date);
 
-  JERRY_ASSERT (day_within_year >= 0 && day_within_year < 365 + in_leap_year);
-
-  if (day_within_year < 31)
-  {
-    return 0;
-  }
-  else if (day_within_year < 59 + in_leap_year)
-  {
-    return 1;
-  }
-  else if (day_within_year < 90 + in_leap_year)
-  {
-    return 2;
-  }
-  else if (day_within_year < 120 + in_leap_year)
-  {
-    return 3;
-  }
-  else if (day_within_year < 151 + in_leap_year)
-  {
-    return 4;
-  }
-  else if (day_within_year < 181 + in_leap_year)
-  {
-    return 5;
-  }
-  else if (day_within_year < 212 + in_leap_year)
-  {
-    return 6;
-  }
-  else if (day_within_year < 243 + in_leap_year)
-  {
-    return 7;
-  }
-  else if (day_within_year < 273 + in_leap_year)
-  {
-    return 8;
-  }
-  else if (day_within_year < 304 + in_leap_year)
-  {
-    return 9;
-  }
-  else if (day_within_year < 334 + in_leap_year)
-  {
-    return 10;
-  }
-
-  return 11;
+  return month;
 } /* ecma_date_month_from_time */
 
 /**
@@ -303,63 +302,10 @@ ecma_date_date_from_time (ecma_number_t time) /**< time value */
 {
   JERRY_ASSERT (!ecma_number_is_nan (time));
 
-  int in_leap_year = ecma_date_in_leap_year (time);
-  int day_within_year = ecma_date_day_within_year (time);
-
-  switch (ecma_date_month_from_time (time))
-  {
-    case 0:
-    {
-      return day_within_year + 1;
-    }
-    case 1:
-    {
-      return day_within_year - 30 ;
-    }
-    case 2:
-    {
-      return day_within_year - 58 - in_leap_year;
-    }
-    case 3:
-    {
-      return day_within_year - 89 - in_leap_year;
-    }
-    case 4:
-    {
-      return day_within_year - 119 - in_leap_year;
-    }
-    case 5:
-    {
-      return day_within_year - 150 - in_leap_year;
-    }
-    case 6:
-    {
-      return day_within_year - 180 - in_leap_year;
-    }
-    case 7:
-    {
-      return day_within_year - 211 - in_leap_year;
-    }
-    case 8:
-    {
-      return day_within_year - 242 - in_leap_year;
-    }
-    case 9:
-    {
-      return day_within_year - 272 - in_leap_year;
-    }
-    case 10:
-    {
-      return day_within_year - 303 - in_leap_year;
-    }
-    case 11:
-    {
-      return day_within_year - 333 - in_leap_year;
-    }
-  }
+  int year, month, date;
+  ecma_date_split_day (ecma_date_day (time), &year, &month, &date);
 
-  JERRY_UNREACHABLE ();
-  return 0;
+  return date;
 } /* ecma_date_date_from_time */
 
 /**
@@ -584,24 +530,36 @@ ecma_date_make_day (ecma_number_t year, /**< year value */
     return ecma_number_make_nan ();
   }
 
+  /* Number of days before the first day of each month in a non-leap year. */
+  static const int days_before_month[] = { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+
   ecma_number_t y = ecma_number_trunc (year);
   ecma_number_t m = ecma_number_trunc (month);
   ecma_number_t dt = ecma_number_trunc (date);
   ecma_number_t ym = y + (ecma_number_t) floor (m / 12);
   ecma_number_t mn = (ecma_number_t) fmod (m, 12);
-  ecma_number_t time = ecma_date_time_from_year (ym);
-
-  JERRY_ASSERT (ecma_date_year_from_time (time) == ym);
 
-  while (ecma_date_month_from_time (time) < mn)
+  if (mn < 0)
   {
-    time += ECMA_DATE_MS_PER_DAY;
+    mn += 12;
   }
 
-  JERRY_ASSERT (ecma_date_month_from_time (time) == mn);
-  JERRY_ASSERT (ecma_date_date_from_time (time) == 1);
+  int month_index = (int) mn;
+  JERRY_ASSERT (month_index >= 0 && month_index < 12);
+
+  /* Computed with ecma_number_t arithmetic, as ym is not limited to the range of int. */
+  ecma_number_t day = (365 * (ym - 1970)
+                       + (ecma_number_t) floor ((ym - 1969) / 4)
+                       - (ecma_number_t) floor ((ym - 1901) / 100)
+                       + (ecma_number_t) floor ((ym - 1601) / 400)
+                       + (ecma_number_t) days_before_month[month_index]);
+
+  if (month_index > 1)
+  {
+    day += (ecma_number_t) (ecma_date_days_in_year (ym) - 365);
+  }
 
-  return (ecma_number_t) ecma_date_day (time) + dt - ((ecma_number_t) 1.0);
+  return day + dt - ((ecma_number_t) 1.0);
 } /* ecma_date_make_day */
 
 /**
@@ -81,9 +81,10 @@ ecma_builtin_helper_object_to_string (const ecma_value_t this_arg) /**< this arg
   ecma_string_t *ret_string_p;
 
   /* Building string "[object #type#]" where type is 'Undefined',
-     'Null' or one of possible object's classes.
-     The string with null character is maximum 19 characters long. */
-  const ssize_t buffer_size = 19;
+     'Null' or one of possible object's classes. */
+  const ssize_t buffer_size = (ssize_t) (lit_get_magic_string_size (LIT_MAGIC_STRING_OBJECT)
+                                         + lit_get_magic_string_size (type_string)
+                                         + 3u);
   MEM_DEFINE_LOCAL_ARRAY (str_buffer, buffer_size, lit_utf8_byte_t);
 
   lit_utf8_byte_t *buffer_ptr = str_buffer;
@@ -25,8 +25,6 @@
 #define PASTE_(x, y) PASTE__ (x, y)
 #define PASTE(x, y) PASTE_ (x, y)
 
-#define SORT_PROPERTY_NAMES_ROUTINE_NAME(builtin_underscored_id) \
-  PASTE (PASTE (ecma_builtin_, builtin_underscored_id), _sort_property_names)
 #define TRY_TO_INSTANTIATE_PROPERTY_ROUTINE_NAME(builtin_underscored_id) \
   PASTE (PASTE (ecma_builtin_, builtin_underscored_id), _try_to_instantiate_property)
 #define DISPATCH_ROUTINE_ROUTINE_NAME(builtin_underscored_id) \
@@ -49,45 +47,61 @@
 #undef ROUTINE_ARG_LIST_0
 #undef ROUTINE_ARG
 
-static lit_magic_string_id_t ecma_builtin_property_names[] =
+#define PROPERTY_INDEX(name) PASTE (ECMA_BUILTIN_PROPERTY_INDEX_, name)
+
+/**
+ * Indices of the built-in's properties in the bit mask of instantiated properties
+ */
+enum
 {
-#define SIMPLE_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) name,
-#define NUMBER_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) name,
-#define STRING_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) name,
-#define CP_UNIMPLEMENTED_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) name,
-#define OBJECT_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) name,
-#define ROUTINE(name, c_function_name, args_number, length_prop_value) name,
+#define SIMPLE_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) PROPERTY_INDEX (name),
+#define NUMBER_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) PROPERTY_INDEX (name),
+#define STRING_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) PROPERTY_INDEX (name),
+#define CP_UNIMPLEMENTED_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) \
+  PROPERTY_INDEX (name),
+#define OBJECT_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) PROPERTY_INDEX (name),
+#define ROUTINE(name, c_function_name, args_number, length_prop_value) PROPERTY_INDEX (name),
 #include BUILTIN_INC_HEADER_NAME
+  ECMA_BUILTIN_PROPERTY_INDEX__COUNT /**< number of the built-in's properties */
 };
 
+JERRY_STATIC_ASSERT (ECMA_BUILTIN_PROPERTY_INDEX__COUNT <= sizeof (uint64_t) * JERRY_BITSINBYTE);
+
 /**
- * Sort builtin's property names array
+ * Get index of the built-in's property with specified name
+ *
+ * Note:
+ *      the mapping is resolved at compile time (the switch is compiled into a jump table or a decision tree),
+ *      so no run-time sorting or searching over a table of property names is performed.
+ *
+ * @return index of the property, if the built-in has property with specified name,
+ *         -1 - otherwise.
  */
-void
-SORT_PROPERTY_NAMES_ROUTINE_NAME (BUILTIN_UNDERSCORED_ID) (void)
+static int32_t
+ecma_builtin_get_property_index (lit_magic_string_id_t id) /**< property name */
 {
-  bool swapped;
-
-  do
+  switch (id)
   {
-    swapped = false;
+#define SIMPLE_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) \
+    case name: return PROPERTY_INDEX (name);
+#define NUMBER_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) \
+    case name: return PROPERTY_INDEX (name);
+#define STRING_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) \
+    case name: return PROPERTY_INDEX (name);
+#define CP_UNIMPLEMENTED_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) \
+    case name: return PROPERTY_INDEX (name);
+#define OBJECT_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable) \
+    case name: return PROPERTY_INDEX (name);
+#define ROUTINE(name, c_function_name, args_number, length_prop_value) \
+    case name: return PROPERTY_INDEX (name);
+#include BUILTIN_INC_HEADER_NAME
 
-    for (ecma_length_t i = 1;
-         i < (sizeof (ecma_builtin_property_names) / sizeof (ecma_builtin_property_names[0]));
-         i++)
+    default:
     {
-      if (ecma_builtin_property_names[i] < ecma_builtin_property_names[i - 1])
-      {
-        lit_magic_string_id_t id_temp = ecma_builtin_property_names[i - 1];
-        ecma_builtin_property_names[i - 1] = ecma_builtin_property_names[i];
-        ecma_builtin_property_names[i] = id_temp;
-
-        swapped = true;
-      }
+      return -1;
     }
   }
-  while (swapped);
-} /* SORT_PROPERTY_NAMES_ROUTINE_NAME */
+} /* ecma_builtin_get_property_index */
 
 /**
  * If the property's name is one of built-in properties of the built-in object
@@ -114,12 +128,7 @@ TRY_TO_INSTANTIATE_PROPERTY_ROUTINE_NAME (BUILTIN_UNDERSCORED_ID) (ecma_object_t
     return NULL;
   }
 
-  const ecma_length_t property_numbers = (ecma_length_t) (sizeof (ecma_builtin_property_names) /
-                                                          sizeof (ecma_builtin_property_names[0]));
-  int32_t index;
-  index = ecma_builtin_bin_search_for_magic_string_id_in_array (ecma_builtin_property_names,
-                                                                property_numbers,
-                                                                id);
+  int32_t index = ecma_builtin_get_property_index (id);
 
   if (index == -1)
   {
@@ -320,7 +329,7 @@ DISPATCH_ROUTINE_ROUTINE_NAME (BUILTIN_UNDERSCORED_ID) (uint16_t builtin_routine
 #undef PASTE__
 #undef PASTE_
 #undef PASTE
-#undef SORT_PROPERTY_NAMES_ROUTINE_NAME
+#undef PROPERTY_INDEX
 #undef DISPATCH_ROUTINE_ROUTINE_NAME
 #undef TRY_TO_INSTANTIATE_PROPERTY_ROUTINE_NAME
 #undef BUILTIN_UNDERSCORED_ID
@@ -112,7 +112,55 @@ static ecma_completion_value_t
 ecma_builtin_string_prototype_object_char_at (ecma_value_t this_arg, /**< this argument */
                                               ecma_value_t arg) /**< routine's argument */
 {
-  ECMA_BUILTIN_CP_UNIMPLEMENTED (this_arg, arg);
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  /* 1. */
+  ECMA_TRY_CATCH (check_coercible_val,
+                  ecma_op_check_object_coercible (this_arg),
+                  ret_value);
+
+  /* 2. */
+  ECMA_TRY_CATCH (to_string_val,
+                  ecma_op_to_string (this_arg),
+                  ret_value);
+
+  /* 3. */
+  ECMA_OP_TO_NUMBER_TRY_CATCH (index_num,
+                               arg,
+                               ret_value);
+
+  ecma_string_t *original_string_p = ecma_get_string_from_value (to_string_val);
+
+  /* 4. */
+  const ecma_length_t len = ecma_string_get_length (original_string_p);
+
+  /* 5. (ToInteger truncates positions in (-1, 0) to zero, and NaN is converted to zero) */
+  if (ecma_number_is_nan (index_num))
+  {
+    index_num = ECMA_NUMBER_ZERO;
+  }
+
+  ecma_string_t *ret_string_p;
+
+  if (index_num <= -ECMA_NUMBER_ONE || index_num >= (ecma_number_t) len)
+  {
+    ret_string_p = ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY);
+  }
+  else
+  {
+    /* 6. */
+    const ecma_char_t char_at = ecma_string_get_char_at_pos (original_string_p, (ecma_length_t) index_num);
+
+    ret_string_p = ecma_new_ecma_string_from_code_unit (char_at);
+  }
+
+  ret_value = ecma_make_normal_completion_value (ecma_make_string_value (ret_string_p));
+
+  ECMA_OP_TO_NUMBER_FINALIZE (index_num);
+  ECMA_FINALIZE (to_string_val);
+  ECMA_FINALIZE (check_coercible_val);
+
+  return ret_value;
 } /* ecma_builtin_string_prototype_object_char_at */
 
 /**
@@ -128,7 +176,55 @@ static ecma_completion_value_t
 ecma_builtin_string_prototype_object_char_code_at (ecma_value_t this_arg, /**< this argument */
                                                    ecma_value_t arg) /**< routine's argument */
 {
-  ECMA_BUILTIN_CP_UNIMPLEMENTED (this_arg, arg);
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  /* 1. */
+  ECMA_TRY_CATCH (check_coercible_val,
+                  ecma_op_check_object_coercible (this_arg),
+                  ret_value);
+
+  /* 2. */
+  ECMA_TRY_CATCH (to_string_val,
+                  ecma_op_to_string (this_arg),
+                  ret_value);
+
+  /* 3. */
+  ECMA_OP_TO_NUMBER_TRY_CATCH (index_num,
+                               arg,
+                               ret_value);
+
+  ecma_string_t *original_string_p = ecma_get_string_from_value (to_string_val);
+
+  /* 4. */
+  const ecma_length_t len = ecma_string_get_length (original_string_p);
+
+  /* 5. (ToInteger truncates positions in (-1, 0) to zero, and NaN is converted to zero) */
+  if (ecma_number_is_nan (index_num))
+  {
+    index_num = ECMA_NUMBER_ZERO;
+  }
+
+  ecma_number_t *ret_num_p = ecma_alloc_number ();
+
+  if (index_num <= -ECMA_NUMBER_ONE || index_num >= (ecma_number_t) len)
+  {
+    *ret_num_p = ecma_number_make_nan ();
+  }
+  else
+  {
+    /* 6. */
+    const ecma_char_t char_at = ecma_string_get_char_at_pos (original_string_p, (ecma_length_t) index_num);
+
+    *ret_num_p = ((ecma_number_t) char_at);
+  }
+
+  ret_value = ecma_make_normal_completion_value (ecma_make_number_value (ret_num_p));
+
+  ECMA_OP_TO_NUMBER_FINALIZE (index_num);
+  ECMA_FINALIZE (to_string_val);
+  ECMA_FINALIZE (check_coercible_val);
+
+  return ret_value;
 } /* ecma_builtin_string_prototype_object_char_code_at */
 
 /**
@@ -199,6 +295,162 @@ ecma_builtin_string_prototype_object_concat (ecma_value_t this_arg, /**< this ar
   return ret_value;
 } /* ecma_builtin_string_prototype_object_concat */
 
+/**
+ * Helper for the String.prototype object's 'indexOf' and 'lastIndexOf' routines
+ *
+ * See also:
+ *          ECMA-262 v5, 15.5.4.7
+ *          ECMA-262 v5, 15.5.4.8
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_string_prototype_object_index_of_helper (ecma_value_t this_arg, /**< this argument */
+                                                      ecma_value_t arg1, /**< searchString */
+                                                      ecma_value_t arg2, /**< position */
+                                                      bool is_last_index_of) /**< true - 'lastIndexOf' routine,
+                                                                              *   false - 'indexOf' routine */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  /* 1. */
+  ECMA_TRY_CATCH (check_coercible_val,
+                  ecma_op_check_object_coercible (this_arg),
+                  ret_value);
+
+  /* 2. */
+  ECMA_TRY_CATCH (to_string_val,
+                  ecma_op_to_string (this_arg),
+                  ret_value);
+
+  /* 3. */
+  ECMA_TRY_CATCH (search_string_val,
+                  ecma_op_to_string (arg1),
+                  ret_value);
+
+  /* 4. */
+  ECMA_OP_TO_NUMBER_TRY_CATCH (pos_num,
+                               arg2,
+                               ret_value);
+
+  ecma_string_t *original_string_p = ecma_get_string_from_value (to_string_val);
+  ecma_string_t *search_string_p = ecma_get_string_from_value (search_string_val);
+
+  const ecma_length_t original_len = ecma_string_get_length (original_string_p);
+  const lit_utf8_size_t original_size = ecma_string_get_size (original_string_p);
+  const lit_utf8_size_t search_size = ecma_string_get_size (search_string_p);
+
+  /* 5. - 6. (lastIndexOf treats NaN position as +Infinity) */
+  ecma_length_t start;
+
+  if (ecma_number_is_nan (pos_num))
+  {
+    start = is_last_index_of ? original_len : 0;
+  }
+  else if (pos_num <= ECMA_NUMBER_ZERO)
+  {
+    start = 0;
+  }
+  else if (pos_num >= (ecma_number_t) original_len)
+  {
+    start = original_len;
+  }
+  else
+  {
+    start = (ecma_length_t) pos_num;
+  }
+
+  ecma_number_t *ret_num_p = ecma_alloc_number ();
+  *ret_num_p = ecma_int32_to_number (-1);
+
+  /* 7. */
+  if (search_size == 0)
+  {
+    *ret_num_p = ((ecma_number_t) start);
+  }
+  else if (search_size <= original_size)
+  {
+    /* contiguous characters are searched in place, and other strings are copied to local buffers */
+    lit_utf8_size_t contiguous_size;
+    const lit_utf8_byte_t *original_utf8_p = ecma_string_get_contiguous_chars (original_string_p, &contiguous_size);
+    const lit_utf8_byte_t *search_utf8_p = ecma_string_get_contiguous_chars (search_string_p, &contiguous_size);
+
+    MEM_DEFINE_LOCAL_ARRAY (original_buffer_p, (original_utf8_p == NULL) ? original_size : 0, lit_utf8_byte_t);
+    MEM_DEFINE_LOCAL_ARRAY (search_buffer_p, (search_utf8_p == NULL) ? search_size : 0, lit_utf8_byte_t);
+
+    if (original_utf8_p == NULL)
+    {
+      ecma_string_to_utf8_string (original_string_p, original_buffer_p, (ssize_t) original_size);
+      original_utf8_p = original_buffer_p;
+    }
+
+    if (search_utf8_p == NULL)
+    {
+      ecma_string_to_utf8_string (search_string_p, search_buffer_p, (ssize_t) search_size);
+      search_utf8_p = search_buffer_p;
+    }
+
+    /* strings of one-byte characters are addressed by code unit positions directly */
+    const bool is_ascii = (original_size == original_len);
+
+    bool is_found;
+    lit_utf8_size_t found_offset;
+
+    if (!is_last_index_of)
+    {
+      const lit_utf8_size_t start_offset = (is_ascii ? start
+                                                     : lit_utf8_string_offset_of_code_unit (original_utf8_p,
+                                                                                            original_size,
+                                                                                            start));
+
+      is_found = lit_utf8_string_find (original_utf8_p,
+                                       original_size,
+                                       search_utf8_p,
+                                       search_size,
+                                       start_offset,
+                                       &found_offset);
+    }
+    else
+    {
+      /* occurrences should start at a character, that starts not after the code unit at 'start' position */
+      const lit_utf8_size_t end_offset = (is_ascii ? JERRY_MIN (start + 1, original_size)
+                                                   : lit_utf8_string_offset_of_code_unit (original_utf8_p,
+                                                                                          original_size,
+                                                                                          start + 1));
+
+      JERRY_ASSERT (end_offset > 0);
+
+      is_found = lit_utf8_string_find_last (original_utf8_p,
+                                            original_size,
+                                            search_utf8_p,
+                                            search_size,
+                                            end_offset - 1,
+                                            &found_offset);
+    }
+
+    if (is_found)
+    {
+      const ecma_length_t found_pos = (is_ascii ? found_offset
+                                                : lit_utf8_string_length (original_utf8_p, found_offset));
+
+      *ret_num_p = ((ecma_number_t) found_pos);
+    }
+
+    MEM_FINALIZE_LOCAL_ARRAY (search_buffer_p);
+    MEM_FINALIZE_LOCAL_ARRAY (original_buffer_p);
+  }
+
+  ret_value = ecma_make_normal_completion_value (ecma_make_number_value (ret_num_p));
+
+  ECMA_OP_TO_NUMBER_FINALIZE (pos_num);
+  ECMA_FINALIZE (search_string_val);
+  ECMA_FINALIZE (to_string_val);
+  ECMA_FINALIZE (check_coercible_val);
+
+  return ret_value;
+} /* ecma_builtin_string_prototype_object_index_of_helper */
+
 /**
  * The String.prototype object's 'indexOf' routine
  *
@@ -213,7 +465,7 @@ ecma_builtin_string_prototype_object_index_of (ecma_value_t this_arg, /**< this
                                                ecma_value_t arg1, /**< routine's first argument */
                                                ecma_value_t arg2) /**< routine's second argument */
 {
-  ECMA_BUILTIN_CP_UNIMPLEMENTED (this_arg, arg1, arg2);
+  return ecma_builtin_string_prototype_object_index_of_helper (this_arg, arg1, arg2, false);
 } /* ecma_builtin_string_prototype_object_index_of */
 
 /**
@@ -230,7 +482,7 @@ ecma_builtin_string_prototype_object_last_index_of (ecma_value_t this_arg, /**<
                                                     ecma_value_t arg1, /**< routine's first argument */
                                                     ecma_value_t arg2) /**< routine's second argument */
 {
-  ECMA_BUILTIN_CP_UNIMPLEMENTED (this_arg, arg1, arg2);
+  return ecma_builtin_string_prototype_object_index_of_helper (this_arg, arg1, arg2, true);
 } /* ecma_builtin_string_prototype_object_last_index_of */
 
 /**
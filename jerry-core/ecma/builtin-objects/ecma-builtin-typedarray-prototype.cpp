@@ -0,0 +1,291 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-builtin-helpers.h"
+#include "ecma-builtins.h"
+#include "ecma-conversion.h"
+#include "ecma-exceptions.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "jrt.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-typedarray-prototype.inc.h"
+#define BUILTIN_UNDERSCORED_ID typed_array_prototype
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup typedarrayprototype ECMA %TypedArray%.prototype object built-in
+ * @{
+ */
+
+/**
+ * Copy elements of a TypedArray object to the target TypedArray object
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.22.2
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_typed_array_prototype_set_from_typed_array (ecma_object_t *target_p, /**< target TypedArray object */
+                                                         uint32_t offset, /**< index of the first target element */
+                                                         ecma_object_t *source_p) /**< source TypedArray object */
+{
+  const uint32_t source_len = ecma_op_typed_array_get_length (source_p);
+
+  if (source_len > ecma_op_typed_array_get_length (target_p) - offset)
+  {
+    return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_RANGE));
+  }
+
+  const ecma_typed_array_type_t type = ecma_op_typed_array_get_type (target_p);
+
+  if (source_len == 0)
+  {
+    /* nothing to copy */
+  }
+  else if (ecma_op_typed_array_get_type (source_p) == type)
+  {
+    const uint32_t element_size = ecma_typed_array_get_element_size (type);
+
+    /* the views can overlap, if they share a buffer */
+    memmove (ecma_op_typed_array_get_data (target_p) + offset * element_size,
+             ecma_op_typed_array_get_data (source_p),
+             source_len * element_size);
+  }
+  else if (ecma_op_typed_array_get_buffer (source_p) != ecma_op_typed_array_get_buffer (target_p))
+  {
+    for (uint32_t index = 0; index < source_len; index++)
+    {
+      ecma_op_typed_array_set_element (target_p, offset + index, ecma_op_typed_array_get_element (source_p, index));
+    }
+  }
+  else
+  {
+    /* elements of different sizes in a shared buffer are copied through a temporary array */
+    MEM_DEFINE_LOCAL_ARRAY (values_p, source_len, ecma_number_t);
+
+    for (uint32_t index = 0; index < source_len; index++)
+    {
+      values_p[index] = ecma_op_typed_array_get_element (source_p, index);
+    }
+
+    for (uint32_t index = 0; index < source_len; index++)
+    {
+      ecma_op_typed_array_set_element (target_p, offset + index, values_p[index]);
+    }
+
+    MEM_FINALIZE_LOCAL_ARRAY (values_p);
+  }
+
+  return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+} /* ecma_builtin_typed_array_prototype_set_from_typed_array */
+
+/**
+ * Copy elements of an array-like object to the target TypedArray object
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.22.1
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_typed_array_prototype_set_from_object (ecma_object_t *target_p, /**< target TypedArray object */
+                                                    uint32_t offset, /**< index of the first target element */
+                                                    ecma_object_t *source_p) /**< source array-like object */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+
+  ECMA_TRY_CATCH (length_value, ecma_op_object_get (source_p, length_magic_string_p), ret_value);
+  ECMA_OP_TO_NUMBER_TRY_CATCH (length_num, length_value, ret_value);
+
+  const uint32_t source_len = ecma_number_to_uint32 (length_num);
+
+  if (source_len > ecma_op_typed_array_get_length (target_p) - offset)
+  {
+    ret_value = ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_RANGE));
+  }
+
+  for (uint32_t index = 0;
+       index < source_len && ecma_is_completion_value_empty (ret_value);
+       index++)
+  {
+    ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+
+    ECMA_TRY_CATCH (element_value, ecma_op_object_get (source_p, index_string_p), ret_value);
+    ECMA_OP_TO_NUMBER_TRY_CATCH (element_num, element_value, ret_value);
+
+    ecma_op_typed_array_set_element (target_p, offset + index, element_num);
+
+    ECMA_OP_TO_NUMBER_FINALIZE (element_num);
+    ECMA_FINALIZE (element_value);
+
+    ecma_deref_ecma_string (index_string_p);
+  }
+
+  if (ecma_is_completion_value_empty (ret_value))
+  {
+    ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (length_num);
+  ECMA_FINALIZE (length_value);
+
+  ecma_deref_ecma_string (length_magic_string_p);
+
+  return ret_value;
+} /* ecma_builtin_typed_array_prototype_set_from_object */
+
+/**
+ * The %TypedArray%.prototype object's 'set' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.22
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_typed_array_prototype_object_set (ecma_value_t this_arg, /**< 'this' argument */
+                                               ecma_value_t arg1, /**< array or typed array */
+                                               ecma_value_t arg2) /**< offset */
+{
+  if (!ecma_op_is_typed_array (this_arg))
+  {
+    return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_TYPE));
+  }
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ecma_object_t *obj_p = ecma_get_object_from_value (this_arg);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (offset_num, arg2, ret_value);
+
+  ecma_number_t offset_integer = (ecma_number_is_nan (offset_num) ? ECMA_NUMBER_ZERO
+                                                                  : ecma_number_trunc (offset_num));
+
+  if (offset_integer < ECMA_NUMBER_ZERO
+      || offset_integer > ecma_uint32_to_number (ecma_op_typed_array_get_length (obj_p)))
+  {
+    ret_value = ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_RANGE));
+  }
+  else if (ecma_op_is_typed_array (arg1))
+  {
+    ret_value = ecma_builtin_typed_array_prototype_set_from_typed_array (obj_p,
+                                                                         ecma_number_to_uint32 (offset_integer),
+                                                                         ecma_get_object_from_value (arg1));
+  }
+  else
+  {
+    ECMA_TRY_CATCH (source_value, ecma_op_to_object (arg1), ret_value);
+
+    ret_value = ecma_builtin_typed_array_prototype_set_from_object (obj_p,
+                                                                    ecma_number_to_uint32 (offset_integer),
+                                                                    ecma_get_object_from_value (source_value));
+
+    ECMA_FINALIZE (source_value);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (offset_num);
+
+  return ret_value;
+} /* ecma_builtin_typed_array_prototype_object_set */
+
+/**
+ * The %TypedArray%.prototype object's 'subarray' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.26
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value.
+ */
+static ecma_completion_value_t
+ecma_builtin_typed_array_prototype_object_subarray (ecma_value_t this_arg, /**< 'this' argument */
+                                                    ecma_value_t arg1, /**< begin */
+                                                    ecma_value_t arg2) /**< end */
+{
+  if (!ecma_op_is_typed_array (this_arg))
+  {
+    return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_TYPE));
+  }
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ecma_object_t *obj_p = ecma_get_object_from_value (this_arg);
+  const uint32_t len = ecma_op_typed_array_get_length (obj_p);
+
+  uint32_t start = 0, end = len;
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (start_num, arg1, ret_value);
+
+  start = ecma_builtin_helper_array_index_normalize (start_num, len);
+
+  if (!ecma_is_value_undefined (arg2))
+  {
+    ECMA_OP_TO_NUMBER_TRY_CATCH (end_num, arg2, ret_value);
+
+    end = ecma_builtin_helper_array_index_normalize (end_num, len);
+
+    ECMA_OP_TO_NUMBER_FINALIZE (end_num);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (start_num);
+
+  if (ecma_is_completion_value_empty (ret_value))
+  {
+    JERRY_ASSERT (start <= len && end <= len);
+
+    const ecma_typed_array_type_t type = ecma_op_typed_array_get_type (obj_p);
+    const uint32_t byte_offset = (ecma_op_typed_array_get_byte_offset (obj_p)
+                                  + start * ecma_typed_array_get_element_size (type));
+
+    /* the new view shares the buffer with the original one */
+    ecma_object_t *new_obj_p = ecma_op_create_typed_array_object (type,
+                                                                  ecma_op_typed_array_get_buffer (obj_p),
+                                                                  byte_offset,
+                                                                  (end > start) ? end - start : 0);
+
+    ret_value = ecma_make_normal_completion_value (ecma_make_object_value (new_obj_p));
+  }
+
+  return ret_value;
+} /* ecma_builtin_typed_array_prototype_object_subarray */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
@@ -50,10 +50,6 @@ extern ecma_object_t*
 ecma_builtin_make_function_object_for_routine (ecma_builtin_id_t builtin_id,
                                                uint16_t routine_id,
                                                ecma_number_t length_prop_num_value);
-extern int32_t
-ecma_builtin_bin_search_for_magic_string_id_in_array (const lit_magic_string_id_t ids[],
-                                                      ecma_length_t array_length,
-                                                      lit_magic_string_id_t key);
 
 #define BUILTIN(builtin_id, \
                 object_type, \
@@ -74,9 +70,7 @@ ecma_builtin_ ## lowercase_name ## _dispatch_routine (uint16_t builtin_routine_i
                                                       ecma_length_t arguments_number); \
 extern ecma_property_t* \
 ecma_builtin_ ## lowercase_name ## _try_to_instantiate_property (ecma_object_t *obj_p, \
-                                                                 ecma_string_t *prop_name_p); \
-extern void \
-ecma_builtin_ ## lowercase_name ## _sort_property_names (void);
+                                                                 ecma_string_t *prop_name_p);
 #include "ecma-builtins.inc.h"
 
 
@@ -192,6 +192,41 @@ ecma_init_builtins (void)
   }
 } /* ecma_init_builtins */
 
+/**
+ * Save pointers to instantiated built-in objects to a heap snapshot
+ */
+void
+ecma_builtins_save_snapshot_state (mem_heap_snapshot_pointer_t *out_objects_p) /**< out: array of
+                                                                                 *        ECMA_BUILTIN_ID__COUNT
+                                                                                 *        elements */
+{
+  for (ecma_builtin_id_t id = (ecma_builtin_id_t) 0;
+       id < ECMA_BUILTIN_ID__COUNT;
+       id = (ecma_builtin_id_t) (id + 1))
+  {
+    out_objects_p[id] = mem_heap_get_snapshot_pointer (ecma_builtin_objects[id]);
+  }
+} /* ecma_builtins_save_snapshot_state */
+
+/**
+ * Initialize ECMA built-ins from a heap snapshot
+ *
+ * Note:
+ *      the heap should be already restored from the snapshot
+ */
+void
+ecma_init_builtins_from_snapshot (const mem_heap_snapshot_pointer_t *objects_p) /**< array of
+                                                                                  *   ECMA_BUILTIN_ID__COUNT
+                                                                                  *   elements */
+{
+  for (ecma_builtin_id_t id = (ecma_builtin_id_t) 0;
+       id < ECMA_BUILTIN_ID__COUNT;
+       id = (ecma_builtin_id_t) (id + 1))
+  {
+    ecma_builtin_objects[id] = (ecma_object_t *) mem_heap_get_pointer_from_snapshot (objects_p[id]);
+  }
+} /* ecma_init_builtins_from_snapshot */
+
 /**
  * Instantiate specified ECMA built-in object
  */
@@ -209,10 +244,6 @@ ecma_instantiate_builtin (ecma_builtin_id_t id) /**< built-in id */
     case builtin_id: \
     { \
       JERRY_ASSERT (ecma_builtin_objects[builtin_id] == NULL); \
-      if (is_static) \
-      { \
-        ecma_builtin_ ## lowercase_name ## _sort_property_names (); \
-      } \
       \
       ecma_object_t *prototype_obj_p; \
       if (object_prototype_builtin_id == ECMA_BUILTIN_ID__COUNT) \
@@ -575,57 +606,6 @@ ecma_builtin_dispatch_routine (ecma_builtin_id_t builtin_object_id, /**< built-i
   JERRY_UNREACHABLE ();
 } /* ecma_builtin_dispatch_routine */
 
-/**
- * Binary search for magic string identifier in array.
- *
- * Warning:
- *         array should be sorted in ascending order
- *
- * @return index of identifier, if it is contained in array,
- *         -1 - otherwise.
- */
-int32_t
-ecma_builtin_bin_search_for_magic_string_id_in_array (const lit_magic_string_id_t ids[], /**< array to search in */
-                                                      ecma_length_t array_length, /**< number of elements
-                                                                                       in the array */
-                                                      lit_magic_string_id_t key) /**< value to search for */
-{
-#ifndef JERRY_NDEBUG
-  /* For binary search the values should be sorted */
-  for (ecma_length_t id_index = 1;
-       id_index < array_length;
-       id_index++)
-  {
-    JERRY_ASSERT (ids[id_index - 1] < ids[id_index]);
-  }
-#endif /* !JERRY_NDEBUG */
-
-  int32_t min = 0;
-  int32_t max = (int32_t) array_length - 1;
-
-  while (min <= max)
-  {
-    int32_t mid = (min + max) / 2;
-
-    if (ids[mid] == key)
-    {
-      return (int32_t) mid;
-    }
-    else if (ids[mid] > key)
-    {
-      max = mid - 1;
-    }
-    else
-    {
-      JERRY_ASSERT (ids[mid] < key);
-
-      min = mid + 1;
-    }
-  }
-
-  return -1;
-} /* ecma_builtin_bin_search_for_magic_string_id_in_array */
-
 /**
  * @}
  * @}
@@ -37,6 +37,8 @@ typedef enum
 /* ecma-builtins.c */
 extern void ecma_init_builtins (void);
 extern void ecma_finalize_builtins (void);
+extern void ecma_builtins_save_snapshot_state (mem_heap_snapshot_pointer_t *out_objects_p);
+extern void ecma_init_builtins_from_snapshot (const mem_heap_snapshot_pointer_t *objects_p);
 
 extern ecma_completion_value_t
 ecma_builtin_dispatch_call (ecma_object_t *obj_p,
@@ -280,6 +280,176 @@ BUILTIN (ECMA_BUILTIN_ID_URI_ERROR,
          uri_error)
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ERROR_BUILTINS */
 
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+/* The ArrayBuffer.prototype object (ECMA-262 v6, 24.1.4) */
+BUILTIN (ECMA_BUILTIN_ID_ARRAY_BUFFER_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_OBJECT_PROTOTYPE,
+         true,
+         true,
+         array_buffer_prototype)
+
+/* The ArrayBuffer object (ECMA-262 v6, 24.1.3) */
+BUILTIN (ECMA_BUILTIN_ID_ARRAY_BUFFER,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         array_buffer)
+
+/* The %TypedArray%.prototype object (ECMA-262 v6, 22.2.3) */
+BUILTIN (ECMA_BUILTIN_ID_TYPED_ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_OBJECT_PROTOTYPE,
+         true,
+         true,
+         typed_array_prototype)
+
+/* The Int8Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_INT8_ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPED_ARRAY_PROTOTYPE,
+         true,
+         true,
+         int8_array_prototype)
+
+/* The Int8Array object (ECMA-262 v6, 22.2.5) */
+BUILTIN (ECMA_BUILTIN_ID_INT8_ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         int8_array)
+
+/* The Uint8Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_UINT8_ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPED_ARRAY_PROTOTYPE,
+         true,
+         true,
+         uint8_array_prototype)
+
+/* The Uint8Array object (ECMA-262 v6, 22.2.5) */
+BUILTIN (ECMA_BUILTIN_ID_UINT8_ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         uint8_array)
+
+/* The Uint8ClampedArray.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_UINT8_CLAMPED_ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPED_ARRAY_PROTOTYPE,
+         true,
+         true,
+         uint8_clamped_array_prototype)
+
+/* The Uint8ClampedArray object (ECMA-262 v6, 22.2.5) */
+BUILTIN (ECMA_BUILTIN_ID_UINT8_CLAMPED_ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         uint8_clamped_array)
+
+/* The Int16Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_INT16_ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPED_ARRAY_PROTOTYPE,
+         true,
+         true,
+         int16_array_prototype)
+
+/* The Int16Array object (ECMA-262 v6, 22.2.5) */
+BUILTIN (ECMA_BUILTIN_ID_INT16_ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         int16_array)
+
+/* The Uint16Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_UINT16_ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPED_ARRAY_PROTOTYPE,
+         true,
+         true,
+         uint16_array_prototype)
+
+/* The Uint16Array object (ECMA-262 v6, 22.2.5) */
+BUILTIN (ECMA_BUILTIN_ID_UINT16_ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         uint16_array)
+
+/* The Int32Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_INT32_ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPED_ARRAY_PROTOTYPE,
+         true,
+         true,
+         int32_array_prototype)
+
+/* The Int32Array object (ECMA-262 v6, 22.2.5) */
+BUILTIN (ECMA_BUILTIN_ID_INT32_ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         int32_array)
+
+/* The Uint32Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_UINT32_ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPED_ARRAY_PROTOTYPE,
+         true,
+         true,
+         uint32_array_prototype)
+
+/* The Uint32Array object (ECMA-262 v6, 22.2.5) */
+BUILTIN (ECMA_BUILTIN_ID_UINT32_ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         uint32_array)
+
+/* The Float32Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_FLOAT32_ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPED_ARRAY_PROTOTYPE,
+         true,
+         true,
+         float32_array_prototype)
+
+/* The Float32Array object (ECMA-262 v6, 22.2.5) */
+BUILTIN (ECMA_BUILTIN_ID_FLOAT32_ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         float32_array)
+
+/* The Float64Array.prototype object (ECMA-262 v6, 22.2.6) */
+BUILTIN (ECMA_BUILTIN_ID_FLOAT64_ARRAY_PROTOTYPE,
+         ECMA_OBJECT_TYPE_GENERAL,
+         ECMA_BUILTIN_ID_TYPED_ARRAY_PROTOTYPE,
+         true,
+         true,
+         float64_array_prototype)
+
+/* The Float64Array object (ECMA-262 v6, 22.2.5) */
+BUILTIN (ECMA_BUILTIN_ID_FLOAT64_ARRAY,
+         ECMA_OBJECT_TYPE_FUNCTION,
+         ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE,
+         true,
+         true,
+         float64_array)
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+
 /**< The [[ThrowTypeError]] object (13.2.3) */
 BUILTIN (ECMA_BUILTIN_ID_TYPE_ERROR_THROWER,
          ECMA_OBJECT_TYPE_FUNCTION,
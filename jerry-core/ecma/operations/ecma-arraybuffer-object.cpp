@@ -0,0 +1,241 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-arraybuffer-object.h"
+#include "ecma-builtins.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-try-catch-macro.h"
+#include "mem-heap.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaarraybufferobject ECMA ArrayBuffer object related routines
+ * @{
+ */
+
+/**
+ * Create ArrayBuffer object without data
+ *
+ * Note:
+ *      the caller should create one of data internal properties
+ *      (ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_DATA or ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_EXTERNAL_DATA)
+ *
+ * @return pointer to the ArrayBuffer object
+ */
+static ecma_object_t *
+ecma_op_create_array_buffer_object_without_data (ecma_length_t byte_length) /**< size of the data, in bytes */
+{
+  ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_ARRAY_BUFFER_PROTOTYPE);
+  ecma_object_t *obj_p = ecma_create_object (prototype_obj_p, true, ECMA_OBJECT_TYPE_GENERAL);
+  ecma_deref_object (prototype_obj_p);
+
+  ecma_string_t *byte_length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_BYTE_LENGTH_UL);
+  ecma_property_t *byte_length_prop_p = ecma_create_named_data_property (obj_p,
+                                                                         byte_length_magic_string_p,
+                                                                         false, false, false);
+  ecma_number_t *byte_length_num_p = ecma_alloc_number ();
+  *byte_length_num_p = ecma_uint32_to_number (byte_length);
+  ecma_set_named_data_property_value (byte_length_prop_p, ecma_make_number_value (byte_length_num_p));
+  ecma_deref_ecma_string (byte_length_magic_string_p);
+
+  /*
+   * Internal properties are created after the named ones, so they are placed at the beginning
+   * of the property list, and are found quickly upon accesses to the data.
+   */
+  ecma_property_t *class_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CLASS);
+  class_prop_p->u.internal_property.value = LIT_MAGIC_STRING_ARRAY_BUFFER_UL;
+
+  ecma_property_t *length_prop_p = ecma_create_internal_property (obj_p,
+                                                                  ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_BYTE_LENGTH);
+  length_prop_p->u.internal_property.value = byte_length;
+
+  return obj_p;
+} /* ecma_op_create_array_buffer_object_without_data */
+
+/**
+ * Create ArrayBuffer object with zero-initialized data of specified size
+ *
+ * The data is allocated on the engine's heap, and is freed together with the object.
+ *
+ * @return pointer to the ArrayBuffer object
+ */
+ecma_object_t *
+ecma_op_create_array_buffer_object (ecma_length_t byte_length) /**< size of the data, in bytes */
+{
+  uint8_t *data_p = NULL;
+
+  if (byte_length != 0)
+  {
+    data_p = (uint8_t *) mem_heap_alloc_block (byte_length, MEM_HEAP_ALLOC_LONG_TERM);
+    memset (data_p, 0, byte_length);
+  }
+
+  ecma_object_t *obj_p = ecma_op_create_array_buffer_object_without_data (byte_length);
+
+  ecma_property_t *data_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_DATA);
+  ECMA_SET_POINTER (data_prop_p->u.internal_property.value, data_p);
+
+  return obj_p;
+} /* ecma_op_create_array_buffer_object */
+
+/**
+ * Create ArrayBuffer object, referencing data in a buffer, owned by the host, without copying the data
+ *
+ * Note:
+ *      the buffer should remain valid until the object is freed by the engine
+ *
+ * @return pointer to the ArrayBuffer object
+ */
+ecma_object_t *
+ecma_op_create_external_array_buffer_object (uint8_t *data_p, /**< buffer with the data */
+                                             ecma_length_t byte_length) /**< size of the data, in bytes */
+{
+  JERRY_ASSERT (data_p != NULL || byte_length == 0);
+
+  ecma_object_t *obj_p = ecma_op_create_array_buffer_object_without_data (byte_length);
+
+  ecma_create_external_pointer_property (obj_p,
+                                         ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_EXTERNAL_DATA,
+                                         (ecma_external_pointer_t) data_p);
+
+  return obj_p;
+} /* ecma_op_create_external_array_buffer_object */
+
+/**
+ * ArrayBuffer object creation operation
+ *
+ * See also: ECMA-262 v6, 24.1.2.1
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+ecma_op_create_array_buffer_object_from_arguments (const ecma_value_t *arguments_list_p, /**< list of arguments that
+                                                                                           *   are passed to ArrayBuffer
+                                                                                           *   constructor */
+                                                   ecma_length_t arguments_list_len) /**< length of the arguments'
+                                                                                      *   list */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ecma_value_t length_value = (arguments_list_len != 0 ? arguments_list_p[0]
+                                                       : ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (length_num, length_value, ret_value);
+
+  uint32_t length_uint32 = ecma_number_to_uint32 (length_num);
+
+  if (ecma_is_value_undefined (length_value))
+  {
+    ret_value = ecma_make_normal_completion_value (ecma_make_object_value (ecma_op_create_array_buffer_object (0)));
+  }
+  else if (ecma_uint32_to_number (length_uint32) != length_num
+           || length_uint32 > CONFIG_MEM_HEAP_AREA_SIZE)
+  {
+    /* the length is not an integer, or the data can't be allocated at all */
+    ret_value = ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_RANGE));
+  }
+  else
+  {
+    ecma_object_t *obj_p = ecma_op_create_array_buffer_object (length_uint32);
+
+    ret_value = ecma_make_normal_completion_value (ecma_make_object_value (obj_p));
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (length_num);
+
+  return ret_value;
+} /* ecma_op_create_array_buffer_object_from_arguments */
+
+/**
+ * Check whether the value is an ArrayBuffer object
+ *
+ * @return true - if the value is an ArrayBuffer object,
+ *         false - otherwise.
+ */
+bool
+ecma_op_is_array_buffer (ecma_value_t value) /**< ecma-value */
+{
+  if (!ecma_is_value_object (value))
+  {
+    return false;
+  }
+
+  ecma_object_t *obj_p = ecma_get_object_from_value (value);
+
+  return (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_GENERAL
+          && ecma_object_get_class_name (obj_p) == LIT_MAGIC_STRING_ARRAY_BUFFER_UL);
+} /* ecma_op_is_array_buffer */
+
+/**
+ * Get size of ArrayBuffer object's data
+ *
+ * @return size of the data, in bytes
+ */
+ecma_length_t
+ecma_op_array_buffer_get_byte_length (ecma_object_t *obj_p) /**< ArrayBuffer object */
+{
+  JERRY_ASSERT (ecma_op_is_array_buffer (ecma_make_object_value (obj_p)));
+
+  ecma_property_t *length_prop_p = ecma_get_internal_property (obj_p,
+                                                               ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_BYTE_LENGTH);
+
+  return length_prop_p->u.internal_property.value;
+} /* ecma_op_array_buffer_get_byte_length */
+
+/**
+ * Get ArrayBuffer object's data
+ *
+ * @return pointer to the data (NULL - if the data is empty)
+ */
+uint8_t *
+ecma_op_array_buffer_get_data (ecma_object_t *obj_p) /**< ArrayBuffer object */
+{
+  JERRY_ASSERT (ecma_op_is_array_buffer (ecma_make_object_value (obj_p)));
+
+  ecma_property_t *data_prop_p = ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_DATA);
+
+  if (data_prop_p != NULL)
+  {
+    return ECMA_GET_POINTER (uint8_t, data_prop_p->u.internal_property.value);
+  }
+  else
+  {
+    ecma_external_pointer_t data_pointer;
+    bool is_found = ecma_get_external_pointer_value (obj_p,
+                                                     ECMA_INTERNAL_PROPERTY_ARRAY_BUFFER_EXTERNAL_DATA,
+                                                     &data_pointer);
+    JERRY_ASSERT (is_found);
+
+    return (uint8_t *) data_pointer;
+  }
+} /* ecma_op_array_buffer_get_data */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
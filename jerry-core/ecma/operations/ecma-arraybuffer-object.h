@@ -0,0 +1,52 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_ARRAYBUFFER_OBJECT_H
+#define ECMA_ARRAYBUFFER_OBJECT_H
+
+#include "ecma-globals.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaarraybufferobject ECMA ArrayBuffer object related routines
+ * @{
+ */
+
+extern ecma_object_t *
+ecma_op_create_array_buffer_object (ecma_length_t byte_length);
+extern ecma_object_t *
+ecma_op_create_external_array_buffer_object (uint8_t *data_p,
+                                             ecma_length_t byte_length);
+extern ecma_completion_value_t
+ecma_op_create_array_buffer_object_from_arguments (const ecma_value_t *arguments_list_p,
+                                                   ecma_length_t arguments_list_len);
+
+extern bool
+ecma_op_is_array_buffer (ecma_value_t value);
+extern ecma_length_t
+ecma_op_array_buffer_get_byte_length (ecma_object_t *obj_p);
+extern uint8_t *
+ecma_op_array_buffer_get_data (ecma_object_t *obj_p);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+#endif /* !ECMA_ARRAYBUFFER_OBJECT_H */
@@ -86,7 +86,7 @@ ecma_op_eval_chars_buffer (const jerry_api_char_t *code_p, /**< code characters
 
   ecma_completion_value_t completion;
 
-  const opcode_t *opcodes_p;
+  const opcode_compact_t *opcodes_p;
   bool is_syntax_correct;
 
   bool is_strict_call = (is_direct && is_called_from_strict_mode_code);
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include "bytecode-data.h"
 #include "ecma-alloc.h"
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
@@ -24,6 +25,9 @@
 #include "ecma-objects-general.h"
 #include "ecma-objects-arguments.h"
 #include "ecma-try-catch-macro.h"
+#include "parser.h"
+#include "serializer.h"
+#include "vm.h"
 
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
@@ -157,7 +161,7 @@ ecma_op_create_function_object (ecma_string_t* formal_parameter_list_p[], /**< f
                                 bool is_strict, /**< 'strict' flag */
                                 bool do_instantiate_arguments_object, /**< should an Arguments object be instantiated
                                                                        *   for the function object upon call */
-                                const opcode_t *opcodes_p, /**< byte-code array */
+                                const opcode_compact_t *opcodes_p, /**< byte-code array */
                                 opcode_counter_t first_opcode_index) /**< index of first opcode of function's body */
 {
   // 1., 4., 13.
@@ -319,16 +323,15 @@ ecma_op_create_function_object (ecma_string_t* formal_parameter_list_p[], /**< f
 } /* ecma_op_create_function_object */
 
 /**
- * External function object creation operation.
- *
- * Note:
- *      external function object is implementation-defined object type
- *      that represent functions implemented in native code, using Embedding API
+ * Create external function object, storing native handler in the specified internal property
  *
  * @return pointer to newly created external function object
  */
-ecma_object_t*
-ecma_op_create_external_function_object (ecma_external_pointer_t code_p) /**< pointer to external native handler */
+static ecma_object_t*
+ecma_op_create_external_function_object_with_handler (ecma_internal_property_id_t code_prop_id, /**< handler's
+                                                                                                  *   property */
+                                                      ecma_external_pointer_t code_p) /**< pointer to external
+                                                                                       *   native handler */
 {
   ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_FUNCTION_PROTOTYPE);
 
@@ -343,7 +346,7 @@ ecma_op_create_external_function_object (ecma_external_pointer_t code_p) /**< po
    */
 
   bool is_created = ecma_create_external_pointer_property (function_obj_p,
-                                                           ECMA_INTERNAL_PROPERTY_NATIVE_CODE,
+                                                           code_prop_id,
                                                            (ecma_external_pointer_t) code_p);
   JERRY_ASSERT (is_created);
 
@@ -370,8 +373,39 @@ ecma_op_create_external_function_object (ecma_external_pointer_t code_p) /**< po
   ecma_deref_ecma_string (magic_string_prototype_p);
 
   return function_obj_p;
+} /* ecma_op_create_external_function_object_with_handler */
+
+/**
+ * External function object creation operation.
+ *
+ * Note:
+ *      external function object is implementation-defined object type
+ *      that represent functions implemented in native code, using Embedding API
+ *
+ * @return pointer to newly created external function object
+ */
+ecma_object_t*
+ecma_op_create_external_function_object (ecma_external_pointer_t code_p) /**< pointer to external native handler */
+{
+  return ecma_op_create_external_function_object_with_handler (ECMA_INTERNAL_PROPERTY_NATIVE_CODE, code_p);
 } /* ecma_op_create_external_function_object */
 
+/**
+ * Creation operation for external function object with numeric native handler
+ *
+ * Note:
+ *      arguments of the function are converted to numbers, and are passed to the handler
+ *      without intermediate Embedding API values; the handler's result is returned as number.
+ *
+ * @return pointer to newly created external function object
+ */
+ecma_object_t*
+ecma_op_create_external_number_function_object (ecma_external_pointer_t code_p) /**< pointer to external
+                                                                                 *   numeric native handler */
+{
+  return ecma_op_create_external_function_object_with_handler (ECMA_INTERNAL_PROPERTY_NATIVE_NUMBER_CODE, code_p);
+} /* ecma_op_create_external_number_function_object */
+
 /**
  * Setup variables for arguments listed in formal parameter list,
  * and, if necessary, Arguments object with 'arguments' binding.
@@ -598,6 +632,98 @@ ecma_op_function_has_instance (ecma_object_t *func_obj_p, /**< Function object *
   }
 } /* ecma_op_function_has_instance */
 
+/**
+ * Compile body of the function, if the body's compilation was deferred by the parser till the function's first call,
+ * and attach the generated byte-code to the function object's [[Code]] internal property
+ *
+ * Note:
+ *      the byte-code is registered in descriptor of the body (see also: lazy_function_body_t),
+ *      so function objects, created from the same function declaration or expression, share the byte-code,
+ *      and the body's source code, that is not necessary anymore, is released
+ *
+ * @return completion value
+ *         Returned value is empty completion value, if the function's body is compiled,
+ *         or throw completion value with SyntaxError, if the body contains syntax errors.
+ */
+static ecma_completion_value_t
+ecma_op_function_compile_lazy_body (ecma_object_t *func_obj_p) /**< Function object */
+{
+  ecma_property_t *opcodes_prop_p = ecma_get_internal_property (func_obj_p, ECMA_INTERNAL_PROPERTY_CODE_BYTECODE);
+  ecma_property_t *code_prop_p = ecma_get_internal_property (func_obj_p, ECMA_INTERNAL_PROPERTY_CODE_FLAGS_AND_OFFSET);
+
+  uint32_t code_prop_value = code_prop_p->u.internal_property.value;
+
+  bool is_strict;
+  bool do_instantiate_args_obj;
+  const opcode_compact_t *opcodes_p = MEM_CP_GET_POINTER (const opcode_compact_t,
+                                                          opcodes_prop_p->u.internal_property.value);
+  opcode_counter_t code_first_opcode_idx = ecma_unpack_code_internal_property_value (code_prop_value,
+                                                                                     &is_strict,
+                                                                                     &do_instantiate_args_obj);
+
+  opcode_t meta_opcode = vm_get_opcode (opcodes_p, code_first_opcode_idx);
+
+  if (likely (meta_opcode.op_idx != __op__idx_meta))
+  {
+    return ecma_make_empty_completion_value ();
+  }
+
+  JERRY_ASSERT (meta_opcode.data.meta.type == OPCODE_META_TYPE_LAZY_FUNCTION_BODY);
+
+  const uint16_t body_index = (uint16_t) ((meta_opcode.data.meta.data_1 << JERRY_BITSINBYTE)
+                                          | meta_opcode.data.meta.data_2);
+  lazy_function_body_t *body_p = GET_LAZY_FUNCTION_BODY_FOR_BYTECODE (opcodes_p, body_index);
+
+  const opcode_compact_t *body_opcodes_p;
+
+  if (body_p->bytecode_cp != MEM_CP_NULL)
+  {
+    /* the body was compiled upon first call of another function object, created from the same code */
+    body_opcodes_p = MEM_CP_GET_NON_NULL_POINTER (const opcode_compact_t, body_p->bytecode_cp);
+  }
+  else
+  {
+    lazy_function_body_source_t *body_source_p = MEM_CP_GET_NON_NULL_POINTER (lazy_function_body_source_t,
+                                                                               body_p->source_cp);
+
+    bool is_syntax_correct = parser_parse_lazy_function_body ((const jerry_api_char_t *) (body_source_p + 1),
+                                                              body_source_p->size,
+                                                              is_strict,
+                                                              &body_opcodes_p);
+
+    if (!is_syntax_correct)
+    {
+      return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_SYNTAX));
+    }
+
+    MEM_CP_SET_NON_NULL_POINTER (body_p->bytecode_cp, body_opcodes_p);
+
+    mem_heap_free_block (body_source_p);
+    body_p->source_cp = MEM_CP_NULL;
+  }
+
+  opcode_scope_code_flags_t scope_flags = vm_get_scope_flags (body_opcodes_p, 0);
+
+  /* strictness of the function is determined upon the function's creation */
+  JERRY_ASSERT (!(scope_flags & OPCODE_SCOPE_CODE_FLAGS_STRICT) || is_strict);
+
+  if ((scope_flags & OPCODE_SCOPE_CODE_FLAGS_NOT_REF_ARGUMENTS_IDENTIFIER)
+      && (scope_flags & OPCODE_SCOPE_CODE_FLAGS_NOT_REF_EVAL_IDENTIFIER))
+  {
+    /* the code doesn't use 'arguments' identifier
+     * and doesn't perform direct call to eval,
+     * so Arguments object can't be referenced */
+    do_instantiate_args_obj = false;
+  }
+
+  MEM_CP_SET_NON_NULL_POINTER (opcodes_prop_p->u.internal_property.value, body_opcodes_p);
+  code_prop_p->u.internal_property.value = ecma_pack_code_internal_property_value (is_strict,
+                                                                                  do_instantiate_args_obj,
+                                                                                  1);
+
+  return ecma_make_empty_completion_value ();
+} /* ecma_op_function_compile_lazy_body */
+
 /**
  * [[Call]] implementation for Function objects,
  * created through 13.2 (ECMA_OBJECT_TYPE_FUNCTION)
@@ -632,6 +758,10 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
     }
     else
     {
+      ECMA_TRY_CATCH (compile_lazy_body_ret,
+                      ecma_op_function_compile_lazy_body (func_obj_p),
+                      ret_value);
+
       /* Entering Function Code (ECMA-262 v5, 10.4.3) */
       ecma_property_t *scope_prop_p = ecma_get_internal_property (func_obj_p, ECMA_INTERNAL_PROPERTY_SCOPE);
       ecma_property_t *opcodes_prop_p = ecma_get_internal_property (func_obj_p, ECMA_INTERNAL_PROPERTY_CODE_BYTECODE);
@@ -645,7 +775,8 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
       // 8.
       bool is_strict;
       bool do_instantiate_args_obj;
-      const opcode_t *opcodes_p = MEM_CP_GET_POINTER (const opcode_t, opcodes_prop_p->u.internal_property.value);
+      const opcode_compact_t *opcodes_p = MEM_CP_GET_POINTER (const opcode_compact_t,
+                                                          opcodes_prop_p->u.internal_property.value);
       opcode_counter_t code_first_opcode_idx = ecma_unpack_code_internal_property_value (code_prop_value,
                                                                                          &is_strict,
                                                                                          &do_instantiate_args_obj);
@@ -704,6 +835,8 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
 
       ecma_deref_object (local_env_p);
       ecma_free_value (this_binding, true);
+
+      ECMA_FINALIZE (compile_lazy_body_ret);
     }
   }
   else if (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION)
@@ -716,16 +849,28 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
   else if (ecma_get_object_type (func_obj_p) == ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION)
   {
     ecma_external_pointer_t handler_p;
-    bool is_retrieved = ecma_get_external_pointer_value (func_obj_p,
-                                                         ECMA_INTERNAL_PROPERTY_NATIVE_CODE,
-                                                         &handler_p);
-    JERRY_ASSERT (is_retrieved);
 
-    ret_value = jerry_dispatch_external_function (func_obj_p,
-                                                  handler_p,
-                                                  this_arg_value,
-                                                  arguments_list_p,
-                                                  arguments_list_len);
+    if (ecma_get_external_pointer_value (func_obj_p,
+                                         ECMA_INTERNAL_PROPERTY_NATIVE_CODE,
+                                         &handler_p))
+    {
+      ret_value = jerry_dispatch_external_function (func_obj_p,
+                                                    handler_p,
+                                                    this_arg_value,
+                                                    arguments_list_p,
+                                                    arguments_list_len);
+    }
+    else
+    {
+      bool is_retrieved = ecma_get_external_pointer_value (func_obj_p,
+                                                           ECMA_INTERNAL_PROPERTY_NATIVE_NUMBER_CODE,
+                                                           &handler_p);
+      JERRY_ASSERT (is_retrieved);
+
+      ret_value = jerry_dispatch_external_number_function (handler_p,
+                                                           arguments_list_p,
+                                                           arguments_list_len);
+    }
   }
   else
   {
@@ -879,7 +1024,7 @@ ecma_op_function_construct (ecma_object_t *func_obj_p, /**< Function object */
 ecma_completion_value_t
 ecma_op_function_declaration (ecma_object_t *lex_env_p, /**< lexical environment */
                               ecma_string_t *function_name_p, /**< function name */
-                              const opcode_t *opcodes_p, /**< byte-code array */
+                              const opcode_compact_t *opcodes_p, /**< byte-code array */
                               opcode_counter_t function_code_opcode_idx, /**< index of first opcode of function code */
                               ecma_string_t* formal_parameter_list_p[], /**< formal parameters list */
                               ecma_length_t formal_parameter_list_length, /**< length of formal parameters list */
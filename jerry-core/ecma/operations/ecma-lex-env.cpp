@@ -70,6 +70,31 @@ ecma_finalize_environment (void)
   ecma_global_lex_env_p = NULL;
 } /* ecma_finalize_environment */
 
+/**
+ * Save pointer to Global environment to a heap snapshot
+ *
+ * @return representation of the pointer in the snapshot
+ */
+mem_heap_snapshot_pointer_t
+ecma_environment_save_snapshot_state (void)
+{
+  return mem_heap_get_snapshot_pointer (ecma_global_lex_env_p);
+} /* ecma_environment_save_snapshot_state */
+
+/**
+ * Initialize Global environment from a heap snapshot
+ *
+ * Note:
+ *      the heap should be already restored from the snapshot
+ */
+void
+ecma_init_environment_from_snapshot (mem_heap_snapshot_pointer_t global_lex_env) /**< Global environment */
+{
+  ecma_global_lex_env_p = (ecma_object_t *) mem_heap_get_pointer_from_snapshot (global_lex_env);
+
+  JERRY_ASSERT (ecma_global_lex_env_p != NULL && ecma_is_lexical_environment (ecma_global_lex_env_p));
+} /* ecma_init_environment_from_snapshot */
+
 /**
  * Get reference to Global lexical environment
  *
@@ -36,6 +36,8 @@
 
 extern void ecma_init_environment (void);
 extern void ecma_finalize_environment (void);
+extern mem_heap_snapshot_pointer_t ecma_environment_save_snapshot_state (void);
+extern void ecma_init_environment_from_snapshot (mem_heap_snapshot_pointer_t global_lex_env);
 extern ecma_object_t* ecma_get_global_environment (void);
 extern bool ecma_is_lexical_environment_global (ecma_object_t *lex_env_p);
 
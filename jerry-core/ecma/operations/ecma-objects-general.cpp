@@ -15,6 +15,7 @@
 
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
+#include "ecma-for-in-cache.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
@@ -868,6 +869,7 @@ ecma_op_general_object_define_own_property (ecma_object_t *obj_p, /**< the objec
 
   if (property_desc_p->is_enumerable_defined)
   {
+    ecma_for_in_cache_invalidate_object (obj_p);
     ecma_set_property_enumerable_attr (current_p, property_desc_p->is_enumerable);
   }
 
@@ -23,6 +23,7 @@
 #include "ecma-objects-arguments.h"
 #include "ecma-objects-general.h"
 #include "ecma-objects.h"
+#include "ecma-typedarray-object.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -44,7 +45,8 @@ ecma_assert_object_type_is_valid (ecma_object_type_t type) /**< object's impleme
                 || type == ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION
                 || type == ECMA_OBJECT_TYPE_STRING
                 || type == ECMA_OBJECT_TYPE_ARGUMENTS
-                || type == ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION);
+                || type == ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION
+                || type == ECMA_OBJECT_TYPE_TYPED_ARRAY);
 } /* ecma_assert_object_type_is_valid */
 
 /**
@@ -84,6 +86,15 @@ ecma_op_object_get (ecma_object_t *obj_p, /**< the object */
     {
       return ecma_op_arguments_object_get (obj_p, property_name_p);
     }
+
+    case ECMA_OBJECT_TYPE_TYPED_ARRAY:
+    {
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+      return ecma_op_typed_array_object_get (obj_p, property_name_p);
+#else /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+      JERRY_UNREACHABLE ();
+#endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+    }
   }
 
   JERRY_ASSERT (false);
@@ -135,6 +146,17 @@ ecma_op_object_get_own_property_longpath (ecma_object_t *obj_p, /**< the object
 
       break;
     }
+
+    case ECMA_OBJECT_TYPE_TYPED_ARRAY:
+    {
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+      prop_p = ecma_op_typed_array_object_get_own_property (obj_p, property_name_p);
+
+      break;
+#else /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+      JERRY_UNREACHABLE ();
+#endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+    }
   }
 
   if (unlikely (prop_p == NULL))
@@ -168,7 +190,12 @@ ecma_op_object_get_own_property (ecma_object_t *obj_p, /**< the object */
 
   ecma_property_t *prop_p = NULL;
 
-  if (likely (ecma_lcache_lookup (obj_p, property_name_p, &prop_p)))
+  /*
+   * Values of typed arrays' element properties are updated upon each lookup
+   * (see also: ecma_op_typed_array_object_get_own_property), so the lookup cache is not used for the objects.
+   */
+  if (likely (ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_TYPED_ARRAY
+              && ecma_lcache_lookup (obj_p, property_name_p, &prop_p)))
   {
     return prop_p;
   }
@@ -251,12 +278,20 @@ ecma_op_object_put (ecma_object_t *obj_p, /**< the object */
    *   [ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION] = &ecma_op_general_object_put,
    *   [ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION] = &ecma_op_general_object_put,
    *   [ECMA_OBJECT_TYPE_ARGUMENTS]         = &ecma_op_general_object_put,
-   *   [ECMA_OBJECT_TYPE_STRING]            = &ecma_op_general_object_put
+   *   [ECMA_OBJECT_TYPE_STRING]            = &ecma_op_general_object_put,
+   *   [ECMA_OBJECT_TYPE_TYPED_ARRAY]       = &ecma_op_typed_array_object_put
    * };
    *
    * return put[type] (obj_p, property_name_p);
    */
 
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+  if (type == ECMA_OBJECT_TYPE_TYPED_ARRAY)
+  {
+    return ecma_op_typed_array_object_put (obj_p, property_name_p, value, is_throw);
+  }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+
   return ecma_op_general_object_put (obj_p, property_name_p, value, is_throw);
 } /* ecma_op_object_put */
 
@@ -342,6 +377,17 @@ ecma_op_object_delete (ecma_object_t *obj_p, /**< the object */
                                               property_name_p,
                                               is_throw);
     }
+
+    case ECMA_OBJECT_TYPE_TYPED_ARRAY:
+    {
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+      return ecma_op_typed_array_object_delete (obj_p,
+                                                property_name_p,
+                                                is_throw);
+#else /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+      JERRY_UNREACHABLE ();
+#endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+    }
   }
 
   JERRY_ASSERT (false);
@@ -441,6 +487,18 @@ ecma_op_object_define_own_property (ecma_object_t *obj_p, /**< the object */
                                                            property_desc_p,
                                                            is_throw);
     }
+
+    case ECMA_OBJECT_TYPE_TYPED_ARRAY:
+    {
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+      return ecma_op_typed_array_object_define_own_property (obj_p,
+                                                             property_name_p,
+                                                             property_desc_p,
+                                                             is_throw);
+#else /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+      JERRY_UNREACHABLE ();
+#endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+    }
   }
 
   JERRY_ASSERT (false);
@@ -470,6 +528,7 @@ ecma_op_object_has_instance (ecma_object_t *obj_p, /**< the object */
     case ECMA_OBJECT_TYPE_GENERAL:
     case ECMA_OBJECT_TYPE_STRING:
     case ECMA_OBJECT_TYPE_ARGUMENTS:
+    case ECMA_OBJECT_TYPE_TYPED_ARRAY:
     {
       return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_TYPE));
     }
@@ -537,6 +596,12 @@ ecma_object_get_class_name (ecma_object_t *obj_p) /**< object */
     {
       return LIT_MAGIC_STRING_ARGUMENTS_UL;
     }
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+    case ECMA_OBJECT_TYPE_TYPED_ARRAY:
+    {
+      return ecma_typed_array_get_class_name (ecma_op_typed_array_get_type (obj_p));
+    }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
     case ECMA_OBJECT_TYPE_FUNCTION:
     {
       lit_magic_string_id_t class_name;
@@ -607,6 +672,22 @@ ecma_object_get_class_name (ecma_object_t *obj_p) /**< object */
             break;
           }
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ERROR_BUILTINS */
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+          case ECMA_BUILTIN_ID_ARRAY_BUFFER:
+          case ECMA_BUILTIN_ID_INT8_ARRAY:
+          case ECMA_BUILTIN_ID_UINT8_ARRAY:
+          case ECMA_BUILTIN_ID_UINT8_CLAMPED_ARRAY:
+          case ECMA_BUILTIN_ID_INT16_ARRAY:
+          case ECMA_BUILTIN_ID_UINT16_ARRAY:
+          case ECMA_BUILTIN_ID_INT32_ARRAY:
+          case ECMA_BUILTIN_ID_UINT32_ARRAY:
+          case ECMA_BUILTIN_ID_FLOAT32_ARRAY:
+          case ECMA_BUILTIN_ID_FLOAT64_ARRAY:
+          {
+            class_name = LIT_MAGIC_STRING_FUNCTION_UL;
+            break;
+          }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
           default:
           {
             JERRY_ASSERT (builtin_id == ECMA_BUILTIN_ID_TYPE_ERROR_THROWER);
@@ -687,6 +768,22 @@ ecma_object_get_class_name (ecma_object_t *obj_p) /**< object */
             return LIT_MAGIC_STRING_REGEXP_UL;
           }
 #endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+          case ECMA_BUILTIN_ID_ARRAY_BUFFER_PROTOTYPE:
+          case ECMA_BUILTIN_ID_TYPED_ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_INT8_ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT8_ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT8_CLAMPED_ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_INT16_ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT16_ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_INT32_ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT32_ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_FLOAT32_ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_FLOAT64_ARRAY_PROTOTYPE:
+          {
+            return LIT_MAGIC_STRING_OBJECT_UL;
+          }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
           default:
           {
             JERRY_ASSERT (ecma_builtin_is (obj_p, ECMA_BUILTIN_ID_GLOBAL));
@@ -0,0 +1,942 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-arraybuffer-object.h"
+#include "ecma-builtins.h"
+#include "ecma-conversion.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-objects-general.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmatypedarrayobject ECMA TypedArray object related routines
+ * @{
+ */
+
+/**
+ * Description of a type of typed arrays' elements
+ */
+typedef struct
+{
+  lit_magic_string_id_t class_name; /**< [[Class]] of the typed arrays */
+  ecma_builtin_id_t prototype_id; /**< built-in prototype of the typed arrays */
+  uint32_t element_size; /**< size of an element, in bytes */
+} ecma_typed_array_type_desc_t;
+
+/**
+ * Descriptions of the typed arrays' element types (in order of ecma_typed_array_type_t)
+ */
+static const ecma_typed_array_type_desc_t ecma_typed_array_type_descs[] =
+{
+  { LIT_MAGIC_STRING_INT8_ARRAY_UL, ECMA_BUILTIN_ID_INT8_ARRAY_PROTOTYPE, sizeof (int8_t) },
+  { LIT_MAGIC_STRING_UINT8_ARRAY_UL, ECMA_BUILTIN_ID_UINT8_ARRAY_PROTOTYPE, sizeof (uint8_t) },
+  { LIT_MAGIC_STRING_UINT8_CLAMPED_ARRAY_UL, ECMA_BUILTIN_ID_UINT8_CLAMPED_ARRAY_PROTOTYPE, sizeof (uint8_t) },
+  { LIT_MAGIC_STRING_INT16_ARRAY_UL, ECMA_BUILTIN_ID_INT16_ARRAY_PROTOTYPE, sizeof (int16_t) },
+  { LIT_MAGIC_STRING_UINT16_ARRAY_UL, ECMA_BUILTIN_ID_UINT16_ARRAY_PROTOTYPE, sizeof (uint16_t) },
+  { LIT_MAGIC_STRING_INT32_ARRAY_UL, ECMA_BUILTIN_ID_INT32_ARRAY_PROTOTYPE, sizeof (int32_t) },
+  { LIT_MAGIC_STRING_UINT32_ARRAY_UL, ECMA_BUILTIN_ID_UINT32_ARRAY_PROTOTYPE, sizeof (uint32_t) },
+  { LIT_MAGIC_STRING_FLOAT32_ARRAY_UL, ECMA_BUILTIN_ID_FLOAT32_ARRAY_PROTOTYPE, sizeof (float) },
+  { LIT_MAGIC_STRING_FLOAT64_ARRAY_UL, ECMA_BUILTIN_ID_FLOAT64_ARRAY_PROTOTYPE, sizeof (double) }
+};
+
+JERRY_STATIC_ASSERT (sizeof (ecma_typed_array_type_descs) / sizeof (ecma_typed_array_type_descs[0])
+                     == ECMA_TYPED_ARRAY__COUNT);
+
+/**
+ * Reject sequence
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+static ecma_completion_value_t
+ecma_reject (bool is_throw) /**< Throw flag */
+{
+  if (is_throw)
+  {
+    return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_TYPE));
+  }
+  else
+  {
+    return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_FALSE);
+  }
+} /* ecma_reject */
+
+/**
+ * Get size of an element of typed arrays of the specified type
+ *
+ * @return size of the element, in bytes
+ */
+uint32_t
+ecma_typed_array_get_element_size (ecma_typed_array_type_t type) /**< type of the elements */
+{
+  JERRY_ASSERT (type < ECMA_TYPED_ARRAY__COUNT);
+
+  return ecma_typed_array_type_descs[type].element_size;
+} /* ecma_typed_array_get_element_size */
+
+/**
+ * Get [[Class]] of typed arrays of the specified type
+ *
+ * @return class name magic string
+ */
+lit_magic_string_id_t
+ecma_typed_array_get_class_name (ecma_typed_array_type_t type) /**< type of the elements */
+{
+  JERRY_ASSERT (type < ECMA_TYPED_ARRAY__COUNT);
+
+  return ecma_typed_array_type_descs[type].class_name;
+} /* ecma_typed_array_get_class_name */
+
+/**
+ * Convert ecma-number to length or offset value
+ *
+ * @return true - if the number is a non-negative integer, representable by uint32_t (the value is returned
+ *                through out_value_p),
+ *         false - otherwise.
+ */
+static bool
+ecma_typed_array_number_to_uint32 (ecma_number_t num, /**< ecma-number */
+                                   uint32_t *out_value_p) /**< out: the number's value */
+{
+  *out_value_p = ecma_number_to_uint32 (num);
+
+  return (ecma_uint32_to_number (*out_value_p) == num);
+} /* ecma_typed_array_number_to_uint32 */
+
+/**
+ * Get index, represented by the property name
+ *
+ * Note:
+ *      only canonical representations of array indices are accepted, other names, including
+ *      names of non-integer and negative numbers, are considered to be ordinary property names
+ *
+ * @return true - if the name is an array index (the index is returned through out_index_p),
+ *         false - otherwise.
+ */
+static bool
+ecma_typed_array_get_index_from_name (ecma_string_t *property_name_p, /**< property name */
+                                      uint32_t *out_index_p) /**< out: index */
+{
+  if (property_name_p->container == ECMA_STRING_CONTAINER_UINT32_IN_DESC)
+  {
+    *out_index_p = property_name_p->u.uint32_number;
+
+    return true;
+  }
+
+  /* names, not starting with a decimal digit, are rejected without conversion to number */
+  if (ecma_string_get_length (property_name_p) == 0)
+  {
+    return false;
+  }
+
+  ecma_char_t first_char = ecma_string_get_char_at_pos (property_name_p, 0);
+
+  if (first_char < '0' || first_char > '9')
+  {
+    return false;
+  }
+
+  ecma_number_t number = ecma_string_to_number (property_name_p);
+  uint32_t index = ecma_number_to_uint32 (number);
+
+  ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+  bool is_index = ecma_compare_ecma_strings (property_name_p, index_string_p);
+  ecma_deref_ecma_string (index_string_p);
+
+  *out_index_p = index;
+
+  return is_index;
+} /* ecma_typed_array_get_index_from_name */
+
+/**
+ * Create own non-writable, non-enumerable and non-configurable data property with number value
+ */
+static void
+ecma_typed_array_create_number_property (ecma_object_t *obj_p, /**< object */
+                                         lit_magic_string_id_t name_id, /**< property name */
+                                         uint32_t value) /**< value */
+{
+  ecma_string_t *name_p = ecma_get_magic_string (name_id);
+  ecma_property_t *prop_p = ecma_create_named_data_property (obj_p, name_p, false, false, false);
+
+  ecma_number_t *num_p = ecma_alloc_number ();
+  *num_p = ecma_uint32_to_number (value);
+  ecma_set_named_data_property_value (prop_p, ecma_make_number_value (num_p));
+
+  ecma_deref_ecma_string (name_p);
+} /* ecma_typed_array_create_number_property */
+
+/**
+ * Create TypedArray object, that is a view of the specified ArrayBuffer's data
+ *
+ * @return pointer to the TypedArray object
+ */
+ecma_object_t *
+ecma_op_create_typed_array_object (ecma_typed_array_type_t type, /**< type of the elements */
+                                   ecma_object_t *buffer_p, /**< ArrayBuffer object */
+                                   ecma_length_t byte_offset, /**< offset of the view in the buffer, in bytes */
+                                   ecma_length_t length) /**< number of the elements */
+{
+  JERRY_ASSERT (type < ECMA_TYPED_ARRAY__COUNT);
+
+  const uint32_t element_size = ecma_typed_array_get_element_size (type);
+  JERRY_ASSERT (byte_offset % element_size == 0);
+  JERRY_ASSERT (byte_offset + length * element_size <= ecma_op_array_buffer_get_byte_length (buffer_p));
+
+  ecma_object_t *prototype_obj_p = ecma_builtin_get (ecma_typed_array_type_descs[type].prototype_id);
+  ecma_object_t *obj_p = ecma_create_object (prototype_obj_p, true, ECMA_OBJECT_TYPE_TYPED_ARRAY);
+  ecma_deref_object (prototype_obj_p);
+
+  ecma_typed_array_create_number_property (obj_p, LIT_MAGIC_STRING_LENGTH, length);
+  ecma_typed_array_create_number_property (obj_p, LIT_MAGIC_STRING_BYTE_LENGTH_UL, length * element_size);
+  ecma_typed_array_create_number_property (obj_p, LIT_MAGIC_STRING_BYTE_OFFSET_UL, byte_offset);
+
+  ecma_string_t *buffer_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_BUFFER);
+  ecma_property_t *buffer_prop_p = ecma_create_named_data_property (obj_p,
+                                                                    buffer_magic_string_p,
+                                                                    false, false, false);
+  ecma_named_data_property_assign_value (obj_p, buffer_prop_p, ecma_make_object_value (buffer_p));
+  ecma_deref_ecma_string (buffer_magic_string_p);
+
+  /*
+   * Internal properties are created after the named ones, so they are placed at the beginning
+   * of the property list, and are found quickly upon accesses to the elements.
+   */
+  ecma_property_t *buffer_internal_prop_p = ecma_create_internal_property (obj_p,
+                                                                           ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_BUFFER);
+  ECMA_SET_NON_NULL_POINTER (buffer_internal_prop_p->u.internal_property.value, buffer_p);
+
+  ecma_property_t *byte_offset_prop_p = ecma_create_internal_property (obj_p,
+                                                                       ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_BYTE_OFFSET);
+  byte_offset_prop_p->u.internal_property.value = byte_offset;
+
+  ecma_property_t *type_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_TYPE);
+  type_prop_p->u.internal_property.value = type;
+
+  ecma_property_t *length_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_LENGTH);
+  length_prop_p->u.internal_property.value = length;
+
+  return obj_p;
+} /* ecma_op_create_typed_array_object */
+
+/**
+ * Create TypedArray object with new ArrayBuffer of the specified number of elements
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+static ecma_completion_value_t
+ecma_op_create_typed_array_object_with_length (ecma_typed_array_type_t type, /**< type of the elements */
+                                               ecma_number_t length_num) /**< number of the elements */
+{
+  const uint32_t element_size = ecma_typed_array_get_element_size (type);
+
+  uint32_t length;
+
+  if (!ecma_typed_array_number_to_uint32 (length_num, &length)
+      || length > CONFIG_MEM_HEAP_AREA_SIZE / element_size)
+  {
+    /* the length is not an integer, or the data can't be allocated at all */
+    return ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_RANGE));
+  }
+
+  ecma_object_t *buffer_p = ecma_op_create_array_buffer_object (length * element_size);
+  ecma_object_t *obj_p = ecma_op_create_typed_array_object (type, buffer_p, 0, length);
+  ecma_deref_object (buffer_p);
+
+  return ecma_make_normal_completion_value (ecma_make_object_value (obj_p));
+} /* ecma_op_create_typed_array_object_with_length */
+
+/**
+ * Create TypedArray object, that is a view of a range of the ArrayBuffer's data
+ *
+ * See also: ECMA-262 v6, 22.2.1.4
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+static ecma_completion_value_t
+ecma_op_create_typed_array_object_from_buffer (ecma_typed_array_type_t type, /**< type of the elements */
+                                               ecma_object_t *buffer_p, /**< ArrayBuffer object */
+                                               ecma_value_t byte_offset_value, /**< offset of the view */
+                                               ecma_value_t length_value) /**< number of the elements */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  const uint32_t element_size = ecma_typed_array_get_element_size (type);
+  const uint32_t buffer_byte_length = ecma_op_array_buffer_get_byte_length (buffer_p);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (byte_offset_num, byte_offset_value, ret_value);
+  ECMA_OP_TO_NUMBER_TRY_CATCH (length_num, length_value, ret_value);
+
+  uint32_t byte_offset = 0;
+  uint32_t length = 0;
+
+  bool is_range_valid = (ecma_is_value_undefined (byte_offset_value)
+                         || ecma_typed_array_number_to_uint32 (byte_offset_num, &byte_offset));
+  is_range_valid = (is_range_valid
+                    && byte_offset % element_size == 0
+                    && byte_offset <= buffer_byte_length);
+
+  if (is_range_valid)
+  {
+    if (ecma_is_value_undefined (length_value))
+    {
+      is_range_valid = ((buffer_byte_length - byte_offset) % element_size == 0);
+      length = (buffer_byte_length - byte_offset) / element_size;
+    }
+    else
+    {
+      is_range_valid = (ecma_typed_array_number_to_uint32 (length_num, &length)
+                        && length <= (buffer_byte_length - byte_offset) / element_size);
+    }
+  }
+
+  if (!is_range_valid)
+  {
+    ret_value = ecma_make_throw_obj_completion_value (ecma_new_standard_error (ECMA_ERROR_RANGE));
+  }
+  else
+  {
+    ecma_object_t *obj_p = ecma_op_create_typed_array_object (type, buffer_p, byte_offset, length);
+
+    ret_value = ecma_make_normal_completion_value (ecma_make_object_value (obj_p));
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (length_num);
+  ECMA_OP_TO_NUMBER_FINALIZE (byte_offset_num);
+
+  return ret_value;
+} /* ecma_op_create_typed_array_object_from_buffer */
+
+/**
+ * Create TypedArray object with elements, copied from an array-like object
+ *
+ * See also: ECMA-262 v6, 22.2.1.3
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+static ecma_completion_value_t
+ecma_op_create_typed_array_object_from_object (ecma_typed_array_type_t type, /**< type of the elements */
+                                               ecma_object_t *source_p) /**< array-like object */
+{
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+
+  ECMA_TRY_CATCH (length_value, ecma_op_object_get (source_p, length_magic_string_p), ret_value);
+  ECMA_OP_TO_NUMBER_TRY_CATCH (length_num, length_value, ret_value);
+
+  ecma_number_t length = ecma_uint32_to_number (ecma_number_to_uint32 (length_num));
+  ecma_completion_value_t create_completion = ecma_op_create_typed_array_object_with_length (type, length);
+
+  if (ecma_is_completion_value_throw (create_completion))
+  {
+    ret_value = create_completion;
+  }
+  else
+  {
+    ecma_object_t *obj_p = ecma_get_object_from_completion_value (create_completion);
+    const uint32_t length = ecma_op_typed_array_get_length (obj_p);
+
+    for (uint32_t index = 0;
+         index < length && ecma_is_completion_value_empty (ret_value);
+         index++)
+    {
+      ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+
+      ECMA_TRY_CATCH (element_value, ecma_op_object_get (source_p, index_string_p), ret_value);
+      ECMA_OP_TO_NUMBER_TRY_CATCH (element_num, element_value, ret_value);
+
+      ecma_op_typed_array_set_element (obj_p, index, element_num);
+
+      ECMA_OP_TO_NUMBER_FINALIZE (element_num);
+      ECMA_FINALIZE (element_value);
+
+      ecma_deref_ecma_string (index_string_p);
+    }
+
+    if (ecma_is_completion_value_empty (ret_value))
+    {
+      ret_value = create_completion;
+    }
+    else
+    {
+      ecma_free_completion_value (create_completion);
+    }
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (length_num);
+  ECMA_FINALIZE (length_value);
+
+  ecma_deref_ecma_string (length_magic_string_p);
+
+  return ret_value;
+} /* ecma_op_create_typed_array_object_from_object */
+
+/**
+ * TypedArray object creation operation
+ *
+ * See also: ECMA-262 v6, 22.2.1
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+ecma_op_create_typed_array_object_from_arguments (ecma_typed_array_type_t type, /**< type of the elements */
+                                                  const ecma_value_t *arguments_list_p, /**< list of arguments that
+                                                                                         *   are passed to TypedArray
+                                                                                         *   constructor */
+                                                  ecma_length_t arguments_list_len) /**< length of the arguments'
+                                                                                     *   list */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  const ecma_value_t undefined_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  ecma_value_t arg1 = (arguments_list_len > 0 ? arguments_list_p[0] : undefined_value);
+
+  if (!ecma_is_value_object (arg1))
+  {
+    ECMA_OP_TO_NUMBER_TRY_CATCH (length_num, arg1, ret_value);
+
+    ret_value = ecma_op_create_typed_array_object_with_length (type,
+                                                               (ecma_is_value_undefined (arg1) ? ECMA_NUMBER_ZERO
+                                                                                               : length_num));
+
+    ECMA_OP_TO_NUMBER_FINALIZE (length_num);
+  }
+  else if (ecma_op_is_array_buffer (arg1))
+  {
+    ecma_value_t arg2 = (arguments_list_len > 1 ? arguments_list_p[1] : undefined_value);
+    ecma_value_t arg3 = (arguments_list_len > 2 ? arguments_list_p[2] : undefined_value);
+
+    ret_value = ecma_op_create_typed_array_object_from_buffer (type, ecma_get_object_from_value (arg1), arg2, arg3);
+  }
+  else
+  {
+    ret_value = ecma_op_create_typed_array_object_from_object (type, ecma_get_object_from_value (arg1));
+  }
+
+  return ret_value;
+} /* ecma_op_create_typed_array_object_from_arguments */
+
+/**
+ * Check whether the value is a TypedArray object
+ *
+ * @return true - if the value is a TypedArray object,
+ *         false - otherwise.
+ */
+bool
+ecma_op_is_typed_array (ecma_value_t value) /**< ecma-value */
+{
+  return (ecma_is_value_object (value)
+          && ecma_get_object_type (ecma_get_object_from_value (value)) == ECMA_OBJECT_TYPE_TYPED_ARRAY);
+} /* ecma_op_is_typed_array */
+
+/**
+ * Get type of the TypedArray object's elements
+ *
+ * @return type of the elements
+ */
+ecma_typed_array_type_t
+ecma_op_typed_array_get_type (ecma_object_t *obj_p) /**< TypedArray object */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPED_ARRAY);
+
+  ecma_property_t *type_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_TYPE);
+
+  return (ecma_typed_array_type_t) type_prop_p->u.internal_property.value;
+} /* ecma_op_typed_array_get_type */
+
+/**
+ * Get number of the TypedArray object's elements
+ *
+ * @return number of the elements
+ */
+ecma_length_t
+ecma_op_typed_array_get_length (ecma_object_t *obj_p) /**< TypedArray object */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPED_ARRAY);
+
+  ecma_property_t *length_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_LENGTH);
+
+  return length_prop_p->u.internal_property.value;
+} /* ecma_op_typed_array_get_length */
+
+/**
+ * Get offset of the TypedArray object's view in the ArrayBuffer
+ *
+ * @return offset, in bytes
+ */
+ecma_length_t
+ecma_op_typed_array_get_byte_offset (ecma_object_t *obj_p) /**< TypedArray object */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPED_ARRAY);
+
+  ecma_property_t *byte_offset_prop_p = ecma_get_internal_property (obj_p,
+                                                                    ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_BYTE_OFFSET);
+
+  return byte_offset_prop_p->u.internal_property.value;
+} /* ecma_op_typed_array_get_byte_offset */
+
+/**
+ * Get ArrayBuffer object, viewed by the TypedArray object
+ *
+ * Note:
+ *      reference counter of the ArrayBuffer object is not increased
+ *
+ * @return pointer to the ArrayBuffer object
+ */
+ecma_object_t *
+ecma_op_typed_array_get_buffer (ecma_object_t *obj_p) /**< TypedArray object */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPED_ARRAY);
+
+  ecma_property_t *buffer_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPED_ARRAY_BUFFER);
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_object_t, buffer_prop_p->u.internal_property.value);
+} /* ecma_op_typed_array_get_buffer */
+
+/**
+ * Get data of the TypedArray object's view
+ *
+ * @return pointer to the first element of the view (NULL - if the view's buffer is empty)
+ */
+uint8_t *
+ecma_op_typed_array_get_data (ecma_object_t *obj_p) /**< TypedArray object */
+{
+  uint8_t *buffer_data_p = ecma_op_array_buffer_get_data (ecma_op_typed_array_get_buffer (obj_p));
+
+  if (buffer_data_p == NULL)
+  {
+    return NULL;
+  }
+
+  return buffer_data_p + ecma_op_typed_array_get_byte_offset (obj_p);
+} /* ecma_op_typed_array_get_data */
+
+/**
+ * Check whether the number is an index of an element of the TypedArray object
+ *
+ * The routine is intended for fast paths of indexed accesses, that don't convert the index to string.
+ *
+ * @return true - if the number is an integer that is less than the number of elements
+ *                (the index is returned through out_index_p),
+ *         false - otherwise.
+ */
+bool
+ecma_op_typed_array_is_element_index (ecma_object_t *obj_p, /**< TypedArray object */
+                                      ecma_number_t index_num, /**< index */
+                                      uint32_t *out_index_p) /**< out: index */
+{
+  return (ecma_typed_array_number_to_uint32 (index_num, out_index_p)
+          && *out_index_p < ecma_op_typed_array_get_length (obj_p));
+} /* ecma_op_typed_array_is_element_index */
+
+/**
+ * Get value of the TypedArray object's element
+ *
+ * @return element's value
+ */
+ecma_number_t
+ecma_op_typed_array_get_element (ecma_object_t *obj_p, /**< TypedArray object */
+                                 uint32_t index) /**< index of the element */
+{
+  JERRY_ASSERT (index < ecma_op_typed_array_get_length (obj_p));
+
+  const ecma_typed_array_type_t type = ecma_op_typed_array_get_type (obj_p);
+  const uint8_t *element_p = ecma_op_typed_array_get_data (obj_p) + index * ecma_typed_array_get_element_size (type);
+
+  /* the elements are copied with memcpy, as external buffers are not necessarily aligned */
+  switch (type)
+  {
+    case ECMA_TYPED_ARRAY_INT8:
+    {
+      return (ecma_number_t) (int8_t) *element_p;
+    }
+    case ECMA_TYPED_ARRAY_UINT8:
+    case ECMA_TYPED_ARRAY_UINT8_CLAMPED:
+    {
+      return (ecma_number_t) *element_p;
+    }
+    case ECMA_TYPED_ARRAY_INT16:
+    {
+      int16_t value;
+      memcpy (&value, element_p, sizeof (value));
+
+      return (ecma_number_t) value;
+    }
+    case ECMA_TYPED_ARRAY_UINT16:
+    {
+      uint16_t value;
+      memcpy (&value, element_p, sizeof (value));
+
+      return (ecma_number_t) value;
+    }
+    case ECMA_TYPED_ARRAY_INT32:
+    {
+      int32_t value;
+      memcpy (&value, element_p, sizeof (value));
+
+      return (ecma_number_t) value;
+    }
+    case ECMA_TYPED_ARRAY_UINT32:
+    {
+      uint32_t value;
+      memcpy (&value, element_p, sizeof (value));
+
+      return ecma_uint32_to_number (value);
+    }
+    case ECMA_TYPED_ARRAY_FLOAT32:
+    {
+      float value;
+      memcpy (&value, element_p, sizeof (value));
+
+      return (ecma_number_t) value;
+    }
+    case ECMA_TYPED_ARRAY_FLOAT64:
+    {
+      double value;
+      memcpy (&value, element_p, sizeof (value));
+
+      return (ecma_number_t) value;
+    }
+    case ECMA_TYPED_ARRAY__COUNT:
+    {
+      break;
+    }
+  }
+
+  JERRY_UNREACHABLE ();
+} /* ecma_op_typed_array_get_element */
+
+/**
+ * Convert number to value of Uint8ClampedArray's element
+ *
+ * See also: ECMA-262 v6, 7.1.11
+ *
+ * @return element's value
+ */
+static uint8_t
+ecma_typed_array_number_to_uint8_clamped (ecma_number_t num) /**< ecma-number */
+{
+  if (ecma_number_is_nan (num)
+      || num <= ECMA_NUMBER_ZERO)
+  {
+    return 0;
+  }
+  else if (num >= (ecma_number_t) UINT8_MAX)
+  {
+    return UINT8_MAX;
+  }
+
+  ecma_number_t floor = ecma_number_trunc (num);
+  ecma_number_t diff = num - floor;
+  uint8_t value = (uint8_t) floor;
+
+  /* ties are rounded to even */
+  if (diff > ECMA_NUMBER_HALF
+      || (diff == ECMA_NUMBER_HALF && (value & 1u) != 0))
+  {
+    value++;
+  }
+
+  return value;
+} /* ecma_typed_array_number_to_uint8_clamped */
+
+/**
+ * Set value of the TypedArray object's element
+ *
+ * The value is converted to the elements' type as described in ECMA-262 v6, 24.1.1.6.
+ */
+void
+ecma_op_typed_array_set_element (ecma_object_t *obj_p, /**< TypedArray object */
+                                 uint32_t index, /**< index of the element */
+                                 ecma_number_t value) /**< new value */
+{
+  JERRY_ASSERT (index < ecma_op_typed_array_get_length (obj_p));
+
+  const ecma_typed_array_type_t type = ecma_op_typed_array_get_type (obj_p);
+  uint8_t *element_p = ecma_op_typed_array_get_data (obj_p) + index * ecma_typed_array_get_element_size (type);
+
+  switch (type)
+  {
+    case ECMA_TYPED_ARRAY_INT8:
+    case ECMA_TYPED_ARRAY_UINT8:
+    {
+      *element_p = (uint8_t) ecma_number_to_uint32 (value);
+      return;
+    }
+    case ECMA_TYPED_ARRAY_UINT8_CLAMPED:
+    {
+      *element_p = ecma_typed_array_number_to_uint8_clamped (value);
+      return;
+    }
+    case ECMA_TYPED_ARRAY_INT16:
+    case ECMA_TYPED_ARRAY_UINT16:
+    {
+      uint16_t element = (uint16_t) ecma_number_to_uint32 (value);
+      memcpy (element_p, &element, sizeof (element));
+      return;
+    }
+    case ECMA_TYPED_ARRAY_INT32:
+    case ECMA_TYPED_ARRAY_UINT32:
+    {
+      uint32_t element = ecma_number_to_uint32 (value);
+      memcpy (element_p, &element, sizeof (element));
+      return;
+    }
+    case ECMA_TYPED_ARRAY_FLOAT32:
+    {
+      float element = (float) value;
+      memcpy (element_p, &element, sizeof (element));
+      return;
+    }
+    case ECMA_TYPED_ARRAY_FLOAT64:
+    {
+      double element = (double) value;
+      memcpy (element_p, &element, sizeof (element));
+      return;
+    }
+    case ECMA_TYPED_ARRAY__COUNT:
+    {
+      break;
+    }
+  }
+
+  JERRY_UNREACHABLE ();
+} /* ecma_op_typed_array_set_element */
+
+/**
+ * [[Get]] ecma TypedArray object's operation
+ *
+ * See also:
+ *          ECMA-262 v6, 9.4.5.4
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+ecma_op_typed_array_object_get (ecma_object_t *obj_p, /**< the TypedArray object */
+                                ecma_string_t *property_name_p) /**< property name */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPED_ARRAY);
+
+  uint32_t index;
+
+  if (!ecma_typed_array_get_index_from_name (property_name_p, &index))
+  {
+    return ecma_op_general_object_get (obj_p, property_name_p);
+  }
+
+  if (index >= ecma_op_typed_array_get_length (obj_p))
+  {
+    return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  ecma_number_t *num_p = ecma_alloc_number ();
+  *num_p = ecma_op_typed_array_get_element (obj_p, index);
+
+  return ecma_make_normal_completion_value (ecma_make_number_value (num_p));
+} /* ecma_op_typed_array_object_get */
+
+/**
+ * [[Put]] ecma TypedArray object's operation
+ *
+ * See also:
+ *          ECMA-262 v6, 9.4.5.5
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+ecma_op_typed_array_object_put (ecma_object_t *obj_p, /**< the TypedArray object */
+                                ecma_string_t *property_name_p, /**< property name */
+                                ecma_value_t value, /**< ecma-value */
+                                bool is_throw) /**< flag that controls failure handling */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPED_ARRAY);
+
+  uint32_t index;
+
+  if (!ecma_typed_array_get_index_from_name (property_name_p, &index))
+  {
+    return ecma_op_general_object_put (obj_p, property_name_p, value, is_throw);
+  }
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (value_num, value, ret_value);
+
+  /* assignments to elements out of the view's bounds are ignored */
+  if (index < ecma_op_typed_array_get_length (obj_p))
+  {
+    ecma_op_typed_array_set_element (obj_p, index, value_num);
+  }
+
+  ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_TRUE);
+
+  ECMA_OP_TO_NUMBER_FINALIZE (value_num);
+
+  return ret_value;
+} /* ecma_op_typed_array_object_put */
+
+/**
+ * [[GetOwnProperty]] ecma TypedArray object's operation
+ *
+ * Properties of elements are created upon first request, and their values are updated
+ * from the view's data upon each request.
+ *
+ * See also:
+ *          ECMA-262 v6, 9.4.5.1
+ *
+ * @return pointer to a property - if it exists,
+ *         NULL (i.e. ecma-undefined) - otherwise.
+ */
+ecma_property_t *
+ecma_op_typed_array_object_get_own_property (ecma_object_t *obj_p, /**< the TypedArray object */
+                                             ecma_string_t *property_name_p) /**< property name */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPED_ARRAY);
+
+  uint32_t index;
+
+  if (!ecma_typed_array_get_index_from_name (property_name_p, &index))
+  {
+    return ecma_op_general_object_get_own_property (obj_p, property_name_p);
+  }
+
+  if (index >= ecma_op_typed_array_get_length (obj_p))
+  {
+    return NULL;
+  }
+
+  ecma_property_t *prop_p = ecma_op_general_object_get_own_property (obj_p, property_name_p);
+
+  if (prop_p == NULL)
+  {
+    prop_p = ecma_create_named_data_property (obj_p, property_name_p, true, true, false);
+
+    ecma_number_t *num_p = ecma_alloc_number ();
+    ecma_set_named_data_property_value (prop_p, ecma_make_number_value (num_p));
+  }
+
+  ecma_value_t prop_value = ecma_get_named_data_property_value (prop_p);
+  JERRY_ASSERT (ecma_is_value_number (prop_value));
+
+  *ecma_get_number_from_value (prop_value) = ecma_op_typed_array_get_element (obj_p, index);
+
+  return prop_p;
+} /* ecma_op_typed_array_object_get_own_property */
+
+/**
+ * [[DefineOwnProperty]] ecma TypedArray object's operation
+ *
+ * See also:
+ *          ECMA-262 v6, 9.4.5.3
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+ecma_op_typed_array_object_define_own_property (ecma_object_t *obj_p, /**< the TypedArray object */
+                                                ecma_string_t *property_name_p, /**< property name */
+                                                const ecma_property_descriptor_t *property_desc_p, /**< property
+                                                                                                    *   descriptor */
+                                                bool is_throw) /**< flag that controls failure handling */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPED_ARRAY);
+
+  uint32_t index;
+
+  if (!ecma_typed_array_get_index_from_name (property_name_p, &index))
+  {
+    return ecma_op_general_object_define_own_property (obj_p, property_name_p, property_desc_p, is_throw);
+  }
+
+  /* elements are always writable, enumerable and non-configurable data properties */
+  if (index >= ecma_op_typed_array_get_length (obj_p)
+      || property_desc_p->is_get_defined
+      || property_desc_p->is_set_defined
+      || (property_desc_p->is_configurable_defined && property_desc_p->is_configurable)
+      || (property_desc_p->is_enumerable_defined && !property_desc_p->is_enumerable)
+      || (property_desc_p->is_writable_defined && !property_desc_p->is_writable))
+  {
+    return ecma_reject (is_throw);
+  }
+
+  if (!property_desc_p->is_value_defined)
+  {
+    return ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (value_num, property_desc_p->value, ret_value);
+
+  ecma_op_typed_array_set_element (obj_p, index, value_num);
+
+  ret_value = ecma_make_simple_completion_value (ECMA_SIMPLE_VALUE_TRUE);
+
+  ECMA_OP_TO_NUMBER_FINALIZE (value_num);
+
+  return ret_value;
+} /* ecma_op_typed_array_object_define_own_property */
+
+/**
+ * [[Delete]] ecma TypedArray object's operation
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+ecma_op_typed_array_object_delete (ecma_object_t *obj_p, /**< the TypedArray object */
+                                   ecma_string_t *property_name_p, /**< property name */
+                                   bool is_throw) /**< flag that controls failure handling */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_TYPED_ARRAY);
+
+  uint32_t index;
+
+  if (ecma_typed_array_get_index_from_name (property_name_p, &index)
+      && index < ecma_op_typed_array_get_length (obj_p))
+  {
+    /* elements are non-configurable */
+    return ecma_reject (is_throw);
+  }
+
+  return ecma_op_general_object_delete (obj_p, property_name_p, is_throw);
+} /* ecma_op_typed_array_object_delete */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
@@ -0,0 +1,114 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_TYPEDARRAY_OBJECT_H
+#define ECMA_TYPEDARRAY_OBJECT_H
+
+#include "ecma-globals.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmatypedarrayobject ECMA TypedArray object related routines
+ * @{
+ */
+
+/**
+ * Types of typed arrays' elements
+ */
+typedef enum
+{
+  ECMA_TYPED_ARRAY_INT8, /**< Int8Array */
+  ECMA_TYPED_ARRAY_UINT8, /**< Uint8Array */
+  ECMA_TYPED_ARRAY_UINT8_CLAMPED, /**< Uint8ClampedArray */
+  ECMA_TYPED_ARRAY_INT16, /**< Int16Array */
+  ECMA_TYPED_ARRAY_UINT16, /**< Uint16Array */
+  ECMA_TYPED_ARRAY_INT32, /**< Int32Array */
+  ECMA_TYPED_ARRAY_UINT32, /**< Uint32Array */
+  ECMA_TYPED_ARRAY_FLOAT32, /**< Float32Array */
+  ECMA_TYPED_ARRAY_FLOAT64, /**< Float64Array */
+  ECMA_TYPED_ARRAY__COUNT /**< number of the types */
+} ecma_typed_array_type_t;
+
+extern uint32_t
+ecma_typed_array_get_element_size (ecma_typed_array_type_t type);
+extern lit_magic_string_id_t
+ecma_typed_array_get_class_name (ecma_typed_array_type_t type);
+
+extern ecma_object_t *
+ecma_op_create_typed_array_object (ecma_typed_array_type_t type,
+                                   ecma_object_t *buffer_p,
+                                   ecma_length_t byte_offset,
+                                   ecma_length_t length);
+extern ecma_completion_value_t
+ecma_op_create_typed_array_object_from_arguments (ecma_typed_array_type_t type,
+                                                  const ecma_value_t *arguments_list_p,
+                                                  ecma_length_t arguments_list_len);
+
+extern bool
+ecma_op_is_typed_array (ecma_value_t value);
+extern ecma_typed_array_type_t
+ecma_op_typed_array_get_type (ecma_object_t *obj_p);
+extern ecma_length_t
+ecma_op_typed_array_get_length (ecma_object_t *obj_p);
+extern ecma_length_t
+ecma_op_typed_array_get_byte_offset (ecma_object_t *obj_p);
+extern ecma_object_t *
+ecma_op_typed_array_get_buffer (ecma_object_t *obj_p);
+extern uint8_t *
+ecma_op_typed_array_get_data (ecma_object_t *obj_p);
+
+extern bool
+ecma_op_typed_array_is_element_index (ecma_object_t *obj_p,
+                                      ecma_number_t index_num,
+                                      uint32_t *out_index_p);
+extern ecma_number_t
+ecma_op_typed_array_get_element (ecma_object_t *obj_p,
+                                 uint32_t index);
+extern void
+ecma_op_typed_array_set_element (ecma_object_t *obj_p,
+                                 uint32_t index,
+                                 ecma_number_t value);
+
+extern ecma_completion_value_t
+ecma_op_typed_array_object_get (ecma_object_t *obj_p,
+                                ecma_string_t *property_name_p);
+extern ecma_completion_value_t
+ecma_op_typed_array_object_put (ecma_object_t *obj_p,
+                                ecma_string_t *property_name_p,
+                                ecma_value_t value,
+                                bool is_throw);
+extern ecma_property_t *
+ecma_op_typed_array_object_get_own_property (ecma_object_t *obj_p,
+                                             ecma_string_t *property_name_p);
+extern ecma_completion_value_t
+ecma_op_typed_array_object_define_own_property (ecma_object_t *obj_p,
+                                                ecma_string_t *property_name_p,
+                                                const ecma_property_descriptor_t *property_desc_p,
+                                                bool is_throw);
+extern ecma_completion_value_t
+ecma_op_typed_array_object_delete (ecma_object_t *obj_p,
+                                   ecma_string_t *property_name_p,
+                                   bool is_throw);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+#endif /* !ECMA_TYPEDARRAY_OBJECT_H */
@@ -133,16 +133,46 @@ typedef bool (*jerry_external_handler_t) (const jerry_api_object_t *function_obj
                                           const jerry_api_value_t args_p[],
                                           const jerry_api_length_t args_count);
 
+/**
+ * Jerry external function handler type with numeric signature
+ *
+ * Arguments of the function are converted to numbers before the handler is invoked,
+ * and the handler's result is returned to the caller as a number, so no API values are created for the call.
+ */
+typedef double (*jerry_external_number_handler_t) (const double args_p[],
+                                                   const jerry_api_length_t args_count);
+
 /**
  * An object's native free callback
  */
 typedef void (*jerry_object_free_callback_t) (const uintptr_t native_p);
 
+/**
+ * An external string's buffer free callback
+ */
+typedef void (*jerry_string_free_callback_t) (const jerry_api_char_t *chars_p, jerry_api_size_t size);
+
+/**
+ * Read-only view of a string's characters (see also: jerry_api_string_lock_chars)
+ */
+typedef struct
+{
+  const jerry_api_char_t *chars_p; /**< utf-8 characters of the string (not zero-terminated) */
+  jerry_api_size_t size; /**< size of the characters, in bytes */
+
+  jerry_api_string_t *string_p; /**< the string, kept alive while its characters are locked */
+  bool is_copy; /**< flag, indicating whether the characters were copied to a temporary buffer */
+} jerry_api_string_chars_t;
+
 extern EXTERN_C ssize_t
 jerry_api_string_to_char_buffer (const jerry_api_string_t *string_p,
                                  jerry_api_char_t *buffer_p,
                                  ssize_t buffer_size);
 extern EXTERN_C
+void jerry_api_string_lock_chars (jerry_api_string_t *string_p, jerry_api_string_chars_t *out_chars_p);
+extern EXTERN_C
+void jerry_api_string_unlock_chars (jerry_api_string_chars_t *chars_p);
+extern EXTERN_C
 jerry_api_string_t* jerry_api_acquire_string (jerry_api_string_t *string_p);
 extern EXTERN_C
 void jerry_api_release_string (jerry_api_string_t *string_p);
@@ -160,6 +190,10 @@ jerry_api_string_t *jerry_api_create_string (const jerry_api_char_t *v);
 extern EXTERN_C
 jerry_api_string_t *jerry_api_create_string_sz (const jerry_api_char_t *, jerry_api_size_t);
 extern EXTERN_C
+jerry_api_string_t *jerry_api_create_external_string (const jerry_api_char_t *,
+                                                      jerry_api_size_t,
+                                                      jerry_string_free_callback_t);
+extern EXTERN_C
 jerry_api_object_t* jerry_api_create_object (void);
 extern EXTERN_C
 jerry_api_object_t* jerry_api_create_error (jerry_api_error_t error_type,
@@ -170,6 +204,16 @@ jerry_api_object_t* jerry_api_create_error_sz (jerry_api_error_t error_type,
                                                jerry_api_size_t message_size);
 extern EXTERN_C
 jerry_api_object_t* jerry_api_create_external_function (jerry_external_handler_t handler_p);
+extern EXTERN_C
+jerry_api_object_t* jerry_api_create_external_number_function (jerry_external_number_handler_t handler_p);
+extern EXTERN_C
+jerry_api_object_t* jerry_api_create_array_buffer (jerry_api_size_t size);
+extern EXTERN_C
+jerry_api_object_t* jerry_api_create_external_array_buffer (uint8_t *buffer_p, jerry_api_size_t size);
+extern EXTERN_C
+bool jerry_api_get_array_buffer_data (jerry_api_object_t *object_p,
+                                      uint8_t **out_buffer_p,
+                                      jerry_api_size_t *out_size_p);
 
 extern EXTERN_C
 bool jerry_api_is_function (const jerry_api_object_t *object_p);
@@ -30,10 +30,20 @@ jerry_dispatch_external_function (ecma_object_t *function_object_p,
                                   const ecma_value_t args_p[],
                                   ecma_length_t args_count);
 
+extern ecma_completion_value_t
+jerry_dispatch_external_number_function (ecma_external_pointer_t handler_p,
+                                         const ecma_value_t args_p[],
+                                         ecma_length_t args_count);
+
 extern void
 jerry_dispatch_object_free_callback (ecma_external_pointer_t freecb_p,
                                      ecma_external_pointer_t native_p);
 
+extern void
+jerry_dispatch_external_string_free_callback (ecma_external_pointer_t freecb_p,
+                                              const lit_utf8_byte_t *chars_p,
+                                              lit_utf8_size_t size);
+
 extern bool
 jerry_is_abort_on_fail (void);
 
@@ -16,6 +16,7 @@
 #include <stdio.h>
 
 #include "ecma-alloc.h"
+#include "ecma-arraybuffer-object.h"
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
 #include "ecma-eval.h"
@@ -23,11 +24,17 @@
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
+#include "ecma-lcache.h"
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
+#include "ecma-stack.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "jsp-eval-cache.h"
 #include "lit-magic-strings.h"
 #include "parser.h"
 #include "serializer.h"
+#include "vm-profile.h"
 
 #define JERRY_INTERNAL
 #include "jerry-internal.h"
@@ -57,6 +64,48 @@ static jerry_flag_t jerry_flags;
  */
 static bool jerry_api_available;
 
+/**
+ * Magic number, identifying heap snapshots
+ */
+#define JERRY_HEAP_SNAPSHOT_MAGIC (0x4A485331u) /* "JHS1" */
+
+/**
+ * Version of heap snapshots' format
+ */
+#define JERRY_HEAP_SNAPSHOT_VERSION (2u)
+
+/**
+ * Signature of engine's build configuration, stored in a heap snapshot
+ *
+ * A snapshot can only be restored by an engine with the same configuration of heap layout.
+ */
+typedef struct
+{
+  uint32_t magic; /**< JERRY_HEAP_SNAPSHOT_MAGIC */
+  uint32_t version; /**< JERRY_HEAP_SNAPSHOT_VERSION */
+  uint32_t header_size; /**< size of snapshot's header */
+  uint32_t heap_area_size; /**< size of heap area */
+  uint32_t heap_chunk_size; /**< size of heap chunk */
+  uint32_t pool_chunk_size; /**< size of pool chunk */
+  uint32_t builtins_number; /**< number of built-in objects */
+  uint32_t magic_strings_number; /**< number of magic strings */
+  uint32_t number_size; /**< size of ecma-number */
+  uint32_t char_size; /**< size of ecma-character */
+} jerry_heap_snapshot_signature_t;
+
+/**
+ * Header of a heap snapshot
+ *
+ * The header is followed by image of the heap's beginning (see also: mem_get_snapshot_image_size).
+ */
+typedef struct
+{
+  jerry_heap_snapshot_signature_t signature; /**< signature of engine's build configuration */
+  mem_snapshot_state_t mem; /**< memory allocators' state */
+  serializer_snapshot_state_t serializer; /**< serializer's state */
+  ecma_snapshot_state_t ecma; /**< ECMA components' state */
+} jerry_heap_snapshot_header_t;
+
 /** \addtogroup jerry_extension Jerry engine extension interface
  * @{
  */
@@ -305,6 +354,79 @@ jerry_api_string_to_char_buffer (const jerry_api_string_t *string_p, /**< string
   return ret_val;
 } /* jerry_api_string_to_char_buffer */
 
+/**
+ * Lock characters of the string for read-only access
+ *
+ * If the string's characters are already stored contiguously (string literals, magic strings, etc.),
+ * pointer to the characters is returned without copying. Otherwise, the characters are copied
+ * to a temporary buffer on the engine's heap.
+ *
+ * Warning:
+ *         locked characters should be unlocked with jerry_api_string_unlock_chars
+ */
+void
+jerry_api_string_lock_chars (jerry_api_string_t *string_p, /**< string */
+                             jerry_api_string_chars_t *out_chars_p) /**< out: view of the string's characters */
+{
+  jerry_assert_api_available ();
+
+  ecma_string_t *pinned_string_p = ecma_copy_or_ref_ecma_string (string_p);
+
+  lit_utf8_size_t size;
+  const lit_utf8_byte_t *chars_p = ecma_string_get_contiguous_chars (pinned_string_p, &size);
+
+  out_chars_p->string_p = pinned_string_p;
+
+  if (chars_p != NULL)
+  {
+    out_chars_p->chars_p = (const jerry_api_char_t *) chars_p;
+    out_chars_p->size = (jerry_api_size_t) size;
+    out_chars_p->is_copy = false;
+  }
+  else
+  {
+    size = ecma_string_get_size (pinned_string_p);
+
+    lit_utf8_byte_t *buffer_p = NULL;
+
+    if (size != 0)
+    {
+      buffer_p = (lit_utf8_byte_t *) mem_heap_alloc_block (size, MEM_HEAP_ALLOC_LONG_TERM);
+
+      ssize_t bytes_copied = ecma_string_to_utf8_string (pinned_string_p, buffer_p, (ssize_t) size);
+      JERRY_ASSERT (bytes_copied == (ssize_t) size);
+    }
+
+    out_chars_p->chars_p = (const jerry_api_char_t *) buffer_p;
+    out_chars_p->size = (jerry_api_size_t) size;
+    out_chars_p->is_copy = (buffer_p != NULL);
+  }
+} /* jerry_api_string_lock_chars */
+
+/**
+ * Unlock characters of the string, previously locked with jerry_api_string_lock_chars
+ *
+ * Note:
+ *      after the call, the characters' pointer should not be used
+ */
+void
+jerry_api_string_unlock_chars (jerry_api_string_chars_t *chars_p) /**< view of a string's characters */
+{
+  jerry_assert_api_available ();
+
+  if (chars_p->is_copy)
+  {
+    mem_heap_free_block ((void *) chars_p->chars_p);
+  }
+
+  ecma_deref_ecma_string (chars_p->string_p);
+
+  chars_p->chars_p = NULL;
+  chars_p->size = 0;
+  chars_p->string_p = NULL;
+  chars_p->is_copy = false;
+} /* jerry_api_string_unlock_chars */
+
 /**
  * Acquire string pointer for usage outside of the engine
  * from string retrieved in extension routine call from engine.
@@ -425,6 +547,33 @@ jerry_api_create_string_sz (const jerry_api_char_t *v, /**< string value */
                                          (lit_utf8_size_t) v_size);
 } /* jerry_api_create_string_sz */
 
+/**
+ * Create a string, referencing characters in an immutable buffer, owned by the caller, without copying them
+ *
+ * Note:
+ *      the buffer should remain valid and unchanged until the free callback is called;
+ *      the callback is called after the string is released by the engine and by the caller
+ *      (or immediately, if the engine doesn't need the buffer), and should not perform
+ *      any requests to the engine.
+ *
+ * Note:
+ *      caller should release the string with jerry_api_release_string, just when the value becomes unnecessary.
+ *
+ * @return pointer to created string
+ */
+jerry_api_string_t *
+jerry_api_create_external_string (const jerry_api_char_t *chars_p, /**< utf-8 characters */
+                                  jerry_api_size_t size, /**< size of the characters, in bytes */
+                                  jerry_string_free_callback_t free_cb) /**< callback, releasing the buffer
+                                                                         *   (can be NULL) */
+{
+  jerry_assert_api_available ();
+
+  return ecma_new_ecma_string_from_external_utf8 ((const lit_utf8_byte_t *) chars_p,
+                                                  (lit_utf8_size_t) size,
+                                                  (ecma_external_pointer_t) free_cb);
+} /* jerry_api_create_external_string */
+
 /**
  * Create an object
  *
@@ -554,6 +703,126 @@ jerry_api_create_external_function (jerry_external_handler_t handler_p) /**< poi
   return ecma_op_create_external_function_object ((ecma_external_pointer_t) handler_p);
 } /* jerry_api_create_external_function */
 
+/**
+ * Create an external function object with numeric native handler
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to created external function object
+ */
+jerry_api_object_t*
+jerry_api_create_external_number_function (jerry_external_number_handler_t handler_p) /**< pointer to numeric
+                                                                                       *   native handler
+                                                                                       *   for the function */
+{
+  jerry_assert_api_available ();
+
+  return ecma_op_create_external_number_function_object ((ecma_external_pointer_t) handler_p);
+} /* jerry_api_create_external_number_function */
+
+/**
+ * Create an ArrayBuffer object with zero-initialized data of the specified size
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to created ArrayBuffer object,
+ *         or NULL - if typed arrays are disabled in the engine's profile.
+ */
+jerry_api_object_t*
+jerry_api_create_array_buffer (jerry_api_size_t size) /**< size of the data, in bytes */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+  return ecma_op_create_array_buffer_object ((ecma_length_t) size);
+#else /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+  (void) size;
+
+  return NULL;
+#endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+} /* jerry_api_create_array_buffer */
+
+/**
+ * Create an ArrayBuffer object, referencing data in a buffer, owned by the caller, without copying the data
+ *
+ * Accesses to the object and to typed arrays, viewing it, read and write the caller's buffer directly.
+ *
+ * Note:
+ *      the buffer should remain valid until the object is freed by the engine; to get notified about
+ *      the moment, caller can set native handle with free callback for the object
+ *      (see also: jerry_api_set_object_native_handle).
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to created ArrayBuffer object,
+ *         or NULL - if typed arrays are disabled in the engine's profile.
+ */
+jerry_api_object_t*
+jerry_api_create_external_array_buffer (uint8_t *buffer_p, /**< buffer with the data */
+                                        jerry_api_size_t size) /**< size of the data, in bytes */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+  return ecma_op_create_external_array_buffer_object (buffer_p, (ecma_length_t) size);
+#else /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+  (void) buffer_p;
+  (void) size;
+
+  return NULL;
+#endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+} /* jerry_api_create_external_array_buffer */
+
+/**
+ * Get data of an ArrayBuffer object, or of a typed array's view
+ *
+ * Note:
+ *      the data can be read and modified in place until the object is freed
+ *
+ * @return true - if the object is an ArrayBuffer object or a typed array (pointer to the data and the data's size
+ *                are returned through out_buffer_p and out_size_p),
+ *         false - otherwise.
+ */
+bool
+jerry_api_get_array_buffer_data (jerry_api_object_t *object_p, /**< ArrayBuffer object or typed array */
+                                 uint8_t **out_buffer_p, /**< out: pointer to the data
+                                                          *        (NULL - if the data is empty) */
+                                 jerry_api_size_t *out_size_p) /**< out: size of the data, in bytes */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+  ecma_value_t object_value = ecma_make_object_value (object_p);
+
+  if (ecma_op_is_array_buffer (object_value))
+  {
+    *out_buffer_p = ecma_op_array_buffer_get_data (object_p);
+    *out_size_p = (jerry_api_size_t) ecma_op_array_buffer_get_byte_length (object_p);
+
+    return true;
+  }
+  else if (ecma_op_is_typed_array (object_value))
+  {
+    ecma_typed_array_type_t type = ecma_op_typed_array_get_type (object_p);
+
+    *out_buffer_p = ecma_op_typed_array_get_data (object_p);
+    *out_size_p = (jerry_api_size_t) (ecma_op_typed_array_get_length (object_p)
+                                      * ecma_typed_array_get_element_size (type));
+
+    return true;
+  }
+#else /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+  (void) object_p;
+  (void) out_buffer_p;
+  (void) out_size_p;
+#endif /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+
+  return false;
+} /* jerry_api_get_array_buffer_data */
+
 /**
  * Dispatch call to specified external function using the native handler
  *
@@ -621,6 +890,54 @@ jerry_dispatch_external_function (ecma_object_t *function_object_p, /**< externa
   return completion_value;
 } /* jerry_dispatch_external_function */
 
+/**
+ * Dispatch call to specified external function using the numeric native handler
+ *
+ * Note:
+ *       the arguments are converted with ToNumber, without creating API values for them,
+ *       so arguments that are already numbers are passed without any conversion or reference counting.
+ *
+ * @return completion value
+ *         Returned value must be freed with ecma_free_completion_value
+ */
+ecma_completion_value_t
+jerry_dispatch_external_number_function (ecma_external_pointer_t handler_p, /**< pointer to the function's
+                                                                             *   numeric native handler */
+                                         const ecma_value_t args_p[], /**< arguments list */
+                                         ecma_length_t args_count) /**< number of arguments */
+{
+  jerry_assert_api_available ();
+
+  ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
+
+  MEM_DEFINE_LOCAL_ARRAY (num_args, args_count, double);
+
+  for (uint32_t i = 0;
+       i < args_count && ecma_is_completion_value_empty (ret_value);
+       i++)
+  {
+    ECMA_OP_TO_NUMBER_TRY_CATCH (arg_num, args_p[i], ret_value);
+
+    num_args[i] = (double) arg_num;
+
+    ECMA_OP_TO_NUMBER_FINALIZE (arg_num);
+  }
+
+  if (ecma_is_completion_value_empty (ret_value))
+  {
+    double result = ((jerry_external_number_handler_t) handler_p) (num_args, args_count);
+
+    ecma_number_t *ret_num_p = ecma_alloc_number ();
+    *ret_num_p = (ecma_number_t) result;
+
+    ret_value = ecma_make_normal_completion_value (ecma_make_number_value (ret_num_p));
+  }
+
+  MEM_FINALIZE_LOCAL_ARRAY (num_args);
+
+  return ret_value;
+} /* jerry_dispatch_external_number_function */
+
 /**
  * Dispatch call to object's native free callback function
  *
@@ -640,6 +957,29 @@ jerry_dispatch_object_free_callback (ecma_external_pointer_t freecb_p, /**< poin
   jerry_make_api_available ();
 } /* jerry_dispatch_object_free_callback */
 
+/**
+ * Dispatch call to external string's buffer free callback function
+ *
+ * Note:
+ *       the callback should not perform any requests to engine
+ */
+void
+jerry_dispatch_external_string_free_callback (ecma_external_pointer_t freecb_p, /**< pointer to free callback */
+                                              const lit_utf8_byte_t *chars_p, /**< the string's buffer */
+                                              lit_utf8_size_t size) /**< size of the buffer */
+{
+  bool is_api_available = jerry_api_available;
+
+  jerry_make_api_unavailable ();
+
+  ((jerry_string_free_callback_t) freecb_p) ((const jerry_api_char_t *) chars_p, (jerry_api_size_t) size);
+
+  if (is_api_available)
+  {
+    jerry_make_api_available ();
+  }
+} /* jerry_dispatch_external_string_free_callback */
+
 /**
  * Check if the specified object is a function object.
  *
@@ -1227,10 +1567,10 @@ jerry_api_eval (const jerry_api_char_t *source_p, /**< source code */
 } /* jerry_api_eval */
 
 /**
- * Jerry engine initialization
+ * Check and set Jerry run-time configuration flags
  */
-void
-jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
+static void
+jerry_init_flags (jerry_flag_t flags) /**< combination of Jerry flags */
 {
   if (flags & (JERRY_FLAG_ENABLE_LOG))
   {
@@ -1257,13 +1597,35 @@ jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
       "Ignoring detailed memory statistics options because memory statistics dump mode is not enabled.\n");
   }
 
+  if (flags & (JERRY_FLAG_VM_PROFILE))
+  {
+#ifndef VM_PROFILE
+    flags &= ~(JERRY_FLAG_VM_PROFILE);
+
+    JERRY_WARNING_MSG ("Ignoring VM profile option because of '!VM_PROFILE' build configuration.\n");
+#endif /* !VM_PROFILE */
+  }
+
   jerry_flags = flags;
+} /* jerry_init_flags */
+
+/**
+ * Jerry engine initialization
+ */
+void
+jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
+{
+  jerry_init_flags (flags);
 
   jerry_make_api_available ();
 
   mem_init ();
   serializer_init ();
   ecma_init ();
+
+#ifdef VM_PROFILE
+  vm_profile_init ((jerry_flags & JERRY_FLAG_VM_PROFILE) != 0);
+#endif /* VM_PROFILE */
 } /* jerry_init */
 
 /**
@@ -1276,12 +1638,163 @@ jerry_cleanup (void)
 
   bool is_show_mem_stats = ((jerry_flags & JERRY_FLAG_MEM_STATS) != 0);
 
+#ifdef MEM_STATS
+  if (is_show_mem_stats)
+  {
+    ecma_lcache_stats_print ();
+  }
+#endif /* MEM_STATS */
+
+#ifdef VM_PROFILE
+  vm_profile_print_report ();
+#endif /* VM_PROFILE */
+
   ecma_finalize ();
+
+#ifdef MEM_STATS
+  if (is_show_mem_stats)
+  {
+    jsp_eval_cache_stats_print ();
+  }
+#endif /* MEM_STATS */
+
   serializer_free ();
   mem_finalize (is_show_mem_stats);
   vm_finalize ();
 } /* jerry_cleanup */
 
+/**
+ * Get signature of the engine's build configuration for a heap snapshot
+ */
+static void
+jerry_get_heap_snapshot_signature (jerry_heap_snapshot_signature_t *out_signature_p) /**< out: signature */
+{
+  out_signature_p->magic = JERRY_HEAP_SNAPSHOT_MAGIC;
+  out_signature_p->version = JERRY_HEAP_SNAPSHOT_VERSION;
+  out_signature_p->header_size = (uint32_t) sizeof (jerry_heap_snapshot_header_t);
+  out_signature_p->heap_area_size = (uint32_t) MEM_HEAP_AREA_SIZE;
+  out_signature_p->heap_chunk_size = (uint32_t) MEM_HEAP_CHUNK_SIZE;
+  out_signature_p->pool_chunk_size = (uint32_t) MEM_POOL_CHUNK_SIZE;
+  out_signature_p->builtins_number = (uint32_t) ECMA_BUILTIN_ID__COUNT;
+  out_signature_p->magic_strings_number = (uint32_t) LIT_MAGIC_STRING__COUNT;
+  out_signature_p->number_size = (uint32_t) sizeof (ecma_number_t);
+  out_signature_p->char_size = (uint32_t) sizeof (ecma_char_t);
+} /* jerry_get_heap_snapshot_signature */
+
+/**
+ * Save snapshot of the engine's heap
+ *
+ * The snapshot contains the heap's image, together with the engine's roots (built-in objects,
+ * Global environment, literal storage, byte-code), so that an engine, initialized with
+ * jerry_init_from_heap_snapshot, continues from the state the snapshot was taken in
+ * (i.e. after initialization and run of warm-up scripts), without repeating the work.
+ *
+ * Note:
+ *      the snapshot can only be taken between runs of scripts (not from an external function handler),
+ *      and when there are no objects that hold external pointers (external functions,
+ *      native handles or free callbacks) and no external magic strings are registered,
+ *      as native addresses are not preserved between runs of the engine;
+ *
+ *      all values, acquired through the API, should be released before the snapshot is taken;
+ *
+ *      the snapshot can only be restored by an engine with the same build configuration.
+ *
+ * @return size of the snapshot - if buffer_p is NULL or the snapshot was saved to the buffer,
+ *         0 - otherwise (the snapshot can't be taken in current state or the buffer is too small).
+ */
+size_t
+jerry_save_heap_snapshot (uint8_t *buffer_p, /**< buffer to save the snapshot to
+                                              *   (or NULL, to query size of the snapshot) */
+                          size_t buffer_size) /**< size of the buffer */
+{
+  jerry_assert_api_available ();
+
+  if (ecma_stack_get_top_frame () != NULL
+      || lit_get_magic_string_ex_count () != 0)
+  {
+    return 0;
+  }
+
+  jerry_heap_snapshot_header_t header;
+  memset (&header, 0, sizeof (header));
+
+  jerry_get_heap_snapshot_signature (&header.signature);
+
+  if (!ecma_save_snapshot_state (&header.ecma))
+  {
+    return 0;
+  }
+
+  serializer_save_snapshot_state (&header.serializer);
+
+  const size_t snapshot_size = sizeof (header) + mem_get_snapshot_image_size ();
+
+  if (buffer_p == NULL)
+  {
+    return snapshot_size;
+  }
+  else if (buffer_size < snapshot_size)
+  {
+    return 0;
+  }
+
+  mem_save_snapshot (&header.mem, buffer_p + sizeof (header));
+
+  memcpy (buffer_p, &header, sizeof (header));
+
+  return snapshot_size;
+} /* jerry_save_heap_snapshot */
+
+/**
+ * Jerry engine initialization from a heap snapshot, saved with jerry_save_heap_snapshot
+ *
+ * Note:
+ *      the snapshot is restored with a single copy of the heap image,
+ *      instead of instantiation of the engine's components.
+ *
+ * @return true - if the engine was initialized from the snapshot,
+ *         false - otherwise (the snapshot is invalid or was saved by an engine with different configuration;
+ *                 in the case the engine is not initialized).
+ */
+bool
+jerry_init_from_heap_snapshot (jerry_flag_t flags, /**< combination of Jerry flags */
+                               const uint8_t *snapshot_p, /**< snapshot */
+                               size_t snapshot_size) /**< size of the snapshot */
+{
+  jerry_heap_snapshot_header_t header;
+
+  if (snapshot_size < sizeof (header))
+  {
+    return false;
+  }
+
+  memcpy (&header, snapshot_p, sizeof (header));
+
+  jerry_heap_snapshot_signature_t signature;
+  jerry_get_heap_snapshot_signature (&signature);
+
+  if (memcmp (&header.signature, &signature, sizeof (signature)) != 0
+      || !mem_is_snapshot_state_valid (&header.mem)
+      || snapshot_size - sizeof (header) < header.mem.heap.image_size)
+  {
+    return false;
+  }
+
+  jerry_init_flags (flags);
+
+  jerry_make_api_available ();
+
+  mem_init_from_snapshot (&header.mem, snapshot_p + sizeof (header));
+  serializer_init_from_snapshot (&header.serializer);
+  ecma_init_from_snapshot (&header.ecma);
+
+#ifdef VM_PROFILE
+  vm_profile_init ((jerry_flags & JERRY_FLAG_VM_PROFILE) != 0);
+#endif /* VM_PROFILE */
+
+  return true;
+} /* jerry_init_from_heap_snapshot */
+
 /**
  * Get Jerry configured memory limits
  */
@@ -1290,7 +1803,9 @@ jerry_get_memory_limits (size_t *out_data_bss_brk_limit_p, /**< out: Jerry's max
                                                             *        data + bss + brk sections */
                          size_t *out_stack_limit_p) /**< out: Jerry's maximum usage of stack */
 {
-  *out_data_bss_brk_limit_p = CONFIG_MEM_HEAP_AREA_SIZE + CONFIG_MEM_DATA_LIMIT_MINUS_HEAP_SIZE;
+  *out_data_bss_brk_limit_p = (CONFIG_MEM_HEAP_AREA_SIZE
+                                + CONFIG_MEM_SCRATCH_AREA_SIZE
+                                + CONFIG_MEM_DATA_LIMIT_MINUS_HEAP_SIZE);
   *out_stack_limit_p = CONFIG_MEM_STACK_LIMIT;
 } /* jerry_get_memory_limits */
 
@@ -1317,6 +1832,25 @@ jerry_reg_err_callback (jerry_error_callback_t callback) /**< pointer to callbac
   JERRY_UNIMPLEMENTED_REF_UNUSED_VARS ("Error callback is not implemented", callback);
 } /* jerry_reg_err_callback */
 
+/**
+ * Prepare virtual machine for run of successfully parsed script
+ */
+static void
+jerry_prepare_vm_for_parsed_script (const opcode_compact_t *opcodes_p) /**< byte-code of the script */
+{
+#ifdef MEM_STATS
+  if (jerry_flags & JERRY_FLAG_MEM_STATS_SEPARATE)
+  {
+    mem_stats_print ();
+    mem_stats_reset_peak ();
+  }
+#endif /* MEM_STATS */
+
+  bool is_show_mem_stats_per_opcode = ((jerry_flags & JERRY_FLAG_MEM_STATS_PER_OPCODE) != 0);
+
+  vm_init (opcodes_p, is_show_mem_stats_per_opcode);
+} /* jerry_prepare_vm_for_parsed_script */
+
 /**
  * Parse script for specified context
  *
@@ -1332,8 +1866,9 @@ jerry_parse (const jerry_api_char_t* source_p, /**< script source */
   bool is_show_opcodes = ((jerry_flags & JERRY_FLAG_SHOW_OPCODES) != 0);
 
   parser_set_show_opcodes (is_show_opcodes);
+  parser_set_parse_functions_lazily ((jerry_flags & JERRY_FLAG_PARSE_FUNCTIONS_LAZILY) != 0);
 
-  const opcode_t *opcodes_p;
+  const opcode_compact_t *opcodes_p;
   bool is_syntax_correct;
 
   is_syntax_correct = parser_parse_script (source_p,
@@ -1345,20 +1880,55 @@ jerry_parse (const jerry_api_char_t* source_p, /**< script source */
     return false;
   }
 
-#ifdef MEM_STATS
-  if (jerry_flags & JERRY_FLAG_MEM_STATS_SEPARATE)
+  jerry_prepare_vm_for_parsed_script (opcodes_p);
+
+  return true;
+} /* jerry_parse */
+
+/**
+ * Parse script for specified context, pulling the script's source in chunks from the source reader
+ *
+ * Note:
+ *      the source is read to the specified buffer on demand, during parse, and the part of source,
+ *      that was already parsed, is discarded from the buffer; if a token, or header of for statement,
+ *      does not fit into the buffer, the parser moves the source to a larger buffer, allocated on the engine's heap,
+ *      so the buffer's size affects only peak memory usage during parse;
+ *      the buffer is not used after the routine returns.
+ *
+ * @return true - if script was parsed successfully,
+ *         false - otherwise (SyntaxError was raised).
+ */
+bool
+jerry_parse_from_reader (jerry_source_reader_callback_t reader_p, /**< script source reader */
+                         void *reader_user_p, /**< user data, passed to the reader */
+                         jerry_api_char_t *buffer_p, /**< buffer for the script source */
+                         size_t buffer_size) /**< size of the buffer */
+{
+  jerry_assert_api_available ();
+
+  bool is_show_opcodes = ((jerry_flags & JERRY_FLAG_SHOW_OPCODES) != 0);
+
+  parser_set_show_opcodes (is_show_opcodes);
+  parser_set_parse_functions_lazily ((jerry_flags & JERRY_FLAG_PARSE_FUNCTIONS_LAZILY) != 0);
+
+  const opcode_compact_t *opcodes_p;
+  bool is_syntax_correct;
+
+  is_syntax_correct = parser_parse_script_from_reader (reader_p,
+                                                       reader_user_p,
+                                                       buffer_p,
+                                                       buffer_size,
+                                                       &opcodes_p);
+
+  if (!is_syntax_correct)
   {
-    mem_stats_print ();
-    mem_stats_reset_peak ();
+    return false;
   }
-#endif /* MEM_STATS */
 
-  bool is_show_mem_stats_per_opcode = ((jerry_flags & JERRY_FLAG_MEM_STATS_PER_OPCODE) != 0);
-
-  vm_init (opcodes_p, is_show_mem_stats_per_opcode);
+  jerry_prepare_vm_for_parsed_script (opcodes_p);
 
   return true;
-} /* jerry_parse */
+} /* jerry_parse_from_reader */
 
 /**
  * Run Jerry in specified run context
@@ -40,6 +40,10 @@ typedef uint32_t jerry_flag_t;
                                                      *   FIXME: Remove. */
 #define JERRY_FLAG_ENABLE_LOG             (1u << 5) /**< enable logging */
 #define JERRY_FLAG_ABORT_ON_FAIL          (1u << 6) /**< abort instead of exit in case of failure */
+#define JERRY_FLAG_PARSE_FUNCTIONS_LAZILY (1u << 7) /**< defer compilation of functions' bodies
+                                                     *   till the functions' first calls */
+#define JERRY_FLAG_VM_PROFILE             (1u << 8) /**< count executions and cycles per opcode and per instruction,
+                                                     *   and dump the profile upon cleanup */
 
 /**
  * Error codes
@@ -77,13 +81,33 @@ extern FILE *jerry_log_file;
  */
 typedef void (*jerry_error_callback_t) (jerry_fatal_code_t);
 
+/**
+ * Script source reader callback type
+ *
+ * The callback should put next portion of script source (not more than buffer_size bytes) to the buffer.
+ *
+ * @return number of bytes put to the buffer (0 - if end of source is reached)
+ */
+typedef size_t (*jerry_source_reader_callback_t) (jerry_api_char_t *buffer_p,
+                                                  size_t buffer_size,
+                                                  void *user_p);
+
 extern EXTERN_C void jerry_init (jerry_flag_t flags);
 extern EXTERN_C void jerry_cleanup (void);
 
+extern EXTERN_C size_t jerry_save_heap_snapshot (uint8_t *buffer_p, size_t buffer_size);
+extern EXTERN_C bool jerry_init_from_heap_snapshot (jerry_flag_t flags,
+                                                    const uint8_t *snapshot_p,
+                                                    size_t snapshot_size);
+
 extern EXTERN_C void jerry_get_memory_limits (size_t *out_data_bss_brk_limit_p, size_t *out_stack_limit_p);
 extern EXTERN_C void jerry_reg_err_callback (jerry_error_callback_t callback);
 
 extern EXTERN_C bool jerry_parse (const jerry_api_char_t * source_p, size_t source_size);
+extern EXTERN_C bool jerry_parse_from_reader (jerry_source_reader_callback_t reader_p,
+                                              void *reader_user_p,
+                                              jerry_api_char_t *buffer_p,
+                                              size_t buffer_size);
 extern EXTERN_C jerry_completion_code_t jerry_run (void);
 
 extern EXTERN_C jerry_completion_code_t
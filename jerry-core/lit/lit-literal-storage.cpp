@@ -33,6 +33,7 @@ lit_literal_storage_t lit_storage;
 rcs_record_t *
 lit_charset_record_t::get_prev () const
 {
+#ifndef CONFIG_MEM_CPOINTER_32BIT
   rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage, (rcs_record_t *)this);
   it.skip (RCS_DYN_STORAGE_LENGTH_UNIT);
 
@@ -40,6 +41,9 @@ lit_charset_record_t::get_prev () const
   cpointer.packed_value = it.read<uint16_t> ();
 
   return cpointer_t::decompress (cpointer);
+#else /* !CONFIG_MEM_CPOINTER_32BIT */
+  return get_pointer (_prev_field_pos, _prev_field_width);
+#endif /* CONFIG_MEM_CPOINTER_32BIT */
 } /* lit_charset_record_t::get_prev */
 
 /**
@@ -48,10 +52,14 @@ lit_charset_record_t::get_prev () const
 void
 lit_charset_record_t::set_prev (rcs_record_t *prev_rec_p) /**< pointer to the record to set as previous */
 {
+#ifndef CONFIG_MEM_CPOINTER_32BIT
   rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage, (rcs_record_t *)this);
   it.skip (RCS_DYN_STORAGE_LENGTH_UNIT);
 
   it.write<uint16_t> (cpointer_t::compress (prev_rec_p).packed_value);
+#else /* !CONFIG_MEM_CPOINTER_32BIT */
+  set_pointer (_prev_field_pos, _prev_field_width, prev_rec_p);
+#endif /* CONFIG_MEM_CPOINTER_32BIT */
 } /* lit_charset_record_t::set_prev */
 
 /**
@@ -84,9 +92,19 @@ lit_charset_record_t::get_charset (lit_utf8_byte_t *buff, /**< output buffer */
 {
   JERRY_ASSERT (buff && size >= sizeof (lit_utf8_byte_t));
 
+  lit_utf8_size_t len = get_length ();
+
+  const lit_utf8_byte_t *contiguous_charset_p = get_contiguous_charset ();
+  if (contiguous_charset_p != NULL)
+  {
+    lit_utf8_size_t bytes_to_copy = (len < size) ? len : (lit_utf8_size_t) size;
+    memcpy (buff, contiguous_charset_p, bytes_to_copy);
+
+    return bytes_to_copy;
+  }
+
   rcs_record_iterator_t it ((rcs_recordset_t *)&lit_storage, (rcs_record_t *)this);
   it.skip (header_size ());
-  lit_utf8_size_t len = get_length ();
   lit_utf8_size_t i;
 
   for (i = 0; i < len && size > 0; ++i)
@@ -99,6 +117,21 @@ lit_charset_record_t::get_charset (lit_utf8_byte_t *buff, /**< output buffer */
   return i;
 } /* lit_charset_record_t::get_charset */
 
+/**
+ * Get pointer to the record's characters, if they are not split between chunks of the literal storage
+ *
+ * Note:
+ *      the pointer remains valid while the literal storage exists, as literals are not moved or freed
+ *
+ * @return pointer to the characters - if they are placed contiguously,
+ *         NULL - otherwise (the characters should be copied with get_charset).
+ */
+const lit_utf8_byte_t *
+lit_charset_record_t::get_contiguous_charset (void)
+{
+  return lit_storage.get_contiguous_data (this, header_size (), get_length ());
+} /* lit_charset_record_t::get_contiguous_charset */
+
 /**
  * Compares characters from the record to the string
  *
@@ -202,6 +235,17 @@ bool
 lit_charset_record_t::is_equal_utf8_string (const lit_utf8_byte_t *str, /**< string to compare with */
                                             lit_utf8_size_t str_size)   /**< length of the string */
 {
+  if (get_length () != str_size)
+  {
+    return false;
+  }
+
+  const lit_utf8_byte_t *contiguous_charset_p = get_contiguous_charset ();
+  if (contiguous_charset_p != NULL)
+  {
+    return (str_size == 0 || memcmp (contiguous_charset_p, str, str_size) == 0);
+  }
+
   rcs_record_iterator_t it_this (&lit_storage, this);
 
   it_this.skip (header_size ());
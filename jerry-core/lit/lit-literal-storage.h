@@ -32,7 +32,7 @@ extern lit_literal_storage_t lit_storage;
  * unused (2 bits)
  * hash (8 bits)
  * length (16 bits)
- * pointer to prev (16 bits)
+ * pointer to prev (16 bits; 22 bits, if CONFIG_MEM_CPOINTER_32BIT is defined)
  * ------- characters -------------------
  * ...
  * chars
@@ -128,6 +128,7 @@ public:
   rcs_record_t *get_prev () const;
 
   lit_utf8_size_t get_charset (lit_utf8_byte_t *, size_t);
+  const lit_utf8_byte_t *get_contiguous_charset (void);
 
   int compare_utf8 (const lit_utf8_byte_t *, lit_utf8_size_t);
   bool is_equal (lit_charset_record_t *);
@@ -160,14 +161,17 @@ private:
 
   /**
    * Offset and length of 'alignment' field, in bits
+   *
+   * Note:
+   *      the field and following unused bits occupy 4 bits
    */
   static const uint32_t _alignment_field_pos = _fields_offset_begin;
-  static const uint32_t _alignment_field_width = 2u;
+  static const uint32_t _alignment_field_width = RCS_DYN_STORAGE_ALIGNMENT_LOG;
 
   /**
    * Offset and length of 'hash' field, in bits
    */
-  static const uint32_t _hash_field_pos = _alignment_field_pos + _alignment_field_width + 2u;
+  static const uint32_t _hash_field_pos = _alignment_field_pos + 4u;
   static const uint32_t _hash_field_width = 8u;
 
   /**
@@ -182,7 +186,11 @@ private:
   static const uint32_t _prev_field_pos = _length_field_pos + _length_field_width;
   static const uint32_t _prev_field_width = rcs_cpointer_t::bit_field_width;
 
+#ifndef CONFIG_MEM_CPOINTER_32BIT
   static const size_t _header_size = RCS_DYN_STORAGE_LENGTH_UNIT + RCS_DYN_STORAGE_LENGTH_UNIT / 2;
+#else /* !CONFIG_MEM_CPOINTER_32BIT */
+  static const size_t _header_size = RCS_DYN_STORAGE_LENGTH_UNIT;
+#endif /* CONFIG_MEM_CPOINTER_32BIT */
 }; /* lit_charset_record_t */
 
 /**
@@ -193,7 +201,7 @@ private:
  * ------- header -----------------------
  * type (4 bits)
  * magic string id  (12 bits)
- * pointer to prev (16 bits)
+ * pointer to prev (16 bits; 22 bits, if CONFIG_MEM_CPOINTER_32BIT is defined)
  * --------------------------------------
  */
 class lit_magic_record_t : public rcs_record_t
@@ -302,7 +310,7 @@ private:
  * ------- header -----------------------
  * type (4 bits)
  * padding  (12 bits)
- * pointer to prev (16 bits)
+ * pointer to prev (16 bits; 22 bits, if CONFIG_MEM_CPOINTER_32BIT is defined)
  * --------------------------------------
  * ecma_number_t
  */
@@ -394,7 +402,7 @@ private:
   static const uint32_t prev_field_width = rcs_cpointer_t::bit_field_width;
 
   static const size_t _header_size = RCS_DYN_STORAGE_LENGTH_UNIT;
-  static const size_t _size = _header_size + sizeof (ecma_number_t);
+  static const size_t _size = JERRY_ALIGNUP (_header_size + sizeof (ecma_number_t), RCS_DYN_STORAGE_LENGTH_UNIT);
 }; /* lit_number_record_t */
 
 /**
@@ -30,6 +30,33 @@ lit_init ()
   lit_magic_strings_ex_init ();
 } /* lit_init */
 
+/**
+ * Save literal storage's state to a heap snapshot
+ */
+void
+lit_save_snapshot_state (lit_snapshot_state_t *out_state_p) /**< out: literal storage's state */
+{
+  out_state_p->first_chunk = mem_heap_get_snapshot_pointer (lit_storage.get_first_chunk ());
+  out_state_p->last_chunk = mem_heap_get_snapshot_pointer (lit_storage.get_last_chunk ());
+} /* lit_save_snapshot_state */
+
+/**
+ * Initialize literal storage from a heap snapshot
+ *
+ * Note:
+ *      the heap should be already restored from the snapshot
+ */
+void
+lit_init_from_snapshot (const lit_snapshot_state_t *state_p) /**< literal storage's state */
+{
+  lit_init ();
+
+  typedef rcs_chunked_list_t::node_t chunk_t;
+
+  lit_storage.init_from_chunks ((chunk_t *) mem_heap_get_pointer_from_snapshot (state_p->first_chunk),
+                                (chunk_t *) mem_heap_get_pointer_from_snapshot (state_p->last_chunk));
+} /* lit_init_from_snapshot */
+
 /**
  * Finalize literal storage
  */
@@ -571,6 +598,20 @@ lit_charset_record_get_size (literal_t lit) /**< literal */
   return static_cast<lit_charset_record_t *> (lit)->get_length ();
 } /* lit_charset_record_get_size */
 
+/**
+ * Get pointer to characters of the charset literal, if they are stored contiguously
+ *
+ * @return pointer to the characters (valid until the literal storage is finalized) - if they are contiguous,
+ *         NULL - otherwise.
+ */
+const lit_utf8_byte_t *
+lit_charset_record_get_contiguous_charset (literal_t lit) /**< literal */
+{
+  JERRY_ASSERT (lit->get_type () == LIT_STR_T);
+
+  return static_cast<lit_charset_record_t *> (lit)->get_contiguous_charset ();
+} /* lit_charset_record_get_contiguous_charset */
+
 /**
  * Get length of the literal
  *
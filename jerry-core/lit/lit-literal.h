@@ -22,8 +22,19 @@
 
 #define LITERAL_TO_REWRITE (INVALID_VALUE - 1)
 
+/**
+ * Literal storage's state, stored in a heap snapshot
+ */
+typedef struct
+{
+  mem_heap_snapshot_pointer_t first_chunk; /**< first chunk of the storage */
+  mem_heap_snapshot_pointer_t last_chunk; /**< last chunk of the storage */
+} lit_snapshot_state_t;
+
 void lit_init ();
 void lit_finalize ();
+void lit_save_snapshot_state (lit_snapshot_state_t *);
+void lit_init_from_snapshot (const lit_snapshot_state_t *);
 void lit_dump_literals ();
 
 literal_t lit_create_literal_from_utf8_string (const lit_utf8_byte_t *, lit_utf8_size_t);
@@ -51,6 +62,7 @@ literal_t lit_get_literal_by_cp (lit_cpointer_t);
 lit_string_hash_t lit_charset_literal_get_hash (literal_t);
 ecma_number_t lit_charset_literal_get_number (literal_t);
 lit_utf8_size_t lit_charset_record_get_size (literal_t);
+const lit_utf8_byte_t *lit_charset_record_get_contiguous_charset (literal_t);
 ecma_length_t lit_charset_record_get_length (literal_t);
 
 lit_magic_string_id_t lit_magic_record_get_magic_str_id (literal_t);
@@ -15,6 +15,7 @@
 
 #include "lit-magic-strings.h"
 
+#include "jrt-libc-includes.h"
 #include "lit-strings.h"
 
 /**
@@ -22,6 +23,19 @@
  */
 static lit_utf8_size_t lit_magic_string_sizes[LIT_MAGIC_STRING__COUNT];
 
+/**
+ * Identifiers of magic strings, ordered by size and, for equal sizes, by contents
+ */
+static uint16_t lit_magic_string_ids_ordered[LIT_MAGIC_STRING__COUNT];
+
+/**
+ * Index in lit_magic_string_ids_ordered of first magic string of each size
+ *
+ * Magic strings of size S are lit_magic_string_ids_ordered[first[S]] ...
+ * lit_magic_string_ids_ordered[first[S + 1] - 1].
+ */
+static uint16_t lit_magic_string_first_ordered_index_by_size[LIT_MAGIC_STRING_LENGTH_LIMIT + 2];
+
 /**
  * External magic strings data array, count and lengths
  */
@@ -29,6 +43,15 @@ static const lit_utf8_byte_t **lit_magic_string_ex_array = NULL;
 static uint32_t lit_magic_string_ex_count = 0;
 static const lit_utf8_size_t *lit_magic_string_ex_sizes = NULL;
 
+/**
+ * Range of identifiers of external magic strings of each size
+ *
+ * All external magic strings of size S have identifiers in [begin[S], end[S]), so strings,
+ * for which the range is empty, are checked without access to the external magic strings.
+ */
+static lit_magic_string_ex_id_t lit_magic_string_ex_begin_id_by_size[LIT_MAGIC_STRING_LENGTH_LIMIT + 1];
+static lit_magic_string_ex_id_t lit_magic_string_ex_end_id_by_size[LIT_MAGIC_STRING_LENGTH_LIMIT + 1];
+
 #ifndef JERRY_NDEBUG
 /**
  * Maximum length among lengths of magic strings
@@ -36,6 +59,79 @@ static const lit_utf8_size_t *lit_magic_string_ex_sizes = NULL;
 static ecma_length_t ecma_magic_string_max_length;
 #endif /* JERRY_NDEBUG */
 
+/**
+ * Check whether the first magic string precedes the second one in order of sizes and contents
+ *
+ * @return true - if the first magic string should precede the second one,
+ *         false - otherwise.
+ */
+static bool
+lit_magic_string_is_ordered_before (lit_magic_string_id_t id1, /**< first magic string's id */
+                                    lit_magic_string_id_t id2) /**< second magic string's id */
+{
+  const lit_utf8_size_t size1 = lit_magic_string_sizes[id1];
+  const lit_utf8_size_t size2 = lit_magic_string_sizes[id2];
+
+  if (size1 != size2)
+  {
+    return (size1 < size2);
+  }
+
+  return memcmp (lit_get_magic_string_utf8 (id1), lit_get_magic_string_utf8 (id2), size1) < 0;
+} /* lit_magic_string_is_ordered_before */
+
+/**
+ * Build index of magic strings, ordered by sizes and contents, that is used for lookup of magic strings
+ *
+ * Note:
+ *      sizes of magic strings should be already initialized
+ */
+static void
+lit_magic_strings_init_ordered_ids (void)
+{
+  JERRY_STATIC_ASSERT (LIT_MAGIC_STRING__COUNT <= UINT16_MAX);
+
+  /* sort by size (stable counting sort) */
+  memset (lit_magic_string_first_ordered_index_by_size, 0, sizeof (lit_magic_string_first_ordered_index_by_size));
+
+  for (uint32_t id = 0; id < LIT_MAGIC_STRING__COUNT; id++)
+  {
+    JERRY_ASSERT (lit_magic_string_sizes[id] <= LIT_MAGIC_STRING_LENGTH_LIMIT);
+
+    lit_magic_string_first_ordered_index_by_size[lit_magic_string_sizes[id] + 1]++;
+  }
+
+  for (uint32_t size = 1; size <= LIT_MAGIC_STRING_LENGTH_LIMIT + 1; size++)
+  {
+    lit_magic_string_first_ordered_index_by_size[size] += lit_magic_string_first_ordered_index_by_size[size - 1];
+  }
+
+  uint16_t next_index_by_size[LIT_MAGIC_STRING_LENGTH_LIMIT + 1];
+  memcpy (next_index_by_size, lit_magic_string_first_ordered_index_by_size, sizeof (next_index_by_size));
+
+  for (uint32_t id = 0; id < LIT_MAGIC_STRING__COUNT; id++)
+  {
+    lit_magic_string_ids_ordered[next_index_by_size[lit_magic_string_sizes[id]]++] = (uint16_t) id;
+  }
+
+  /* sort strings of each size by contents (insertion sort, as the groups are small) */
+  for (uint32_t i = 1; i < LIT_MAGIC_STRING__COUNT; i++)
+  {
+    const uint16_t id = lit_magic_string_ids_ordered[i];
+    uint32_t j = i;
+
+    while (j > 0
+           && lit_magic_string_is_ordered_before ((lit_magic_string_id_t) id,
+                                                  (lit_magic_string_id_t) lit_magic_string_ids_ordered[j - 1]))
+    {
+      lit_magic_string_ids_ordered[j] = lit_magic_string_ids_ordered[j - 1];
+      j--;
+    }
+
+    lit_magic_string_ids_ordered[j] = id;
+  }
+} /* lit_magic_strings_init_ordered_ids */
+
 /**
  * Initialize data for string helpers
  */
@@ -60,6 +156,8 @@ lit_magic_strings_init (void)
     JERRY_ASSERT (ecma_magic_string_max_length <= LIT_MAGIC_STRING_LENGTH_LIMIT);
 #endif /* !JERRY_NDEBUG */
   }
+
+  lit_magic_strings_init_ordered_ids ();
 } /* lit_magic_strings_init */
 
 /**
@@ -71,6 +169,9 @@ lit_magic_strings_ex_init (void)
   lit_magic_string_ex_array = NULL;
   lit_magic_string_ex_count = 0;
   lit_magic_string_ex_sizes = NULL;
+
+  memset (lit_magic_string_ex_begin_id_by_size, 0, sizeof (lit_magic_string_ex_begin_id_by_size));
+  memset (lit_magic_string_ex_end_id_by_size, 0, sizeof (lit_magic_string_ex_end_id_by_size));
 } /* lit_magic_strings_ex_init */
 
 /**
@@ -166,6 +267,20 @@ lit_magic_strings_ex_set (const lit_utf8_byte_t **ex_str_items, /**< character a
   lit_magic_string_ex_count = count;
   lit_magic_string_ex_sizes = ex_str_sizes;
 
+  for (lit_magic_string_ex_id_t id = (lit_magic_string_ex_id_t) 0;
+       id < lit_magic_string_ex_count;
+       id = (lit_magic_string_ex_id_t) (id + 1))
+  {
+    const lit_utf8_size_t size = JERRY_MIN (lit_magic_string_ex_sizes[id], LIT_MAGIC_STRING_LENGTH_LIMIT);
+
+    if (lit_magic_string_ex_begin_id_by_size[size] == lit_magic_string_ex_end_id_by_size[size])
+    {
+      lit_magic_string_ex_begin_id_by_size[size] = id;
+    }
+
+    lit_magic_string_ex_end_id_by_size[size] = id + 1;
+  }
+
 #ifndef JERRY_NDEBUG
   for (lit_magic_string_ex_id_t id = (lit_magic_string_ex_id_t) 0;
        id < lit_magic_string_ex_count;
@@ -193,17 +308,33 @@ lit_is_utf8_string_magic (const lit_utf8_byte_t *string_p, /**< utf-8 string */
                           lit_utf8_size_t string_size, /**< string size in bytes */
                           lit_magic_string_id_t *out_id_p) /**< out: magic string's id */
 {
-  TODO (Improve performance of search);
-
-  for (lit_magic_string_id_t id = (lit_magic_string_id_t) 0;
-       id < LIT_MAGIC_STRING__COUNT;
-       id = (lit_magic_string_id_t) (id + 1))
+  if (string_size <= LIT_MAGIC_STRING_LENGTH_LIMIT)
   {
-    if (lit_compare_utf8_string_and_magic_string (string_p, string_size, id))
-    {
-      *out_id_p = id;
+    /* binary search among magic strings of the same size */
+    uint32_t lower = lit_magic_string_first_ordered_index_by_size[string_size];
+    uint32_t upper = lit_magic_string_first_ordered_index_by_size[string_size + 1];
 
-      return true;
+    while (lower < upper)
+    {
+      const uint32_t middle = lower + (upper - lower) / 2;
+      const lit_magic_string_id_t id = (lit_magic_string_id_t) lit_magic_string_ids_ordered[middle];
+
+      const int cmp = memcmp (string_p, lit_get_magic_string_utf8 (id), string_size);
+
+      if (cmp == 0)
+      {
+        *out_id_p = id;
+
+        return true;
+      }
+      else if (cmp < 0)
+      {
+        upper = middle;
+      }
+      else
+      {
+        lower = middle + 1;
+      }
     }
   }
 
@@ -223,10 +354,10 @@ bool lit_is_ex_utf8_string_magic (const lit_utf8_byte_t *string_p, /**< utf-8 st
                                   lit_utf8_size_t string_size, /**< string size in bytes */
                                   lit_magic_string_ex_id_t *out_id_p) /**< out: magic string's id */
 {
-  TODO (Improve performance of search);
+  const lit_utf8_size_t size = JERRY_MIN (string_size, LIT_MAGIC_STRING_LENGTH_LIMIT);
 
-  for (lit_magic_string_ex_id_t id = (lit_magic_string_ex_id_t) 0;
-       id < lit_magic_string_ex_count;
+  for (lit_magic_string_ex_id_t id = lit_magic_string_ex_begin_id_by_size[size];
+       id < lit_magic_string_ex_end_id_by_size[size];
        id = (lit_magic_string_ex_id_t) (id + 1))
   {
     if (lit_compare_utf8_string_and_magic_string_ex (string_p, string_size, id))
@@ -439,6 +439,34 @@ lit_get_unicode_char_size_by_utf8_first_byte (lit_utf8_byte_t first_byte) /**< f
   }
 } /* lit_get_unicode_char_size_by_utf8_first_byte */
 
+/**
+ * Get offset of code unit with specified position in utf-8 string
+ *
+ * Note:
+ *      if the position points to second code unit of a surrogate pair, represented with one 4-byte sequence,
+ *      offset of the next character is returned
+ *
+ * @return offset in bytes (size of the string, if the position is not less than the string's length)
+ */
+lit_utf8_size_t
+lit_utf8_string_offset_of_code_unit (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 string */
+                                     lit_utf8_size_t utf8_buf_size, /**< string size in bytes */
+                                     ecma_length_t code_unit_offset) /**< position of the code unit */
+{
+  lit_utf8_size_t offset = 0;
+  ecma_length_t code_units = 0;
+
+  while (offset < utf8_buf_size && code_units < code_unit_offset)
+  {
+    const lit_utf8_size_t char_size = lit_get_unicode_char_size_by_utf8_first_byte (utf8_buf_p[offset]);
+
+    code_units += (char_size > LIT_UTF8_MAX_BYTES_IN_CODE_UNIT) ? 2 : 1;
+    offset += char_size;
+  }
+
+  return JERRY_MIN (offset, utf8_buf_size);
+} /* lit_utf8_string_offset_of_code_unit */
+
 /**
  * Convert code_unit to utf-8 representation
  *
@@ -577,3 +605,144 @@ bool lit_compare_utf8_strings_relational (const lit_utf8_byte_t *string1_p, /**<
 
   return (lit_utf8_iterator_reached_buffer_end (&iter1) && !lit_utf8_iterator_reached_buffer_end (&iter2));
 } /* lit_compare_utf8_strings_relational */
+
+/**
+ * Minimum size of searched string, starting from which lit_utf8_string_find uses
+ * Boyer-Moore-Horspool algorithm instead of checking each occurrence of the searched string's first byte
+ */
+#define LIT_UTF8_STRING_FIND_SKIP_TABLE_MIN_SIZE (4)
+
+/**
+ * Find first occurrence of a string in another string
+ *
+ * Note:
+ *      valid utf-8 strings can only match at character boundaries, so the search is performed bytewise
+ *
+ * @return true - if the string was found (its offset is returned through out_offset_p),
+ *         false - otherwise.
+ */
+bool
+lit_utf8_string_find (const lit_utf8_byte_t *haystack_p, /**< utf-8 string to search in */
+                      lit_utf8_size_t haystack_size, /**< size of the string to search in */
+                      const lit_utf8_byte_t *needle_p, /**< utf-8 string to search for */
+                      lit_utf8_size_t needle_size, /**< size of the string to search for */
+                      lit_utf8_size_t start_offset, /**< offset to start search from */
+                      lit_utf8_size_t *out_offset_p) /**< out: offset of the found string */
+{
+  if (start_offset > haystack_size
+      || needle_size > haystack_size - start_offset)
+  {
+    return false;
+  }
+  else if (needle_size == 0)
+  {
+    *out_offset_p = start_offset;
+    return true;
+  }
+
+  const lit_utf8_size_t last_offset = haystack_size - needle_size;
+  lit_utf8_size_t offset = start_offset;
+
+  if (needle_size < LIT_UTF8_STRING_FIND_SKIP_TABLE_MIN_SIZE)
+  {
+    /* short strings: find candidates by their first byte */
+    while (offset <= last_offset)
+    {
+      const lit_utf8_byte_t *candidate_p = (const lit_utf8_byte_t *) memchr (haystack_p + offset,
+                                                                             needle_p[0],
+                                                                             last_offset - offset + 1);
+      if (candidate_p == NULL)
+      {
+        return false;
+      }
+
+      offset = (lit_utf8_size_t) (candidate_p - haystack_p);
+
+      if (memcmp (candidate_p + 1, needle_p + 1, needle_size - 1) == 0)
+      {
+        *out_offset_p = offset;
+        return true;
+      }
+
+      offset++;
+    }
+
+    return false;
+  }
+
+  /* long strings: Boyer-Moore-Horspool, with shifts limited to byte range to keep the table small */
+  uint8_t shifts[UINT8_MAX + 1];
+  const uint8_t max_shift = (uint8_t) JERRY_MIN (needle_size, UINT8_MAX);
+
+  memset (shifts, max_shift, sizeof (shifts));
+
+  for (lit_utf8_size_t i = needle_size - JERRY_MIN (needle_size, UINT8_MAX); i < needle_size - 1; i++)
+  {
+    shifts[needle_p[i]] = (uint8_t) (needle_size - 1 - i);
+  }
+
+  const lit_utf8_byte_t needle_last_byte = needle_p[needle_size - 1];
+
+  while (offset <= last_offset)
+  {
+    const lit_utf8_byte_t haystack_byte = haystack_p[offset + needle_size - 1];
+
+    if (haystack_byte == needle_last_byte
+        && memcmp (haystack_p + offset, needle_p, needle_size - 1) == 0)
+    {
+      *out_offset_p = offset;
+      return true;
+    }
+
+    offset += shifts[haystack_byte];
+  }
+
+  return false;
+} /* lit_utf8_string_find */
+
+/**
+ * Find last occurrence of a string in another string, that starts not after specified offset
+ *
+ * @return true - if the string was found (its offset is returned through out_offset_p),
+ *         false - otherwise.
+ */
+bool
+lit_utf8_string_find_last (const lit_utf8_byte_t *haystack_p, /**< utf-8 string to search in */
+                           lit_utf8_size_t haystack_size, /**< size of the string to search in */
+                           const lit_utf8_byte_t *needle_p, /**< utf-8 string to search for */
+                           lit_utf8_size_t needle_size, /**< size of the string to search for */
+                           lit_utf8_size_t max_offset, /**< maximum offset of the found string */
+                           lit_utf8_size_t *out_offset_p) /**< out: offset of the found string */
+{
+  if (needle_size > haystack_size)
+  {
+    return false;
+  }
+
+  lit_utf8_size_t offset = JERRY_MIN (max_offset, haystack_size - needle_size);
+
+  if (needle_size == 0)
+  {
+    *out_offset_p = offset;
+    return true;
+  }
+
+  const lit_utf8_byte_t needle_first_byte = needle_p[0];
+
+  while (true)
+  {
+    if (haystack_p[offset] == needle_first_byte
+        && memcmp (haystack_p + offset + 1, needle_p + 1, needle_size - 1) == 0)
+    {
+      *out_offset_p = offset;
+      return true;
+    }
+
+    if (offset == 0)
+    {
+      return false;
+    }
+
+    offset--;
+  }
+} /* lit_utf8_string_find_last */
@@ -56,6 +56,7 @@ lit_string_hash_t lit_utf8_string_calc_hash_last_bytes (const lit_utf8_byte_t *,
 /* code unit access */
 ecma_char_t lit_utf8_string_code_unit_at (const lit_utf8_byte_t *, lit_utf8_size_t, ecma_length_t);
 lit_utf8_size_t lit_get_unicode_char_size_by_utf8_first_byte (lit_utf8_byte_t);
+lit_utf8_size_t lit_utf8_string_offset_of_code_unit (const lit_utf8_byte_t *, lit_utf8_size_t, ecma_length_t);
 
 /* conversion */
 lit_utf8_size_t lit_code_unit_to_utf8 (ecma_char_t, lit_utf8_byte_t *);
@@ -72,6 +73,21 @@ bool lit_compare_utf8_strings_relational (const lit_utf8_byte_t *string1_p,
                                           const lit_utf8_byte_t *string2_p,
                                           lit_utf8_size_t);
 
+/* substring search */
+bool lit_utf8_string_find (const lit_utf8_byte_t *,
+                           lit_utf8_size_t,
+                           const lit_utf8_byte_t *,
+                           lit_utf8_size_t,
+                           lit_utf8_size_t,
+                           lit_utf8_size_t *);
+
+bool lit_utf8_string_find_last (const lit_utf8_byte_t *,
+                                lit_utf8_size_t,
+                                const lit_utf8_byte_t *,
+                                lit_utf8_size_t,
+                                lit_utf8_size_t,
+                                lit_utf8_size_t *);
+
 /* read code point from buffer */
 lit_utf8_size_t lit_read_code_point_from_utf8 (const lit_utf8_byte_t *,
                                                lit_utf8_size_t,
@@ -22,6 +22,7 @@
 #include "mem-allocator.h"
 #include "mem-heap.h"
 #include "mem-poolman.h"
+#include "mem-scratch.h"
 
 #define MEM_ALLOCATOR_INTERNAL
 
@@ -33,6 +34,11 @@
 static uint8_t mem_heap_area[ MEM_HEAP_AREA_SIZE ] __attribute__ ((aligned (JERRY_MAX (MEM_ALIGNMENT,
                                                                                        MEM_HEAP_CHUNK_SIZE))));
 
+/**
+ * Area for scratch stack
+ */
+static uint8_t mem_scratch_area[ MEM_SCRATCH_AREA_SIZE ] __attribute__ ((aligned (MEM_ALIGNMENT)));
+
 /**
  * The 'try to give memory back' callback
  */
@@ -46,6 +52,7 @@ mem_init (void)
 {
   mem_heap_init (mem_heap_area, sizeof (mem_heap_area));
   mem_pools_init ();
+  mem_scratch_init (mem_scratch_area, sizeof (mem_scratch_area));
 } /* mem_init */
 
 /**
@@ -55,6 +62,7 @@ void
 mem_finalize (bool is_show_mem_stats) /**< show heap memory stats
                                            before finalization? */
 {
+  mem_scratch_finalize ();
   mem_pools_finalize ();
 
   if (is_show_mem_stats)
@@ -78,12 +86,87 @@ mem_finalize (bool is_show_mem_stats) /**< show heap memory stats
             stats.free_chunks,
             stats.peak_pools_count,
             stats.peak_allocated_chunks);
+
+    mem_scratch_stats_t scratch_stats;
+    mem_scratch_get_stats (&scratch_stats);
+
+    printf ("Scratch stack stats:\n");
+    printf ("  Size: %zu\n"
+            "  Allocated bytes: %zu\n"
+            "  Peak allocated bytes: %zu\n"
+            "  Allocations: %zu\n"
+            "  Heap fallbacks: %zu\n\n",
+            scratch_stats.size,
+            scratch_stats.allocated_bytes,
+            scratch_stats.peak_allocated_bytes,
+            scratch_stats.allocations,
+            scratch_stats.heap_fallbacks);
 #endif /* MEM_STATS */
   }
 
   mem_heap_finalize ();
 } /* mem_finalize */
 
+/**
+ * Get size of the heap image, stored in a heap snapshot
+ *
+ * @return size of the image
+ */
+size_t
+mem_get_snapshot_image_size (void)
+{
+  return mem_heap_get_snapshot_image_size ();
+} /* mem_get_snapshot_image_size */
+
+/**
+ * Save memory allocators' state and the heap image to a heap snapshot
+ *
+ * Note:
+ *      the scratch stack should be empty, as it is not stored in the snapshot
+ */
+void
+mem_save_snapshot (mem_snapshot_state_t *out_state_p, /**< out: memory allocators' state */
+                   uint8_t *out_image_p) /**< out: buffer for the heap image
+                                          *        (see also: mem_get_snapshot_image_size) */
+{
+  mem_heap_save_snapshot (&out_state_p->heap, out_image_p);
+  mem_pools_save_snapshot_state (&out_state_p->pools);
+} /* mem_save_snapshot */
+
+/**
+ * Check that memory allocators' state, read from a heap snapshot, fits the heap area
+ *
+ * @return true - if the state can be restored,
+ *         false - otherwise.
+ */
+bool
+mem_is_snapshot_state_valid (const mem_snapshot_state_t *state_p) /**< memory allocators' state */
+{
+  const mem_heap_snapshot_state_t *heap_state_p = &state_p->heap;
+
+  return (heap_state_p->image_size <= sizeof (mem_heap_area)
+          && heap_state_p->first_block < heap_state_p->image_size
+          && heap_state_p->last_block < heap_state_p->image_size
+          && heap_state_p->first_block % MEM_HEAP_CHUNK_SIZE == 0
+          && heap_state_p->last_block % MEM_HEAP_CHUNK_SIZE == 0
+          && (state_p->pools.first_pool == MEM_HEAP_SNAPSHOT_POINTER_NULL
+              || state_p->pools.first_pool < heap_state_p->image_size));
+} /* mem_is_snapshot_state_valid */
+
+/**
+ * Initialize memory allocators from a heap snapshot
+ */
+void
+mem_init_from_snapshot (const mem_snapshot_state_t *state_p, /**< memory allocators' state */
+                        const uint8_t *image_p) /**< heap image */
+{
+  JERRY_ASSERT (mem_is_snapshot_state_valid (state_p));
+
+  mem_heap_init_from_snapshot (mem_heap_area, sizeof (mem_heap_area), &state_p->heap, image_p);
+  mem_pools_init_from_snapshot (&state_p->pools);
+  mem_scratch_init (mem_scratch_area, sizeof (mem_scratch_area));
+} /* mem_init_from_snapshot */
+
 /**
  * Get base pointer for allocation area.
  */
@@ -196,6 +279,7 @@ mem_stats_reset_peak (void)
 {
   mem_heap_stats_reset_peak ();
   mem_pools_stats_reset_peak ();
+  mem_scratch_stats_reset_peak ();
 } /* mem_stats_reset_peak */
 
 /**
@@ -222,5 +306,20 @@ mem_stats_print (void)
           stats.free_chunks,
           stats.peak_pools_count,
           stats.peak_allocated_chunks);
+
+  mem_scratch_stats_t scratch_stats;
+  mem_scratch_get_stats (&scratch_stats);
+
+  printf ("Scratch stack stats:\n");
+  printf ("  Size: %zu\n"
+          "  Allocated bytes: %zu\n"
+          "  Peak allocated bytes: %zu\n"
+          "  Allocations: %zu\n"
+          "  Heap fallbacks: %zu\n\n",
+          scratch_stats.size,
+          scratch_stats.allocated_bytes,
+          scratch_stats.peak_allocated_bytes,
+          scratch_stats.allocations,
+          scratch_stats.heap_fallbacks);
 } /* mem_stats_print */
 #endif /* MEM_STATS */
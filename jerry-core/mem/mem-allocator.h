@@ -27,11 +27,16 @@
 #include "mem-config.h"
 #include "mem-heap.h"
 #include "mem-poolman.h"
+#include "mem-scratch.h"
 
 /**
  * Compressed pointer
  */
+#ifndef CONFIG_MEM_CPOINTER_32BIT
 typedef uint16_t mem_cpointer_t;
+#else /* !CONFIG_MEM_CPOINTER_32BIT */
+typedef uint32_t mem_cpointer_t;
+#endif /* CONFIG_MEM_CPOINTER_32BIT */
 
 /**
  * Representation of NULL value for compressed pointers
@@ -119,9 +124,23 @@ typedef void (*mem_try_give_memory_back_callback_t) (mem_try_give_memory_back_se
     MEM_CP_SET_NON_NULL_POINTER (cp_value, non_compressed_pointer); \
   }
 
+/**
+ * Memory allocators' state, stored in a heap snapshot
+ */
+typedef struct
+{
+  mem_heap_snapshot_state_t heap; /**< heap's state */
+  mem_pools_snapshot_state_t pools; /**< pool manager's state */
+} mem_snapshot_state_t;
+
 extern void mem_init (void);
 extern void mem_finalize (bool is_show_mem_stats);
 
+extern size_t mem_get_snapshot_image_size (void);
+extern void mem_save_snapshot (mem_snapshot_state_t *out_state_p, uint8_t *out_image_p);
+extern bool mem_is_snapshot_state_valid (const mem_snapshot_state_t *state_p);
+extern void mem_init_from_snapshot (const mem_snapshot_state_t *state_p, const uint8_t *image_p);
+
 extern uintptr_t mem_compress_pointer (const void *pointer);
 extern void* mem_decompress_pointer (uintptr_t compressed_pointer);
 
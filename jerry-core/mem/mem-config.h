@@ -33,6 +33,11 @@
  */
 #define MEM_HEAP_CHUNK_SIZE ((size_t) (CONFIG_MEM_HEAP_CHUNK_SIZE))
 
+/**
+ * Size of scratch stack
+ */
+#define MEM_SCRATCH_AREA_SIZE ((size_t) (CONFIG_MEM_SCRATCH_AREA_SIZE))
+
 /**
  * Size of pool chunk
  */
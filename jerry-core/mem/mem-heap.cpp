@@ -449,6 +449,123 @@ mem_heap_finalize (void)
   memset (&mem_heap, 0, sizeof (mem_heap));
 } /* mem_heap_finalize */
 
+/**
+ * Convert pointer to the heap to its representation in a heap snapshot
+ *
+ * @return offset of the pointed byte from the heap's beginning - if the pointer is not NULL,
+ *         MEM_HEAP_SNAPSHOT_POINTER_NULL - otherwise.
+ */
+mem_heap_snapshot_pointer_t
+mem_heap_get_snapshot_pointer (const void *ptr) /**< pointer to the heap or NULL */
+{
+  if (ptr == NULL)
+  {
+    return MEM_HEAP_SNAPSHOT_POINTER_NULL;
+  }
+
+  JERRY_ASSERT (mem_heap.heap_start <= ptr
+                && ptr < mem_heap.heap_start + mem_heap.heap_size);
+
+  return (mem_heap_snapshot_pointer_t) ((const uint8_t *) ptr - mem_heap.heap_start);
+} /* mem_heap_get_snapshot_pointer */
+
+/**
+ * Convert representation of a heap pointer in a heap snapshot back to the pointer
+ *
+ * @return pointer to the heap - if snapshot pointer is not MEM_HEAP_SNAPSHOT_POINTER_NULL,
+ *         NULL - otherwise.
+ */
+void*
+mem_heap_get_pointer_from_snapshot (mem_heap_snapshot_pointer_t snapshot_pointer) /**< pointer,
+                                                                                    *   stored in a snapshot */
+{
+  if (snapshot_pointer == MEM_HEAP_SNAPSHOT_POINTER_NULL)
+  {
+    return NULL;
+  }
+
+  JERRY_ASSERT (snapshot_pointer < mem_heap.heap_size);
+
+  return mem_heap.heap_start + snapshot_pointer;
+} /* mem_heap_get_pointer_from_snapshot */
+
+/**
+ * Get size of the heap's beginning that should be stored in a heap snapshot
+ *
+ * Note:
+ *      all allocated blocks are placed in the area, and the rest of the heap is the last block's free space.
+ *
+ * @return size of the heap image
+ */
+size_t
+mem_heap_get_snapshot_image_size (void)
+{
+  mem_block_header_t *last_block_p = mem_heap.last_block_p;
+
+  VALGRIND_DEFINED_STRUCT (last_block_p);
+  bool is_last_block_free = mem_is_block_free (last_block_p);
+  VALGRIND_NOACCESS_STRUCT (last_block_p);
+
+  if (is_last_block_free)
+  {
+    return (size_t) ((uint8_t *) (last_block_p + 1) - mem_heap.heap_start);
+  }
+  else
+  {
+    return mem_heap.heap_size;
+  }
+} /* mem_heap_get_snapshot_image_size */
+
+/**
+ * Save heap's state and image of the heap to a heap snapshot
+ */
+void
+mem_heap_save_snapshot (mem_heap_snapshot_state_t *out_state_p, /**< out: heap's state */
+                        uint8_t *out_image_p) /**< out: buffer for the heap image
+                                               *        (see also: mem_heap_get_snapshot_image_size) */
+{
+  out_state_p->image_size = mem_heap_get_snapshot_image_size ();
+  out_state_p->first_block = mem_heap_get_snapshot_pointer (mem_heap.first_block_p);
+  out_state_p->last_block = mem_heap_get_snapshot_pointer (mem_heap.last_block_p);
+  out_state_p->allocated_bytes = mem_heap.allocated_bytes;
+  out_state_p->limit = mem_heap.limit;
+
+#ifdef MEM_STATS
+  out_state_p->stats = mem_heap_stats;
+#endif /* MEM_STATS */
+
+  VALGRIND_DEFINED_SPACE (mem_heap.heap_start, out_state_p->image_size);
+  memcpy (out_image_p, mem_heap.heap_start, out_state_p->image_size);
+} /* mem_heap_save_snapshot */
+
+/**
+ * Initialize heap from a heap snapshot
+ */
+void
+mem_heap_init_from_snapshot (uint8_t *heap_start, /**< first address of heap space */
+                             size_t heap_size, /**< heap space size */
+                             const mem_heap_snapshot_state_t *state_p, /**< heap's state */
+                             const uint8_t *image_p) /**< heap image */
+{
+  mem_heap_init (heap_start, heap_size);
+
+  JERRY_ASSERT (state_p->image_size <= heap_size);
+
+  VALGRIND_DEFINED_SPACE (heap_start, state_p->image_size);
+  memcpy (heap_start, image_p, state_p->image_size);
+
+  mem_heap.first_block_p = (mem_block_header_t *) mem_heap_get_pointer_from_snapshot (state_p->first_block);
+  mem_heap.last_block_p = (mem_block_header_t *) mem_heap_get_pointer_from_snapshot (state_p->last_block);
+  mem_heap.allocated_bytes = state_p->allocated_bytes;
+  mem_heap.limit = state_p->limit;
+
+#ifdef MEM_STATS
+  mem_heap_stats = state_p->stats;
+#endif /* MEM_STATS */
+
+  mem_check_heap ();
+} /* mem_heap_init_from_snapshot */
+
 /**
  * Initialize block header located in the specified first chunk of the block
  */
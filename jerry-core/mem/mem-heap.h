@@ -81,34 +81,40 @@ extern void mem_heap_stats_reset_peak (void);
 #endif /* MEM_STATS */
 
 /**
- * Define a local array variable and allocate memory for the array on the heap.
+ * Representation of a heap pointer in a heap snapshot - offset of the pointed byte from the heap's beginning
  *
- * If requested number of elements is zero, assign NULL to the variable.
- *
- * Warning:
- *         if there is not enough memory on the heap, shutdown engine with ERR_OUT_OF_MEMORY.
+ * Unlike compressed pointers, the representation can point to the heap's first byte.
  */
-#define MEM_DEFINE_LOCAL_ARRAY(var_name, number, type) \
-{ \
-  size_t var_name ## ___size = (size_t) (number) * sizeof (type); \
-  type *var_name = static_cast <type *> (mem_heap_alloc_block (var_name ## ___size, MEM_HEAP_ALLOC_SHORT_TERM));
+typedef uint32_t mem_heap_snapshot_pointer_t;
 
 /**
- * Free the previously defined local array variable, freeing corresponding block on the heap,
- * if it was allocated (i.e. if the array's size was non-zero).
+ * Representation of NULL value in a heap snapshot
  */
-#define MEM_FINALIZE_LOCAL_ARRAY(var_name) \
-  if (var_name != NULL) \
-  { \
-    JERRY_ASSERT (var_name ## ___size != 0); \
-    \
-    mem_heap_free_block (var_name); \
-  } \
-  else \
-  { \
-    JERRY_ASSERT (var_name ## ___size == 0); \
-  } \
-}
+#define MEM_HEAP_SNAPSHOT_POINTER_NULL (UINT32_MAX)
+
+/**
+ * Heap's state, stored in a heap snapshot
+ */
+typedef struct
+{
+  size_t image_size; /**< size of the heap's beginning, containing all allocated blocks */
+  mem_heap_snapshot_pointer_t first_block; /**< first block of the heap */
+  mem_heap_snapshot_pointer_t last_block; /**< last block of the heap */
+  size_t allocated_bytes; /**< total size of allocated heap space */
+  size_t limit; /**< current limit of heap usage */
+#ifdef MEM_STATS
+  mem_heap_stats_t stats; /**< heap's memory usage statistics */
+#endif /* MEM_STATS */
+} mem_heap_snapshot_state_t;
+
+extern mem_heap_snapshot_pointer_t mem_heap_get_snapshot_pointer (const void *ptr);
+extern void* mem_heap_get_pointer_from_snapshot (mem_heap_snapshot_pointer_t snapshot_pointer);
+extern size_t mem_heap_get_snapshot_image_size (void);
+extern void mem_heap_save_snapshot (mem_heap_snapshot_state_t *out_state_p, uint8_t *out_image_p);
+extern void mem_heap_init_from_snapshot (uint8_t *heap_start,
+                                         size_t heap_size,
+                                         const mem_heap_snapshot_state_t *state_p,
+                                         const uint8_t *image_p);
 
 /**
  * @}
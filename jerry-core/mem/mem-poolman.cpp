@@ -90,6 +90,37 @@ mem_pools_finalize (void)
   JERRY_ASSERT (mem_free_chunks_number == 0);
 } /* mem_pools_finalize */
 
+/**
+ * Save pool manager's state to a heap snapshot
+ */
+void
+mem_pools_save_snapshot_state (mem_pools_snapshot_state_t *out_state_p) /**< out: pool manager's state */
+{
+  out_state_p->first_pool = mem_heap_get_snapshot_pointer (mem_pools);
+  out_state_p->free_chunks_number = mem_free_chunks_number;
+
+#ifdef MEM_STATS
+  out_state_p->stats = mem_pools_stats;
+#endif /* MEM_STATS */
+} /* mem_pools_save_snapshot_state */
+
+/**
+ * Initialize pool manager from a heap snapshot
+ *
+ * Note:
+ *      the heap should be already restored from the snapshot
+ */
+void
+mem_pools_init_from_snapshot (const mem_pools_snapshot_state_t *state_p) /**< pool manager's state */
+{
+  mem_pools = (mem_pool_state_t *) mem_heap_get_pointer_from_snapshot (state_p->first_pool);
+  mem_free_chunks_number = state_p->free_chunks_number;
+
+#ifdef MEM_STATS
+  mem_pools_stats = state_p->stats;
+#endif /* MEM_STATS */
+} /* mem_pools_init_from_snapshot */
+
 /**
  * Long path for mem_pools_alloc
  *
@@ -28,6 +28,7 @@
 #define JERRY_MEM_POOLMAN_H
 
 #include "jrt.h"
+#include "mem-heap.h"
 
 extern void mem_pools_init (void);
 extern void mem_pools_finalize (void);
@@ -66,6 +67,21 @@ extern void mem_pools_get_stats (mem_pools_stats_t *out_pools_stats_p);
 extern void mem_pools_stats_reset_peak (void);
 #endif /* MEM_STATS */
 
+/**
+ * Pool manager's state, stored in a heap snapshot
+ */
+typedef struct
+{
+  mem_heap_snapshot_pointer_t first_pool; /**< first pool of the pools' list */
+  size_t free_chunks_number; /**< number of free chunks */
+#ifdef MEM_STATS
+  mem_pools_stats_t stats; /**< pools' memory usage statistics */
+#endif /* MEM_STATS */
+} mem_pools_snapshot_state_t;
+
+extern void mem_pools_save_snapshot_state (mem_pools_snapshot_state_t *out_state_p);
+extern void mem_pools_init_from_snapshot (const mem_pools_snapshot_state_t *state_p);
+
 #endif /* JERRY_MEM_POOLMAN_H */
 
 /**
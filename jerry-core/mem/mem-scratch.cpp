@@ -0,0 +1,264 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** \addtogroup mem Memory allocation
+ * @{
+ *
+ * \addtogroup scratch Scratch stack
+ * @{
+ */
+
+/**
+ * Scratch stack implementation
+ */
+
+#include "jrt.h"
+#include "jrt-libc-includes.h"
+#include "mem-allocator.h"
+#include "mem-config.h"
+#include "mem-heap.h"
+#include "mem-scratch.h"
+
+/*
+ * Valgrind-related options and headers
+ */
+#ifdef JERRY_VALGRIND
+# include "memcheck.h"
+
+# define VALGRIND_NOACCESS_SPACE(p, s)  (void)VALGRIND_MAKE_MEM_NOACCESS((p), (s))
+# define VALGRIND_UNDEFINED_SPACE(p, s) (void)VALGRIND_MAKE_MEM_UNDEFINED((p), (s))
+#else /* JERRY_VALGRIND */
+# define VALGRIND_NOACCESS_SPACE(p, s)
+# define VALGRIND_UNDEFINED_SPACE(p, s)
+#endif /* JERRY_VALGRIND */
+
+/**
+ * Scratch stack state
+ */
+typedef struct
+{
+  uint8_t *area_start; /**< first address of the scratch area */
+  size_t area_size; /**< size of the scratch area */
+  size_t top; /**< offset of the first free byte of the area */
+} mem_scratch_state_t;
+
+/**
+ * Scratch stack
+ */
+static mem_scratch_state_t mem_scratch;
+
+#ifdef MEM_STATS
+/**
+ * Scratch stack's memory usage statistics
+ */
+static mem_scratch_stats_t mem_scratch_stats;
+
+static void mem_scratch_stat_init (void);
+static void mem_scratch_stat_alloc (void);
+static void mem_scratch_stat_heap_fallback (void);
+
+#  define MEM_SCRATCH_STAT_INIT() mem_scratch_stat_init ()
+#  define MEM_SCRATCH_STAT_ALLOC() mem_scratch_stat_alloc ()
+#  define MEM_SCRATCH_STAT_HEAP_FALLBACK() mem_scratch_stat_heap_fallback ()
+#else /* !MEM_STATS */
+#  define MEM_SCRATCH_STAT_INIT()
+#  define MEM_SCRATCH_STAT_ALLOC()
+#  define MEM_SCRATCH_STAT_HEAP_FALLBACK()
+#endif /* !MEM_STATS */
+
+/**
+ * Check whether the pointer points to the scratch area
+ *
+ * @return true - if the pointer points to the scratch area,
+ *         false - otherwise.
+ */
+static bool
+mem_scratch_is_area_pointer (const void *ptr) /**< pointer */
+{
+  const uint8_t *uint8_ptr = (const uint8_t *) ptr;
+
+  return (uint8_ptr >= mem_scratch.area_start
+          && uint8_ptr < mem_scratch.area_start + mem_scratch.area_size);
+} /* mem_scratch_is_area_pointer */
+
+/**
+ * Initialize scratch stack
+ */
+void
+mem_scratch_init (uint8_t *area_start, /**< first address of the area */
+                  size_t area_size) /**< size of the area */
+{
+  JERRY_ASSERT (area_start != NULL);
+  JERRY_ASSERT ((uintptr_t) area_start % MEM_ALIGNMENT == 0);
+  JERRY_ASSERT (area_size % MEM_ALIGNMENT == 0);
+
+  mem_scratch.area_start = area_start;
+  mem_scratch.area_size = area_size;
+  mem_scratch.top = 0;
+
+  VALGRIND_NOACCESS_SPACE (area_start, area_size);
+
+  MEM_SCRATCH_STAT_INIT ();
+} /* mem_scratch_init */
+
+/**
+ * Finalize scratch stack
+ */
+void
+mem_scratch_finalize (void)
+{
+  /* all local arrays should be released at the moment */
+  JERRY_ASSERT (mem_scratch.top == 0);
+
+  mem_scratch.area_start = NULL;
+  mem_scratch.area_size = 0;
+} /* mem_scratch_finalize */
+
+/**
+ * Allocate region for a temporary buffer
+ *
+ * Note:
+ *      the region should be freed with mem_scratch_free in reverse order of allocation
+ *
+ * Warning:
+ *         if the region doesn't fit into the scratch area and there is not enough memory on the heap,
+ *         engine is shut down with ERR_OUT_OF_MEMORY.
+ *
+ * @return pointer to allocated region - if requested size is non-zero,
+ *         NULL - otherwise.
+ */
+void*
+mem_scratch_alloc (size_t size_in_bytes) /**< size of region to allocate */
+{
+  if (unlikely (size_in_bytes == 0))
+  {
+    return NULL;
+  }
+
+  const size_t aligned_size = JERRY_ALIGNUP (size_in_bytes, MEM_ALIGNMENT);
+
+  if (likely (aligned_size <= mem_scratch.area_size - mem_scratch.top))
+  {
+    uint8_t *region_p = mem_scratch.area_start + mem_scratch.top;
+    mem_scratch.top += aligned_size;
+
+    VALGRIND_UNDEFINED_SPACE (region_p, size_in_bytes);
+
+    MEM_SCRATCH_STAT_ALLOC ();
+
+    return region_p;
+  }
+  else
+  {
+    MEM_SCRATCH_STAT_HEAP_FALLBACK ();
+
+    return mem_heap_alloc_block (size_in_bytes, MEM_HEAP_ALLOC_SHORT_TERM);
+  }
+} /* mem_scratch_alloc */
+
+/**
+ * Free region, previously allocated with mem_scratch_alloc
+ */
+void
+mem_scratch_free (void *ptr, /**< pointer to the region */
+                  size_t size_in_bytes) /**< size of the region (as passed to mem_scratch_alloc) */
+{
+  JERRY_ASSERT (ptr != NULL && size_in_bytes != 0);
+
+  if (likely (mem_scratch_is_area_pointer (ptr)))
+  {
+    const size_t aligned_size = JERRY_ALIGNUP (size_in_bytes, MEM_ALIGNMENT);
+
+    /* the region should be the most recently allocated one */
+    JERRY_ASSERT (mem_scratch.top >= aligned_size
+                  && (uint8_t *) ptr == mem_scratch.area_start + mem_scratch.top - aligned_size);
+
+    mem_scratch.top -= aligned_size;
+
+    VALGRIND_NOACCESS_SPACE (ptr, aligned_size);
+
+#ifdef MEM_STATS
+    mem_scratch_stats.allocated_bytes = mem_scratch.top;
+#endif /* MEM_STATS */
+  }
+  else
+  {
+    mem_heap_free_block (ptr);
+  }
+} /* mem_scratch_free */
+
+#ifdef MEM_STATS
+/**
+ * Get scratch stack's memory usage statistics
+ */
+void
+mem_scratch_get_stats (mem_scratch_stats_t *out_scratch_stats_p) /**< out: scratch stack's stats */
+{
+  *out_scratch_stats_p = mem_scratch_stats;
+} /* mem_scratch_get_stats */
+
+/**
+ * Reset peak values in memory usage statistics
+ */
+void
+mem_scratch_stats_reset_peak (void)
+{
+  mem_scratch_stats.peak_allocated_bytes = mem_scratch_stats.allocated_bytes;
+} /* mem_scratch_stats_reset_peak */
+
+/**
+ * Initialize scratch stack's memory usage statistics account structure
+ */
+static void
+mem_scratch_stat_init (void)
+{
+  memset (&mem_scratch_stats, 0, sizeof (mem_scratch_stats));
+
+  mem_scratch_stats.size = mem_scratch.area_size;
+} /* mem_scratch_stat_init */
+
+/**
+ * Account allocation of a region in the scratch area
+ */
+static void
+mem_scratch_stat_alloc (void)
+{
+  mem_scratch_stats.allocations++;
+  mem_scratch_stats.allocated_bytes = mem_scratch.top;
+
+  if (mem_scratch_stats.allocated_bytes > mem_scratch_stats.peak_allocated_bytes)
+  {
+    mem_scratch_stats.peak_allocated_bytes = mem_scratch_stats.allocated_bytes;
+  }
+  if (mem_scratch_stats.allocated_bytes > mem_scratch_stats.global_peak_allocated_bytes)
+  {
+    mem_scratch_stats.global_peak_allocated_bytes = mem_scratch_stats.allocated_bytes;
+  }
+} /* mem_scratch_stat_alloc */
+
+/**
+ * Account allocation, passed to the heap because of the scratch area's overflow
+ */
+static void
+mem_scratch_stat_heap_fallback (void)
+{
+  mem_scratch_stats.heap_fallbacks++;
+} /* mem_scratch_stat_heap_fallback */
+#endif /* MEM_STATS */
+
+/**
+ * @}
+ * @}
+ */
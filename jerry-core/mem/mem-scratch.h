@@ -0,0 +1,100 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** \addtogroup mem Memory allocation
+ * @{
+ *
+ * \addtogroup scratch Scratch stack
+ * @{
+ */
+
+/**
+ * Scratch stack interface
+ *
+ * The scratch stack is a bump-pointer area for short-term temporary buffers
+ * that are released in strict LIFO order (see also: MEM_DEFINE_LOCAL_ARRAY).
+ * Requests that don't fit into the area are transparently served by the heap.
+ */
+#ifndef JERRY_MEM_SCRATCH_H
+#define JERRY_MEM_SCRATCH_H
+
+#include "jrt.h"
+
+extern void mem_scratch_init (uint8_t *area_start, size_t area_size);
+extern void mem_scratch_finalize (void);
+extern void* mem_scratch_alloc (size_t size_in_bytes);
+extern void mem_scratch_free (void *ptr, size_t size_in_bytes);
+
+#ifdef MEM_STATS
+/**
+ * Scratch stack's memory usage statistics
+ */
+typedef struct
+{
+  size_t size; /**< size of the scratch area */
+
+  size_t allocated_bytes; /**< currently allocated bytes */
+  size_t peak_allocated_bytes; /**< peak allocated bytes */
+  size_t global_peak_allocated_bytes; /**< non-resettable peak allocated bytes */
+
+  size_t allocations; /**< number of allocations served by the scratch area */
+  size_t heap_fallbacks; /**< number of allocations passed to the heap because of the area's overflow */
+} mem_scratch_stats_t;
+
+extern void mem_scratch_get_stats (mem_scratch_stats_t *out_scratch_stats_p);
+extern void mem_scratch_stats_reset_peak (void);
+#endif /* MEM_STATS */
+
+/**
+ * Define a local array variable and allocate memory for the array on the scratch stack.
+ *
+ * If requested number of elements is zero, assign NULL to the variable.
+ *
+ * Note:
+ *      local arrays should be finalized in reverse order of their definition,
+ *      which is guaranteed by the macros' lexical nesting.
+ *
+ * Warning:
+ *         if the array doesn't fit into the scratch stack and there is not enough memory on the heap,
+ *         shutdown engine with ERR_OUT_OF_MEMORY.
+ */
+#define MEM_DEFINE_LOCAL_ARRAY(var_name, number, type) \
+{ \
+  size_t var_name ## ___size = (size_t) (number) * sizeof (type); \
+  type *var_name = static_cast <type *> (mem_scratch_alloc (var_name ## ___size));
+
+/**
+ * Free the previously defined local array variable, releasing corresponding region of the scratch stack
+ * (or of the heap), if it was allocated (i.e. if the array's size was non-zero).
+ */
+#define MEM_FINALIZE_LOCAL_ARRAY(var_name) \
+  if (var_name != NULL) \
+  { \
+    JERRY_ASSERT (var_name ## ___size != 0); \
+    \
+    mem_scratch_free (var_name, var_name ## ___size); \
+  } \
+  else \
+  { \
+    JERRY_ASSERT (var_name ## ___size == 0); \
+  } \
+}
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !JERRY_MEM_SCRATCH_H */
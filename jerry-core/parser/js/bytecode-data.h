@@ -29,12 +29,24 @@
  *
  * Bytecode, which is kept in the 'opcodes' field, is divided into blocks
  * of 'BLOCK_SIZE' operands. Every block has its own numbering of literals.
- * Literal uid could be in range [0, 127] in every block.
+ * Literal uid is in range [0, 127], if the block refers to no more than 128 literals,
+ * so that the uid fits into compact form of instruction. Greater uids are encoded
+ * with BLOCK_LIT_UID_WIDE_FLAG set, to be distinguished from register identifiers.
  *
  * To map uid to literal id 'lit_id_hash' table is used.
  */
 #define BLOCK_SIZE 64
 
+/**
+ * Maximum literal uid, that is encoded in instruction's argument as is
+ */
+#define BLOCK_LIT_UID_COMPACT_LAST (OPCODE_REG_FIRST - 1)
+
+/**
+ * Flag of literal uid, greater than BLOCK_LIT_UID_COMPACT_LAST, in instruction's argument
+ */
+#define BLOCK_LIT_UID_WIDE_FLAG (0x8000u)
+
 /**
  * Header of byte-code memory region, containing byte-code array and literal identifiers hash table
  */
@@ -44,12 +56,47 @@ typedef struct __attribute__ ((aligned (MEM_ALIGNMENT)))
                                   *   See also: lit_id_hash_table_init */
   mem_cpointer_t next_opcodes_cp; /**< pointer to next byte-code memory region */
   opcode_counter_t instructions_number; /**< number of instructions in the byte-code array */
+  mem_cpointer_t lazy_function_bodies_cp; /**< pointer to table of function bodies, which compilation
+                                           *   is deferred till the functions' first calls (or NULL,
+                                           *   if there are no such bodies in the byte-code)
+                                           *   See also: lazy_function_body_t */
+  mem_cpointer_t wide_opcodes_cp; /**< pointer to table of instructions, which arguments don't fit
+                                   *   into compact form (or NULL, if there are no such instructions
+                                   *   in the byte-code)
+                                   *   See also: OPCODE_COMPACT_WIDE_FLAG */
+#ifdef VM_PROFILE
+  mem_cpointer_t lines_cp; /**< pointer to array of source line numbers of the instructions */
+#endif /* VM_PROFILE */
 } opcodes_header_t;
 
+/**
+ * Descriptor of a function's body, which compilation is deferred till the function's first call
+ * (see also: OPCODE_META_TYPE_LAZY_FUNCTION_BODY)
+ *
+ * Note:
+ *      the table of the descriptors is terminated with a descriptor, which pointers are both NULL
+ */
+typedef struct
+{
+  mem_cpointer_t source_cp; /**< pointer to source code of the body (see also: lazy_function_body_source_t),
+                             *   or NULL - if the body is already compiled */
+  mem_cpointer_t bytecode_cp; /**< pointer to byte-code of the body, or NULL - until the body is compiled */
+} lazy_function_body_t;
+
+/**
+ * Header of heap block, containing source code of a function's body, which compilation is deferred
+ *
+ * The header is followed by the source code's characters.
+ */
+typedef struct
+{
+  lit_utf8_size_t size; /**< size of the source code in bytes */
+} lazy_function_body_source_t;
+
 typedef struct
 {
   const ecma_char_t *strings_buffer;
-  const opcode_t *opcodes;
+  const opcode_compact_t *opcodes;
   opcode_counter_t opcodes_count;
 } bytecode_data_t;
 
@@ -64,5 +111,23 @@ typedef struct
 #define GET_HASH_TABLE_FOR_BYTECODE(opcodes) (MEM_CP_GET_POINTER (lit_id_hash_table, \
                                                                   GET_BYTECODE_HEADER (opcodes)->lit_id_hash_cp))
 
+/**
+ * Macros to get a table of long opcode counters (see also: OPCODE_COUNTER_LONG_IDX_FIRST),
+ * located right after the byte-code array
+ */
+#define GET_LONG_OPCODE_COUNTERS_FOR_BYTECODE(opcodes) \
+  ((opcode_counter_t *) (((uint8_t *) GET_BYTECODE_HEADER (opcodes)) \
+                         + JERRY_ALIGNUP (sizeof (opcodes_header_t) \
+                                          + (GET_BYTECODE_HEADER (opcodes)->instructions_number \
+                                             * sizeof (opcode_compact_t)), \
+                                          MEM_ALIGNMENT)))
+
+/**
+ * Macros to get a descriptor of function's body, which compilation is deferred,
+ * by index of the descriptor in the table of the byte-code region
+ */
+#define GET_LAZY_FUNCTION_BODY_FOR_BYTECODE(opcodes, index) \
+  (MEM_CP_GET_NON_NULL_POINTER (lazy_function_body_t, GET_BYTECODE_HEADER (opcodes)->lazy_function_bodies_cp) \
+   + (index))
 
 #endif // BYTECODE_DATA_H
@@ -38,13 +38,24 @@ data (array_list al)
   return (uint8_t *) al + sizeof (array_list_header);
 }
 
-array_list
-array_list_append (array_list al, void *element)
+/**
+ * Grow the list's block, so that it could hold at least the specified number of elements
+ *
+ * Note:
+ *      the block is grown by at least half of its size, so appending an element takes amortized constant time
+ *
+ * @return the list (the block could be moved)
+ */
+static array_list
+array_list_reserve (array_list al, /**< list */
+                    size_t elements_count) /**< required number of elements */
 {
   array_list_header *h = extract_header (al);
-  if ((h->len + 1) * h->element_size + sizeof (array_list_header) > h->size)
+  const size_t required_size = elements_count * h->element_size + sizeof (array_list_header);
+
+  if (required_size > h->size)
   {
-    size_t size = jsp_mm_recommend_size (h->size + h->element_size);
+    size_t size = jsp_mm_recommend_size (JERRY_MAX (required_size, h->size + h->size / 2));
     JERRY_ASSERT (size > h->size);
 
     uint8_t *new_block_p = (uint8_t *) jsp_mm_alloc (size);
@@ -57,6 +68,16 @@ array_list_append (array_list al, void *element)
     h->size = size;
     al = (array_list) h;
   }
+
+  return al;
+} /* array_list_reserve */
+
+array_list
+array_list_append (array_list al, void *element)
+{
+  al = array_list_reserve (al, extract_header (al)->len + 1);
+
+  array_list_header *h = extract_header (al);
   memcpy (data (al) + (h->len * h->element_size), element, h->element_size);
   h->len++;
   return al;
@@ -70,6 +91,18 @@ array_list_drop_last (array_list al)
   h->len--;
 }
 
+/**
+ * Remove elements from end of the list, so that the specified number of elements remains
+ */
+void
+array_list_truncate (array_list al, /**< list */
+                     size_t len) /**< new number of elements */
+{
+  array_list_header *h = extract_header (al);
+  JERRY_ASSERT (len <= h->len);
+  h->len = len;
+} /* array_list_truncate */
+
 void *
 array_list_element (array_list al, size_t index)
 {
@@ -25,6 +25,7 @@ array_list array_list_init (uint8_t);
 void array_list_free (array_list);
 array_list array_list_append (array_list, void *);
 void array_list_drop_last (array_list);
+void array_list_truncate (array_list, size_t);
 void *array_list_element (array_list, size_t);
 void array_list_set_element (array_list, size_t, void *);
 void *array_list_last_element (array_list, size_t);
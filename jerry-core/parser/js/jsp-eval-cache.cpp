@@ -0,0 +1,306 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "jrt-libc-includes.h"
+#include "jsp-eval-cache.h"
+#include "mem-heap.h"
+
+/** \addtogroup jsparser ECMAScript parser
+ * @{
+ *
+ * \addtogroup evalcache Cache of byte-code, generated for eval and Function constructor
+ * @{
+ *
+ * Byte-code arrays are not freed until engine's finalization (see also: serializer_free),
+ * so byte-code, generated for a source, can be reused upon subsequent parse requests
+ * for the same source, kind of code and strictness.
+ */
+
+#ifndef CONFIG_PARSER_EVAL_CACHE_DISABLE
+/**
+ * Entry of the eval cache
+ */
+typedef struct
+{
+  const opcode_compact_t *opcodes_p; /**< cached byte-code (NULL marks entry empty) */
+  jerry_api_char_t *source_p; /**< copy of the source code */
+  size_t source_size; /**< size of the source code */
+  uint32_t hash; /**< hash of the source code */
+  uint8_t kind; /**< kind of the code (jsp_eval_cache_code_kind_t) */
+  bool is_strict; /**< whether the code was parsed in strict mode */
+  bool is_recently_used; /**< whether the entry was hit since last eviction pass */
+} jsp_eval_cache_entry_t;
+
+/**
+ * The eval cache's entries
+ */
+static jsp_eval_cache_entry_t jsp_eval_cache_entries[CONFIG_PARSER_EVAL_CACHE_ENTRIES_NUMBER];
+
+/**
+ * Position of eviction pass in the entries array
+ */
+static uint32_t jsp_eval_cache_eviction_index;
+
+#ifdef MEM_STATS
+/**
+ * The eval cache's usage statistics
+ */
+static jsp_eval_cache_stats_t jsp_eval_cache_stats;
+#endif /* MEM_STATS */
+
+/**
+ * Calculate hash of source code (32-bit FNV-1a)
+ *
+ * @return hash value
+ */
+static uint32_t
+jsp_eval_cache_calc_hash (const jerry_api_char_t *source_p, /**< source code */
+                          size_t source_size) /**< size of the source code */
+{
+  uint32_t hash = 2166136261u;
+
+  for (size_t i = 0; i < source_size; i++)
+  {
+    hash ^= source_p[i];
+    hash *= 16777619u;
+  }
+
+  return hash;
+} /* jsp_eval_cache_calc_hash */
+
+/**
+ * Free entry of the eval cache
+ */
+static void
+jsp_eval_cache_free_entry (jsp_eval_cache_entry_t *entry_p) /**< entry */
+{
+  JERRY_ASSERT (entry_p->opcodes_p != NULL);
+
+  if (entry_p->source_p != NULL)
+  {
+    mem_heap_free_block (entry_p->source_p);
+  }
+
+  entry_p->opcodes_p = NULL;
+  entry_p->source_p = NULL;
+} /* jsp_eval_cache_free_entry */
+#endif /* !CONFIG_PARSER_EVAL_CACHE_DISABLE */
+
+/**
+ * Initialize the eval cache
+ */
+void
+jsp_eval_cache_init (void)
+{
+#ifndef CONFIG_PARSER_EVAL_CACHE_DISABLE
+  memset (jsp_eval_cache_entries, 0, sizeof (jsp_eval_cache_entries));
+  jsp_eval_cache_eviction_index = 0;
+
+#ifdef MEM_STATS
+  memset (&jsp_eval_cache_stats, 0, sizeof (jsp_eval_cache_stats));
+#endif /* MEM_STATS */
+#endif /* !CONFIG_PARSER_EVAL_CACHE_DISABLE */
+} /* jsp_eval_cache_init */
+
+/**
+ * Free all entries of the eval cache
+ */
+void
+jsp_eval_cache_finalize (void)
+{
+#ifndef CONFIG_PARSER_EVAL_CACHE_DISABLE
+  for (uint32_t i = 0; i < CONFIG_PARSER_EVAL_CACHE_ENTRIES_NUMBER; i++)
+  {
+    if (jsp_eval_cache_entries[i].opcodes_p != NULL)
+    {
+      jsp_eval_cache_free_entry (&jsp_eval_cache_entries[i]);
+    }
+  }
+#endif /* !CONFIG_PARSER_EVAL_CACHE_DISABLE */
+} /* jsp_eval_cache_finalize */
+
+/**
+ * Lookup byte-code, generated for specified source code, in the eval cache
+ *
+ * @return pointer to the byte-code - if there is corresponding entry in the cache,
+ *         NULL - otherwise.
+ */
+const opcode_compact_t *
+jsp_eval_cache_lookup (jsp_eval_cache_code_kind_t kind, /**< kind of the code */
+                       bool is_strict, /**< is the code parsed in strict mode */
+                       const jerry_api_char_t *source_p, /**< source code */
+                       size_t source_size) /**< size of the source code */
+{
+#ifndef CONFIG_PARSER_EVAL_CACHE_DISABLE
+  if (source_size > CONFIG_PARSER_EVAL_CACHE_MAX_SOURCE_SIZE)
+  {
+    return NULL;
+  }
+
+  uint32_t hash = jsp_eval_cache_calc_hash (source_p, source_size);
+
+  for (uint32_t i = 0; i < CONFIG_PARSER_EVAL_CACHE_ENTRIES_NUMBER; i++)
+  {
+    jsp_eval_cache_entry_t *entry_p = &jsp_eval_cache_entries[i];
+
+    if (entry_p->opcodes_p != NULL
+        && entry_p->hash == hash
+        && entry_p->kind == kind
+        && entry_p->is_strict == is_strict
+        && entry_p->source_size == source_size
+        && memcmp (entry_p->source_p, source_p, source_size) == 0)
+    {
+      entry_p->is_recently_used = true;
+
+#ifdef MEM_STATS
+      jsp_eval_cache_stats.hits++;
+#endif /* MEM_STATS */
+
+      return entry_p->opcodes_p;
+    }
+  }
+
+#ifdef MEM_STATS
+  jsp_eval_cache_stats.misses++;
+#endif /* MEM_STATS */
+#else /* CONFIG_PARSER_EVAL_CACHE_DISABLE */
+  (void) kind;
+  (void) is_strict;
+  (void) source_p;
+  (void) source_size;
+#endif /* CONFIG_PARSER_EVAL_CACHE_DISABLE */
+
+  return NULL;
+} /* jsp_eval_cache_lookup */
+
+/**
+ * Put byte-code, generated for specified source code, into the eval cache
+ *
+ * Note:
+ *      if the cache is full, an entry that was not hit recently is replaced
+ */
+void
+jsp_eval_cache_insert (jsp_eval_cache_code_kind_t kind, /**< kind of the code */
+                       bool is_strict, /**< is the code parsed in strict mode */
+                       const jerry_api_char_t *source_p, /**< source code */
+                       size_t source_size, /**< size of the source code */
+                       const opcode_compact_t *opcodes_p) /**< byte-code, generated for the source code */
+{
+  JERRY_ASSERT (opcodes_p != NULL);
+
+#ifndef CONFIG_PARSER_EVAL_CACHE_DISABLE
+  if (source_size > CONFIG_PARSER_EVAL_CACHE_MAX_SOURCE_SIZE)
+  {
+    return;
+  }
+
+  jsp_eval_cache_entry_t *entry_p;
+
+  while (true)
+  {
+    entry_p = &jsp_eval_cache_entries[jsp_eval_cache_eviction_index];
+    jsp_eval_cache_eviction_index = (jsp_eval_cache_eviction_index + 1u) % CONFIG_PARSER_EVAL_CACHE_ENTRIES_NUMBER;
+
+    if (entry_p->opcodes_p == NULL)
+    {
+      break;
+    }
+    else if (entry_p->is_recently_used)
+    {
+      entry_p->is_recently_used = false;
+    }
+    else
+    {
+      jsp_eval_cache_free_entry (entry_p);
+
+#ifdef MEM_STATS
+      jsp_eval_cache_stats.evictions++;
+#endif /* MEM_STATS */
+
+      break;
+    }
+  }
+
+  entry_p->source_p = NULL;
+  if (source_size != 0)
+  {
+    entry_p->source_p = (jerry_api_char_t *) mem_heap_alloc_block (source_size, MEM_HEAP_ALLOC_LONG_TERM);
+    memcpy (entry_p->source_p, source_p, source_size);
+  }
+
+  entry_p->opcodes_p = opcodes_p;
+  entry_p->source_size = source_size;
+  entry_p->hash = jsp_eval_cache_calc_hash (source_p, source_size);
+  entry_p->kind = (uint8_t) kind;
+  entry_p->is_strict = is_strict;
+  entry_p->is_recently_used = false;
+#else /* CONFIG_PARSER_EVAL_CACHE_DISABLE */
+  (void) kind;
+  (void) is_strict;
+  (void) source_p;
+  (void) source_size;
+#endif /* CONFIG_PARSER_EVAL_CACHE_DISABLE */
+} /* jsp_eval_cache_insert */
+
+#ifdef MEM_STATS
+/**
+ * Get eval cache usage statistics
+ */
+void
+jsp_eval_cache_get_stats (jsp_eval_cache_stats_t *out_stats_p) /**< out: statistics */
+{
+#ifndef CONFIG_PARSER_EVAL_CACHE_DISABLE
+  *out_stats_p = jsp_eval_cache_stats;
+
+  out_stats_p->entries = 0;
+  for (uint32_t i = 0; i < CONFIG_PARSER_EVAL_CACHE_ENTRIES_NUMBER; i++)
+  {
+    if (jsp_eval_cache_entries[i].opcodes_p != NULL)
+    {
+      out_stats_p->entries++;
+    }
+  }
+#else /* CONFIG_PARSER_EVAL_CACHE_DISABLE */
+  memset (out_stats_p, 0, sizeof (*out_stats_p));
+#endif /* CONFIG_PARSER_EVAL_CACHE_DISABLE */
+} /* jsp_eval_cache_get_stats */
+
+/**
+ * Print eval cache usage statistics
+ */
+void
+jsp_eval_cache_stats_print (void)
+{
+  jsp_eval_cache_stats_t stats;
+  jsp_eval_cache_get_stats (&stats);
+
+  printf ("Eval cache stats:\n");
+  printf ("  Entries: %zu / %zu\n"
+          "  Hits: %zu\n"
+          "  Misses: %zu\n"
+          "  Evictions: %zu\n\n",
+          stats.entries,
+          (size_t) CONFIG_PARSER_EVAL_CACHE_ENTRIES_NUMBER,
+          stats.hits,
+          stats.misses,
+          stats.evictions);
+} /* jsp_eval_cache_stats_print */
+#endif /* MEM_STATS */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,72 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef JSP_EVAL_CACHE_H
+#define JSP_EVAL_CACHE_H
+
+#include "jrt.h"
+#include "opcodes.h"
+
+/** \addtogroup jsparser ECMAScript parser
+ * @{
+ *
+ * \addtogroup evalcache Cache of byte-code, generated for eval and Function constructor
+ * @{
+ */
+
+/**
+ * Kind of code, stored in the cache
+ */
+typedef enum
+{
+  JSP_EVAL_CACHE_CODE_EVAL, /**< code passed to eval () */
+  JSP_EVAL_CACHE_CODE_FUNCTION /**< body of function, created via new Function (...) */
+} jsp_eval_cache_code_kind_t;
+
+extern void jsp_eval_cache_init (void);
+extern void jsp_eval_cache_finalize (void);
+extern const opcode_compact_t *jsp_eval_cache_lookup (jsp_eval_cache_code_kind_t kind,
+                                              bool is_strict,
+                                              const jerry_api_char_t *source_p,
+                                              size_t source_size);
+extern void jsp_eval_cache_insert (jsp_eval_cache_code_kind_t kind,
+                                   bool is_strict,
+                                   const jerry_api_char_t *source_p,
+                                   size_t source_size,
+                                   const opcode_compact_t *opcodes_p);
+
+#ifdef MEM_STATS
+/**
+ * Eval cache usage statistics
+ */
+typedef struct
+{
+  size_t entries; /**< number of occupied entries */
+  size_t hits; /**< number of lookups, that found cached byte-code */
+  size_t misses; /**< number of lookups, that didn't find cached byte-code */
+  size_t evictions; /**< number of entries, replaced with newer entries */
+} jsp_eval_cache_stats_t;
+
+extern void jsp_eval_cache_get_stats (jsp_eval_cache_stats_t *out_stats_p);
+extern void jsp_eval_cache_stats_print (void);
+#endif /* MEM_STATS */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !JSP_EVAL_CACHE_H */
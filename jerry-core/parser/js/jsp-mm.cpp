@@ -25,20 +25,92 @@
  * @{
  */
 
+/**
+ * Maximum size of an allocation, placed in an arena chunk
+ *
+ * Larger blocks are allocated separately in the heap, so that they could be released just upon jsp_mm_free.
+ */
+#define JSP_MM_ARENA_MAX_ALLOCATION_SIZE (128)
+
+/**
+ * Size of an arena chunk
+ */
+#define JSP_MM_ARENA_CHUNK_SIZE (CONFIG_PARSER_MM_ARENA_CHUNK_SIZE)
+
+/**
+ * Number of lists of free arena allocations (one list per allocation size, aligned to MEM_ALIGNMENT)
+ */
+#define JSP_MM_ARENA_FREE_LISTS_NUMBER (JSP_MM_ARENA_MAX_ALLOCATION_SIZE / MEM_ALIGNMENT)
+
+JERRY_STATIC_ASSERT (JSP_MM_ARENA_MAX_ALLOCATION_SIZE % MEM_ALIGNMENT == 0);
+JERRY_STATIC_ASSERT ((JSP_MM_ARENA_MAX_ALLOCATION_SIZE & (JSP_MM_ARENA_MAX_ALLOCATION_SIZE - 1)) == 0);
+
 /**
  * Header of a managed block, allocated by parser
  */
-typedef struct __attribute__ ((alignment (MEM_ALIGNMENT)))
+typedef struct __attribute__ ((aligned (MEM_ALIGNMENT)))
 {
-  mem_cpointer_t prev_block_cp; /**< previous managed block */
-  mem_cpointer_t next_block_cp; /**< next managed block */
+  union
+  {
+    /**
+     * Links of a block, allocated separately in the heap
+     */
+    struct
+    {
+      mem_cpointer_t prev_block_cp; /**< previous separately allocated block */
+      mem_cpointer_t next_block_cp; /**< next separately allocated block */
+    } separate;
+
+    /**
+     * Description of a block, placed in an arena chunk
+     */
+    struct
+    {
+      uint16_t size; /**< size of the block's data space */
+      mem_cpointer_t next_free_block_cp; /**< next free block of the same size (for free blocks) */
+    } arena;
+  } u;
+
+  bool is_separate; /**< true - if the block is allocated separately in the heap,
+                     *   false - if the block is placed in an arena chunk */
 } jsp_mm_header_t;
 
 /**
- * List used for tracking memory blocks
+ * Header of an arena chunk
+ */
+typedef struct __attribute__ ((aligned (MEM_ALIGNMENT)))
+{
+  mem_cpointer_t next_chunk_cp; /**< previously allocated chunk */
+} jsp_mm_arena_chunk_header_t;
+
+JERRY_STATIC_ASSERT (sizeof (jsp_mm_arena_chunk_header_t) + sizeof (jsp_mm_header_t) + JSP_MM_ARENA_MAX_ALLOCATION_SIZE
+                     <= JSP_MM_ARENA_CHUNK_SIZE);
+
+/**
+ * List of blocks, allocated separately in the heap
  */
 jsp_mm_header_t *jsp_mm_blocks_p = NULL;
 
+/**
+ * List of arena chunks (the first chunk is the one, new blocks are placed to)
+ */
+static jsp_mm_arena_chunk_header_t *jsp_mm_arena_chunks_p = NULL;
+
+/**
+ * Free space of the current arena chunk
+ */
+static uint8_t *jsp_mm_arena_free_space_p = NULL;
+
+/**
+ * End of the current arena chunk
+ */
+static uint8_t *jsp_mm_arena_end_p = NULL;
+
+/**
+ * Lists of free arena blocks (list i holds blocks of (i + 1) * MEM_ALIGNMENT bytes)
+ */
+static jsp_mm_header_t *jsp_mm_arena_free_lists[JSP_MM_ARENA_FREE_LISTS_NUMBER];
+
 /**
  * Initialize managed memory allocator
  */
@@ -46,6 +118,9 @@ void
 jsp_mm_init (void)
 {
   JERRY_ASSERT (jsp_mm_blocks_p == NULL);
+  JERRY_ASSERT (jsp_mm_arena_chunks_p == NULL);
+
+  memset (jsp_mm_arena_free_lists, 0, sizeof (jsp_mm_arena_free_lists));
 } /* jsp_mm_init */
 
 /**
@@ -55,6 +130,7 @@ void
 jsp_mm_finalize (void)
 {
   JERRY_ASSERT (jsp_mm_blocks_p == NULL);
+  JERRY_ASSERT (jsp_mm_arena_chunks_p == NULL);
 } /* jsp_mm_finalize */
 
 /**
@@ -84,24 +160,84 @@ jsp_mm_recommend_size (size_t minimum_size) /**< minimum required size */
   return block_and_header_size - sizeof (jsp_mm_header_t);
 } /* jsp_mm_recommend_size */
 
+/**
+ * Place a block of specified size in an arena chunk
+ *
+ * @return pointer to the block's header
+ */
+static jsp_mm_header_t*
+jsp_mm_arena_alloc (size_t size) /**< size of the block's data space, aligned to MEM_ALIGNMENT */
+{
+  JERRY_ASSERT (size > 0 && size <= JSP_MM_ARENA_MAX_ALLOCATION_SIZE);
+  JERRY_ASSERT (size % MEM_ALIGNMENT == 0);
+
+  jsp_mm_header_t **free_list_p = &jsp_mm_arena_free_lists[size / MEM_ALIGNMENT - 1u];
+  jsp_mm_header_t *header_p = *free_list_p;
+
+  if (header_p != NULL)
+  {
+    JERRY_ASSERT (!header_p->is_separate && header_p->u.arena.size == size);
+
+    *free_list_p = MEM_CP_GET_POINTER (jsp_mm_header_t, header_p->u.arena.next_free_block_cp);
+
+    return header_p;
+  }
+
+  const size_t size_with_header = sizeof (jsp_mm_header_t) + size;
+
+  if (jsp_mm_arena_free_space_p == NULL
+      || (size_t) (jsp_mm_arena_end_p - jsp_mm_arena_free_space_p) < size_with_header)
+  {
+    jsp_mm_arena_chunk_header_t *chunk_p;
+    chunk_p = (jsp_mm_arena_chunk_header_t *) mem_heap_alloc_block (JSP_MM_ARENA_CHUNK_SIZE,
+                                                                    MEM_HEAP_ALLOC_SHORT_TERM);
+
+    MEM_CP_SET_POINTER (chunk_p->next_chunk_cp, jsp_mm_arena_chunks_p);
+    jsp_mm_arena_chunks_p = chunk_p;
+
+    jsp_mm_arena_free_space_p = (uint8_t *) (chunk_p + 1);
+    jsp_mm_arena_end_p = (uint8_t *) chunk_p + JSP_MM_ARENA_CHUNK_SIZE;
+  }
+
+  header_p = (jsp_mm_header_t *) jsp_mm_arena_free_space_p;
+  jsp_mm_arena_free_space_p += size_with_header;
+
+  header_p->is_separate = false;
+  header_p->u.arena.size = (uint16_t) size;
+  header_p->u.arena.next_free_block_cp = MEM_CP_NULL;
+
+  return header_p;
+} /* jsp_mm_arena_alloc */
+
 /**
  * Allocate a managed memory block of specified size
  *
+ * Note:
+ *      small blocks are placed in arena chunks, larger blocks are allocated separately in the heap
+ *
  * @return pointer to data space of allocated block
  */
 void*
 jsp_mm_alloc (size_t size) /**< size of block to allocate */
 {
+  const size_t aligned_size = JERRY_ALIGNUP (size == 0 ? 1 : size, MEM_ALIGNMENT);
+
+  if (aligned_size <= JSP_MM_ARENA_MAX_ALLOCATION_SIZE)
+  {
+    return (void *) (jsp_mm_arena_alloc (aligned_size) + 1);
+  }
+
   void *ptr_p = mem_heap_alloc_block (size + sizeof (jsp_mm_header_t), MEM_HEAP_ALLOC_SHORT_TERM);
 
   jsp_mm_header_t *tmem_header_p = (jsp_mm_header_t*) ptr_p;
 
-  tmem_header_p->prev_block_cp = MEM_CP_NULL;
-  MEM_CP_SET_POINTER (tmem_header_p->next_block_cp, jsp_mm_blocks_p);
+  tmem_header_p->is_separate = true;
+  tmem_header_p->u.separate.prev_block_cp = MEM_CP_NULL;
+  MEM_CP_SET_POINTER (tmem_header_p->u.separate.next_block_cp, jsp_mm_blocks_p);
 
   if (jsp_mm_blocks_p != NULL)
   {
-    MEM_CP_SET_POINTER (jsp_mm_blocks_p->prev_block_cp, tmem_header_p);
+    MEM_CP_SET_POINTER (jsp_mm_blocks_p->u.separate.prev_block_cp, tmem_header_p);
   }
 
   jsp_mm_blocks_p = tmem_header_p;
@@ -111,20 +247,34 @@ jsp_mm_alloc (size_t size) /**< size of block to allocate */
 
 /**
  * Free a managed memory block
+ *
+ * Note:
+ *      blocks, placed in arena chunks, are put to lists of free blocks for reuse,
+ *      and the chunks themselves are released upon jsp_mm_free_all
  */
 void
 jsp_mm_free (void *ptr) /**< pointer to data space of allocated block */
 {
   jsp_mm_header_t *tmem_header_p = ((jsp_mm_header_t *) ptr) - 1;
 
+  if (!tmem_header_p->is_separate)
+  {
+    jsp_mm_header_t **free_list_p = &jsp_mm_arena_free_lists[tmem_header_p->u.arena.size / MEM_ALIGNMENT - 1u];
+
+    MEM_CP_SET_POINTER (tmem_header_p->u.arena.next_free_block_cp, *free_list_p);
+    *free_list_p = tmem_header_p;
+
+    return;
+  }
+
   jsp_mm_header_t *prev_block_p = MEM_CP_GET_POINTER (jsp_mm_header_t,
-                                                      tmem_header_p->prev_block_cp);
+                                                      tmem_header_p->u.separate.prev_block_cp);
   jsp_mm_header_t *next_block_p = MEM_CP_GET_POINTER (jsp_mm_header_t,
-                                                      tmem_header_p->next_block_cp);
+                                                      tmem_header_p->u.separate.next_block_cp);
 
   if (prev_block_p != NULL)
   {
-    prev_block_p->next_block_cp = tmem_header_p->next_block_cp;
+    prev_block_p->u.separate.next_block_cp = tmem_header_p->u.separate.next_block_cp;
   }
   else
   {
@@ -134,14 +284,14 @@ jsp_mm_free (void *ptr) /**< pointer to data space of allocated block */
 
   if (next_block_p != NULL)
   {
-    next_block_p->prev_block_cp = tmem_header_p->prev_block_cp;
+    next_block_p->u.separate.prev_block_cp = tmem_header_p->u.separate.prev_block_cp;
   }
 
   mem_heap_free_block (tmem_header_p);
 } /* jsp_mm_free */
 
 /**
- * Free all currently allocated managed memory blocks
+ * Free all currently allocated managed memory blocks and arena chunks
  */
 void
 jsp_mm_free_all (void)
@@ -149,12 +299,27 @@ jsp_mm_free_all (void)
   while (jsp_mm_blocks_p != NULL)
   {
     jsp_mm_header_t *next_block_p = MEM_CP_GET_POINTER (jsp_mm_header_t,
-                                                        jsp_mm_blocks_p->next_block_cp);
+                                                        jsp_mm_blocks_p->u.separate.next_block_cp);
 
     mem_heap_free_block (jsp_mm_blocks_p);
 
     jsp_mm_blocks_p = next_block_p;
   }
+
+  while (jsp_mm_arena_chunks_p != NULL)
+  {
+    jsp_mm_arena_chunk_header_t *next_chunk_p = MEM_CP_GET_POINTER (jsp_mm_arena_chunk_header_t,
+                                                                    jsp_mm_arena_chunks_p->next_chunk_cp);
+
+    mem_heap_free_block (jsp_mm_arena_chunks_p);
+
+    jsp_mm_arena_chunks_p = next_chunk_p;
+  }
+
+  jsp_mm_arena_free_space_p = NULL;
+  jsp_mm_arena_end_p = NULL;
+
+  memset (jsp_mm_arena_free_lists, 0, sizeof (jsp_mm_arena_free_lists));
 } /* jsp_mm_free_all */
 
 /**
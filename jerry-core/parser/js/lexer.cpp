@@ -24,6 +24,10 @@
 static token saved_token, prev_token, sent_token, empty_token;
 
 static bool allow_dump_lines = false, strict_mode;
+
+/* Flag, indicating that literals are not registered for tokens, as the tokens are skipped by the parser
+ * (see also: lexer_set_skip_mode).  */
+static bool skip_mode = false;
 static size_t buffer_size = 0;
 
 /* Represents the contents of a script.  */
@@ -31,6 +35,38 @@ static const jerry_api_char_t *buffer_start = NULL;
 static const jerry_api_char_t *buffer = NULL;
 static const jerry_api_char_t *token_start;
 
+/* Source reader that fills the buffer on demand (NULL - if the whole source is in the buffer,
+ * or end of source was reached).  */
+static jerry_source_reader_callback_t source_reader_p = NULL;
+static void *source_reader_user_p = NULL;
+static size_t buffer_capacity = 0;
+
+/* Flag, indicating that the buffer was allocated by the lexer, instead of the buffer, passed to lexer_init
+ * (see also: grow_buffer).  */
+static bool is_buffer_allocated = false;
+
+/* Position of the buffer's first character in the source, and line and column of the character
+ * (if source reader is specified, the buffer holds a window of the source, see also: discard_scanned_source).  */
+static locus buffer_start_locus = 0;
+static size_t buffer_start_line = 0;
+static size_t buffer_start_column = 0;
+
+/* Position, starting from which the source is retained in the buffer (see also: lexer_pin_source).  */
+static locus pinned_locus = LOCUS_NONE;
+
+/* Part of source, starting from the specified position, that is retained for the parser
+ * (see also: lexer_start_source_capture).  */
+static locus capture_start_locus = LOCUS_NONE;
+static lit_utf8_byte_t *capture_buffer_p = NULL;
+static size_t capture_buffer_size = 0;
+static size_t capture_buffer_capacity = 0;
+
+#ifdef VM_PROFILE
+/* Position and number of the source line, that was most recently resolved by lexer_get_current_line.  */
+static locus line_cache_locus = 0;
+static uint32_t line_cache_line = 1;
+#endif /* VM_PROFILE */
+
 #define LA(I)       (get_char (I))
 
 static bool
@@ -39,23 +75,244 @@ is_empty (token tok)
   return tok.type == TOK_EMPTY;
 }
 
+/**
+ * Get position in the source of the specified character of the buffer
+ *
+ * @return locus
+ */
+static locus
+pointer_to_locus (const jerry_api_char_t *char_p) /**< character in the buffer */
+{
+  JERRY_ASSERT (char_p >= buffer_start && char_p <= buffer_start + buffer_size);
+
+  return buffer_start_locus + (locus) (char_p - buffer_start);
+} /* pointer_to_locus */
+
 static locus
 current_locus (void)
 {
   if (token_start == NULL)
   {
-    return (locus) (buffer - buffer_start);
+    return pointer_to_locus (buffer);
   }
   else
   {
-    return (locus) (token_start - buffer_start);
+    return pointer_to_locus (token_start);
   }
 }
 
+/**
+ * Get position in the source, starting from which the source should be kept in the buffer
+ *
+ * Note:
+ *      the following are retained: the token being scanned and the tokens that were most recently
+ *      returned or saved by the parser (so the parser could seek back to them), and the source,
+ *      pinned with lexer_pin_source
+ *
+ * @return locus
+ */
+static locus
+get_retained_source_locus (void)
+{
+  locus retained_locus = JERRY_MIN (pointer_to_locus (buffer), pinned_locus);
+
+  if (token_start != NULL)
+  {
+    retained_locus = JERRY_MIN (retained_locus, pointer_to_locus (token_start));
+
+    /* opening quote of string literal precedes the token's start */
+    if (retained_locus > buffer_start_locus)
+    {
+      retained_locus--;
+    }
+  }
+
+  retained_locus = JERRY_MIN (retained_locus, sent_token.loc);
+
+  if (!is_empty (saved_token))
+  {
+    retained_locus = JERRY_MIN (retained_locus, saved_token.loc);
+  }
+
+  JERRY_ASSERT (retained_locus >= buffer_start_locus);
+
+  return retained_locus;
+} /* get_retained_source_locus */
+
+/**
+ * Append characters to the captured part of source
+ */
+static void
+capture_source (const jerry_api_char_t *chars_p, /**< characters */
+                size_t chars_num) /**< number of the characters */
+{
+  if (capture_buffer_size + chars_num > capture_buffer_capacity)
+  {
+    size_t new_capacity = JERRY_MAX (capture_buffer_capacity * 2, (size_t) CONFIG_PARSER_SOURCE_READER_CHUNK_SIZE);
+    while (new_capacity < capture_buffer_size + chars_num)
+    {
+      new_capacity *= 2;
+    }
+
+    lit_utf8_byte_t *new_buffer_p = (lit_utf8_byte_t *) jsp_mm_alloc (new_capacity);
+
+    if (capture_buffer_p != NULL)
+    {
+      memcpy (new_buffer_p, capture_buffer_p, capture_buffer_size);
+      jsp_mm_free (capture_buffer_p);
+    }
+
+    capture_buffer_p = new_buffer_p;
+    capture_buffer_capacity = new_capacity;
+  }
+
+  memcpy (capture_buffer_p + capture_buffer_size, chars_p, chars_num);
+  capture_buffer_size += chars_num;
+} /* capture_source */
+
+/**
+ * Discard the part of source, that is not needed anymore, from the beginning of the buffer,
+ * moving the remaining characters to the buffer's beginning
+ *
+ * Note:
+ *      line and column of the discarded characters are accounted, so positions in the source
+ *      are still resolved to lines and columns, and captured part of source is copied
+ *      from the discarded characters (see also: lexer_start_source_capture)
+ */
+static void
+discard_scanned_source (void)
+{
+  JERRY_ASSERT (source_reader_p != NULL);
+
+  const locus retained_locus = get_retained_source_locus ();
+  const size_t discarded_size = retained_locus - buffer_start_locus;
+
+  if (discarded_size == 0)
+  {
+    return;
+  }
+
+  for (size_t i = 0; i < discarded_size; i++)
+  {
+    if (buffer_start[i] == '\n')
+    {
+      buffer_start_line++;
+      buffer_start_column = 0;
+    }
+    else
+    {
+      buffer_start_column++;
+    }
+  }
+
+  if (capture_start_locus < retained_locus)
+  {
+    const locus captured_locus = JERRY_MAX (capture_start_locus, buffer_start_locus);
+
+    capture_source (buffer_start + (captured_locus - buffer_start_locus), retained_locus - captured_locus);
+  }
+
+  memmove ((jerry_api_char_t *) buffer_start, buffer_start + discarded_size, buffer_size - discarded_size);
+
+  buffer_size -= discarded_size;
+  buffer_start_locus = retained_locus;
+
+  buffer -= discarded_size;
+
+  if (token_start != NULL)
+  {
+    token_start -= discarded_size;
+  }
+} /* discard_scanned_source */
+
+/**
+ * Move the buffer's contents to a newly allocated buffer of twice larger capacity
+ *
+ * Note:
+ *      the new buffer is allocated with jsp_mm_alloc, so it is freed together with other parser's allocations
+ */
+static void
+grow_buffer (void)
+{
+  JERRY_ASSERT (buffer_size == buffer_capacity);
+
+  const size_t new_capacity = buffer_capacity * 2;
+  jerry_api_char_t *new_buffer_p = (jerry_api_char_t *) jsp_mm_alloc (new_capacity);
+
+  memcpy (new_buffer_p, buffer_start, buffer_size);
+
+  if (is_buffer_allocated)
+  {
+    jsp_mm_free ((jerry_api_char_t *) buffer_start);
+  }
+
+  buffer = new_buffer_p + (buffer - buffer_start);
+
+  if (token_start != NULL)
+  {
+    token_start = new_buffer_p + (token_start - buffer_start);
+  }
+
+  buffer_start = new_buffer_p;
+  buffer_capacity = new_capacity;
+  is_buffer_allocated = true;
+} /* grow_buffer */
+
+/**
+ * Pull chunks of source from the source reader to the buffer,
+ * until specified number of source characters, starting from current position,
+ * is available in the buffer, or end of source is reached.
+ *
+ * Note:
+ *      if the buffer is full, the part of source, that is not needed anymore, is discarded;
+ *      if the retained part of source takes the whole buffer (i.e. a token or a pinned region
+ *      is larger than the buffer), the buffer is grown.
+ *
+ * @return true - if specified number of characters is available in the buffer,
+ *         false - otherwise (end of source was reached).
+ */
+static bool
+read_source (size_t required_size) /**< required number of characters */
+{
+  while ((size_t) (buffer - buffer_start) + required_size > buffer_size
+         && source_reader_p != NULL)
+  {
+    if (buffer_size == buffer_capacity)
+    {
+      discard_scanned_source ();
+
+      if (buffer_size == buffer_capacity)
+      {
+        grow_buffer ();
+      }
+    }
+
+    const size_t chunk_size = JERRY_MIN (buffer_capacity - buffer_size,
+                                         (size_t) CONFIG_PARSER_SOURCE_READER_CHUNK_SIZE);
+
+    const size_t read_size = source_reader_p ((jerry_api_char_t *) buffer_start + buffer_size,
+                                              chunk_size,
+                                              source_reader_user_p);
+    JERRY_ASSERT (read_size <= chunk_size);
+
+    if (read_size == 0)
+    {
+      source_reader_p = NULL;
+    }
+    else
+    {
+      buffer_size += read_size;
+    }
+  }
+
+  return ((size_t) (buffer - buffer_start) + required_size <= buffer_size);
+} /* read_source */
+
 static ecma_char_t
 get_char (size_t i)
 {
-  if ((buffer + i) >= (buffer_start + buffer_size))
+  if ((buffer + i) >= (buffer_start + buffer_size)
+      && !read_source (i + 1))
   {
     return '\0';
   }
@@ -65,8 +322,6 @@ get_char (size_t i)
 static void
 dump_current_line (void)
 {
-  const lit_utf8_byte_t *i;
-
   if (!allow_dump_lines)
   {
     return;
@@ -74,10 +329,13 @@ dump_current_line (void)
 
   printf ("// ");
 
+  /* the line is dumped as long as it fits into the buffer together with the retained part of source */
+  const size_t max_line_length = buffer_capacity - (pointer_to_locus (buffer) - get_retained_source_locus ());
+
   FIXME ("Unicode: properly process non-ascii characters.");
-  for (i = buffer; *i != '\n' && *i != 0; i++)
+  for (size_t i = 0; i < max_line_length && LA (i) != '\n' && LA (i) != '\0'; i++)
   {
-    putchar (*i);
+    putchar (LA (i));
   }
   putchar ('\n');
 }
@@ -124,6 +382,14 @@ convert_string_to_token (token_type tt, /**< token type */
 {
   JERRY_ASSERT (str_p != NULL);
 
+  if (skip_mode
+      && !(tt == TOK_NAME
+           && (lit_compare_utf8_string_and_magic_string (str_p, length, LIT_MAGIC_STRING_ARGUMENTS)
+               || lit_compare_utf8_string_and_magic_string (str_p, length, LIT_MAGIC_STRING_EVAL))))
+  {
+    return create_token (tt, MEM_CP_NULL);
+  }
+
   literal_t lit = lit_find_literal_by_utf8_string (str_p, length);
   if (lit != NULL)
   {
@@ -138,6 +404,82 @@ convert_string_to_token (token_type tt, /**< token type */
   return create_token_from_lit (tt, lit);
 }
 
+/**
+ * Keyword descriptor
+ */
+typedef struct
+{
+  const char *keyword_p; /**< keyword's characters */
+  keyword keyword_id; /**< keyword's identifier */
+} kw_descr_t;
+
+/**
+ * Keywords, ordered by length
+ */
+static const kw_descr_t keywords[] =
+{
+#define KW_DESCR(literal, keyword_id) { literal, keyword_id }
+  KW_DESCR ("do", KW_DO),
+  KW_DESCR ("if", KW_IF),
+  KW_DESCR ("in", KW_IN),
+  KW_DESCR ("for", KW_FOR),
+  KW_DESCR ("let", KW_LET),
+  KW_DESCR ("new", KW_NEW),
+  KW_DESCR ("try", KW_TRY),
+  KW_DESCR ("var", KW_VAR),
+  KW_DESCR ("case", KW_CASE),
+  KW_DESCR ("else", KW_ELSE),
+  KW_DESCR ("enum", KW_ENUM),
+  KW_DESCR ("this", KW_THIS),
+  KW_DESCR ("void", KW_VOID),
+  KW_DESCR ("with", KW_WITH),
+  KW_DESCR ("break", KW_BREAK),
+  KW_DESCR ("catch", KW_CATCH),
+  KW_DESCR ("class", KW_CLASS),
+  KW_DESCR ("const", KW_CONST),
+  KW_DESCR ("super", KW_SUPER),
+  KW_DESCR ("throw", KW_THROW),
+  KW_DESCR ("while", KW_WHILE),
+  KW_DESCR ("yield", KW_YIELD),
+  KW_DESCR ("delete", KW_DELETE),
+  KW_DESCR ("export", KW_EXPORT),
+  KW_DESCR ("import", KW_IMPORT),
+  KW_DESCR ("public", KW_PUBLIC),
+  KW_DESCR ("return", KW_RETURN),
+  KW_DESCR ("static", KW_STATIC),
+  KW_DESCR ("switch", KW_SWITCH),
+  KW_DESCR ("typeof", KW_TYPEOF),
+  KW_DESCR ("default", KW_DEFAULT),
+  KW_DESCR ("extends", KW_EXTENDS),
+  KW_DESCR ("finally", KW_FINALLY),
+  KW_DESCR ("package", KW_PACKAGE),
+  KW_DESCR ("private", KW_PRIVATE),
+  KW_DESCR ("continue", KW_CONTINUE),
+  KW_DESCR ("debugger", KW_DEBUGGER),
+  KW_DESCR ("function", KW_FUNCTION),
+  KW_DESCR ("interface", KW_INTERFACE),
+  KW_DESCR ("protected", KW_PROTECTED),
+  KW_DESCR ("implements", KW_IMPLEMENTS),
+  KW_DESCR ("instanceof", KW_INSTANCEOF)
+#undef KW_DESCR
+};
+
+/**
+ * Maximum length of a keyword
+ */
+#define KEYWORD_MAX_LENGTH (10)
+
+/**
+ * Index in the keywords array of first keyword of each length
+ *
+ * Keywords of length L are keywords[keywords_first_index_by_length[L]] ...
+ * keywords[keywords_first_index_by_length[L + 1] - 1].
+ */
+static const uint8_t keywords_first_index_by_length[KEYWORD_MAX_LENGTH + 2] =
+{
+  0, 0, 0, 3, 8, 14, 22, 30, 35, 38, 40, 42
+};
+
 /**
  * Try to decode specified string as keyword
  *
@@ -150,71 +492,20 @@ static token
 decode_keyword (const lit_utf8_byte_t *str_p, /**< characters buffer */
                 lit_utf8_size_t str_size) /**< string's length */
 {
-  typedef struct
-  {
-    const char *keyword_p;
-    keyword keyword_id;
-  } kw_descr_t;
-
-  const kw_descr_t keywords[] =
-  {
-#define KW_DESCR(literal, keyword_id) { literal, keyword_id }
-    KW_DESCR ("break", KW_BREAK),
-    KW_DESCR ("case", KW_CASE),
-    KW_DESCR ("catch", KW_CATCH),
-    KW_DESCR ("class", KW_CLASS),
-    KW_DESCR ("const", KW_CONST),
-    KW_DESCR ("continue", KW_CONTINUE),
-    KW_DESCR ("debugger", KW_DEBUGGER),
-    KW_DESCR ("default", KW_DEFAULT),
-    KW_DESCR ("delete", KW_DELETE),
-    KW_DESCR ("do", KW_DO),
-    KW_DESCR ("else", KW_ELSE),
-    KW_DESCR ("enum", KW_ENUM),
-    KW_DESCR ("export", KW_EXPORT),
-    KW_DESCR ("extends", KW_EXTENDS),
-    KW_DESCR ("finally", KW_FINALLY),
-    KW_DESCR ("for", KW_FOR),
-    KW_DESCR ("function", KW_FUNCTION),
-    KW_DESCR ("if", KW_IF),
-    KW_DESCR ("in", KW_IN),
-    KW_DESCR ("instanceof", KW_INSTANCEOF),
-    KW_DESCR ("interface", KW_INTERFACE),
-    KW_DESCR ("import", KW_IMPORT),
-    KW_DESCR ("implements", KW_IMPLEMENTS),
-    KW_DESCR ("let", KW_LET),
-    KW_DESCR ("new", KW_NEW),
-    KW_DESCR ("package", KW_PACKAGE),
-    KW_DESCR ("private", KW_PRIVATE),
-    KW_DESCR ("protected", KW_PROTECTED),
-    KW_DESCR ("public", KW_PUBLIC),
-    KW_DESCR ("return", KW_RETURN),
-    KW_DESCR ("static", KW_STATIC),
-    KW_DESCR ("super", KW_SUPER),
-    KW_DESCR ("switch", KW_SWITCH),
-    KW_DESCR ("this", KW_THIS),
-    KW_DESCR ("throw", KW_THROW),
-    KW_DESCR ("try", KW_TRY),
-    KW_DESCR ("typeof", KW_TYPEOF),
-    KW_DESCR ("var", KW_VAR),
-    KW_DESCR ("void", KW_VOID),
-    KW_DESCR ("while", KW_WHILE),
-    KW_DESCR ("with", KW_WITH),
-    KW_DESCR ("yield", KW_YIELD)
-#undef KW_DESCR
-  };
-
   keyword kw = KW_NONE;
 
-  for (uint32_t i = 0; i < sizeof (keywords) / sizeof (kw_descr_t); i++)
+  if (str_size <= KEYWORD_MAX_LENGTH)
   {
-    if (lit_compare_utf8_strings (str_p,
-                                  str_size,
-                                  (lit_utf8_byte_t *) keywords[i].keyword_p,
-                                  (lit_utf8_size_t) strlen (keywords[i].keyword_p)))
+    for (uint32_t i = keywords_first_index_by_length[str_size];
+         i < keywords_first_index_by_length[str_size + 1];
+         i++)
     {
-      kw = keywords[i].keyword_id;
-      break;
+      if (keywords[i].keyword_p[0] == (char) str_p[0]
+          && memcmp (str_p, keywords[i].keyword_p, str_size) == 0)
+      {
+        kw = keywords[i].keyword_id;
+        break;
+      }
     }
   }
 
@@ -270,6 +561,11 @@ decode_keyword (const lit_utf8_byte_t *str_p, /**< characters buffer */
 static token
 convert_seen_num_to_token (ecma_number_t num)
 {
+  if (skip_mode)
+  {
+    return create_token (TOK_NUMBER, MEM_CP_NULL);
+  }
+
   literal_t lit = lit_find_literal_by_num (num);
   if (lit != NULL)
   {
@@ -584,7 +880,7 @@ convert_string_to_token_transform_escape_seq (token_type tok_type, /**< type of
       }
       else if (!every_char_allowed_in_identifier)
       {
-        PARSE_ERROR ("Malformed identifier name", source_str_p - buffer_start);
+        PARSE_ERROR ("Malformed identifier name", pointer_to_locus (source_str_p));
       }
     }
 
@@ -595,7 +891,7 @@ convert_string_to_token_transform_escape_seq (token_type tok_type, /**< type of
   }
   else
   {
-    PARSE_ERROR ("Malformed escape sequence", source_str_p - buffer_start);
+    PARSE_ERROR ("Malformed escape sequence", pointer_to_locus (source_str_p));
   }
 
   jsp_mm_free (str_buf_p);
@@ -656,7 +952,7 @@ parse_name (void)
 
         if (!is_correct_sequence)
         {
-          PARSE_ERROR ("Malformed escape sequence", token_start - buffer_start);
+          PARSE_ERROR ("Malformed escape sequence", pointer_to_locus (token_start));
         }
       }
     }
@@ -720,7 +1016,7 @@ parse_number (void)
 
     if (isalpha (c) || c == '_' || c == '$')
     {
-      PARSE_ERROR ("Integer literal shall not contain non-digit characters", buffer - buffer_start);
+      PARSE_ERROR ("Integer literal shall not contain non-digit characters", pointer_to_locus (buffer));
     }
 
     tok_length = (size_t) (buffer - token_start);
@@ -774,12 +1070,12 @@ parse_number (void)
     if (is_fp && c == '.')
     {
       FIXME (/* This is wrong: 1..toString ().  */)
-      PARSE_ERROR ("Integer literal shall not contain more than one dot character", buffer - buffer_start);
+      PARSE_ERROR ("Integer literal shall not contain more than one dot character", pointer_to_locus (buffer));
     }
     if (is_exp && (c == 'e' || c == 'E'))
     {
       PARSE_ERROR ("Integer literal shall not contain more than exponential marker ('e' or 'E')",
-                   buffer - buffer_start);
+                   pointer_to_locus (buffer));
     }
 
     if (c == '.')
@@ -787,7 +1083,7 @@ parse_number (void)
       if (isalpha (LA (1)) || LA (1) == '_' || LA (1) == '$')
       {
         PARSE_ERROR ("Integer literal shall not contain non-digit character after got character",
-                     buffer - buffer_start);
+                     pointer_to_locus (buffer));
       }
       is_fp = true;
       consume_char ();
@@ -803,7 +1099,7 @@ parse_number (void)
       if (!isdigit (LA (1)))
       {
         PARSE_ERROR ("Integer literal shall not contain non-digit character after exponential marker ('e' or 'E')",
-                     buffer - buffer_start);
+                     pointer_to_locus (buffer));
       }
       is_exp = true;
       consume_char ();
@@ -812,7 +1108,7 @@ parse_number (void)
 
     if (isalpha (c) || c == '_' || c == '$')
     {
-      PARSE_ERROR ("Integer literal shall not contain non-digit characters", buffer - buffer_start);
+      PARSE_ERROR ("Integer literal shall not contain non-digit characters", pointer_to_locus (buffer));
     }
 
     if (!isdigit (c))
@@ -837,7 +1133,7 @@ parse_number (void)
   {
     if (strict_mode)
     {
-      PARSE_ERROR ("Octal tnteger literals are not allowed in strict mode", token_start - buffer_start);
+      PARSE_ERROR ("Octal tnteger literals are not allowed in strict mode", pointer_to_locus (token_start));
     }
     for (i = 0; i < tok_length; i++)
     {
@@ -914,11 +1210,11 @@ parse_string (void)
 
     if (c == '\0')
     {
-      PARSE_ERROR ("Unclosed string", token_start - buffer_start);
+      PARSE_ERROR ("Unclosed string", pointer_to_locus (token_start));
     }
     else if (ecma_char_is_line_terminator (c))
     {
-      PARSE_ERROR ("String literal shall not contain newline character", token_start - buffer_start);
+      PARSE_ERROR ("String literal shall not contain newline character", pointer_to_locus (token_start));
     }
     else if (c == '\\')
     {
@@ -975,11 +1271,11 @@ parse_regexp (void)
 
     if (c == '\0')
     {
-      PARSE_ERROR ("Unclosed string", token_start - buffer_start);
+      PARSE_ERROR ("Unclosed string", pointer_to_locus (token_start));
     }
     else if (c == '\n')
     {
-      PARSE_ERROR ("RegExp literal shall not contain newline character", token_start - buffer_start);
+      PARSE_ERROR ("RegExp literal shall not contain newline character", pointer_to_locus (token_start));
     }
     else if (c == '\\')
     {
@@ -1037,13 +1333,6 @@ grobble_whitespaces (void)
   }
 }
 
-static void
-lexer_set_source (const jerry_api_char_t * source)
-{
-  buffer_start = source;
-  buffer = buffer_start;
-}
-
 static bool
 replace_comment_by_newline (void)
 {
@@ -1086,7 +1375,7 @@ replace_comment_by_newline (void)
     }
     if (multiline && c == '\0')
     {
-      PARSE_ERROR ("Unclosed multiline comment", buffer - buffer_start);
+      PARSE_ERROR ("Unclosed multiline comment", pointer_to_locus (buffer));
     }
     consume_char ();
   }
@@ -1135,12 +1424,7 @@ lexer_next_token_private (void)
   {
     if (replace_comment_by_newline ())
     {
-      token ret;
-
-      ret.type = TOK_NEWLINE;
-      ret.uid = 0;
-
-      return ret;
+      return create_token (TOK_NEWLINE, 0);
     }
     else
     {
@@ -1249,15 +1533,15 @@ lexer_next_token_private (void)
       }
       break;
     }
-    default: PARSE_SORRY ("Unknown character", buffer - buffer_start);
+    default: PARSE_SORRY ("Unknown character", pointer_to_locus (buffer));
   }
-  PARSE_SORRY ("Unknown character", buffer - buffer_start);
+  PARSE_SORRY ("Unknown character", pointer_to_locus (buffer));
 }
 
 token
 lexer_next_token (void)
 {
-  if (buffer == buffer_start)
+  if (pointer_to_locus (buffer) == 0)
   {
     dump_current_line ();
   }
@@ -1279,7 +1563,7 @@ lexer_next_token (void)
   if (prev_token.type == TOK_EOF
       && sent_token.type == TOK_EOF)
   {
-    PARSE_ERROR ("Unexpected EOF", buffer - buffer_start);
+    PARSE_ERROR ("Unexpected EOF", pointer_to_locus (buffer));
   }
 
   prev_token = sent_token;
@@ -1307,23 +1591,138 @@ lexer_prev_token (void)
   return prev_token;
 }
 
+/**
+ * Set position of the lexer in the source
+ *
+ * Note:
+ *      if source reader is specified, only positions, that are still retained in the buffer,
+ *      can be set (see also: get_retained_source_locus, lexer_pin_source)
+ */
 void
-lexer_seek (size_t locus)
+lexer_seek (locus loc) /**< position in the source */
 {
-  JERRY_ASSERT (locus < buffer_size);
+  JERRY_ASSERT (loc >= buffer_start_locus && loc < buffer_start_locus + buffer_size);
   JERRY_ASSERT (token_start == NULL);
 
-  buffer = buffer_start + locus;
+  buffer = buffer_start + (loc - buffer_start_locus);
   saved_token = empty_token;
-}
+} /* lexer_seek */
 
+/**
+ * Retain the source, starting from the specified position, in the source buffer,
+ * until lexer_unpin_source is called, so that the lexer could be seeked back to the position
+ *
+ * @return position, that was pinned before the call
+ */
+locus
+lexer_pin_source (locus loc) /**< position in the source */
+{
+  JERRY_ASSERT (loc >= buffer_start_locus);
+
+  const locus prev_pinned_locus = pinned_locus;
+  pinned_locus = JERRY_MIN (pinned_locus, loc);
+
+  return prev_pinned_locus;
+} /* lexer_pin_source */
+
+/**
+ * Release the source, pinned with corresponding lexer_pin_source
+ */
 void
-lexer_locus_to_line_and_column (size_t locus, size_t *line, size_t *column)
+lexer_unpin_source (locus prev_pinned_locus) /**< value, returned by lexer_pin_source */
 {
-  JERRY_ASSERT (locus <= buffer_size);
+  JERRY_ASSERT (prev_pinned_locus >= pinned_locus);
+
+  pinned_locus = prev_pinned_locus;
+} /* lexer_unpin_source */
+
+/**
+ * Start capture of the source, starting from the specified position
+ *
+ * Note:
+ *      the captured part of source is copied from the buffer before the characters are discarded,
+ *      so the part can be larger than the buffer (see also: lexer_get_captured_source)
+ */
+void
+lexer_start_source_capture (locus loc) /**< position in the source */
+{
+  JERRY_ASSERT (capture_start_locus == LOCUS_NONE);
+  JERRY_ASSERT (capture_buffer_p == NULL);
+  JERRY_ASSERT (loc >= buffer_start_locus);
+
+  capture_start_locus = loc;
+} /* lexer_start_source_capture */
+
+/**
+ * Get the captured part of source, from the position, specified upon lexer_start_source_capture,
+ * till the specified position
+ *
+ * Note:
+ *      the returned pointer is valid until lexer_stop_source_capture is called
+ *
+ * @return pointer to the captured characters
+ */
+const lit_utf8_byte_t *
+lexer_get_captured_source (locus end_loc, /**< position, following the part of source */
+                           size_t *out_size_p) /**< out: size of the part */
+{
+  JERRY_ASSERT (capture_start_locus != LOCUS_NONE);
+  JERRY_ASSERT (end_loc >= capture_start_locus && end_loc <= buffer_start_locus + buffer_size);
+
+  *out_size_p = end_loc - capture_start_locus;
+
+  if (capture_buffer_p == NULL)
+  {
+    /* nothing was discarded since the capture was started */
+    JERRY_ASSERT (capture_start_locus >= buffer_start_locus);
+
+    return buffer_start + (capture_start_locus - buffer_start_locus);
+  }
+
+  JERRY_ASSERT (capture_start_locus + capture_buffer_size == buffer_start_locus);
+
+  capture_source (buffer_start, end_loc - buffer_start_locus);
+
+  return capture_buffer_p;
+} /* lexer_get_captured_source */
+
+/**
+ * Stop capture of the source, started with lexer_start_source_capture
+ */
+void
+lexer_stop_source_capture (void)
+{
+  JERRY_ASSERT (capture_start_locus != LOCUS_NONE);
+
+  if (capture_buffer_p != NULL)
+  {
+    jsp_mm_free (capture_buffer_p);
+
+    capture_buffer_p = NULL;
+    capture_buffer_size = 0;
+    capture_buffer_capacity = 0;
+  }
+
+  capture_start_locus = LOCUS_NONE;
+} /* lexer_stop_source_capture */
+
+/**
+ * Get line and column of the specified position in the source
+ *
+ * Note:
+ *      if the position was already discarded from the source buffer,
+ *      the earliest position, that is still retained, is resolved instead
+ *      (see also: discard_scanned_source)
+ */
+void
+lexer_locus_to_line_and_column (locus loc, /**< position in the source */
+                                size_t *line, /**< out: line number (lines are numbered starting from 0) */
+                                size_t *column) /**< out: column number (columns are numbered starting from 0) */
+{
+  JERRY_ASSERT (loc <= buffer_start_locus + buffer_size);
   const jerry_api_char_t *buf;
-  size_t l = 0, c = 0;
-  for (buf = buffer_start; (size_t) (buf - buffer_start) < locus; buf++)
+  size_t l = buffer_start_line, c = buffer_start_column;
+  for (buf = buffer_start; pointer_to_locus (buf) < loc; buf++)
   {
     if (*buf == '\n')
     {
@@ -1342,17 +1741,64 @@ lexer_locus_to_line_and_column (size_t locus, size_t *line, size_t *column)
   {
     *column = c;
   }
-}
+} /* lexer_locus_to_line_and_column */
+
+#ifdef VM_PROFILE
+/**
+ * Get number of the source line, containing the token that was most recently returned by lexer_next_token
+ *
+ * Note:
+ *      the parser mostly moves forward through the source, so newlines are counted
+ *      starting from the previously resolved position, unless the parser seeked back,
+ *      or the position was discarded from the source buffer
+ *
+ * @return line number (lines are numbered starting from 1)
+ */
+uint32_t
+lexer_get_current_line (void)
+{
+  const locus loc = sent_token.loc;
+  JERRY_ASSERT (loc >= buffer_start_locus && loc <= buffer_start_locus + buffer_size);
+
+  if (loc < line_cache_locus
+      || line_cache_locus < buffer_start_locus)
+  {
+    line_cache_locus = buffer_start_locus;
+    line_cache_line = (uint32_t) (buffer_start_line + 1);
+  }
 
+  for (const jerry_api_char_t *buf = buffer_start + (line_cache_locus - buffer_start_locus);
+       pointer_to_locus (buf) < loc;
+       buf++)
+  {
+    if (*buf == '\n')
+    {
+      line_cache_line++;
+    }
+  }
+
+  line_cache_locus = loc;
+
+  return line_cache_line;
+} /* lexer_get_current_line */
+#endif /* VM_PROFILE */
+
+/**
+ * Print the specified line of the source
+ *
+ * Note:
+ *      only the part of line, that is retained in the source buffer, is printed
+ */
 void
-lexer_dump_line (size_t line)
+lexer_dump_line (size_t line) /**< line number (lines are numbered starting from 0) */
 {
-  size_t l = 0;
-  for (const lit_utf8_byte_t *buf = buffer_start; *buf != '\0'; buf++)
+  size_t l = buffer_start_line;
+  const lit_utf8_byte_t *buffer_end_p = buffer_start + buffer_size;
+  for (const lit_utf8_byte_t *buf = buffer_start; buf < buffer_end_p && *buf != '\0'; buf++)
   {
     if (l == line)
     {
-      for (; *buf != '\n' && *buf != '\0'; buf++)
+      for (; buf < buffer_end_p && *buf != '\n' && *buf != '\0'; buf++)
       {
         putchar (*buf);
       }
@@ -1363,7 +1809,7 @@ lexer_dump_line (size_t line)
       l++;
     }
   }
-}
+} /* lexer_dump_line */
 
 const char *
 lexer_keyword_to_string (keyword kw)
@@ -1507,6 +1953,20 @@ lexer_set_strict_mode (bool is_strict)
   strict_mode = is_strict;
 }
 
+/**
+ * Enable or disable skip mode of the lexer
+ *
+ * Note:
+ *      in the skip mode, literals are not looked up or created for identifiers, string, number
+ *      and regular expression tokens, so the tokens' uids are invalid, except for 'arguments'
+ *      and 'eval' identifiers, which are still registered, so that their references are detected
+ */
+void
+lexer_set_skip_mode (bool is_skip_mode) /**< new value of the flag */
+{
+  skip_mode = is_skip_mode;
+} /* lexer_set_skip_mode */
+
 /**
  * Check whether the identifier tokens represent the same identifiers
  *
@@ -1531,8 +1991,13 @@ lexer_are_tokens_with_same_identifier (token id1, /**< identifier token (TOK_NAM
  * Initialize lexer to start parsing of a new source
  */
 void
-lexer_init (const jerry_api_char_t *source, /**< script source */
-            size_t source_size, /**< script source size in bytes */
+lexer_init (const jerry_api_char_t *source, /**< script source (or buffer for script source,
+                                             *   if source reader is specified) */
+            size_t source_size, /**< script source size in bytes (or size of the buffer,
+                                 *   if source reader is specified) */
+            jerry_source_reader_callback_t reader_p, /**< source reader, filling the buffer on demand
+                                                      *   (or NULL - if the whole source is in the buffer) */
+            void *reader_user_p, /**< user data for the source reader */
             bool show_opcodes) /**< flag indicating if to dump opcodes */
 {
   empty_token.type = TOK_EMPTY;
@@ -1541,11 +2006,47 @@ lexer_init (const jerry_api_char_t *source, /**< script source */
 
   saved_token = prev_token = sent_token = empty_token;
 
-  buffer_size = source_size;
-  lexer_set_source (source);
+  source_reader_p = reader_p;
+  source_reader_user_p = reader_user_p;
+
+  buffer_size = (reader_p == NULL) ? source_size : 0;
+  buffer_capacity = source_size;
+
+  buffer_start = source;
+  buffer = buffer_start;
+  token_start = NULL;
+  is_buffer_allocated = false;
+
+  buffer_start_locus = 0;
+  buffer_start_line = 0;
+  buffer_start_column = 0;
+
+  pinned_locus = LOCUS_NONE;
+
+  capture_start_locus = LOCUS_NONE;
+  capture_buffer_p = NULL;
+  capture_buffer_size = 0;
+  capture_buffer_capacity = 0;
+
   lexer_set_strict_mode (false);
+  lexer_set_skip_mode (false);
+
+#ifdef VM_PROFILE
+  line_cache_locus = 0;
+  line_cache_line = 1;
+#endif /* VM_PROFILE */
 
 #ifndef JERRY_NDEBUG
+  JERRY_ASSERT (sizeof (keywords) / sizeof (keywords[0]) == keywords_first_index_by_length[KEYWORD_MAX_LENGTH + 1]);
+
+  for (uint32_t length = 0; length <= KEYWORD_MAX_LENGTH; length++)
+  {
+    for (uint32_t i = keywords_first_index_by_length[length]; i < keywords_first_index_by_length[length + 1]; i++)
+    {
+      JERRY_ASSERT (strlen (keywords[i].keyword_p) == length);
+    }
+  }
+
   allow_dump_lines = show_opcodes;
 #else /* JERRY_NDEBUG */
   (void) show_opcodes;
@@ -157,12 +157,17 @@ typedef enum __attr_packed___
 
 typedef size_t locus;
 
+/**
+ * Value of locus, that doesn't correspond to any position in a source
+ */
+#define LOCUS_NONE (~((locus) 0))
+
 /* Represents the contents of a token.  */
 typedef struct
 {
   locus loc;
   token_type type;
-  uint16_t uid;
+  mem_cpointer_t uid;
 } token;
 
 /**
@@ -170,19 +175,28 @@ typedef struct
  */
 #define TOKEN_EMPTY_INITIALIZER {0, TOK_EMPTY, 0}
 
-void lexer_init (const jerry_api_char_t *, size_t, bool);
+void lexer_init (const jerry_api_char_t *, size_t, jerry_source_reader_callback_t, void *, bool);
 
 token lexer_next_token (void);
 void lexer_save_token (token);
 token lexer_prev_token (void);
 
 void lexer_seek (locus);
+locus lexer_pin_source (locus);
+void lexer_unpin_source (locus);
+void lexer_start_source_capture (locus);
+const lit_utf8_byte_t *lexer_get_captured_source (locus, size_t *);
+void lexer_stop_source_capture (void);
 void lexer_locus_to_line_and_column (locus, size_t *, size_t *);
 void lexer_dump_line (size_t);
+#ifdef VM_PROFILE
+uint32_t lexer_get_current_line (void);
+#endif /* VM_PROFILE */
 const char *lexer_keyword_to_string (keyword);
 const char *lexer_token_type_to_string (token_type);
 
 void lexer_set_strict_mode (bool);
+void lexer_set_skip_mode (bool);
 
 extern bool lexer_are_tokens_with_same_identifier (token id1, token id2);
 
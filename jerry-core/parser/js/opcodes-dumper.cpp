@@ -15,6 +15,7 @@
 
 #include "opcodes-dumper.h"
 
+#include "jsp-mm.h"
 #include "serializer.h"
 #include "stack.h"
 #include "syntax-errors.h"
@@ -26,9 +27,9 @@ static idx_t temp_name, max_temp_name;
 
 enum
 {
-  U8_global_size
+  logical_checks_starts_global_size
 };
-STATIC_STACK (U8, uint8_t)
+STATIC_STACK (logical_checks_starts, size_t)
 
 enum
 {
@@ -84,6 +85,18 @@ enum
 };
 STATIC_STACK (case_clauses, opcode_counter_t)
 
+enum
+{
+  switch_statements_global_size
+};
+STATIC_STACK (switch_statements, size_t)
+
+enum
+{
+  stashed_op_metas_global_size
+};
+STATIC_STACK (stashed_op_metas, op_meta)
+
 enum
 {
   tries_global_size
@@ -132,6 +145,12 @@ reset_temp_name (void)
 static idx_t
 next_temp_name (void)
 {
+  if (temp_name == OPCODE_REG_GENERAL_COMPACT_LAST + 1)
+  {
+    /* identifiers, reserved for parser's markers, are skipped */
+    temp_name = OPCODE_REG_GENERAL_WIDE_FIRST;
+  }
+
   idx_t next_reg = temp_name++;
 
   if (next_reg > OPCODE_REG_GENERAL_LAST)
@@ -402,14 +421,42 @@ create_op_meta_for_vlt (varg_list_type vlt, operand *res, operand *obj)
   return ret;
 }
 
+/**
+ * Encode opcode counter into a pair of instruction arguments
+ *
+ * See also:
+ *          OPCODE_COUNTER_LONG_IDX_FIRST
+ */
 static void
 split_opcode_counter (opcode_counter_t oc, idx_t *id1, idx_t *id2)
 {
   JERRY_ASSERT (id1 != NULL);
   JERRY_ASSERT (id2 != NULL);
-  *id1 = (idx_t) (oc >> JERRY_BITSINBYTE);
-  *id2 = (idx_t) (oc & ((1 << JERRY_BITSINBYTE) - 1));
-  JERRY_ASSERT (oc == calc_opcode_counter_from_idx_idx (*id1, *id2));
+
+  uint32_t encoded_oc;
+
+  if (oc < OPCODE_COUNTER_MAX_SHORT_VALUE)
+  {
+    encoded_oc = oc;
+  }
+  else if (oc == MAX_OPCODES)
+  {
+    encoded_oc = (1u << (2 * JERRY_BITSINBYTE)) - 1u;
+  }
+  else
+  {
+    const size_t index = serializer_register_long_opcode_counter (oc);
+    if (index >= OPCODE_COUNTER_MAX_LONG_COUNTERS_NUMBER)
+    {
+      PARSE_ERROR ("Too many long jumps", 0);
+    }
+
+    encoded_oc = (uint32_t) (OPCODE_COUNTER_MAX_SHORT_VALUE + index);
+  }
+
+  *id1 = (idx_t) (encoded_oc >> JERRY_BITSINBYTE);
+  *id2 = (idx_t) (encoded_oc & ((1 << JERRY_BITSINBYTE) - 1));
+  JERRY_ASSERT (oc == calc_opcode_counter_from_idx_idx (NULL, *id1, *id2));
 }
 
 static op_meta
@@ -809,6 +856,74 @@ dumper_is_eval_literal (operand obj) /**< byte-code operand */
   return is_eval_lit;
 } /* dumper_is_eval_literal */
 
+/**
+ * Check whether byte-code operand can be a reference, i.e. a target of an assignment or of increment / decrement
+ *
+ * Note:
+ *      the operand should be result of the last dumped instruction sequence
+ *
+ * @return false - if the operand is a temporary, that holds value of a literal or of 'this',
+ *                 or result of an operator (except for the member access, call and 'new' operators),
+ *         true - otherwise.
+ */
+bool
+dumper_is_possible_reference (operand obj) /**< byte-code operand */
+{
+  if (obj.type != OPERAND_TMP
+      || serializer_get_current_opcode_counter () == 0)
+  {
+    return true;
+  }
+
+  const op_meta last = last_dumped_op_meta ();
+
+  switch (last.op.op_idx)
+  {
+    case OPCODE (assignment):
+    case OPCODE (this_binding):
+    case OPCODE (delete_var):
+    case OPCODE (delete_prop):
+    case OPCODE (typeof):
+    case OPCODE (logical_not):
+    case OPCODE (b_and):
+    case OPCODE (b_or):
+    case OPCODE (b_xor):
+    case OPCODE (b_not):
+    case OPCODE (b_shift_left):
+    case OPCODE (b_shift_right):
+    case OPCODE (b_shift_uright):
+    case OPCODE (equal_value):
+    case OPCODE (not_equal_value):
+    case OPCODE (equal_value_type):
+    case OPCODE (not_equal_value_type):
+    case OPCODE (less_than):
+    case OPCODE (greater_than):
+    case OPCODE (less_or_equal_than):
+    case OPCODE (greater_or_equal_than):
+    case OPCODE (instanceof):
+    case OPCODE (in):
+    case OPCODE (post_incr):
+    case OPCODE (post_decr):
+    case OPCODE (pre_incr):
+    case OPCODE (pre_decr):
+    case OPCODE (addition):
+    case OPCODE (substraction):
+    case OPCODE (division):
+    case OPCODE (multiplication):
+    case OPCODE (remainder):
+    case OPCODE (unary_minus):
+    case OPCODE (unary_plus):
+    {
+      /* all the instructions put their result to the first argument */
+      return (last.op.data.assignment.var_left != obj.data.uid);
+    }
+    default:
+    {
+      return true;
+    }
+  }
+} /* dumper_is_possible_reference */
+
 void
 dump_boolean_assignment (operand op, bool is_true)
 {
@@ -1109,7 +1224,7 @@ dump_varg_header_for_rewrite (varg_list_type vlt, operand obj)
 }
 
 operand
-rewrite_varg_header_set_args_count (uint8_t args_count)
+rewrite_varg_header_set_args_count (idx_t args_count)
 {
   op_meta om = serializer_get_op_meta (STACK_TOP (varg_headers));
   switch (om.op.op_idx)
@@ -1305,21 +1420,10 @@ dump_function_end_for_rewrite (void)
 }
 
 void
-rewrite_function_end (varg_list_type vlt)
+rewrite_function_end (void)
 {
-  opcode_counter_t oc;
-  if (vlt == VARG_FUNC_DECL)
-  {
-    oc = (opcode_counter_t) (get_diff_from (STACK_TOP (function_ends))
-                                            + serializer_count_opcodes_in_subscopes ());
-  }
-  else
-  {
-    JERRY_ASSERT (vlt == VARG_FUNC_EXPR);
-    oc = (opcode_counter_t) (get_diff_from (STACK_TOP (function_ends)));
-  }
   idx_t id1, id2;
-  split_opcode_counter (oc, &id1, &id2);
+  split_opcode_counter (get_diff_from (STACK_TOP (function_ends)), &id1, &id2);
   const opcode_t opcode = getop_meta (OPCODE_META_TYPE_FUNCTION_END, id1, id2);
   serializer_rewrite_op_meta (STACK_TOP (function_ends), create_op_meta_000 (opcode));
   STACK_DROP (function_ends, 1);
@@ -1935,7 +2039,7 @@ dump_bitwise_or_res (operand lhs, operand rhs)
 void
 start_dumping_logical_and_checks (void)
 {
-  STACK_PUSH (U8, (uint8_t) STACK_SIZE (logical_and_checks));
+  STACK_PUSH (logical_checks_starts, STACK_SIZE (logical_and_checks));
 }
 
 void
@@ -1962,7 +2066,7 @@ dump_logical_and_check_for_rewrite (operand op)
 void
 rewrite_logical_and_checks (void)
 {
-  for (uint8_t i = STACK_TOP (U8); i < STACK_SIZE (logical_and_checks); i++)
+  for (size_t i = STACK_TOP (logical_checks_starts); i < STACK_SIZE (logical_and_checks); i++)
   {
     op_meta jmp_op_meta = serializer_get_op_meta (STACK_ELEMENT (logical_and_checks, i));
     JERRY_ASSERT (jmp_op_meta.op.op_idx == OPCODE (is_false_jmp_down));
@@ -1972,14 +2076,14 @@ rewrite_logical_and_checks (void)
     jmp_op_meta.op.data.is_false_jmp_down.opcode_2 = id2;
     serializer_rewrite_op_meta (STACK_ELEMENT (logical_and_checks, i), jmp_op_meta);
   }
-  STACK_DROP (logical_and_checks, STACK_SIZE (logical_and_checks) - STACK_TOP (U8));
-  STACK_DROP (U8, 1);
+  STACK_DROP (logical_and_checks, STACK_SIZE (logical_and_checks) - STACK_TOP (logical_checks_starts));
+  STACK_DROP (logical_checks_starts, 1);
 }
 
 void
 start_dumping_logical_or_checks (void)
 {
-  STACK_PUSH (U8, (uint8_t) STACK_SIZE (logical_or_checks));
+  STACK_PUSH (logical_checks_starts, STACK_SIZE (logical_or_checks));
 }
 
 void
@@ -2006,7 +2110,7 @@ dump_logical_or_check_for_rewrite (operand op)
 void
 rewrite_logical_or_checks (void)
 {
-  for (uint8_t i = STACK_TOP (U8); i < STACK_SIZE (logical_or_checks); i++)
+  for (size_t i = STACK_TOP (logical_checks_starts); i < STACK_SIZE (logical_or_checks); i++)
   {
     op_meta jmp_op_meta = serializer_get_op_meta (STACK_ELEMENT (logical_or_checks, i));
     JERRY_ASSERT (jmp_op_meta.op.op_idx == OPCODE (is_true_jmp_down));
@@ -2016,8 +2120,8 @@ rewrite_logical_or_checks (void)
     jmp_op_meta.op.data.is_true_jmp_down.opcode_2 = id2;
     serializer_rewrite_op_meta (STACK_ELEMENT (logical_or_checks, i), jmp_op_meta);
   }
-  STACK_DROP (logical_or_checks, STACK_SIZE (logical_or_checks) - STACK_TOP (U8));
-  STACK_DROP (U8, 1);
+  STACK_DROP (logical_or_checks, STACK_SIZE (logical_or_checks) - STACK_TOP (logical_checks_starts));
+  STACK_DROP (logical_checks_starts, 1);
 }
 
 void
@@ -2283,68 +2387,224 @@ rewrite_simple_or_nested_jump_and_get_next (opcode_counter_t jump_oc, /**< posit
 
   serializer_rewrite_op_meta (jump_oc, jump_op_meta);
 
-  return calc_opcode_counter_from_idx_idx (id1_prev, id2_prev);
+  return calc_opcode_counter_from_idx_idx (NULL, id1_prev, id2_prev);
 } /* rewrite_simple_or_nested_jump_get_next */
 
+/**
+ * Move instructions of current scope, starting from the specified position, to stash,
+ * so that the instructions could be dumped later at another position
+ *
+ * Note:
+ *      jumps of the instructions should not lead outside of the moved block
+ *
+ * See also:
+ *          dump_stashed_instructions
+ *
+ * @return number of the stashed instructions
+ */
+opcode_counter_t
+dumper_stash_instructions (opcode_counter_t first_oc) /**< position of first instruction to stash */
+{
+  const opcode_counter_t current_oc = serializer_get_current_opcode_counter ();
+  JERRY_ASSERT (first_oc <= current_oc);
+
+  for (opcode_counter_t oc = first_oc; oc < current_oc; oc++)
+  {
+    STACK_PUSH (stashed_op_metas, serializer_get_op_meta (oc));
+  }
+
+  serializer_set_writing_position (first_oc);
+
+  return (opcode_counter_t) (current_oc - first_oc);
+} /* dumper_stash_instructions */
+
+/**
+ * Dump instructions, that are located in the stash starting from the specified index, at current position
+ */
+static void
+dump_stashed_instructions_from (size_t first_index, /**< index of first instruction in the stash */
+                                opcode_counter_t instrs_num) /**< number of the instructions */
+{
+  JERRY_ASSERT (first_index + instrs_num <= STACK_SIZE (stashed_op_metas));
+
+  for (size_t index = first_index; index < first_index + instrs_num; index++)
+  {
+    const op_meta stashed_op_meta = STACK_ELEMENT (stashed_op_metas, index);
+
+    serializer_dump_op_meta (stashed_op_meta);
+
+#ifdef VM_PROFILE
+    /* the instruction keeps the source line, it was generated for */
+    serializer_set_instruction_line ((opcode_counter_t) (serializer_get_current_opcode_counter () - 1),
+                                     stashed_op_meta.line);
+#endif /* VM_PROFILE */
+  }
+} /* dump_stashed_instructions_from */
+
+/**
+ * Dump instructions, that were most recently stashed with dumper_stash_instructions, at current position,
+ * and remove them from the stash
+ */
 void
-start_dumping_case_clauses (void)
+dump_stashed_instructions (opcode_counter_t instrs_num) /**< number of the instructions,
+                                                         *   returned by dumper_stash_instructions */
 {
-  STACK_PUSH (U8, (uint8_t) STACK_SIZE (case_clauses));
-  STACK_PUSH (U8, (uint8_t) STACK_SIZE (case_clauses));
-}
+  JERRY_ASSERT (STACK_SIZE (stashed_op_metas) >= instrs_num);
 
+  dump_stashed_instructions_from (STACK_SIZE (stashed_op_metas) - instrs_num, instrs_num);
+
+  STACK_DROP (stashed_op_metas, instrs_num);
+} /* dump_stashed_instructions */
+
+/**
+ * Start dumping of switch statement's case clauses
+ *
+ * Note:
+ *      Layout of generated byte-code is the following:
+ *                           jmp_down -> Checks
+ *        Clause1Body:
+ *                           ...
+ *        ClauseNBody:
+ *                           ...
+ *                           jmp_down -> End
+ *        Checks:
+ *                           tmp <- Clause1Expression === SwitchExpression
+ *                           is_true_jmp_up tmp -> Clause1Body
+ *                           ...
+ *                           tmp <- ClauseNExpression === SwitchExpression
+ *                           is_true_jmp_up tmp -> ClauseNBody
+ *                           jmp_up -> DefaultClauseBody (if there is default clause)
+ *        End:
+ *
+ *      so the clauses are parsed in one pass: the checks are stashed, while the bodies are parsed,
+ *      and dumped after the bodies (see also: dumper_stash_instructions)
+ */
 void
-dump_case_clause_check_for_rewrite (operand switch_expr, operand case_expr)
+start_dumping_case_clauses (void)
 {
-  const operand res = tmp_operand ();
-  dump_triple_address (getop_equal_value_type, res, switch_expr, case_expr);
+  STACK_PUSH (switch_statements, STACK_SIZE (case_clauses));
+
   STACK_PUSH (case_clauses, serializer_get_current_opcode_counter ());
-  const opcode_t opcode = getop_is_true_jmp_down (res.data.uid, INVALID_VALUE, INVALID_VALUE);
+  const opcode_t opcode = getop_jmp_down (INVALID_VALUE, INVALID_VALUE);
   serializer_dump_op_meta (create_op_meta_000 (opcode));
-}
 
+  /* position of default clause's body (MAX_OPCODES - if there is no default clause) */
+  STACK_PUSH (case_clauses, MAX_OPCODES);
+
+  /* first register, that is not used by the switch statement's expression */
+  STACK_PUSH (case_clauses, temp_name);
+} /* start_dumping_case_clauses */
+
+/**
+ * Start dumping of case clause's check (the clause's expression)
+ */
 void
-dump_default_clause_check_for_rewrite (void)
+start_dumping_case_clause_check (void)
 {
+  /*
+   * the checks are performed before any of the bodies, so registers, used by the bodies, are reused,
+   * except for the registers, holding value of the switch statement's expression
+   */
+  temp_name = (idx_t) STACK_ELEMENT (case_clauses, STACK_TOP (switch_statements) + 2);
+
   STACK_PUSH (case_clauses, serializer_get_current_opcode_counter ());
-  const opcode_t opcode = getop_jmp_down (INVALID_VALUE, INVALID_VALUE);
+} /* start_dumping_case_clause_check */
+
+/**
+ * Finish dumping of case clause's check, and stash the check till the end of the switch statement
+ */
+void
+dump_case_clause_check_for_rewrite (operand switch_expr, /**< switch statement's expression */
+                                    operand case_expr) /**< case clause's expression */
+{
+  const operand res = tmp_operand ();
+  dump_triple_address (getop_equal_value_type, res, switch_expr, case_expr);
+  const opcode_t opcode = getop_is_true_jmp_up (res.data.uid, INVALID_VALUE, INVALID_VALUE);
   serializer_dump_op_meta (create_op_meta_000 (opcode));
-}
 
+  /* start position of the check is replaced with number of the check's instructions */
+  STACK_SET_HEAD (case_clauses, 1, dumper_stash_instructions (STACK_TOP (case_clauses)));
+
+  /* position of the clause's body */
+  STACK_PUSH (case_clauses, serializer_get_current_opcode_counter ());
+} /* dump_case_clause_check_for_rewrite */
+
+/**
+ * Mark start of default clause's body
+ */
 void
-rewrite_case_clause (void)
+dump_default_clause_check_for_rewrite (void)
 {
-  const opcode_counter_t jmp_oc = STACK_ELEMENT (case_clauses, STACK_HEAD (U8, 2));
-  idx_t id1, id2;
-  split_opcode_counter (get_diff_from (jmp_oc), &id1, &id2);
-  op_meta jmp_op_meta = serializer_get_op_meta (jmp_oc);
-  JERRY_ASSERT (jmp_op_meta.op.op_idx == OPCODE (is_true_jmp_down));
-  jmp_op_meta.op.data.is_true_jmp_down.opcode_1 = id1;
-  jmp_op_meta.op.data.is_true_jmp_down.opcode_2 = id2;
-  serializer_rewrite_op_meta (jmp_oc, jmp_op_meta);
-  STACK_INCR_HEAD (U8, 2);
-}
+  STACK_SET_ELEMENT (case_clauses, STACK_TOP (switch_statements) + 1, serializer_get_current_opcode_counter ());
+} /* dump_default_clause_check_for_rewrite */
 
+/**
+ * Finish dumping of switch statement's case clauses: dump the stashed checks, and jump to default clause
+ */
 void
-rewrite_default_clause (void)
+finish_dumping_case_clauses (void)
 {
-  const opcode_counter_t jmp_oc = STACK_TOP (case_clauses);
+  const size_t first_index = STACK_TOP (switch_statements);
+  JERRY_ASSERT ((STACK_SIZE (case_clauses) - first_index - 3) % 2 == 0);
+
+  const size_t clauses_num = (STACK_SIZE (case_clauses) - first_index - 3) / 2;
+
+  const opcode_counter_t jmp_to_end_oc = serializer_get_current_opcode_counter ();
+  serializer_dump_op_meta (create_op_meta_000 (getop_jmp_down (INVALID_VALUE, INVALID_VALUE)));
+
+  /* Checks */
+  const opcode_counter_t jmp_to_checks_oc = STACK_ELEMENT (case_clauses, first_index);
   idx_t id1, id2;
-  split_opcode_counter (get_diff_from (jmp_oc), &id1, &id2);
-  op_meta jmp_op_meta = serializer_get_op_meta (jmp_oc);
+  split_opcode_counter (get_diff_from (jmp_to_checks_oc), &id1, &id2);
+  op_meta jmp_op_meta = serializer_get_op_meta (jmp_to_checks_oc);
   JERRY_ASSERT (jmp_op_meta.op.op_idx == OPCODE (jmp_down));
   jmp_op_meta.op.data.jmp_down.opcode_1 = id1;
   jmp_op_meta.op.data.jmp_down.opcode_2 = id2;
-  serializer_rewrite_op_meta (jmp_oc, jmp_op_meta);
-}
+  serializer_rewrite_op_meta (jmp_to_checks_oc, jmp_op_meta);
 
-void
-finish_dumping_case_clauses (void)
-{
-  STACK_DROP (case_clauses, STACK_SIZE (case_clauses) - STACK_TOP (U8));
-  STACK_DROP (U8, 1);
-  STACK_DROP (U8, 1);
-}
+  size_t checks_instrs_num = 0;
+  for (size_t clause_index = 0; clause_index < clauses_num; clause_index++)
+  {
+    checks_instrs_num += STACK_ELEMENT (case_clauses, first_index + 3 + clause_index * 2);
+  }
+
+  size_t stash_index = STACK_SIZE (stashed_op_metas) - checks_instrs_num;
+  for (size_t clause_index = 0; clause_index < clauses_num; clause_index++)
+  {
+    const opcode_counter_t check_instrs_num = STACK_ELEMENT (case_clauses, first_index + 3 + clause_index * 2);
+    const opcode_counter_t body_oc = STACK_ELEMENT (case_clauses, first_index + 4 + clause_index * 2);
+
+    dump_stashed_instructions_from (stash_index, check_instrs_num);
+    stash_index += check_instrs_num;
+
+    const opcode_counter_t check_jmp_oc = (opcode_counter_t) (serializer_get_current_opcode_counter () - 1);
+    split_opcode_counter ((opcode_counter_t) (check_jmp_oc - body_oc), &id1, &id2);
+    op_meta check_jmp_op_meta = serializer_get_op_meta (check_jmp_oc);
+    JERRY_ASSERT (check_jmp_op_meta.op.op_idx == OPCODE (is_true_jmp_up));
+    check_jmp_op_meta.op.data.is_true_jmp_up.opcode_1 = id1;
+    check_jmp_op_meta.op.data.is_true_jmp_up.opcode_2 = id2;
+    serializer_rewrite_op_meta (check_jmp_oc, check_jmp_op_meta);
+  }
+
+  const opcode_counter_t default_body_oc = STACK_ELEMENT (case_clauses, first_index + 1);
+  if (default_body_oc != MAX_OPCODES)
+  {
+    split_opcode_counter (get_diff_from (default_body_oc), &id1, &id2);
+    serializer_dump_op_meta (create_op_meta_000 (getop_jmp_up (id1, id2)));
+  }
+
+  /* End */
+  split_opcode_counter (get_diff_from (jmp_to_end_oc), &id1, &id2);
+  jmp_op_meta = serializer_get_op_meta (jmp_to_end_oc);
+  JERRY_ASSERT (jmp_op_meta.op.op_idx == OPCODE (jmp_down));
+  jmp_op_meta.op.data.jmp_down.opcode_1 = id1;
+  jmp_op_meta.op.data.jmp_down.opcode_2 = id2;
+  serializer_rewrite_op_meta (jmp_to_end_oc, jmp_op_meta);
+
+  STACK_DROP (stashed_op_metas, checks_instrs_num);
+  STACK_DROP (case_clauses, STACK_SIZE (case_clauses) - first_index);
+  STACK_DROP (switch_statements, 1);
+} /* finish_dumping_case_clauses */
 
 /**
  * Dump template of 'with' instruction.
@@ -2540,31 +2800,79 @@ dump_throw (operand op)
   dump_single_address (getop_throw_value, op);
 }
 
-bool
-dumper_variable_declaration_exists (lit_cpointer_t lit_id)
+/**
+ * Dump template of 'meta' instruction, referencing the scope's table of declarations
+ *
+ * Note:
+ *      the offset to the table is written upon the scope's end, if the scope has declarations
+ *      (see also: dump_scope_declarations)
+ *
+ * @return position of dumped instruction
+ */
+opcode_counter_t
+dump_scope_declarations_for_rewrite (void)
 {
-  for (opcode_counter_t oc = (opcode_counter_t) (serializer_get_current_opcode_counter () - 1);
-       oc > 0; oc--)
-  {
-    const op_meta var_decl_op_meta = serializer_get_op_meta (oc);
-    if (var_decl_op_meta.op.op_idx != OPCODE (var_decl))
-    {
-      break;
-    }
-    if (var_decl_op_meta.lit_id[0].packed_value == lit_id.packed_value)
-    {
-      return true;
-    }
-  }
-  return false;
-}
+  opcode_counter_t oc = serializer_get_current_opcode_counter ();
+
+  const opcode_t opcode = getop_meta (OPCODE_META_TYPE_SCOPE_DECLARATIONS, 0, 0);
+  serializer_dump_op_meta (create_op_meta_000 (opcode));
+
+  return oc;
+} /* dump_scope_declarations_for_rewrite */
 
+/**
+ * Dump the scope's table of declarations after the scope's code, and write offset to the table
+ * to the scope's header (see also: dump_scope_declarations_for_rewrite)
+ *
+ * The table consists of 'var_decl' instructions for the scope's variables, followed by
+ * 'meta' instructions, referencing 'func_decl_n' instructions of the scope's function declarations,
+ * and is terminated with 'meta' instruction of OPCODE_META_TYPE_END_SCOPE_DECLARATIONS type.
+ *
+ * Note:
+ *      if the scope has no declarations, the table is not dumped
+ */
 void
-dump_variable_declaration (lit_cpointer_t lit_id)
+dump_scope_declarations (opcode_counter_t scope_decls_oc, /**< position of the scope's 'meta' instruction,
+                                                           *   referencing the table */
+                         const lit_cpointer_t *var_names_p, /**< names of the scope's variables */
+                         size_t var_names_num, /**< number of the variables */
+                         const opcode_counter_t *func_decls_p, /**< positions of 'func_decl_n' instructions
+                                                                *   of the scope's function declarations */
+                         size_t func_decls_num) /**< number of the function declarations */
 {
-  const opcode_t opcode = getop_var_decl (LITERAL_TO_REWRITE);
-  serializer_dump_op_meta (create_op_meta_100 (opcode, lit_id));
-}
+  if (var_names_num == 0 && func_decls_num == 0)
+  {
+    return;
+  }
+
+  idx_t id1, id2;
+
+  op_meta scope_decls_op_meta = serializer_get_op_meta (scope_decls_oc);
+  JERRY_ASSERT (scope_decls_op_meta.op.op_idx == OPCODE (meta)
+                && scope_decls_op_meta.op.data.meta.type == OPCODE_META_TYPE_SCOPE_DECLARATIONS);
+  split_opcode_counter (get_diff_from (scope_decls_oc), &id1, &id2);
+  scope_decls_op_meta.op.data.meta.data_1 = id1;
+  scope_decls_op_meta.op.data.meta.data_2 = id2;
+  serializer_rewrite_op_meta (scope_decls_oc, scope_decls_op_meta);
+
+  for (size_t index = 0; index < var_names_num; index++)
+  {
+    const opcode_t opcode = getop_var_decl (LITERAL_TO_REWRITE);
+    serializer_dump_op_meta (create_op_meta_100 (opcode, var_names_p[index]));
+  }
+
+  for (size_t index = 0; index < func_decls_num; index++)
+  {
+    JERRY_ASSERT (serializer_get_op_meta (func_decls_p[index]).op.op_idx == OPCODE (func_decl_n));
+
+    split_opcode_counter (get_diff_from (func_decls_p[index]), &id1, &id2);
+    const opcode_t opcode = getop_meta (OPCODE_META_TYPE_FUNCTION_DECLARATION, id1, id2);
+    serializer_dump_op_meta (create_op_meta_000 (opcode));
+  }
+
+  const opcode_t opcode = getop_meta (OPCODE_META_TYPE_END_SCOPE_DECLARATIONS, INVALID_VALUE, INVALID_VALUE);
+  serializer_dump_op_meta (create_op_meta_000 (opcode));
+} /* dump_scope_declarations */
 
 /**
  * Dump template of 'meta' instruction for scope's code flags.
@@ -2605,6 +2913,23 @@ rewrite_scope_code_flags (opcode_counter_t scope_code_flags_oc, /**< position of
   serializer_rewrite_op_meta (scope_code_flags_oc, opm);
 } /* rewrite_scope_code_flags */
 
+/**
+ * Dump 'meta' instruction, referencing source code of a function's body,
+ * which compilation is deferred till the function's first call
+ *
+ * See also:
+ *          ecma_op_function_call
+ */
+void
+dump_lazy_function_body (uint16_t body_index) /**< index of the body's descriptor
+                                               *   (see also: serializer_register_lazy_function_body) */
+{
+  const opcode_t opcode = getop_meta (OPCODE_META_TYPE_LAZY_FUNCTION_BODY,
+                                      (idx_t) (body_index >> JERRY_BITSINBYTE),
+                                      (idx_t) (body_index & ((1 << JERRY_BITSINBYTE) - 1)));
+  serializer_dump_op_meta (create_op_meta_000 (opcode));
+} /* dump_lazy_function_body */
+
 void
 dump_ret (void)
 {
@@ -2640,7 +2965,7 @@ dumper_init (void)
 {
   max_temp_name = 0;
   reset_temp_name ();
-  STACK_INIT (U8);
+  STACK_INIT (logical_checks_starts);
   STACK_INIT (varg_headers);
   STACK_INIT (function_ends);
   STACK_INIT (logical_and_checks);
@@ -2650,6 +2975,8 @@ dumper_init (void)
   STACK_INIT (prop_getters);
   STACK_INIT (next_iterations);
   STACK_INIT (case_clauses);
+  STACK_INIT (switch_statements);
+  STACK_INIT (stashed_op_metas);
   STACK_INIT (catches);
   STACK_INIT (finallies);
   STACK_INIT (tries);
@@ -2660,7 +2987,7 @@ dumper_init (void)
 void
 dumper_free (void)
 {
-  STACK_FREE (U8);
+  STACK_FREE (logical_checks_starts);
   STACK_FREE (varg_headers);
   STACK_FREE (function_ends);
   STACK_FREE (logical_and_checks);
@@ -2670,6 +2997,8 @@ dumper_free (void)
   STACK_FREE (prop_getters);
   STACK_FREE (next_iterations);
   STACK_FREE (case_clauses);
+  STACK_FREE (switch_statements);
+  STACK_FREE (stashed_op_metas);
   STACK_FREE (catches);
   STACK_FREE (finallies);
   STACK_FREE (tries);
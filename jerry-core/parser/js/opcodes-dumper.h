@@ -62,6 +62,7 @@ void dumper_start_varg_code_sequence (void);
 void dumper_finish_varg_code_sequence (void);
 
 extern bool dumper_is_eval_literal (operand);
+extern bool dumper_is_possible_reference (operand);
 
 void dump_boolean_assignment (operand, bool);
 operand dump_boolean_assignment_res (bool);
@@ -81,7 +82,7 @@ void dump_variable_assignment (operand, operand);
 operand dump_variable_assignment_res (operand);
 
 void dump_varg_header_for_rewrite (varg_list_type, operand);
-operand rewrite_varg_header_set_args_count (uint8_t);
+operand rewrite_varg_header_set_args_count (idx_t);
 void dump_call_additional_info (opcode_call_flags_t, operand);
 void dump_varg (operand);
 
@@ -93,7 +94,7 @@ operand dump_prop_getter_res (operand, operand);
 void dump_prop_setter (operand, operand, operand);
 
 void dump_function_end_for_rewrite (void);
-void rewrite_function_end (varg_list_type);
+void rewrite_function_end (void);
 
 void dump_this (operand);
 operand dump_this_res (void);
@@ -194,11 +195,13 @@ rewrite_simple_or_nested_jump_and_get_next (opcode_counter_t jump_oc,
                                             opcode_counter_t target_oc);
 void dump_continue_iterations_check (operand);
 
+opcode_counter_t dumper_stash_instructions (opcode_counter_t);
+void dump_stashed_instructions (opcode_counter_t);
+
 void start_dumping_case_clauses (void);
+void start_dumping_case_clause_check (void);
 void dump_case_clause_check_for_rewrite (operand, operand);
 void dump_default_clause_check_for_rewrite (void);
-void rewrite_case_clause (void);
-void rewrite_default_clause (void);
 void finish_dumping_case_clauses (void);
 
 void dump_delete (operand, operand, bool, locus);
@@ -224,13 +227,15 @@ void rewrite_finally (void);
 void dump_end_try_catch_finally (void);
 void dump_throw (operand);
 
-bool dumper_variable_declaration_exists (lit_cpointer_t);
-void dump_variable_declaration (lit_cpointer_t);
+opcode_counter_t dump_scope_declarations_for_rewrite (void);
+void dump_scope_declarations (opcode_counter_t, const lit_cpointer_t *, size_t, const opcode_counter_t *, size_t);
 
 opcode_counter_t dump_scope_code_flags_for_rewrite (void);
 void rewrite_scope_code_flags (opcode_counter_t scope_code_flags_oc,
                                opcode_scope_code_flags_t scope_flags);
 
+void dump_lazy_function_body (uint16_t);
+
 void dump_reg_var_decl_for_rewrite (void);
 void rewrite_reg_var_decl (void);
 
@@ -0,0 +1,1126 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-helpers.h"
+#include "ecma-number-arithmetic.h"
+#include "jsp-mm.h"
+#include "optimizer.h"
+
+#ifndef CONFIG_PARSER_BYTECODE_OPTIMIZER_DISABLE
+
+#define OPCODE(op) (__op__idx_##op)
+
+/**
+ * Get value of the instruction's argument
+ *
+ * @return the argument's value
+ */
+static idx_t
+optimizer_get_arg (op_meta *om_p, /**< instruction */
+                   uint8_t arg_index) /**< index of the argument */
+{
+  JERRY_ASSERT (arg_index < 3);
+
+  raw_opcode *raw_p = (raw_opcode *) &om_p->op;
+  return raw_p->uids[arg_index + 1];
+} /* optimizer_get_arg */
+
+/**
+ * Set value of the instruction's argument
+ */
+static void
+optimizer_set_arg (op_meta *om_p, /**< instruction */
+                   uint8_t arg_index, /**< index of the argument */
+                   idx_t value) /**< new value */
+{
+  JERRY_ASSERT (arg_index < 3);
+
+  raw_opcode *raw_p = (raw_opcode *) &om_p->op;
+  raw_p->uids[arg_index + 1] = value;
+} /* optimizer_set_arg */
+
+/**
+ * Maximum number of jumps, followed during threading of a jump chain
+ */
+#define OPTIMIZER_MAX_THREADED_JUMPS (8)
+
+/**
+ * Target value for instructions without offset argument
+ */
+#define OPTIMIZER_NO_TARGET (MAX_OPCODES)
+
+/**
+ * Get position of instruction's argument pair, containing offset to another instruction
+ *
+ * @return true - if the instruction has offset argument,
+ *         false - otherwise.
+ */
+static bool
+optimizer_get_offset_arg (op_meta *om_p, /**< instruction */
+                          uint8_t *out_arg_index_p, /**< out: index of first argument of the pair */
+                          bool *out_is_backward_p) /**< out: true - if the offset is directed backward,
+                                                    *        false - otherwise */
+{
+  *out_is_backward_p = false;
+
+  switch (om_p->op.op_idx)
+  {
+    case OPCODE (jmp_up):
+    {
+      *out_arg_index_p = 0;
+      *out_is_backward_p = true;
+      return true;
+    }
+    case OPCODE (jmp_down):
+    case OPCODE (jmp_break_continue):
+    case OPCODE (try_block):
+    {
+      *out_arg_index_p = 0;
+      return true;
+    }
+    case OPCODE (is_true_jmp_up):
+    case OPCODE (is_false_jmp_up):
+    {
+      *out_arg_index_p = 1;
+      *out_is_backward_p = true;
+      return true;
+    }
+    case OPCODE (is_true_jmp_down):
+    case OPCODE (is_false_jmp_down):
+    case OPCODE (for_in):
+    case OPCODE (with):
+    {
+      *out_arg_index_p = 1;
+      return true;
+    }
+    case OPCODE (meta):
+    {
+      switch (om_p->op.data.meta.type)
+      {
+        case OPCODE_META_TYPE_FUNCTION_END:
+        case OPCODE_META_TYPE_CATCH:
+        case OPCODE_META_TYPE_FINALLY:
+        case OPCODE_META_TYPE_SCOPE_DECLARATIONS:
+        {
+          *out_arg_index_p = 1;
+          return true;
+        }
+        case OPCODE_META_TYPE_FUNCTION_DECLARATION:
+        {
+          *out_arg_index_p = 1;
+          *out_is_backward_p = true;
+          return true;
+        }
+        default:
+        {
+          return false;
+        }
+      }
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* optimizer_get_offset_arg */
+
+/**
+ * Check whether the instruction is an unconditional jump inside of current run scope
+ */
+static bool
+optimizer_is_plain_jump (const op_meta *om_p) /**< instruction */
+{
+  return (om_p->op.op_idx == OPCODE (jmp_down) || om_p->op.op_idx == OPCODE (jmp_up));
+} /* optimizer_is_plain_jump */
+
+/**
+ * Check whether the instruction is a conditional jump
+ */
+static bool
+optimizer_is_conditional_jump (const op_meta *om_p) /**< instruction */
+{
+  return (om_p->op.op_idx == OPCODE (is_true_jmp_down)
+          || om_p->op.op_idx == OPCODE (is_true_jmp_up)
+          || om_p->op.op_idx == OPCODE (is_false_jmp_down)
+          || om_p->op.op_idx == OPCODE (is_false_jmp_up));
+} /* optimizer_is_conditional_jump */
+
+/**
+ * Check whether the instruction's argument is a general-purpose register
+ */
+static bool
+optimizer_is_arg_general_reg (op_meta *om_p, /**< instruction */
+                              uint8_t arg_index) /**< index of the argument */
+{
+  const idx_t idx = optimizer_get_arg (om_p, arg_index);
+
+  return (idx >= OPCODE_REG_GENERAL_FIRST
+          && idx <= OPCODE_REG_GENERAL_LAST
+          && idx != LITERAL_TO_REWRITE
+          && idx != INVALID_VALUE
+          && om_p->lit_id[arg_index].packed_value == MEM_CP_NULL);
+} /* optimizer_is_arg_general_reg */
+
+/**
+ * Get number of arguments of instruction, that reads all its arguments except first one,
+ * and then writes result to the first argument.
+ *
+ * Note:
+ *      'assignment' is not considered here, as its second and third arguments describe a value.
+ *
+ * @return number of arguments - for instructions of the kind,
+ *         0 - otherwise.
+ */
+static uint8_t
+optimizer_get_dst_first_args_num (const op_meta *om_p) /**< instruction */
+{
+  switch (om_p->op.op_idx)
+  {
+    case OPCODE (prop_getter):
+    case OPCODE (b_shift_left):
+    case OPCODE (b_shift_right):
+    case OPCODE (b_shift_uright):
+    case OPCODE (b_and):
+    case OPCODE (b_or):
+    case OPCODE (b_xor):
+    case OPCODE (equal_value):
+    case OPCODE (not_equal_value):
+    case OPCODE (equal_value_type):
+    case OPCODE (not_equal_value_type):
+    case OPCODE (less_than):
+    case OPCODE (greater_than):
+    case OPCODE (less_or_equal_than):
+    case OPCODE (greater_or_equal_than):
+    case OPCODE (instanceof):
+    case OPCODE (in):
+    case OPCODE (addition):
+    case OPCODE (substraction):
+    case OPCODE (division):
+    case OPCODE (multiplication):
+    case OPCODE (remainder):
+    {
+      return 3;
+    }
+    case OPCODE (typeof):
+    case OPCODE (b_not):
+    case OPCODE (logical_not):
+    case OPCODE (unary_plus):
+    case OPCODE (unary_minus):
+    {
+      return 2;
+    }
+    default:
+    {
+      return 0;
+    }
+  }
+} /* optimizer_get_dst_first_args_num */
+
+/**
+ * Check whether the instruction writes its result to the first argument
+ */
+static bool
+optimizer_is_dst_first_op (const op_meta *om_p) /**< instruction */
+{
+  return (om_p->op.op_idx == OPCODE (assignment)
+          || optimizer_get_dst_first_args_num (om_p) != 0);
+} /* optimizer_is_dst_first_op */
+
+/**
+ * Check whether the instruction, writing its result to the first argument, reads the register
+ */
+static bool
+optimizer_is_reg_read (op_meta *om_p, /**< instruction (see also: optimizer_is_dst_first_op) */
+                       idx_t reg) /**< register */
+{
+  JERRY_ASSERT (optimizer_is_dst_first_op (om_p));
+
+  if (om_p->op.op_idx == OPCODE (assignment))
+  {
+    return (om_p->op.data.assignment.type_value_right == OPCODE_ARG_TYPE_VARIABLE
+            && optimizer_get_arg (om_p, 2) == reg
+            && om_p->lit_id[2].packed_value == MEM_CP_NULL);
+  }
+
+  const uint8_t args_num = optimizer_get_dst_first_args_num (om_p);
+  for (uint8_t arg_index = 1; arg_index < args_num; arg_index++)
+  {
+    if (optimizer_get_arg (om_p, arg_index) == reg
+        && om_p->lit_id[arg_index].packed_value == MEM_CP_NULL)
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* optimizer_is_reg_read */
+
+/**
+ * Maximum number of instructions, checked during search of the register's uses
+ */
+#define OPTIMIZER_MAX_LIVENESS_CHECK_STEPS (1024)
+
+/**
+ * Marks of instructions, visited during current search of a register's uses
+ */
+static uint32_t *optimizer_visit_marks_p;
+
+/**
+ * Mark of current search of a register's uses
+ */
+static uint32_t optimizer_visit_mark;
+
+/**
+ * Check whether value of the register is not used, starting from the specified instruction
+ *
+ * Note:
+ *      the check is conservative: the register is considered alive if an instruction, that transfers control
+ *      in a way other than 'jmp_*' or 'is_*_jmp_*', is met before the register is overwritten,
+ *      or if the check takes more than OPTIMIZER_MAX_LIVENESS_CHECK_STEPS steps.
+ *
+ * @return true - if the register is dead,
+ *         false - if the register may be used.
+ */
+static bool
+optimizer_is_reg_dead_at (op_meta *ops_p, /**< instructions */
+                          const opcode_counter_t *targets_p, /**< targets of the instructions */
+                          opcode_counter_t ops_num, /**< number of instructions */
+                          opcode_counter_t oc, /**< instruction to start the check from */
+                          idx_t reg, /**< register */
+                          uint32_t *steps_p) /**< in-out: number of steps, made during the check */
+{
+  for (; oc < ops_num; oc++)
+  {
+    if (optimizer_visit_marks_p[oc] == optimizer_visit_mark)
+    {
+      /* the instruction is either already checked, or is being checked on a path, that is a loop */
+      return true;
+    }
+    optimizer_visit_marks_p[oc] = optimizer_visit_mark;
+
+    if (++*steps_p > OPTIMIZER_MAX_LIVENESS_CHECK_STEPS)
+    {
+      return false;
+    }
+
+    op_meta *om_p = ops_p + oc;
+
+    if (om_p->op.op_idx == OPCODE (nop))
+    {
+      continue;
+    }
+    else if (optimizer_is_dst_first_op (om_p))
+    {
+      if (optimizer_is_reg_read (om_p, reg))
+      {
+        return false;
+      }
+      else if (optimizer_get_arg (om_p, 0) == reg
+               && om_p->lit_id[0].packed_value == MEM_CP_NULL)
+      {
+        return true;
+      }
+
+      continue;
+    }
+    else if (om_p->op.op_idx == OPCODE (pre_incr)
+             || om_p->op.op_idx == OPCODE (pre_decr)
+             || om_p->op.op_idx == OPCODE (post_incr)
+             || om_p->op.op_idx == OPCODE (post_decr))
+    {
+      if (optimizer_get_arg (om_p, 1) == reg
+          && om_p->lit_id[1].packed_value == MEM_CP_NULL)
+      {
+        return false;
+      }
+      else if (optimizer_get_arg (om_p, 0) == reg
+               && om_p->lit_id[0].packed_value == MEM_CP_NULL)
+      {
+        return true;
+      }
+
+      continue;
+    }
+
+    for (uint8_t arg_index = 0; arg_index < 3; arg_index++)
+    {
+      if (optimizer_get_arg (om_p, arg_index) == reg
+          && om_p->lit_id[arg_index].packed_value == MEM_CP_NULL)
+      {
+        return false;
+      }
+    }
+
+    switch (om_p->op.op_idx)
+    {
+      case OPCODE (ret):
+      case OPCODE (retval):
+      {
+        return true;
+      }
+      case OPCODE (jmp_down):
+      case OPCODE (jmp_up):
+      {
+        oc = (opcode_counter_t) (targets_p[oc] - 1);
+        break;
+      }
+      case OPCODE (is_true_jmp_down):
+      case OPCODE (is_true_jmp_up):
+      case OPCODE (is_false_jmp_down):
+      case OPCODE (is_false_jmp_up):
+      {
+        if (!optimizer_is_reg_dead_at (ops_p, targets_p, ops_num, targets_p[oc], reg, steps_p))
+        {
+          return false;
+        }
+        break;
+      }
+      case OPCODE (meta):
+      {
+        switch (om_p->op.data.meta.type)
+        {
+          case OPCODE_META_TYPE_CALL_SITE_INFO:
+          case OPCODE_META_TYPE_VARG:
+          case OPCODE_META_TYPE_VARG_PROP_DATA:
+          case OPCODE_META_TYPE_VARG_PROP_GETTER:
+          case OPCODE_META_TYPE_VARG_PROP_SETTER:
+          {
+            break;
+          }
+          case OPCODE_META_TYPE_FUNCTION_END:
+          {
+            /* body of function declaration is skipped at the declaration's place (see also: opfunc_func_decl_n) */
+            oc = (opcode_counter_t) (targets_p[oc] - 1);
+            break;
+          }
+          default:
+          {
+            return false;
+          }
+        }
+        break;
+      }
+      case OPCODE (jmp_break_continue):
+      case OPCODE (try_block):
+      case OPCODE (with):
+      case OPCODE (for_in):
+      case OPCODE (throw_value):
+      case OPCODE (func_expr_n):
+      {
+        return false;
+      }
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+  return true;
+} /* optimizer_is_reg_dead_at */
+
+/**
+ * Check whether value of the register is not used, starting from the specified instruction
+ *
+ * See also:
+ *          optimizer_is_reg_dead_at
+ *
+ * @return true - if the register is dead,
+ *         false - if the register may be used.
+ */
+static bool
+optimizer_is_reg_dead (op_meta *ops_p, /**< instructions */
+                       const opcode_counter_t *targets_p, /**< targets of the instructions */
+                       opcode_counter_t ops_num, /**< number of instructions */
+                       opcode_counter_t oc, /**< instruction to start the check from */
+                       idx_t reg) /**< register */
+{
+  uint32_t steps = 0;
+  optimizer_visit_mark++;
+
+  return optimizer_is_reg_dead_at (ops_p, targets_p, ops_num, oc, reg, &steps);
+} /* optimizer_is_reg_dead */
+
+/**
+ * Get number, assigned to general-purpose register by the instruction
+ *
+ * @return true - if the instruction is assignment of a number to a general-purpose register,
+ *         false - otherwise.
+ */
+static bool
+optimizer_get_number_assignment (op_meta *om_p, /**< instruction */
+                                 idx_t *out_reg_p, /**< out: register */
+                                 ecma_number_t *out_num_p) /**< out: the number */
+{
+  if (om_p->op.op_idx != OPCODE (assignment)
+      || !optimizer_is_arg_general_reg (om_p, 0))
+  {
+    return false;
+  }
+
+  if (om_p->op.data.assignment.type_value_right == OPCODE_ARG_TYPE_SMALLINT)
+  {
+    *out_num_p = (ecma_number_t) om_p->op.data.assignment.value_right;
+  }
+  else if (om_p->op.data.assignment.type_value_right == OPCODE_ARG_TYPE_NUMBER)
+  {
+    literal_t lit = lit_get_literal_by_cp (om_p->lit_id[2]);
+    JERRY_ASSERT (lit->get_type () == LIT_NUMBER_T);
+
+    *out_num_p = lit_charset_literal_get_number (lit);
+  }
+  else
+  {
+    return false;
+  }
+
+  *out_reg_p = om_p->op.data.assignment.var_left;
+
+  return true;
+} /* optimizer_get_number_assignment */
+
+/**
+ * Calculate result of binary operation on numbers
+ *
+ * Note:
+ *      the calculation repeats the calculation of corresponding opcode handler
+ *      for the case of number arguments.
+ *
+ * @return true - if the operation can be calculated at parse stage,
+ *         false - otherwise.
+ */
+static bool
+optimizer_fold_binary_op (uint8_t op_idx, /**< operation */
+                          ecma_number_t left_num, /**< left argument */
+                          ecma_number_t right_num, /**< right argument */
+                          ecma_number_t *out_num_p) /**< out: result */
+{
+  const int32_t left_int32 = ecma_number_to_int32 (left_num);
+  const uint32_t left_uint32 = ecma_number_to_uint32 (left_num);
+  const uint32_t right_uint32 = ecma_number_to_uint32 (right_num);
+
+  switch (op_idx)
+  {
+    case OPCODE (addition):
+    {
+      *out_num_p = ecma_number_add (left_num, right_num);
+      break;
+    }
+    case OPCODE (substraction):
+    {
+      *out_num_p = ecma_number_substract (left_num, right_num);
+      break;
+    }
+    case OPCODE (multiplication):
+    {
+      *out_num_p = ecma_number_multiply (left_num, right_num);
+      break;
+    }
+    case OPCODE (division):
+    {
+      *out_num_p = ecma_number_divide (left_num, right_num);
+      break;
+    }
+    case OPCODE (remainder):
+    {
+      *out_num_p = ecma_op_number_remainder (left_num, right_num);
+      break;
+    }
+    case OPCODE (b_and):
+    {
+      *out_num_p = ecma_int32_to_number ((int32_t) (left_uint32 & right_uint32));
+      break;
+    }
+    case OPCODE (b_or):
+    {
+      *out_num_p = ecma_int32_to_number ((int32_t) (left_uint32 | right_uint32));
+      break;
+    }
+    case OPCODE (b_xor):
+    {
+      *out_num_p = ecma_int32_to_number ((int32_t) (left_uint32 ^ right_uint32));
+      break;
+    }
+    case OPCODE (b_shift_left):
+    {
+      *out_num_p = ecma_int32_to_number (left_int32 << (right_uint32 & 0x1F));
+      break;
+    }
+    case OPCODE (b_shift_right):
+    {
+      *out_num_p = ecma_int32_to_number (left_int32 >> (right_uint32 & 0x1F));
+      break;
+    }
+    case OPCODE (b_shift_uright):
+    {
+      *out_num_p = ecma_uint32_to_number (left_uint32 >> (right_uint32 & 0x1F));
+      break;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  /* NaN and negative zero are not representable with number literals */
+  return (!ecma_number_is_nan (*out_num_p)
+          && !(ecma_number_is_zero (*out_num_p) && ecma_number_is_negative (*out_num_p)));
+} /* optimizer_fold_binary_op */
+
+/**
+ * Make assignment of a number to the specified destination
+ *
+ * @return instruction
+ */
+static op_meta
+optimizer_make_number_assignment (idx_t dst, /**< destination register or LITERAL_TO_REWRITE */
+                                  lit_cpointer_t dst_lit_id, /**< destination literal */
+                                  ecma_number_t num) /**< the number */
+{
+  op_meta ret;
+
+  if (num >= 0 && num <= (ecma_number_t) ((1 << JERRY_BITSINBYTE) - 1)
+      && num == (ecma_number_t) (idx_t) num)
+  {
+    ret.op = getop_assignment (dst, OPCODE_ARG_TYPE_SMALLINT, (idx_t) num);
+    ret.lit_id[2] = NOT_A_LITERAL;
+  }
+  else
+  {
+    ret.op = getop_assignment (dst, OPCODE_ARG_TYPE_NUMBER, LITERAL_TO_REWRITE);
+    ret.lit_id[2] = lit_cpointer_t::compress (lit_find_or_create_literal_from_num (num));
+  }
+
+  ret.lit_id[0] = dst_lit_id;
+  ret.lit_id[1] = NOT_A_LITERAL;
+
+  return ret;
+} /* optimizer_make_number_assignment */
+
+/**
+ * Skip 'nop' instructions
+ *
+ * @return position of first instruction at or after the specified position, that is not 'nop',
+ *         or number of instructions - if there is no such instruction
+ */
+static opcode_counter_t
+optimizer_skip_nops (op_meta *ops_p, /**< instructions */
+                     opcode_counter_t ops_num, /**< number of instructions */
+                     opcode_counter_t oc) /**< position */
+{
+  while (oc < ops_num && ops_p[oc].op.op_idx == OPCODE (nop))
+  {
+    oc++;
+  }
+
+  return oc;
+} /* optimizer_skip_nops */
+
+/**
+ * Get next instruction, that is not 'nop'
+ *
+ * @return position of the instruction, or number of instructions - if there is no such instruction
+ */
+static opcode_counter_t
+optimizer_next_op (op_meta *ops_p, /**< instructions */
+                   opcode_counter_t ops_num, /**< number of instructions */
+                   opcode_counter_t oc) /**< current position */
+{
+  return optimizer_skip_nops (ops_p, ops_num, (opcode_counter_t) (oc + 1));
+} /* optimizer_next_op */
+
+/**
+ * Get previous instruction, that is not 'nop'
+ *
+ * @return position of the instruction, or 0 - if there is no such instruction
+ */
+static opcode_counter_t
+optimizer_prev_op (op_meta *ops_p, /**< instructions */
+                   opcode_counter_t oc) /**< current position */
+{
+  while (oc > 0)
+  {
+    oc--;
+
+    if (ops_p[oc].op.op_idx != OPCODE (nop))
+    {
+      break;
+    }
+  }
+
+  return oc;
+} /* optimizer_prev_op */
+
+/**
+ * Check whether there are no jump targets in the (first_oc, last_oc] range
+ */
+static bool
+optimizer_is_straight_code (const bool *is_target_p, /**< jump target flags */
+                            opcode_counter_t first_oc, /**< first position */
+                            opcode_counter_t last_oc) /**< last position */
+{
+  for (opcode_counter_t oc = (opcode_counter_t) (first_oc + 1); oc <= last_oc; oc++)
+  {
+    if (is_target_p[oc])
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* optimizer_is_straight_code */
+
+/**
+ * Fill jump target flags
+ */
+static void
+optimizer_mark_targets (const opcode_counter_t *targets_p, /**< targets of the instructions */
+                        opcode_counter_t ops_num, /**< number of instructions */
+                        bool *is_target_p) /**< out: jump target flags (ops_num + 1 elements) */
+{
+  memset (is_target_p, 0, (size_t) (ops_num + 1) * sizeof (bool));
+
+  for (opcode_counter_t oc = 0; oc < ops_num; oc++)
+  {
+    if (targets_p[oc] <= ops_num)
+    {
+      is_target_p[targets_p[oc]] = true;
+    }
+  }
+} /* optimizer_mark_targets */
+
+/**
+ * Thread jumps, targeting unconditional jumps, and invert conditional jumps over unconditional jumps
+ *
+ *  - if (cond) goto L1; ... L1: goto L2;          ->  if (cond) goto L2;
+ *  - if (cond) goto L1; goto L2; L1: ...          ->  if (!cond) goto L2; L1: ...
+ *  - goto L1; L1: ...                             ->  L1: ...
+ *
+ * @return true - if the instructions were changed,
+ *         false - otherwise.
+ */
+static bool
+optimizer_optimize_jumps (op_meta *ops_p, /**< instructions */
+                          opcode_counter_t *targets_p, /**< targets of the instructions */
+                          bool *is_target_p, /**< jump target flags */
+                          opcode_counter_t ops_num) /**< number of instructions */
+{
+  bool is_changed = false;
+
+  for (opcode_counter_t oc = 0; oc < ops_num; oc++)
+  {
+    op_meta *om_p = ops_p + oc;
+
+    if (!optimizer_is_plain_jump (om_p) && !optimizer_is_conditional_jump (om_p))
+    {
+      continue;
+    }
+
+    /* the chain is threaded only if it ends at an instruction, other than unconditional jump,
+     * so cyclic chains are left as is */
+    opcode_counter_t target = optimizer_skip_nops (ops_p, ops_num, targets_p[oc]);
+    for (uint32_t hops = 0;
+         hops < OPTIMIZER_MAX_THREADED_JUMPS && target < ops_num && optimizer_is_plain_jump (ops_p + target);
+         hops++)
+    {
+      target = optimizer_skip_nops (ops_p, ops_num, targets_p[target]);
+    }
+
+    if (target != targets_p[oc]
+        && (target >= ops_num || !optimizer_is_plain_jump (ops_p + target)))
+    {
+      targets_p[oc] = target;
+      is_target_p[target] = true;
+
+      is_changed = true;
+    }
+
+    const opcode_counter_t next_oc = optimizer_next_op (ops_p, ops_num, oc);
+    const opcode_counter_t target_oc = optimizer_skip_nops (ops_p, ops_num, targets_p[oc]);
+
+    if (optimizer_is_conditional_jump (om_p)
+        && next_oc < ops_num
+        && optimizer_is_plain_jump (ops_p + next_oc)
+        && !is_target_p[next_oc]
+        && targets_p[next_oc] != next_oc
+        && optimizer_next_op (ops_p, ops_num, next_oc) == target_oc)
+    {
+      if (om_p->op.op_idx == OPCODE (is_true_jmp_down) || om_p->op.op_idx == OPCODE (is_true_jmp_up))
+      {
+        om_p->op.op_idx = OPCODE (is_false_jmp_down);
+      }
+      else
+      {
+        om_p->op.op_idx = OPCODE (is_true_jmp_down);
+      }
+
+      targets_p[oc] = targets_p[next_oc];
+      is_target_p[targets_p[oc]] = true;
+
+      ops_p[next_oc].op = getop_nop ();
+      targets_p[next_oc] = OPTIMIZER_NO_TARGET;
+
+      is_changed = true;
+    }
+    else if (optimizer_is_plain_jump (om_p)
+             && next_oc == target_oc)
+    {
+      om_p->op = getop_nop ();
+      targets_p[oc] = OPTIMIZER_NO_TARGET;
+
+      is_changed = true;
+    }
+  }
+
+  if (is_changed)
+  {
+    optimizer_mark_targets (targets_p, ops_num, is_target_p);
+  }
+
+  return is_changed;
+} /* optimizer_optimize_jumps */
+
+/**
+ * Fold arithmetic on constants, forward variable reads to operations and merge moves with operations
+ *
+ *  - tmpA = c1; tmpB = c2; dst = tmpA op tmpB;    ->  dst = (c1 op c2);
+ *  - tmpA = var; [tmpB = c;] dst = tmpA op ...;   ->  [tmpB = c;] dst = var op ...;
+ *  - tmpA = op (...); var = tmpA;                 ->  var = op (...);
+ *
+ * where the temporary registers are not used after the sequences, and there are no jump targets
+ * inside of the sequences.
+ *
+ * @return true - if the instructions were changed,
+ *         false - otherwise.
+ */
+static bool
+optimizer_optimize_values (op_meta *ops_p, /**< instructions */
+                           const opcode_counter_t *targets_p, /**< targets of the instructions */
+                           const bool *is_target_p, /**< jump target flags */
+                           opcode_counter_t ops_num) /**< number of instructions */
+{
+  bool is_changed = false;
+
+  opcode_counter_t oc = 0;
+  while (oc < ops_num)
+  {
+    op_meta *om_p = ops_p + oc;
+
+    idx_t left_reg, right_reg;
+    ecma_number_t left_num, right_num, res_num;
+
+    const opcode_counter_t next_oc = optimizer_next_op (ops_p, ops_num, oc);
+    if (next_oc >= ops_num)
+    {
+      break;
+    }
+
+    op_meta *next_om_p = ops_p + next_oc;
+
+    if (optimizer_get_number_assignment (om_p, &left_reg, &left_num)
+        && optimizer_get_number_assignment (next_om_p, &right_reg, &right_num)
+        && left_reg != right_reg)
+    {
+      const opcode_counter_t op_oc = optimizer_next_op (ops_p, ops_num, next_oc);
+      op_meta *op_om_p = ops_p + op_oc;
+
+      if (op_oc < ops_num
+          && optimizer_get_dst_first_args_num (op_om_p) == 3
+          && optimizer_is_arg_general_reg (op_om_p, 1)
+          && optimizer_is_arg_general_reg (op_om_p, 2)
+          && optimizer_get_arg (op_om_p, 1) == left_reg
+          && optimizer_get_arg (op_om_p, 2) == right_reg
+          && optimizer_is_straight_code (is_target_p, oc, op_oc)
+          && optimizer_fold_binary_op (op_om_p->op.op_idx, left_num, right_num, &res_num)
+          && (optimizer_get_arg (op_om_p, 0) == left_reg
+              || optimizer_is_reg_dead (ops_p, targets_p, ops_num, op_oc + 1u, left_reg))
+          && (optimizer_get_arg (op_om_p, 0) == right_reg
+              || optimizer_is_reg_dead (ops_p, targets_p, ops_num, op_oc + 1u, right_reg)))
+      {
+#ifdef VM_PROFILE
+        const uint16_t line = op_om_p->line;
+#endif /* VM_PROFILE */
+        ops_p[op_oc] = optimizer_make_number_assignment (optimizer_get_arg (op_om_p, 0), op_om_p->lit_id[0], res_num);
+#ifdef VM_PROFILE
+        ops_p[op_oc].line = line;
+#endif /* VM_PROFILE */
+        om_p->op = getop_nop ();
+        next_om_p->op = getop_nop ();
+
+        /* the result can be folded further together with preceding assignment */
+        oc = optimizer_prev_op (ops_p, oc);
+        is_changed = true;
+        continue;
+      }
+    }
+
+    if (om_p->op.op_idx == OPCODE (assignment)
+        && om_p->op.data.assignment.type_value_right == OPCODE_ARG_TYPE_VARIABLE
+        && om_p->lit_id[2].packed_value != MEM_CP_NULL
+        && optimizer_is_arg_general_reg (om_p, 0))
+    {
+      const idx_t reg = optimizer_get_arg (om_p, 0);
+
+      opcode_counter_t op_oc = next_oc;
+      while (op_oc < ops_num
+             && optimizer_get_number_assignment (ops_p + op_oc, &right_reg, &right_num)
+             && right_reg != reg)
+      {
+        op_oc = optimizer_next_op (ops_p, ops_num, op_oc);
+      }
+
+      op_meta *op_om_p = ops_p + op_oc;
+
+      if (op_oc < ops_num
+          && optimizer_get_dst_first_args_num (op_om_p) == 3
+          && optimizer_is_reg_read (op_om_p, reg)
+          && optimizer_is_straight_code (is_target_p, oc, op_oc)
+          && (optimizer_get_arg (op_om_p, 0) == reg
+              || optimizer_is_reg_dead (ops_p, targets_p, ops_num, op_oc + 1u, reg)))
+      {
+        for (uint8_t arg_index = 1; arg_index < 3; arg_index++)
+        {
+          if (optimizer_get_arg (op_om_p, arg_index) == reg
+              && op_om_p->lit_id[arg_index].packed_value == MEM_CP_NULL)
+          {
+            optimizer_set_arg (op_om_p, arg_index, LITERAL_TO_REWRITE);
+            op_om_p->lit_id[arg_index] = om_p->lit_id[2];
+          }
+        }
+
+        om_p->op = getop_nop ();
+
+        oc = next_oc;
+        is_changed = true;
+        continue;
+      }
+    }
+
+    if (optimizer_is_dst_first_op (om_p)
+        && optimizer_is_arg_general_reg (om_p, 0)
+        && next_om_p->op.op_idx == OPCODE (assignment)
+        && next_om_p->op.data.assignment.type_value_right == OPCODE_ARG_TYPE_VARIABLE
+        && optimizer_is_arg_general_reg (next_om_p, 2)
+        && optimizer_get_arg (next_om_p, 2) == optimizer_get_arg (om_p, 0)
+        && optimizer_is_straight_code (is_target_p, oc, next_oc)
+        && optimizer_is_reg_dead (ops_p, targets_p, ops_num, next_oc + 1u, optimizer_get_arg (om_p, 0)))
+    {
+      optimizer_set_arg (om_p, 0, optimizer_get_arg (next_om_p, 0));
+      om_p->lit_id[0] = next_om_p->lit_id[0];
+      next_om_p->op = getop_nop ();
+
+      /* the merged instruction can be merged further with following move */
+      is_changed = true;
+      continue;
+    }
+
+    oc = next_oc;
+  }
+
+  return is_changed;
+} /* optimizer_optimize_values */
+
+/**
+ * Remove 'nop' instructions, moving the other instructions to their new positions and updating offsets
+ *
+ * @return new number of instructions
+ */
+static opcode_counter_t
+optimizer_write_back (op_meta *ops_p, /**< instructions */
+                      const opcode_counter_t *targets_p, /**< targets of the instructions */
+                      opcode_counter_t ops_num) /**< number of instructions */
+{
+  /* new position of each instruction, i.e. number of instructions before it, that are not removed */
+  opcode_counter_t *new_pos_p = (opcode_counter_t *) jsp_mm_alloc ((size_t) (ops_num + 1)
+                                                                   * sizeof (opcode_counter_t));
+
+  opcode_counter_t new_ops_num = 0;
+  for (opcode_counter_t oc = 0; oc < ops_num; oc++)
+  {
+    new_pos_p[oc] = new_ops_num;
+
+    if (ops_p[oc].op.op_idx != OPCODE (nop))
+    {
+      new_ops_num++;
+    }
+  }
+  new_pos_p[ops_num] = new_ops_num;
+
+  for (opcode_counter_t oc = 0; oc < ops_num; oc++)
+  {
+    op_meta *om_p = ops_p + oc;
+
+    if (om_p->op.op_idx == OPCODE (nop))
+    {
+      continue;
+    }
+
+    const opcode_counter_t new_oc = new_pos_p[oc];
+
+    uint8_t arg_index;
+    bool is_backward;
+    if (optimizer_get_offset_arg (om_p, &arg_index, &is_backward))
+    {
+      opcode_counter_t offset;
+      const opcode_counter_t new_target = new_pos_p[targets_p[oc]];
+
+      if (new_target > new_oc)
+      {
+        offset = (opcode_counter_t) (new_target - new_oc);
+
+        if (om_p->op.op_idx == OPCODE (jmp_up))
+        {
+          om_p->op.op_idx = OPCODE (jmp_down);
+        }
+        else if (om_p->op.op_idx == OPCODE (is_true_jmp_up))
+        {
+          om_p->op.op_idx = OPCODE (is_true_jmp_down);
+        }
+        else if (om_p->op.op_idx == OPCODE (is_false_jmp_up))
+        {
+          om_p->op.op_idx = OPCODE (is_false_jmp_down);
+        }
+        else
+        {
+          JERRY_ASSERT (!is_backward);
+        }
+      }
+      else
+      {
+        offset = (opcode_counter_t) (new_oc - new_target);
+
+        if (om_p->op.op_idx == OPCODE (jmp_down))
+        {
+          om_p->op.op_idx = OPCODE (jmp_up);
+        }
+        else if (om_p->op.op_idx == OPCODE (is_true_jmp_down))
+        {
+          om_p->op.op_idx = OPCODE (is_true_jmp_up);
+        }
+        else if (om_p->op.op_idx == OPCODE (is_false_jmp_down))
+        {
+          om_p->op.op_idx = OPCODE (is_false_jmp_up);
+        }
+        else
+        {
+          JERRY_ASSERT (is_backward || offset == 0);
+        }
+      }
+
+      JERRY_ASSERT (offset < OPCODE_COUNTER_MAX_SHORT_VALUE);
+
+      optimizer_set_arg (om_p, arg_index, (idx_t) (offset >> JERRY_BITSINBYTE));
+      optimizer_set_arg (om_p, (uint8_t) (arg_index + 1), (idx_t) (offset & ((1 << JERRY_BITSINBYTE) - 1)));
+    }
+
+    ops_p[new_oc] = *om_p;
+  }
+
+  jsp_mm_free (new_pos_p);
+
+  return new_ops_num;
+} /* optimizer_write_back */
+
+/**
+ * Peephole optimization of instructions of a source
+ *
+ * Note:
+ *      the instructions are optimized in place, with removed instructions excluded from the array
+ *
+ * Note:
+ *      the source should contain less than OPCODE_COUNTER_MAX_SHORT_VALUE instructions,
+ *      as long offsets are not supported by the optimizer.
+ *
+ * @return true - if the instructions were changed,
+ *         false - otherwise.
+ */
+bool
+optimizer_optimize_instructions (op_meta *ops_p, /**< instructions */
+                                 opcode_counter_t *ops_num_p) /**< in-out: number of instructions */
+{
+  const opcode_counter_t ops_num = *ops_num_p;
+
+  /* long offsets are not supported by the optimizer */
+  JERRY_ASSERT (ops_num < OPCODE_COUNTER_MAX_SHORT_VALUE);
+
+  if (ops_num == 0)
+  {
+    return false;
+  }
+
+  opcode_counter_t *targets_p = (opcode_counter_t *) jsp_mm_alloc (ops_num * sizeof (opcode_counter_t));
+  bool *is_target_p = (bool *) jsp_mm_alloc ((size_t) (ops_num + 1) * sizeof (bool));
+  bool is_changed = false;
+
+  optimizer_visit_marks_p = (uint32_t *) jsp_mm_alloc (ops_num * sizeof (uint32_t));
+  memset (optimizer_visit_marks_p, 0, ops_num * sizeof (uint32_t));
+  optimizer_visit_mark = 0;
+
+  for (opcode_counter_t oc = 0; oc < ops_num; oc++)
+  {
+    op_meta *om_p = ops_p + oc;
+
+    targets_p[oc] = OPTIMIZER_NO_TARGET;
+
+    uint8_t arg_index;
+    bool is_backward;
+    if (optimizer_get_offset_arg (om_p, &arg_index, &is_backward))
+    {
+      const idx_t offset_idx1 = optimizer_get_arg (om_p, arg_index);
+      const idx_t offset_idx2 = optimizer_get_arg (om_p, (uint8_t) (arg_index + 1));
+      const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (NULL, offset_idx1, offset_idx2);
+      JERRY_ASSERT (offset < OPCODE_COUNTER_MAX_SHORT_VALUE);
+
+      if (is_backward)
+      {
+        JERRY_ASSERT (offset <= oc);
+        targets_p[oc] = (opcode_counter_t) (oc - offset);
+      }
+      else
+      {
+        JERRY_ASSERT (oc + offset <= ops_num);
+        targets_p[oc] = (opcode_counter_t) (oc + offset);
+      }
+    }
+  }
+
+  optimizer_mark_targets (targets_p, ops_num, is_target_p);
+
+  bool is_changed_at_iteration;
+  do
+  {
+    is_changed_at_iteration = optimizer_optimize_jumps (ops_p, targets_p, is_target_p, ops_num);
+    is_changed_at_iteration = (optimizer_optimize_values (ops_p, targets_p, is_target_p, ops_num)
+                               || is_changed_at_iteration);
+
+    is_changed = is_changed || is_changed_at_iteration;
+  }
+  while (is_changed_at_iteration);
+
+  if (is_changed)
+  {
+    *ops_num_p = optimizer_write_back (ops_p, targets_p, ops_num);
+  }
+
+  jsp_mm_free (optimizer_visit_marks_p);
+  optimizer_visit_marks_p = NULL;
+
+  jsp_mm_free (is_target_p);
+  jsp_mm_free (targets_p);
+
+  return is_changed;
+} /* optimizer_optimize_instructions */
+
+#endif /* !CONFIG_PARSER_BYTECODE_OPTIMIZER_DISABLE */
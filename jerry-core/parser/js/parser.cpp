@@ -14,9 +14,11 @@
  * limitations under the License.
  */
 
+#include "array-list.h"
 #include "ecma-helpers.h"
 #include "hash-table.h"
 #include "jrt-libc-includes.h"
+#include "jsp-eval-cache.h"
 #include "jsp-label.h"
 #include "jsp-mm.h"
 #include "opcodes.h"
@@ -24,9 +26,8 @@
 #include "opcodes-native-call.h"
 #include "parser.h"
 #include "re-parser.h"
-#include "scopes-tree.h"
+#include "scanner.h"
 #include "serializer.h"
-#include "stack.h"
 #include "syntax-errors.h"
 #include "vm.h"
 
@@ -47,16 +48,35 @@ typedef enum
   JSP_EVAL_RET_STORE_DUMP, /**< dump */
 } jsp_eval_ret_store_t;
 
+/**
+ * Declarations of a scope (global code, eval code or function's body), collected during the scope's parse
+ *
+ * See also:
+ *          jsp_start_scope_declarations, jsp_finish_scope_declarations
+ */
+typedef struct jsp_scope_decls_t
+{
+  struct jsp_scope_decls_t *prev_scope_decls_p; /**< declarations of the enclosing scope */
+  array_list var_names; /**< names of declared variables (lit_cpointer_t), or null_list - if there are none */
+#ifdef VM_PROFILE
+  array_list var_lines; /**< numbers of source lines of the variables' declarations (uint32_t) */
+#endif /* VM_PROFILE */
+  array_list func_decls; /**< positions of 'func_decl_n' instructions of the scope's function declarations
+                          *   (opcode_counter_t), or null_list - if there are none */
+  opcode_counter_t scope_code_flags_oc; /**< position of 'meta' instruction for the scope's code flags */
+  opcode_counter_t scope_decls_oc; /**< position of 'meta' instruction, referencing the scope's declarations table */
+  bool is_use_strict; /**< the scope starts with 'use strict' directive */
+  bool is_ref_arguments_identifier; /**< 'arguments' identifier is referenced in the scope */
+  bool is_ref_eval_identifier; /**< 'eval' identifier is referenced in the scope */
+} jsp_scope_decls_t;
+
 static token tok;
+static jsp_scope_decls_t *current_scope_decls_p = NULL;
 static bool inside_eval = false;
 static bool inside_function = false;
+static bool inside_strict_mode_code = false;
 static bool parser_show_opcodes = false;
-
-enum
-{
-  scopes_global_size
-};
-STATIC_STACK (scopes, scopes_tree)
+static bool parser_parse_functions_lazily = false;
 
 #define EMIT_ERROR(MESSAGE) PARSE_ERROR(MESSAGE, tok.loc)
 #define EMIT_SORRY(MESSAGE) PARSE_SORRY(MESSAGE, tok.loc)
@@ -68,7 +88,7 @@ static operand parse_expression (bool, jsp_eval_ret_store_t);
 static void parse_statement (jsp_label_t *outermost_stmt_label_p);
 static operand parse_assignment_expression (bool);
 static void parse_source_element_list (bool);
-static operand parse_argument_list (varg_list_type, operand, uint8_t *, operand *);
+static operand parse_argument_list (varg_list_type, operand, idx_t *, operand *);
 
 static bool
 token_is (token_type tt)
@@ -79,7 +99,7 @@ token_is (token_type tt)
 static uint16_t
 token_data (void)
 {
-  return tok.uid;
+  return (uint16_t) tok.uid;
 }
 
 /**
@@ -100,6 +120,21 @@ static void
 skip_token (void)
 {
   tok = lexer_next_token ();
+
+  if (tok.type == TOK_NAME
+      && current_scope_decls_p != NULL)
+  {
+    literal_t lit_p = lit_get_literal_by_cp (token_data_as_lit_cp ());
+
+    if (lit_literal_equal_type_cstr (lit_p, "arguments"))
+    {
+      current_scope_decls_p->is_ref_arguments_identifier = true;
+    }
+    else if (lit_literal_equal_type_cstr (lit_p, "eval"))
+    {
+      current_scope_decls_p->is_ref_eval_identifier = true;
+    }
+  }
 }
 
 static void
@@ -170,7 +205,7 @@ token_after_newlines_must_be_keyword (keyword kw)
 static bool
 is_strict_mode (void)
 {
-  return scopes_tree_strict_mode (STACK_TOP (scopes));
+  return inside_strict_mode_code;
 }
 
 /**
@@ -222,6 +257,76 @@ jsp_skip_braces (token_type brace_type) /**< type of the opening brace */
   current_token_must_be (closing_bracket_type);
 } /* jsp_skip_braces */
 
+/**
+ * Check whether compilation of the function's body, that is going to be parsed, is deferred
+ * till the function's first call
+ *
+ * @return true - if the body should be skipped (see also: jsp_skip_function_body),
+ *         false - if the body should be compiled at once.
+ */
+static bool
+jsp_is_function_body_skipped (void)
+{
+  /* if the table of lazily compiled bodies is full, the body is compiled at once */
+  return (parser_parse_functions_lazily
+          && serializer_can_register_lazy_function_body ());
+} /* jsp_is_function_body_skipped */
+
+/**
+ * Skip body of a function, deferring the body's compilation till the function's first call
+ *
+ * Note:
+ *      the skipped body is checked for a subset of early errors (see also: scanner_skip_function_body),
+ *      the body's other early errors are reported upon its compilation (see also: ecma_op_function_call)
+ *
+ * Note:
+ *      opening brace of the body should be set as current token when the routine is called,
+ *      and the body's closing brace is current token upon return from the routine
+ */
+static void
+jsp_skip_function_body (void)
+{
+  current_token_must_be (TOK_OPEN_BRACE);
+
+  const locus body_start_loc = tok.loc + 1;
+
+  /* the body's source can be larger than the source buffer (see also: jerry_parse_from_reader) */
+  lexer_start_source_capture (body_start_loc);
+
+  scanner_function_body_info_t body_info;
+  tok = scanner_skip_function_body (is_strict_mode (), &body_info);
+
+  JERRY_ASSERT (token_is (TOK_CLOSE_BRACE) && tok.loc >= body_start_loc);
+
+  size_t body_source_size;
+  const lit_utf8_byte_t *body_source_p = lexer_get_captured_source (tok.loc, &body_source_size);
+
+  const uint16_t body_index = serializer_register_lazy_function_body (body_source_p,
+                                                                      (lit_utf8_size_t) body_source_size);
+  lexer_stop_source_capture ();
+
+  opcode_scope_code_flags_t scope_flags = OPCODE_SCOPE_CODE_FLAGS__EMPTY;
+
+  if (body_info.is_use_strict)
+  {
+    inside_strict_mode_code = true;
+    scope_flags = (opcode_scope_code_flags_t) (scope_flags | OPCODE_SCOPE_CODE_FLAGS_STRICT);
+  }
+
+  if (!body_info.is_ref_arguments_identifier)
+  {
+    scope_flags = (opcode_scope_code_flags_t) (scope_flags | OPCODE_SCOPE_CODE_FLAGS_NOT_REF_ARGUMENTS_IDENTIFIER);
+  }
+
+  if (!body_info.is_ref_eval_identifier)
+  {
+    scope_flags = (opcode_scope_code_flags_t) (scope_flags | OPCODE_SCOPE_CODE_FLAGS_NOT_REF_EVAL_IDENTIFIER);
+  }
+
+  rewrite_scope_code_flags (dump_scope_code_flags_for_rewrite (), scope_flags);
+  dump_lazy_function_body (body_index);
+} /* jsp_skip_function_body */
+
 /**
  * Find next token of specified type before the specified location
  *
@@ -256,7 +361,7 @@ jsp_find_next_token_before_the_locus (token_type token_to_find, /**< token to se
         if (tok.loc >= end_loc)
         {
           lexer_seek (end_loc);
-          tok = lexer_next_token ();
+          skip_token ();
 
           return false;
         }
@@ -383,8 +488,8 @@ parse_property_assignment (void)
 
     dump_function_end_for_rewrite ();
 
-    const bool is_strict = scopes_tree_strict_mode (STACK_TOP (scopes));
-    scopes_tree_set_strict_mode (STACK_TOP (scopes), false);
+    const bool is_strict = inside_strict_mode_code;
+    inside_strict_mode_code = false;
 
     token_after_newlines_must_be (TOK_OPEN_BRACE);
     skip_newlines ();
@@ -400,15 +505,14 @@ parse_property_assignment (void)
 
     token_after_newlines_must_be (TOK_CLOSE_BRACE);
 
-    scopes_tree_set_strict_mode (STACK_TOP (scopes), is_strict);
+    inside_strict_mode_code = is_strict;
 
-    dump_ret ();
-    rewrite_function_end (VARG_FUNC_EXPR);
+    rewrite_function_end ();
 
     inside_function = was_in_function;
 
-    scopes_tree_set_strict_mode (STACK_TOP (scopes), is_outer_scope_strict);
-    lexer_set_strict_mode (scopes_tree_strict_mode (STACK_TOP (scopes)));
+    inside_strict_mode_code = is_outer_scope_strict;
+    lexer_set_strict_mode (is_strict_mode ());
 
     if (is_setter)
     {
@@ -429,10 +533,10 @@ parse_property_assignment (void)
     For each ALT dumps appropriate bytecode. Uses OBJ during dump if neccesary.
     Result tmp. */
 static operand
-parse_argument_list (varg_list_type vlt, operand obj, uint8_t *args_count, operand *this_arg_p)
+parse_argument_list (varg_list_type vlt, operand obj, idx_t *args_count, operand *this_arg_p)
 {
   token_type close_tt = TOK_CLOSE_PAREN;
-  uint8_t args_num = 0;
+  idx_t args_num = 0;
 
   JERRY_ASSERT (!(vlt != VARG_CALL_EXPR && this_arg_p != NULL));
 
@@ -575,6 +679,10 @@ parse_argument_list (varg_list_type vlt, operand obj, uint8_t *args_count, opera
       current_token_must_be (close_tt);
     }
 
+    if (args_num == UINT16_MAX)
+    {
+      PARSE_ERROR ("Too many elements in the list", tok.loc);
+    }
     args_num++;
 
     dumper_finish_varg_code_sequence ();
@@ -622,8 +730,6 @@ parse_argument_list (varg_list_type vlt, operand obj, uint8_t *args_count, opera
 static void
 parse_function_declaration (void)
 {
-  STACK_DECLARE_USAGE (scopes);
-
   assert_keyword (KW_FUNCTION);
 
   jsp_label_t *masked_label_set_p = jsp_label_mask_set ();
@@ -634,10 +740,18 @@ parse_function_declaration (void)
   syntax_check_for_eval_and_arguments_in_strict_mode (name, is_strict_mode (), tok.loc);
 
   skip_newlines ();
-  STACK_PUSH (scopes, scopes_tree_init (STACK_TOP (scopes)));
-  serializer_set_scope (STACK_TOP (scopes));
-  scopes_tree_set_strict_mode (STACK_TOP (scopes), scopes_tree_strict_mode (STACK_HEAD (scopes, 2)));
-  lexer_set_strict_mode (scopes_tree_strict_mode (STACK_TOP (scopes)));
+
+  const bool is_outer_scope_strict = is_strict_mode ();
+
+  /* the function is instantiated upon entering the enclosing scope (see also: jsp_finish_scope_declarations) */
+  JERRY_ASSERT (current_scope_decls_p != NULL);
+  if (current_scope_decls_p->func_decls == null_list)
+  {
+    current_scope_decls_p->func_decls = array_list_init (sizeof (opcode_counter_t));
+  }
+
+  opcode_counter_t func_decl_oc = serializer_get_current_opcode_counter ();
+  current_scope_decls_p->func_decls = array_list_append (current_scope_decls_p->func_decls, &func_decl_oc);
 
   syntax_start_checking_of_vargs ();
   parse_argument_list (VARG_FUNC_DECL, name, NULL, NULL);
@@ -645,29 +759,33 @@ parse_function_declaration (void)
   dump_function_end_for_rewrite ();
 
   token_after_newlines_must_be (TOK_OPEN_BRACE);
-  skip_newlines ();
 
-  bool was_in_function = inside_function;
-  inside_function = true;
+  if (jsp_is_function_body_skipped ())
+  {
+    jsp_skip_function_body ();
+  }
+  else
+  {
+    skip_newlines ();
 
-  parse_source_element_list (false);
+    bool was_in_function = inside_function;
+    inside_function = true;
 
-  next_token_must_be (TOK_CLOSE_BRACE);
+    parse_source_element_list (false);
 
-  dump_ret ();
-  rewrite_function_end (VARG_FUNC_DECL);
+    next_token_must_be (TOK_CLOSE_BRACE);
 
-  inside_function = was_in_function;
+    inside_function = was_in_function;
+  }
+
+  rewrite_function_end ();
 
   syntax_check_for_syntax_errors_in_formal_param_list (is_strict_mode (), tok.loc);
 
-  STACK_DROP (scopes, 1);
-  serializer_set_scope (STACK_TOP (scopes));
-  lexer_set_strict_mode (scopes_tree_strict_mode (STACK_TOP (scopes)));
+  inside_strict_mode_code = is_outer_scope_strict;
+  lexer_set_strict_mode (is_strict_mode ());
 
   jsp_label_restore_set (masked_label_set_p);
-
-  STACK_CHECK_USAGE (scopes);
 }
 
 /* function_expression
@@ -703,29 +821,35 @@ parse_function_expression (void)
   dump_function_end_for_rewrite ();
 
   token_after_newlines_must_be (TOK_OPEN_BRACE);
-  skip_newlines ();
 
-  bool was_in_function = inside_function;
-  inside_function = true;
+  if (jsp_is_function_body_skipped ())
+  {
+    jsp_skip_function_body ();
+  }
+  else
+  {
+    skip_newlines ();
 
-  jsp_label_t *masked_label_set_p = jsp_label_mask_set ();
+    bool was_in_function = inside_function;
+    inside_function = true;
 
-  parse_source_element_list (false);
+    jsp_label_t *masked_label_set_p = jsp_label_mask_set ();
 
-  jsp_label_restore_set (masked_label_set_p);
+    parse_source_element_list (false);
 
+    jsp_label_restore_set (masked_label_set_p);
 
-  next_token_must_be (TOK_CLOSE_BRACE);
+    next_token_must_be (TOK_CLOSE_BRACE);
 
-  dump_ret ();
-  rewrite_function_end (VARG_FUNC_EXPR);
+    inside_function = was_in_function;
+  }
 
-  inside_function = was_in_function;
+  rewrite_function_end ();
 
   syntax_check_for_syntax_errors_in_formal_param_list (is_strict_mode (), tok.loc);
 
-  scopes_tree_set_strict_mode (STACK_TOP (scopes), is_outer_scope_strict);
-  lexer_set_strict_mode (scopes_tree_strict_mode (STACK_TOP (scopes)));
+  inside_strict_mode_code = is_outer_scope_strict;
+  lexer_set_strict_mode (is_strict_mode ());
 
   return res;
 }
@@ -1022,6 +1146,11 @@ parse_postfix_expression (void)
   skip_token ();
   if (token_is (TOK_DOUBLE_PLUS))
   {
+    if (!dumper_is_possible_reference (expr))
+    {
+      EMIT_ERROR ("Invalid left-hand side expression");
+    }
+
     syntax_check_for_eval_and_arguments_in_strict_mode (expr, is_strict_mode (), tok.loc);
 
     const operand res = dump_post_increment_res (expr);
@@ -1033,6 +1162,11 @@ parse_postfix_expression (void)
   }
   else if (token_is (TOK_DOUBLE_MINUS))
   {
+    if (!dumper_is_possible_reference (expr))
+    {
+      EMIT_ERROR ("Invalid left-hand side expression");
+    }
+
     syntax_check_for_eval_and_arguments_in_strict_mode (expr, is_strict_mode (), tok.loc);
 
     const operand res = dump_post_decrement_res (expr);
@@ -1064,6 +1198,12 @@ parse_unary_expression (operand *this_arg_gl, operand *prop_gl)
     {
       skip_newlines ();
       expr = parse_unary_expression (&this_arg, &prop);
+
+      if (!dumper_is_possible_reference (expr))
+      {
+        EMIT_ERROR ("Invalid left-hand side expression");
+      }
+
       syntax_check_for_eval_and_arguments_in_strict_mode (expr, is_strict_mode (), tok.loc);
       expr = dump_pre_increment_res (expr);
       if (!operand_is_empty (this_arg) && !operand_is_empty (prop))
@@ -1076,6 +1216,12 @@ parse_unary_expression (operand *this_arg_gl, operand *prop_gl)
     {
       skip_newlines ();
       expr = parse_unary_expression (&this_arg, &prop);
+
+      if (!dumper_is_possible_reference (expr))
+      {
+        EMIT_ERROR ("Invalid left-hand side expression");
+      }
+
       syntax_check_for_eval_and_arguments_in_strict_mode (expr, is_strict_mode (), tok.loc);
       expr = dump_pre_decrement_res (expr);
       if (!operand_is_empty (this_arg) && !operand_is_empty (prop))
@@ -1640,6 +1786,11 @@ parse_assignment_expression (bool in_allowed)
       || tt == TOK_XOR_EQ
       || tt == TOK_OR_EQ)
   {
+    if (!dumper_is_possible_reference (expr))
+    {
+      EMIT_ERROR ("Invalid left-hand side expression");
+    }
+
     syntax_check_for_eval_and_arguments_in_strict_mode (expr, is_strict_mode (), tok.loc);
     skip_newlines ();
     start_dumping_assignment_expression ();
@@ -1744,6 +1895,47 @@ parse_expression (bool in_allowed, /**< flag indicating if 'in' is allowed insid
   return expr;
 } /* parse_expression */
 
+/**
+ * Register variable declaration in current scope
+ */
+static void
+jsp_declare_variable (lit_cpointer_t var_name_cp) /**< variable's name */
+{
+  JERRY_ASSERT (current_scope_decls_p != NULL);
+
+  array_list var_names = current_scope_decls_p->var_names;
+
+  if (var_names == null_list)
+  {
+    var_names = array_list_init (sizeof (lit_cpointer_t));
+  }
+  else
+  {
+    const size_t var_names_num = array_list_len (var_names);
+
+    for (size_t index = 0; index < var_names_num; index++)
+    {
+      if (((lit_cpointer_t *) array_list_element (var_names, index))->packed_value == var_name_cp.packed_value)
+      {
+        return;
+      }
+    }
+  }
+
+  current_scope_decls_p->var_names = array_list_append (var_names, &var_name_cp);
+
+#ifdef VM_PROFILE
+  /* 'var_decl' instructions are inserted upon the scope's end, so the declaration's line is remembered */
+  if (current_scope_decls_p->var_lines == null_list)
+  {
+    current_scope_decls_p->var_lines = array_list_init (sizeof (uint32_t));
+  }
+
+  uint32_t line = lexer_get_current_line ();
+  current_scope_decls_p->var_lines = array_list_append (current_scope_decls_p->var_lines, &line);
+#endif /* VM_PROFILE */
+} /* jsp_declare_variable */
+
 /* variable_declaration
   : Identifier LT!* initialiser?
   ;
@@ -1754,7 +1946,11 @@ static operand
 parse_variable_declaration (void)
 {
   current_token_must_be (TOK_NAME);
-  const operand name = literal_operand (token_data_as_lit_cp ());
+  const lit_cpointer_t name_cp = token_data_as_lit_cp ();
+  const operand name = literal_operand (name_cp);
+
+  syntax_check_for_eval_and_arguments_in_strict_mode (name, is_strict_mode (), tok.loc);
+  jsp_declare_variable (name_cp);
 
   skip_newlines ();
   if (token_is (TOK_EQ))
@@ -1820,10 +2016,9 @@ parse_variable_declaration_list (void)
  *                        If Condition is evaluted to true, jump -> NextIteration
  */
 static void
-jsp_parse_for_statement (jsp_label_t *outermost_stmt_label_p, /**< outermost (first) label, corresponding to
+jsp_parse_for_statement (jsp_label_t *outermost_stmt_label_p) /**< outermost (first) label, corresponding to
                                                                *   the statement (or NULL, if there are no named
                                                                *   labels associated with the statement) */
-                         locus for_body_statement_loc) /**< locus of loop body statement */
 {
   current_token_must_be (TOK_OPEN_PAREN);
   skip_newlines ();
@@ -1850,26 +2045,47 @@ jsp_parse_for_statement (jsp_label_t *outermost_stmt_label_p, /**< outermost (fi
   dumper_set_next_interation_target ();
 
   current_token_must_be (TOK_SEMICOLON);
-  skip_token ();
+  skip_newlines ();
 
-  // Save Condition locus
-  const locus condition_loc = tok.loc;
+  /*
+   * Condition and Increment are dumped after Body, so their instructions are stashed while Body is parsed,
+   * and the header is parsed once (without seeking back to the header after Body is parsed)
+   */
 
-  if (!jsp_find_next_token_before_the_locus (TOK_SEMICOLON,
-                                             for_body_statement_loc,
-                                             true))
+  // Condition
+  const opcode_counter_t condition_oc = serializer_get_current_opcode_counter ();
+  operand cond;
+
+  if (token_is (TOK_SEMICOLON))
   {
-    EMIT_ERROR ("Invalid for statement");
+    cond = empty_operand ();
+  }
+  else
+  {
+    cond = parse_expression (true, JSP_EVAL_RET_STORE_NOT_DUMP);
+    skip_token ();
   }
 
   current_token_must_be (TOK_SEMICOLON);
-  skip_token ();
 
-  // Save Increment locus
-  const locus increment_loc = tok.loc;
+  const opcode_counter_t condition_instrs_num = dumper_stash_instructions (condition_oc);
+
+  skip_newlines ();
+
+  // Increment
+  const opcode_counter_t increment_oc = serializer_get_current_opcode_counter ();
+
+  if (!token_is (TOK_CLOSE_PAREN))
+  {
+    parse_expression (true, JSP_EVAL_RET_STORE_NOT_DUMP);
+    skip_token ();
+  }
+
+  current_token_must_be (TOK_CLOSE_PAREN);
+
+  const opcode_counter_t increment_instrs_num = dumper_stash_instructions (increment_oc);
 
   // Body
-  lexer_seek (for_body_statement_loc);
   skip_newlines ();
 
   parse_statement (NULL);
@@ -1882,32 +2098,14 @@ jsp_parse_for_statement (jsp_label_t *outermost_stmt_label_p, /**< outermost (fi
                                    serializer_get_current_opcode_counter ());
 
   // Increment
-  lexer_seek (increment_loc);
-  skip_newlines ();
-
-  if (!token_is (TOK_CLOSE_PAREN))
-  {
-    parse_expression (true, JSP_EVAL_RET_STORE_NOT_DUMP);
-  }
-
-  current_token_must_be (TOK_CLOSE_PAREN);
+  dump_stashed_instructions (increment_instrs_num);
 
   // Setup ConditionCheck
   rewrite_jump_to_end ();
 
   // Condition
-  lexer_seek (condition_loc);
-  skip_newlines ();
-
-  if (token_is (TOK_SEMICOLON))
-  {
-    dump_continue_iterations_check (empty_operand ());
-  }
-  else
-  {
-    operand cond = parse_expression (true, JSP_EVAL_RET_STORE_NOT_DUMP);
-    dump_continue_iterations_check (cond);
-  }
+  dump_stashed_instructions (condition_instrs_num);
+  dump_continue_iterations_check (cond);
 
   lexer_seek (loop_end_loc);
   skip_newlines ();
@@ -2005,6 +2203,10 @@ jsp_parse_for_in_statement (jsp_label_t *outermost_stmt_label_p, /**< outermost
   bool is_raised = jsp_label_raise_nested_jumpable_border ();
 
   current_token_must_be (TOK_OPEN_PAREN);
+
+  /* Iterator is parsed after Collection, so the header is retained in the source buffer till Body is reached */
+  const locus prev_pinned_loc = lexer_pin_source (tok.loc);
+
   skip_newlines ();
 
   // Save Iterator location
@@ -2044,7 +2246,7 @@ jsp_parse_for_in_statement (jsp_label_t *outermost_stmt_label_p, /**< outermost
 
   // Dump assignment VariableDeclarationNoIn / LeftHandSideExpression <- OPCODE_REG_SPECIAL_FOR_IN_PROPERTY_NAME
   lexer_seek (iterator_loc);
-  tok = lexer_next_token ();
+  skip_token ();
 
   operand iterator_base, iterator_identifier, for_in_special_reg;
   for_in_special_reg = jsp_create_operand_for_in_special_reg ();
@@ -2061,7 +2263,9 @@ jsp_parse_for_in_statement (jsp_label_t *outermost_stmt_label_p, /**< outermost
 
   // Body
   lexer_seek (for_body_statement_loc);
-  tok = lexer_next_token ();
+  skip_token ();
+
+  lexer_unpin_source (prev_pinned_loc);
 
   parse_statement (NULL);
 
@@ -2079,7 +2283,7 @@ jsp_parse_for_in_statement (jsp_label_t *outermost_stmt_label_p, /**< outermost
   dump_for_in_end ();
 
   lexer_seek (loop_end_loc);
-  tok = lexer_next_token ();
+  skip_token ();
   if (tok.type != TOK_CLOSE_BRACE)
   {
     lexer_save_token (tok);
@@ -2110,23 +2314,28 @@ jsp_parse_for_or_for_in_statement (jsp_label_t *outermost_stmt_label_p) /**< out
 
   for_open_paren_loc = tok.loc;
 
+  /* the header is scanned again, after type of the statement is determined */
+  const locus prev_pinned_loc = lexer_pin_source (for_open_paren_loc);
+
   jsp_skip_braces (TOK_OPEN_PAREN);
   skip_newlines ();
 
   for_body_statement_loc = tok.loc;
 
   lexer_seek (for_open_paren_loc);
-  tok = lexer_next_token ();
+  skip_token ();
 
   bool is_plain_for = jsp_find_next_token_before_the_locus (TOK_SEMICOLON,
                                                             for_body_statement_loc,
                                                             true);
   lexer_seek (for_open_paren_loc);
-  tok = lexer_next_token ();
+  skip_token ();
+
+  lexer_unpin_source (prev_pinned_loc);
 
   if (is_plain_for)
   {
-    jsp_parse_for_statement (outermost_stmt_label_p, for_body_statement_loc);
+    jsp_parse_for_statement (outermost_stmt_label_p);
   }
   else
   {
@@ -2237,14 +2446,15 @@ parse_while_statement (jsp_label_t *outermost_stmt_label_p) /**< outermost (firs
 {
   assert_keyword (KW_WHILE);
 
-  token_after_newlines_must_be (TOK_OPEN_PAREN);
-  const locus cond_loc = tok.loc;
-  jsp_skip_braces (TOK_OPEN_PAREN);
-
   dump_jump_to_end_for_rewrite ();
 
   dumper_set_next_interation_target ();
 
+  /* the condition is dumped after the body, so its instructions are stashed while the body is parsed */
+  const opcode_counter_t cond_oc = serializer_get_current_opcode_counter ();
+  const operand cond = parse_expression_inside_parens ();
+  const opcode_counter_t cond_instrs_num = dumper_stash_instructions (cond_oc);
+
   skip_newlines ();
   parse_statement (NULL);
 
@@ -2254,8 +2464,7 @@ parse_while_statement (jsp_label_t *outermost_stmt_label_p) /**< outermost (firs
   rewrite_jump_to_end ();
 
   const locus end_loc = tok.loc;
-  lexer_seek (cond_loc);
-  const operand cond = parse_expression_inside_parens ();
+  dump_stashed_instructions (cond_instrs_num);
   dump_continue_iterations_check (cond);
 
   lexer_seek (end_loc);
@@ -2289,21 +2498,6 @@ parse_with_statement (void)
   }
 }
 
-static void
-skip_case_clause_body (void)
-{
-  while (!is_keyword (KW_CASE)
-         && !is_keyword (KW_DEFAULT)
-         && !token_is (TOK_CLOSE_BRACE))
-  {
-    if (token_is (TOK_OPEN_BRACE))
-    {
-      jsp_skip_braces (TOK_OPEN_BRACE);
-    }
-    skip_newlines ();
-  }
-}
-
 /* switch_statement
   : 'switch' LT!* '(' LT!* expression LT!* ')' LT!* '{' LT!* case_block LT!* '}'
   ;
@@ -2322,23 +2516,27 @@ parse_switch_statement (void)
   const operand switch_expr = parse_expression_inside_parens ();
   token_after_newlines_must_be (TOK_OPEN_BRACE);
 
+  jsp_label_t label;
+  jsp_label_push (&label,
+                  JSP_LABEL_TYPE_UNNAMED_BREAKS,
+                  TOKEN_EMPTY_INITIALIZER);
+
   start_dumping_case_clauses ();
-  const locus start_loc = tok.loc;
   bool was_default = false;
-  // First, generate table of jumps
+
   skip_newlines ();
   while (is_keyword (KW_CASE) || is_keyword (KW_DEFAULT))
   {
     if (is_keyword (KW_CASE))
     {
+      start_dumping_case_clause_check ();
+
       skip_newlines ();
       const operand case_expr = parse_expression (true, JSP_EVAL_RET_STORE_NOT_DUMP);
       next_token_must_be (TOK_COLON);
       dump_case_clause_check_for_rewrite (switch_expr, case_expr);
-      skip_newlines ();
-      skip_case_clause_body ();
     }
-    else if (is_keyword (KW_DEFAULT))
+    else
     {
       if (was_default)
       {
@@ -2346,64 +2544,24 @@ parse_switch_statement (void)
       }
       was_default = true;
       token_after_newlines_must_be (TOK_COLON);
-      skip_newlines ();
-      skip_case_clause_body ();
+      dump_default_clause_check_for_rewrite ();
     }
-  }
-  current_token_must_be (TOK_CLOSE_BRACE);
 
-  if (was_default)
-  {
-    dump_default_clause_check_for_rewrite ();
-  }
-
-  lexer_seek (start_loc);
-  next_token_must_be (TOK_OPEN_BRACE);
-
-  jsp_label_t label;
-  jsp_label_push (&label,
-                  JSP_LABEL_TYPE_UNNAMED_BREAKS,
-                  TOKEN_EMPTY_INITIALIZER);
-
-  // Second, parse case clauses' bodies and rewrite jumps
-  skip_newlines ();
-  while (is_keyword (KW_CASE) || is_keyword (KW_DEFAULT))
-  {
-    if (is_keyword (KW_CASE))
+    skip_newlines ();
+    if (!is_keyword (KW_CASE)
+        && !is_keyword (KW_DEFAULT)
+        && !token_is (TOK_CLOSE_BRACE))
     {
-      while (!token_is (TOK_COLON))
-      {
-        skip_newlines ();
-      }
-      rewrite_case_clause ();
-      skip_newlines ();
-      if (is_keyword (KW_CASE) || is_keyword (KW_DEFAULT))
-      {
-        continue;
-      }
       parse_statement_list ();
-    }
-    else if (is_keyword (KW_DEFAULT))
-    {
-      token_after_newlines_must_be (TOK_COLON);
       skip_newlines ();
-      rewrite_default_clause ();
-      if (is_keyword (KW_CASE))
-      {
-        continue;
-      }
-      parse_statement_list ();
-      continue;
     }
-    skip_newlines ();
   }
   current_token_must_be (TOK_CLOSE_BRACE);
-  skip_token ();
+
+  finish_dumping_case_clauses ();
 
   jsp_label_rewrite_jumps_and_pop (&label,
                                    serializer_get_current_opcode_counter ());
-
-  finish_dumping_case_clauses ();
 }
 
 /* catch_clause
@@ -2509,7 +2667,8 @@ insert_semicolon (void)
     lexer_save_token (tok);
     return;
   }
-  if (token_is (TOK_CLOSE_BRACE))
+  if (token_is (TOK_CLOSE_BRACE)
+      || token_is (TOK_EOF))
   {
     lexer_save_token (tok);
     return;
@@ -2831,204 +2990,123 @@ parse_source_element (void)
   }
 }
 
+/**
+ * Start collection of declarations of a scope, that is going to be parsed
+ *
+ * Note:
+ *      the routine dumps the scope's header ('meta' instruction for the scope's code flags,
+ *      'reg_var_decl' instruction and 'meta' instruction, referencing the scope's declarations table),
+ *      that is completed upon the scope's end (see also: jsp_finish_scope_declarations)
+ */
 static void
-skip_optional_name_and_parens (void)
+jsp_start_scope_declarations (jsp_scope_decls_t *scope_decls_p) /**< out: descriptor of the scope's
+                                                                   *        declarations */
 {
-  if (token_is (TOK_NAME))
-  {
-    token_after_newlines_must_be (TOK_OPEN_PAREN);
-  }
-  else
-  {
-    current_token_must_be (TOK_OPEN_PAREN);
-  }
+  scope_decls_p->scope_code_flags_oc = dump_scope_code_flags_for_rewrite ();
+  scope_decls_p->is_use_strict = false;
 
-  while (!token_is (TOK_CLOSE_PAREN))
+  if (token_is (TOK_STRING) && lit_literal_equal_type_cstr (lit_get_literal_by_cp (token_data_as_lit_cp ()),
+                                                            "use strict"))
   {
-    skip_newlines ();
+    inside_strict_mode_code = true;
+    scope_decls_p->is_use_strict = true;
   }
-}
 
-static void
-skip_function (void)
-{
-  skip_newlines ();
-  skip_optional_name_and_parens ();
-  skip_newlines ();
-  jsp_skip_braces (TOK_OPEN_BRACE);
-}
+  lexer_set_strict_mode (is_strict_mode ());
 
-static bool
-var_declared (lit_cpointer_t var_cp)
-{
-  return dumper_variable_declaration_exists (var_cp);
-}
+  dump_reg_var_decl_for_rewrite ();
+
+  scope_decls_p->scope_decls_oc = dump_scope_declarations_for_rewrite ();
+  scope_decls_p->var_names = null_list;
+  scope_decls_p->func_decls = null_list;
+#ifdef VM_PROFILE
+  scope_decls_p->var_lines = null_list;
+#endif /* VM_PROFILE */
+  scope_decls_p->is_ref_arguments_identifier = false;
+  scope_decls_p->is_ref_eval_identifier = false;
+
+  scope_decls_p->prev_scope_decls_p = current_scope_decls_p;
+  current_scope_decls_p = scope_decls_p;
+} /* jsp_start_scope_declarations */
 
+/**
+ * Finish collection of declarations of the scope, that was parsed,
+ * dumping the scope's declarations table after the scope's code and writing the scope's code flags
+ *
+ * Note:
+ *      the table is processed upon entering the scope (see also: vm_run_from_pos),
+ *      so the declarations are instantiated before execution of the scope's code
+ */
 static void
-preparse_scope (bool is_global)
+jsp_finish_scope_declarations (jsp_scope_decls_t *scope_decls_p) /**< descriptor of the scope's declarations */
 {
-  const locus start_loc = tok.loc;
-  const token_type end_tt = is_global ? TOK_EOF : TOK_CLOSE_BRACE;
-
-  opcode_counter_t scope_code_flags_oc = dump_scope_code_flags_for_rewrite ();
+  JERRY_ASSERT (current_scope_decls_p == scope_decls_p);
+  current_scope_decls_p = scope_decls_p->prev_scope_decls_p;
 
-  bool is_ref_arguments_identifier = false;
-  bool is_ref_eval_identifier = false;
-  bool is_use_strict = false;
+  const lit_cpointer_t *var_names_p = NULL;
+  size_t var_names_num = 0;
+  if (scope_decls_p->var_names != null_list)
+  {
+    var_names_p = (const lit_cpointer_t *) array_list_element (scope_decls_p->var_names, 0);
+    var_names_num = array_list_len (scope_decls_p->var_names);
+  }
 
-  if (token_is (TOK_STRING) && lit_literal_equal_type_cstr (lit_get_literal_by_cp (token_data_as_lit_cp ()),
-                                                            "use strict"))
+  const opcode_counter_t *func_decls_p = NULL;
+  size_t func_decls_num = 0;
+  if (scope_decls_p->func_decls != null_list)
   {
-    scopes_tree_set_strict_mode (STACK_TOP (scopes), true);
-    is_use_strict = true;
+    func_decls_p = (const opcode_counter_t *) array_list_element (scope_decls_p->func_decls, 0);
+    func_decls_num = array_list_len (scope_decls_p->func_decls);
   }
 
-  lexer_set_strict_mode (scopes_tree_strict_mode (STACK_TOP (scopes)));
+#ifdef VM_PROFILE
+  /* the table starts with 'var_decl' instructions (see also: dump_scope_declarations) */
+  const opcode_counter_t var_decls_oc = serializer_get_current_opcode_counter ();
+#endif /* VM_PROFILE */
 
-  dump_reg_var_decl_for_rewrite ();
+  dump_scope_declarations (scope_decls_p->scope_decls_oc, var_names_p, var_names_num, func_decls_p, func_decls_num);
 
-  bool is_in_var_declaration_list = false;
-
-  size_t nesting_level = 0;
-  while (nesting_level > 0 || !token_is (end_tt))
+  if (scope_decls_p->var_names != null_list)
   {
-    /*
-     * FIXME:
-     *       Remove preparse_scope; move variable declaration search to main pass of parser.
-     *       When byte-code and scope storages would be introduced, move variable declarations
-     *       from byte-code to scope descriptor.
-     */
-    if (token_is (TOK_NAME))
-    {
-      if (lit_literal_equal_type_cstr (lit_get_literal_by_cp (token_data_as_lit_cp ()), "arguments"))
-      {
-        is_ref_arguments_identifier = true;
-      }
-      else if (lit_literal_equal_type_cstr (lit_get_literal_by_cp (token_data_as_lit_cp ()), "eval"))
-      {
-        is_ref_eval_identifier = true;
-      }
-
-      if (is_in_var_declaration_list)
-      {
-        if (!var_declared (token_data_as_lit_cp ()))
-        {
-          syntax_check_for_eval_and_arguments_in_strict_mode (literal_operand (token_data_as_lit_cp ()),
-                                                              is_strict_mode (),
-                                                              tok.loc);
-          dump_variable_declaration (token_data_as_lit_cp ());
-        }
-      }
+#ifdef VM_PROFILE
+    JERRY_ASSERT (array_list_len (scope_decls_p->var_lines) == var_names_num);
 
-      skip_newlines ();
-    }
-    else if (is_in_var_declaration_list)
+    for (size_t index = 0; index < var_names_num; index++)
     {
-      if (token_is (TOK_EQ))
-      {
-        skip_newlines ();
-
-        while (!token_is (end_tt)
-               && !token_is (TOK_COMMA)
-               && !token_is (TOK_SEMICOLON))
-        {
-          if (is_keyword (KW_FUNCTION))
-          {
-            skip_function ();
-          }
-          else if (token_is (TOK_OPEN_BRACE))
-          {
-            jsp_skip_braces (TOK_OPEN_BRACE);
-          }
-          else if (token_is (TOK_OPEN_SQUARE))
-          {
-            jsp_skip_braces (TOK_OPEN_SQUARE);
-          }
-          else if (token_is (TOK_OPEN_PAREN))
-          {
-            jsp_skip_braces (TOK_OPEN_PAREN);
-          }
-          else if (token_is (TOK_KEYWORD))
-          {
-            break;
-          }
-          else if (token_is (TOK_CLOSE_BRACE))
-          {
-            /* the '}' would be handled during next iteration, reducing nesting level counter */
-            is_in_var_declaration_list = false;
-
-            break;
-          }
+      serializer_set_instruction_line ((opcode_counter_t) (var_decls_oc + index),
+                                       *(uint32_t *) array_list_element (scope_decls_p->var_lines, index));
+    }
 
-          skip_token ();
-        }
-      }
-      else if (token_is (TOK_COMMA))
-      {
-        skip_newlines ();
-      }
-      else
-      {
-        is_in_var_declaration_list = false;
+    array_list_free (scope_decls_p->var_lines);
+#endif /* VM_PROFILE */
 
-        skip_newlines ();
-      }
-    }
-    else
-    {
-      if (token_is (TOK_OPEN_BRACE))
-      {
-        nesting_level++;
-      }
-      else if (token_is (TOK_CLOSE_BRACE))
-      {
-        nesting_level--;
-      }
-      else if (token_is (TOK_OPEN_SQUARE))
-      {
-        jsp_skip_braces (TOK_OPEN_SQUARE);
-      }
-      else if (is_keyword (KW_VAR))
-      {
-        is_in_var_declaration_list = true;
-      }
-      else if (is_keyword (KW_FUNCTION))
-      {
-        skip_function ();
-      }
+    array_list_free (scope_decls_p->var_names);
+  }
 
-      skip_newlines ();
-    }
+  if (scope_decls_p->func_decls != null_list)
+  {
+    array_list_free (scope_decls_p->func_decls);
   }
 
   opcode_scope_code_flags_t scope_flags = OPCODE_SCOPE_CODE_FLAGS__EMPTY;
 
-  if (is_use_strict)
+  if (scope_decls_p->is_use_strict)
   {
     scope_flags = (opcode_scope_code_flags_t) (scope_flags | OPCODE_SCOPE_CODE_FLAGS_STRICT);
   }
 
-  if (!is_ref_arguments_identifier)
+  if (!scope_decls_p->is_ref_arguments_identifier)
   {
     scope_flags = (opcode_scope_code_flags_t) (scope_flags | OPCODE_SCOPE_CODE_FLAGS_NOT_REF_ARGUMENTS_IDENTIFIER);
   }
 
-  if (!is_ref_eval_identifier)
+  if (!scope_decls_p->is_ref_eval_identifier)
   {
     scope_flags = (opcode_scope_code_flags_t) (scope_flags | OPCODE_SCOPE_CODE_FLAGS_NOT_REF_EVAL_IDENTIFIER);
   }
 
-  rewrite_scope_code_flags (scope_code_flags_oc, scope_flags);
-
-  if (start_loc != tok.loc)
-  {
-    lexer_seek (start_loc);
-  }
-  else
-  {
-    lexer_save_token (tok);
-  }
-}
+  rewrite_scope_code_flags (scope_decls_p->scope_code_flags_oc, scope_flags);
+} /* jsp_finish_scope_declarations */
 
 /**
  * Parse source element list
@@ -3036,12 +3114,19 @@ preparse_scope (bool is_global)
  *  source_element_list
  *   : source_element (LT!* source_element)*
  *   ;
+ *
+ * Note:
+ *      the source is parsed in single pass, with instructions emitted in their final order;
+ *      declarations of the scope are collected during the pass and are dumped as the scope's declarations table
+ *      after the scope's final return instruction
  */
 static void
 parse_source_element_list (bool is_global) /**< flag indicating if we are parsing the global scope */
 {
   dumper_new_scope ();
-  preparse_scope (is_global);
+
+  jsp_scope_decls_t scope_decls;
+  jsp_start_scope_declarations (&scope_decls);
 
   if (inside_eval
       && !inside_function)
@@ -3049,13 +3134,35 @@ parse_source_element_list (bool is_global) /**< flag indicating if we are parsin
     dump_undefined_assignment (eval_ret_operand ());
   }
 
+  /* the first token is read again, so that it is registered as token of the scope */
+  lexer_save_token (tok);
+
   skip_newlines ();
   while (!token_is (TOK_EOF) && !token_is (TOK_CLOSE_BRACE))
   {
     parse_source_element ();
     skip_newlines ();
   }
+
+  if (is_global && !token_is (TOK_EOF))
+  {
+    EMIT_ERROR ("Unmatched } brace");
+  }
+
   lexer_save_token (tok);
+
+  if (inside_eval
+      && !inside_function)
+  {
+    dump_retval (eval_ret_operand ());
+  }
+  else
+  {
+    dump_ret ();
+  }
+
+  jsp_finish_scope_declarations (&scope_decls);
+
   rewrite_reg_var_decl ();
   dumper_finish_scope ();
 } /* parse_source_element_list */
@@ -3072,18 +3179,24 @@ parse_source_element_list (bool is_global) /**< flag indicating if we are parsin
  */
 static bool
 parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer */
-                      size_t source_size, /**< source code size in bytes */
+                      size_t source_size, /**< source code size in bytes (or size of the buffer,
+                                           *   if source reader is specified) */
+                      jerry_source_reader_callback_t reader_p, /**< source reader, filling the buffer
+                                                                *   on demand (or NULL - if the whole
+                                                                *   source is in the buffer) */
+                      void *reader_user_p, /**< user data for the source reader */
                       bool in_function, /**< flag indicating if we are parsing body of a function */
                       bool in_eval, /**< flag indicating if we are parsing body of eval code */
                       bool is_strict, /**< flag, indicating whether current code
                                        *   inherited strict mode from code of an outer scope */
-                      const opcode_t **out_opcodes_p) /**< out: generated byte-code array
-                                                       *  (in case there were no syntax errors) */
+                      const opcode_compact_t **out_opcodes_p) /**< out: generated byte-code array
+                                                               *  (in case there were no syntax errors) */
 {
   JERRY_ASSERT (out_opcodes_p != NULL);
 
   inside_function = in_function;
   inside_eval = in_eval;
+  current_scope_decls_p = NULL;
 
 #ifndef JERRY_NDEBUG
   volatile bool is_parse_finished = false;
@@ -3094,17 +3207,17 @@ parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer
   jsp_mm_init ();
   jsp_label_init ();
 
-  lexer_init (source_p, source_size, parser_show_opcodes);
+  lexer_init (source_p, source_size, reader_p, reader_user_p, parser_show_opcodes);
 
   serializer_set_show_opcodes (parser_show_opcodes);
+  serializer_reset_instructions ();
+  serializer_reset_long_opcode_counters ();
+  serializer_reset_lazy_function_bodies ();
   dumper_init ();
   syntax_init ();
 
-  STACK_INIT (scopes);
-  STACK_PUSH (scopes, scopes_tree_init (NULL));
-  serializer_set_scope (STACK_TOP (scopes));
-  scopes_tree_set_strict_mode (STACK_TOP (scopes), is_strict);
-  lexer_set_strict_mode (scopes_tree_strict_mode (STACK_TOP (scopes)));
+  inside_strict_mode_code = is_strict;
+  lexer_set_strict_mode (is_strict_mode ());
 
   jmp_buf *syntax_error_label_p = syntax_get_syntax_error_longjmp_label ();
   int r = setjmp (*syntax_error_label_p);
@@ -3117,33 +3230,17 @@ parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer
     skip_newlines ();
     JERRY_ASSERT (token_is (TOK_EOF));
 
-    if (in_function)
-    {
-      dump_ret ();
-    }
-    else if (inside_eval)
-    {
-      dump_retval (eval_ret_operand ());
-    }
-    else
-    {
-      dump_ret ();
-    }
-
 #ifndef JERRY_NDEBUG
     is_parse_finished = true;
 #endif /* !JERRY_NDEBUG */
 
     syntax_free ();
 
-    *out_opcodes_p = serializer_merge_scopes_into_bytecode ();
+    *out_opcodes_p = serializer_finalize_bytecode ();
 
     dumper_free ();
 
-    serializer_set_scope (NULL);
-    scopes_tree_free (STACK_TOP (scopes));
-    STACK_DROP (scopes, 1);
-    STACK_FREE (scopes);
+    jsp_mm_free_all ();
 
     is_syntax_correct = true;
   }
@@ -3157,6 +3254,8 @@ parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer
 
     *out_opcodes_p = NULL;
 
+    serializer_free_lazy_function_bodies ();
+
     jsp_label_remove_all_labels ();
     jsp_mm_free_all ();
 
@@ -3178,12 +3277,31 @@ parser_parse_program (const jerry_api_char_t *source_p, /**< source code buffer
 bool
 parser_parse_script (const jerry_api_char_t *source, /**< source script */
                      size_t source_size, /**< source script size it bytes */
-                     const opcode_t **opcodes_p) /**< out: generated byte-code array
-                                                  *  (in case there were no syntax errors) */
+                     const opcode_compact_t **opcodes_p) /**< out: generated byte-code array
+                                                          *  (in case there were no syntax errors) */
 {
-  return parser_parse_program (source, source_size, false, false, false, opcodes_p);
+  return parser_parse_program (source, source_size, NULL, NULL, false, false, false, opcodes_p);
 } /* parser_parse_script */
 
+/**
+ * Parse source script, pulling it in chunks from the source reader
+ *
+ * @return true - if parse finished successfully (no SyntaxError were raised);
+ *         false - otherwise.
+ */
+bool
+parser_parse_script_from_reader (jerry_source_reader_callback_t reader_p, /**< source reader */
+                                 void *reader_user_p, /**< user data for the source reader */
+                                 jerry_api_char_t *buffer_p, /**< buffer for the source */
+                                 size_t buffer_size, /**< size of the buffer */
+                                 const opcode_compact_t **opcodes_p) /**< out: generated byte-code array
+                                                                      *  (in case there were no syntax errors) */
+{
+  JERRY_ASSERT (reader_p != NULL);
+
+  return parser_parse_program (buffer_p, buffer_size, reader_p, reader_user_p, false, false, false, opcodes_p);
+} /* parser_parse_script_from_reader */
+
 /**
  * Parse string passed to eval() call
  *
@@ -3195,10 +3313,27 @@ parser_parse_eval (const jerry_api_char_t *source, /**< string passed to eval()
                    size_t source_size, /**< string size in bytes */
                    bool is_strict, /**< flag, indicating whether eval is called
                                     *   from strict code in direct mode */
-                   const opcode_t **opcodes_p) /**< out: generated byte-code array
-                                                *  (in case there were no syntax errors) */
+                   const opcode_compact_t **opcodes_p) /**< out: generated byte-code array
+                                                        *  (in case there were no syntax errors) */
 {
-  return parser_parse_program (source, source_size, false, true, is_strict, opcodes_p);
+  const opcode_compact_t *cached_opcodes_p = jsp_eval_cache_lookup (JSP_EVAL_CACHE_CODE_EVAL,
+                                                            is_strict,
+                                                            source,
+                                                            source_size);
+  if (cached_opcodes_p != NULL)
+  {
+    *opcodes_p = cached_opcodes_p;
+    return true;
+  }
+
+  bool is_syntax_correct = parser_parse_program (source, source_size, NULL, NULL, false, true, is_strict, opcodes_p);
+
+  if (is_syntax_correct)
+  {
+    jsp_eval_cache_insert (JSP_EVAL_CACHE_CODE_EVAL, is_strict, source, source_size, *opcodes_p);
+  }
+
+  return is_syntax_correct;
 } /* parser_parse_eval */
 
 /**
@@ -3216,8 +3351,8 @@ parser_parse_new_function (const jerry_api_char_t **params, /**< array of argume
                                                              *                                       body) call */
                            const size_t *params_size, /**< sizes of arguments strings */
                            size_t params_count, /**< total number of arguments passed to new Function (...) */
-                           const opcode_t **out_opcodes_p) /**< out: generated byte-code array
-                                                            *  (in case there were no syntax errors) */
+                           const opcode_compact_t **out_opcodes_p) /**< out: generated byte-code array
+                                                                    *  (in case there were no syntax errors) */
 {
   // Process arguments
   JERRY_ASSERT (params_count > 0);
@@ -3226,14 +3361,54 @@ parser_parse_new_function (const jerry_api_char_t **params, /**< array of argume
     FIXME ("check parameter's name for syntax errors");
     lit_find_or_create_literal_from_utf8_string ((lit_utf8_byte_t *) params[i], (lit_utf8_size_t) params_size[i]);
   }
-  return parser_parse_program (params[params_count - 1],
-                               params_size[params_count - 1],
-                               true,
-                               false,
-                               false,
-                               out_opcodes_p);
+
+  const jerry_api_char_t *body_p = params[params_count - 1];
+  const size_t body_size = params_size[params_count - 1];
+
+  const opcode_compact_t *cached_opcodes_p = jsp_eval_cache_lookup (JSP_EVAL_CACHE_CODE_FUNCTION,
+                                                            false,
+                                                            body_p,
+                                                            body_size);
+  if (cached_opcodes_p != NULL)
+  {
+    *out_opcodes_p = cached_opcodes_p;
+    return true;
+  }
+
+  bool is_syntax_correct = parser_parse_program (body_p,
+                                                 body_size,
+                                                 NULL,
+                                                 NULL,
+                                                 true,
+                                                 false,
+                                                 false,
+                                                 out_opcodes_p);
+
+  if (is_syntax_correct)
+  {
+    jsp_eval_cache_insert (JSP_EVAL_CACHE_CODE_FUNCTION, false, body_p, body_size, *out_opcodes_p);
+  }
+
+  return is_syntax_correct;
 } /* parser_parse_new_function */
 
+/**
+ * Parse body of a function, which compilation was deferred till the function's first call
+ *
+ * @return true - if parse finished successfully (no SyntaxError were raised);
+ *         false - otherwise.
+ */
+bool
+parser_parse_lazy_function_body (const jerry_api_char_t *body_p, /**< source code of the function's body */
+                                 size_t body_size, /**< size of the source code in bytes */
+                                 bool is_strict, /**< flag, indicating whether the function's code
+                                                  *   is strict mode code */
+                                 const opcode_compact_t **out_opcodes_p) /**< out: generated byte-code array
+                                                                          *  (in case there were no syntax errors) */
+{
+  return parser_parse_program (body_p, body_size, NULL, NULL, true, false, is_strict, out_opcodes_p);
+} /* parser_parse_lazy_function_body */
+
 /**
  * Tell parser to dump bytecode
  */
@@ -3242,3 +3417,18 @@ parser_set_show_opcodes (bool show_opcodes) /**< flag indicating if to dump byte
 {
   parser_show_opcodes = show_opcodes;
 } /* parser_set_show_opcodes */
+
+/**
+ * Tell parser to defer compilation of functions' bodies till the functions' first calls
+ *
+ * Note:
+ *      in the mode a function's body is only checked for a subset of early errors during the parse
+ *      (see also: scanner_skip_function_body), and the body's other early errors are reported
+ *      as SyntaxError, thrown upon the function's first call
+ */
+void
+parser_set_parse_functions_lazily (bool parse_functions_lazily) /**< flag indicating if to defer
+                                                                  *   compilation of functions' bodies */
+{
+  parser_parse_functions_lazily = parse_functions_lazily;
+} /* parser_set_parse_functions_lazily */
@@ -19,8 +19,12 @@
 #include "jrt.h"
 
 void parser_set_show_opcodes (bool);
-bool parser_parse_script (const jerry_api_char_t *, size_t, const opcode_t **);
-bool parser_parse_eval (const jerry_api_char_t *, size_t, bool, const opcode_t **);
-bool parser_parse_new_function (const jerry_api_char_t **, const size_t *, size_t, const opcode_t **);
+void parser_set_parse_functions_lazily (bool);
+bool parser_parse_script (const jerry_api_char_t *, size_t, const opcode_compact_t **);
+bool parser_parse_script_from_reader (jerry_source_reader_callback_t, void *, jerry_api_char_t *, size_t,
+                                      const opcode_compact_t **);
+bool parser_parse_eval (const jerry_api_char_t *, size_t, bool, const opcode_compact_t **);
+bool parser_parse_new_function (const jerry_api_char_t **, const size_t *, size_t, const opcode_compact_t **);
+bool parser_parse_lazy_function_body (const jerry_api_char_t *, size_t, bool, const opcode_compact_t **);
 
 #endif /* PARSER_H */
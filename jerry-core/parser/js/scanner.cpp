@@ -0,0 +1,1527 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "lit-magic-strings.h"
+#include "scanner.h"
+#include "stack.h"
+#include "syntax-errors.h"
+
+/**
+ * The scanner skips body of a function, which compilation is deferred till the function's first call,
+ * without generating byte-code, and checks the body for a subset of early errors on the token level:
+ *  - balance of brackets;
+ *  - usage of reserved words and of keywords instead of identifiers;
+ *  - targets of assignment and of increment / decrement operators, that are certainly not references;
+ *  - operators without operands;
+ *  - placement of 'break' and 'continue' statements;
+ *  - strict mode restrictions on 'eval' and 'arguments', 'with' statement, 'delete' of identifiers,
+ *    and duplicated formal parameters of nested functions.
+ *
+ * The checks are conservative, so a body, that is accepted by the parser, is not rejected by the scanner.
+ * Other early errors are reported upon the body's compilation (see also: ecma_op_function_call).
+ */
+
+/**
+ * Kind of a bracketed part of source, that is being scanned
+ */
+typedef enum __attr_packed___
+{
+  SCANNER_BRACKET_BLOCK, /**< block statement, including bodies of loops and of switch statement */
+  SCANNER_BRACKET_FUNCTION_BODY, /**< body of a function */
+  SCANNER_BRACKET_FORMAL_PARAMETERS, /**< formal parameter list of a nested function */
+  SCANNER_BRACKET_STATEMENT_HEADER, /**< parenthesized header of a statement */
+  SCANNER_BRACKET_OBJECT_LITERAL, /**< object literal */
+  SCANNER_BRACKET_ARRAY_LITERAL, /**< array literal */
+  SCANNER_BRACKET_PROPERTY_INDEX, /**< bracketed property accessor */
+  SCANNER_BRACKET_CALL_ARGUMENTS, /**< argument list of a call */
+  SCANNER_BRACKET_GROUPING /**< grouping operator */
+} scanner_bracket_t;
+
+/**
+ * Statement, which header or body is expected
+ */
+typedef enum __attr_packed___
+{
+  SCANNER_STATEMENT_NONE, /**< no statement */
+  SCANNER_STATEMENT_LOOP, /**< 'for' or 'while' statement */
+  SCANNER_STATEMENT_DO_LOOP, /**< 'do-while' statement */
+  SCANNER_STATEMENT_SWITCH, /**< 'switch' statement */
+  SCANNER_STATEMENT_CATCH, /**< catch block of 'try' statement */
+  SCANNER_STATEMENT_OTHER /**< 'if' or 'with' statement, or condition of 'do-while' statement */
+} scanner_statement_t;
+
+/**
+ * Part of function's header, that is expected
+ */
+typedef enum __attr_packed___
+{
+  SCANNER_FUNCTION_NONE, /**< no function header */
+  SCANNER_FUNCTION_NAME, /**< name of function declaration */
+  SCANNER_FUNCTION_NAME_OR_PARAMETERS, /**< optional name of function expression */
+  SCANNER_FUNCTION_PARAMETERS, /**< formal parameter list */
+  SCANNER_FUNCTION_BODY /**< function's body */
+} scanner_function_header_t;
+
+/**
+ * Syntactic position of the next token
+ */
+typedef enum __attr_packed___
+{
+  SCANNER_POS_STATEMENT, /**< start of a statement */
+  SCANNER_POS_EXPRESSION, /**< start of an assignment expression */
+  SCANNER_POS_OPERAND, /**< operand of an operator, which precedence is higher than precedence of assignment */
+  SCANNER_POS_AFTER_OPERAND, /**< end of an operand */
+  SCANNER_POS_RETURN_ARGUMENT, /**< optional argument of 'return' statement */
+  SCANNER_POS_JUMP_LABEL, /**< optional label of 'break' or 'continue' statement */
+  SCANNER_POS_VAR_NAME, /**< name of a declared variable */
+  SCANNER_POS_CATCH_PARAMETER, /**< name of catch block's parameter */
+  SCANNER_POS_PARAMETER, /**< name of a formal parameter */
+  SCANNER_POS_AFTER_PARAMETER, /**< end of a formal parameter */
+  SCANNER_POS_PROPERTY_NAME, /**< name of an object literal's property */
+  SCANNER_POS_AFTER_PROPERTY_NAME, /**< end of an object literal's property name */
+  SCANNER_POS_MEMBER_NAME /**< identifier name of the member access operator */
+} scanner_position_t;
+
+/**
+ * State of an expression, that is being scanned
+ */
+typedef struct
+{
+  scanner_position_t pos; /**< position of the next token */
+  bool is_operand_required; /**< an operand should start at the position */
+  bool is_reference; /**< the operand, that ends at the position, can be a reference */
+  bool is_assignable; /**< the operand is not an operand of an operator, which precedence
+                       *   is higher than precedence of assignment */
+  bool is_identifier; /**< the operand is an identifier */
+  bool is_eval_or_arguments; /**< the operand is 'eval' or 'arguments' identifier */
+  bool is_label; /**< the operand is an identifier at start of a statement, i.e. it can be a label */
+  bool is_prefix_update; /**< the operand is operand of prefix '++' or '--' */
+  bool is_prefix_delete; /**< the operand is operand of 'delete' */
+  bool is_next_prefix_update; /**< the next operand is operand of prefix '++' or '--' */
+  bool is_next_prefix_delete; /**< the next operand is operand of 'delete' */
+  bool is_var_list; /**< a variable declaration list is being scanned */
+  bool is_case_expression; /**< expression of 'case' or 'default' clause, ended with colon, is being scanned */
+  uint32_t conditionals_num; /**< number of conditional operators, which colon is not yet scanned */
+} scanner_expression_t;
+
+/**
+ * Flags of a bracketed part of source
+ */
+typedef enum
+{
+  SCANNER_BRACKET_FLAGS__EMPTY = (0u), /**< initializer for empty flag set */
+  SCANNER_BRACKET_FLAGS_BREAK_TARGET = (1u << 0), /**< 'break' without label is allowed in the bracket */
+  SCANNER_BRACKET_FLAGS_CONTINUE_TARGET = (1u << 1), /**< 'continue' without label is allowed in the bracket */
+  SCANNER_BRACKET_FLAGS_LABELLED = (1u << 2), /**< a labelled statement starts in the bracket */
+  SCANNER_BRACKET_FLAGS_DO_LOOP_BODY = (1u << 3), /**< the bracket is body of 'do-while' statement */
+  SCANNER_BRACKET_FLAGS_CHECK_PARAMETERS = (1u << 4), /**< formal parameters of the function are checked
+                                                       *   for duplication upon end of its body */
+  SCANNER_BRACKET_FLAGS_OUTER_STRICT = (1u << 5) /**< code, enclosing the function, is strict mode code */
+} scanner_bracket_flags_t;
+
+/**
+ * Descriptor of a bracketed part of source, that is being scanned
+ */
+typedef struct
+{
+  scanner_expression_t outer_expr; /**< state of the enclosing expression */
+  scanner_bracket_t type; /**< kind of the bracket */
+  scanner_statement_t statement; /**< statement of the header (for SCANNER_BRACKET_STATEMENT_HEADER) */
+  uint8_t flags; /**< flags (scanner_bracket_flags_t) */
+} scanner_bracket_descr_t;
+
+enum
+{
+  scanner_brackets_global_size
+};
+STATIC_STACK (scanner_brackets, scanner_bracket_descr_t)
+
+/**
+ * State of the current expression
+ */
+static scanner_expression_t expr;
+
+/**
+ * Expected part of a function's header
+ */
+static scanner_function_header_t function_header;
+
+/**
+ * Flag, indicating that the expected function is getter or setter of an object literal
+ */
+static bool is_accessor;
+
+/**
+ * Statement, which parenthesized header is expected
+ */
+static scanner_statement_t expected_header;
+
+/**
+ * Statement, which body is expected
+ */
+static scanner_statement_t expected_body;
+
+/**
+ * Flag, indicating that the last scanned token is closing brace of 'do-while' statement's body
+ */
+static bool is_after_do_loop_body;
+
+/**
+ * Flag, indicating that the last scanned token is opening brace of a function's body
+ */
+static bool is_function_body_start;
+
+/**
+ * Flag, indicating that the keyword of the current jump statement is 'continue'
+ */
+static bool is_continue;
+
+/**
+ * Flag, indicating that code of the current function is strict mode code
+ */
+static bool is_strict;
+
+/**
+ * Description of the skipped body
+ */
+static scanner_function_body_info_t *body_info_p;
+
+/**
+ * Check whether the token is the specified identifier
+ *
+ * Note:
+ *      in skip mode of the lexer, only 'eval' and 'arguments' identifiers are registered as literals
+ *      (see also: lexer_set_skip_mode)
+ *
+ * @return true - if the token is identifier, equal to the specified magic string,
+ *         false - otherwise.
+ */
+static bool
+scanner_is_identifier (token tok, /**< token */
+                       lit_magic_string_id_t id) /**< magic string */
+{
+  if (tok.type != TOK_NAME || tok.uid == MEM_CP_NULL)
+  {
+    return false;
+  }
+
+  lit_cpointer_t cp;
+  cp.packed_value = tok.uid;
+
+  return lit_literal_equal_type_utf8 (lit_get_literal_by_cp (cp),
+                                      lit_get_magic_string_utf8 (id),
+                                      lit_get_magic_string_size (id));
+} /* scanner_is_identifier */
+
+/**
+ * Check whether the token is 'eval' or 'arguments' identifier
+ *
+ * @return true / false
+ */
+static bool
+scanner_is_eval_or_arguments (token tok) /**< token */
+{
+  return (scanner_is_identifier (tok, LIT_MAGIC_STRING_EVAL)
+          || scanner_is_identifier (tok, LIT_MAGIC_STRING_ARGUMENTS));
+} /* scanner_is_eval_or_arguments */
+
+/**
+ * Check that the token is an identifier, that can be name of a declaration in the current code
+ */
+static void
+scanner_check_declared_name (token tok) /**< token */
+{
+  if (tok.type != TOK_NAME)
+  {
+    PARSE_ERROR ("Expected identifier", tok.loc);
+  }
+
+  if (is_strict && scanner_is_eval_or_arguments (tok))
+  {
+    PARSE_ERROR ("'eval' and 'arguments' are not allowed here in strict mode", tok.loc);
+  }
+} /* scanner_check_declared_name */
+
+/**
+ * Check whether the token can be name of a property in an object literal
+ *
+ * @return true / false
+ */
+static bool
+scanner_is_property_name (token tok) /**< token */
+{
+  return (tok.type == TOK_NAME
+          || tok.type == TOK_KEYWORD
+          || tok.type == TOK_STRING
+          || tok.type == TOK_NUMBER
+          || tok.type == TOK_SMALL_INT
+          || tok.type == TOK_NULL
+          || tok.type == TOK_BOOL);
+} /* scanner_is_property_name */
+
+/**
+ * Check whether the keyword is reserved, i.e. is not used in the language's grammar
+ *
+ * Note:
+ *      the future reserved words of strict mode code are keyword tokens only in strict mode code
+ *
+ * @return true / false
+ */
+static bool
+scanner_is_reserved_word (keyword kw) /**< keyword */
+{
+  switch (kw)
+  {
+    case KW_CLASS:
+    case KW_CONST:
+    case KW_ENUM:
+    case KW_EXPORT:
+    case KW_EXTENDS:
+    case KW_IMPORT:
+    case KW_SUPER:
+    case KW_IMPLEMENTS:
+    case KW_INTERFACE:
+    case KW_LET:
+    case KW_PACKAGE:
+    case KW_PRIVATE:
+    case KW_PROTECTED:
+    case KW_PUBLIC:
+    case KW_STATIC:
+    case KW_YIELD:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* scanner_is_reserved_word */
+
+/**
+ * Check whether the token can not start an operand
+ *
+ * @return true / false
+ */
+static bool
+scanner_is_not_operand_start (token tok) /**< token */
+{
+  switch (tok.type)
+  {
+    case TOK_NAME:
+    case TOK_SMALL_INT:
+    case TOK_NUMBER:
+    case TOK_NULL:
+    case TOK_BOOL:
+    case TOK_STRING:
+    case TOK_REGEXP:
+    case TOK_OPEN_BRACE:
+    case TOK_OPEN_PAREN:
+    case TOK_OPEN_SQUARE:
+    case TOK_PLUS:
+    case TOK_MINUS:
+    case TOK_NOT:
+    case TOK_COMPL:
+    case TOK_DOUBLE_PLUS:
+    case TOK_DOUBLE_MINUS:
+    {
+      return false;
+    }
+    case TOK_KEYWORD:
+    {
+      return ((keyword) tok.uid == KW_IN || (keyword) tok.uid == KW_INSTANCEOF);
+    }
+    default:
+    {
+      return true;
+    }
+  }
+} /* scanner_is_not_operand_start */
+
+/**
+ * Check whether the token is an assignment operator
+ *
+ * @return true / false
+ */
+static bool
+scanner_is_assignment_operator (token tok) /**< token */
+{
+  switch (tok.type)
+  {
+    case TOK_EQ:
+    case TOK_PLUS_EQ:
+    case TOK_MINUS_EQ:
+    case TOK_MULT_EQ:
+    case TOK_MOD_EQ:
+    case TOK_DIV_EQ:
+    case TOK_LSHIFT_EQ:
+    case TOK_RSHIFT_EQ:
+    case TOK_RSHIFT_EX_EQ:
+    case TOK_AND_EQ:
+    case TOK_OR_EQ:
+    case TOK_XOR_EQ:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* scanner_is_assignment_operator */
+
+/**
+ * Finish scan of an operand, checking operand of prefix '++', '--' and 'delete' operators
+ */
+static void
+scanner_finish_operand (locus loc) /**< location of the token after the operand */
+{
+  if (expr.pos != SCANNER_POS_AFTER_OPERAND)
+  {
+    return;
+  }
+
+  if (expr.is_prefix_update)
+  {
+    if (!expr.is_reference)
+    {
+      PARSE_ERROR ("Invalid left-hand side expression", loc);
+    }
+
+    if (is_strict && expr.is_eval_or_arguments)
+    {
+      PARSE_ERROR ("'eval' and 'arguments' are not allowed here in strict mode", loc);
+    }
+  }
+
+  if (expr.is_prefix_delete && is_strict && expr.is_identifier)
+  {
+    syntax_check_delete (is_strict, loc);
+  }
+
+  expr.is_prefix_update = false;
+  expr.is_prefix_delete = false;
+  expr.is_label = false;
+} /* scanner_finish_operand */
+
+/**
+ * Start scan of an operand at the current position
+ */
+static void
+scanner_start_operand (token tok, /**< first token of the operand */
+                       bool is_reference, /**< the operand can be a reference */
+                       bool is_identifier) /**< the operand is an identifier */
+{
+  scanner_finish_operand (tok.loc);
+
+  expr.is_assignable = (expr.pos != SCANNER_POS_OPERAND);
+  expr.is_label = (expr.pos == SCANNER_POS_STATEMENT && is_identifier);
+  expr.is_reference = is_reference;
+  expr.is_identifier = is_identifier;
+  expr.is_eval_or_arguments = (is_identifier && scanner_is_eval_or_arguments (tok));
+  expr.is_prefix_update = expr.is_next_prefix_update;
+  expr.is_prefix_delete = expr.is_next_prefix_delete;
+  expr.is_next_prefix_update = false;
+  expr.is_next_prefix_delete = false;
+
+  expr.pos = SCANNER_POS_AFTER_OPERAND;
+  expr.is_operand_required = false;
+} /* scanner_start_operand */
+
+/**
+ * Continue scan of an operand with member access or call operator
+ */
+static void
+scanner_continue_operand (void)
+{
+  JERRY_ASSERT (expr.pos == SCANNER_POS_AFTER_OPERAND);
+
+  expr.is_reference = true;
+  expr.is_identifier = false;
+  expr.is_eval_or_arguments = false;
+  expr.is_label = false;
+} /* scanner_continue_operand */
+
+/**
+ * Set position of the next token
+ */
+static void
+scanner_set_position (scanner_position_t pos, /**< position */
+                      bool is_operand_required) /**< an operand should start at the position */
+{
+  expr.pos = pos;
+  expr.is_operand_required = is_operand_required;
+} /* scanner_set_position */
+
+/**
+ * Reset state of the current expression
+ */
+static void
+scanner_reset_expression (scanner_position_t pos, /**< position of the next token */
+                          bool is_operand_required) /**< an operand should start at the position */
+{
+  memset (&expr, 0, sizeof (expr));
+
+  scanner_set_position (pos, is_operand_required);
+} /* scanner_reset_expression */
+
+/**
+ * Start a new statement at the current position
+ */
+static void
+scanner_start_statement (locus loc) /**< location of the statement's first token */
+{
+  scanner_finish_operand (loc);
+
+  expr.is_var_list = false;
+  expr.conditionals_num = 0;
+
+  scanner_set_position (SCANNER_POS_STATEMENT, false);
+} /* scanner_start_statement */
+
+/**
+ * Open a bracket, saving state of the enclosing expression
+ */
+static void
+scanner_open_bracket (scanner_bracket_t type, /**< kind of the bracket */
+                      uint8_t flags, /**< flags of the bracket (scanner_bracket_flags_t) */
+                      scanner_position_t pos, /**< position of the next token */
+                      bool is_operand_required) /**< an operand should start at the position */
+{
+  scanner_bracket_descr_t bracket;
+
+  bracket.outer_expr = expr;
+  bracket.type = type;
+  bracket.statement = SCANNER_STATEMENT_NONE;
+  bracket.flags = flags;
+
+  STACK_PUSH (scanner_brackets, bracket);
+
+  scanner_reset_expression (pos, is_operand_required);
+} /* scanner_open_bracket */
+
+/**
+ * Set flags of the innermost bracket
+ */
+static void
+scanner_set_bracket_flags (uint8_t flags) /**< flags to set (scanner_bracket_flags_t) */
+{
+  scanner_bracket_descr_t bracket = STACK_TOP (scanner_brackets);
+  bracket.flags = (uint8_t) (bracket.flags | flags);
+  STACK_SET_HEAD (scanner_brackets, 1, bracket);
+} /* scanner_set_bracket_flags */
+
+/**
+ * Start a function's body
+ */
+static void
+scanner_start_function_body (uint8_t flags) /**< flags of the body (scanner_bracket_flags_t) */
+{
+  if (is_strict)
+  {
+    flags = (uint8_t) (flags | SCANNER_BRACKET_FLAGS_OUTER_STRICT);
+  }
+
+  scanner_open_bracket (SCANNER_BRACKET_FUNCTION_BODY, flags, SCANNER_POS_STATEMENT, false);
+
+  is_function_body_start = true;
+} /* scanner_start_function_body */
+
+/**
+ * Check that a jump statement without label is inside of its target,
+ * or that a label, referred by a jump statement, is declared
+ */
+static void
+scanner_check_jump (bool is_labelled, /**< the jump statement has label */
+                    locus loc __attr_unused___) /**< location of the jump statement's label or of its end */
+{
+  uint8_t target_flag;
+
+  if (is_labelled)
+  {
+    target_flag = SCANNER_BRACKET_FLAGS_LABELLED;
+  }
+  else if (is_continue)
+  {
+    target_flag = SCANNER_BRACKET_FLAGS_CONTINUE_TARGET;
+  }
+  else
+  {
+    target_flag = SCANNER_BRACKET_FLAGS_BREAK_TARGET;
+  }
+
+  for (size_t i = STACK_SIZE (scanner_brackets); i > 0; i--)
+  {
+    const scanner_bracket_descr_t bracket = STACK_ELEMENT (scanner_brackets, i - 1);
+
+    if (bracket.flags & target_flag)
+    {
+      return;
+    }
+
+    if (bracket.type == SCANNER_BRACKET_FUNCTION_BODY)
+    {
+      break;
+    }
+  }
+
+  if (is_labelled)
+  {
+    PARSE_ERROR ("Label not found", loc);
+  }
+  else if (is_continue)
+  {
+    PARSE_ERROR ("'continue' is allowed only inside a loop", loc);
+  }
+  else
+  {
+    PARSE_ERROR ("'break' is allowed only inside a loop or a switch statement", loc);
+  }
+} /* scanner_check_jump */
+
+/**
+ * Scan a token of a function's header
+ */
+static void
+scanner_scan_function_header (token tok) /**< token */
+{
+  switch (function_header)
+  {
+    case SCANNER_FUNCTION_NAME:
+    {
+      scanner_check_declared_name (tok);
+
+      function_header = SCANNER_FUNCTION_PARAMETERS;
+      break;
+    }
+    case SCANNER_FUNCTION_NAME_OR_PARAMETERS:
+    {
+      if (tok.type != TOK_OPEN_PAREN)
+      {
+        scanner_check_declared_name (tok);
+
+        function_header = SCANNER_FUNCTION_PARAMETERS;
+        break;
+      }
+
+      /* FALLTHRU */
+    }
+    case SCANNER_FUNCTION_PARAMETERS:
+    {
+      if (tok.type != TOK_OPEN_PAREN)
+      {
+        PARSE_ERROR ("Expected '('", tok.loc);
+      }
+
+      if (!is_accessor)
+      {
+        syntax_start_checking_of_vargs ();
+      }
+
+      scanner_open_bracket (SCANNER_BRACKET_FORMAL_PARAMETERS,
+                            SCANNER_BRACKET_FLAGS__EMPTY,
+                            SCANNER_POS_PARAMETER,
+                            false);
+
+      function_header = SCANNER_FUNCTION_NONE;
+      break;
+    }
+    case SCANNER_FUNCTION_BODY:
+    {
+      if (tok.type != TOK_OPEN_BRACE)
+      {
+        PARSE_ERROR ("Expected '{'", tok.loc);
+      }
+
+      scanner_start_function_body (is_accessor ? SCANNER_BRACKET_FLAGS__EMPTY
+                                               : SCANNER_BRACKET_FLAGS_CHECK_PARAMETERS);
+
+      function_header = SCANNER_FUNCTION_NONE;
+      break;
+    }
+    default:
+    {
+      JERRY_UNREACHABLE ();
+    }
+  }
+} /* scanner_scan_function_header */
+
+/**
+ * Scan a token of a nested function's formal parameter list
+ */
+static void
+scanner_scan_formal_parameter (token tok) /**< token */
+{
+  if (tok.type == TOK_CLOSE_PAREN
+      && (expr.pos == SCANNER_POS_AFTER_PARAMETER || !expr.is_operand_required))
+  {
+    expr = STACK_TOP (scanner_brackets).outer_expr;
+    STACK_DROP (scanner_brackets, 1);
+
+    function_header = SCANNER_FUNCTION_BODY;
+  }
+  else if (expr.pos == SCANNER_POS_PARAMETER)
+  {
+    scanner_check_declared_name (tok);
+
+    if (!is_accessor)
+    {
+      lit_cpointer_t cp;
+      cp.packed_value = tok.uid;
+
+      syntax_add_varg (literal_operand (cp));
+    }
+
+    scanner_set_position (SCANNER_POS_AFTER_PARAMETER, false);
+  }
+  else if (tok.type == TOK_COMMA)
+  {
+    scanner_set_position (SCANNER_POS_PARAMETER, true);
+  }
+  else
+  {
+    PARSE_ERROR ("Expected ',' or ')'", tok.loc);
+  }
+} /* scanner_scan_formal_parameter */
+
+/**
+ * Scan 'function' keyword
+ */
+static void
+scanner_scan_function_keyword (token tok) /**< the keyword */
+{
+  is_accessor = false;
+
+  if (expr.pos == SCANNER_POS_EXPRESSION
+      || expr.pos == SCANNER_POS_OPERAND
+      || expr.pos == SCANNER_POS_RETURN_ARGUMENT)
+  {
+    /* state of the enclosing expression, that is restored after the function's end */
+    scanner_start_operand (tok, false, false);
+
+    function_header = SCANNER_FUNCTION_NAME_OR_PARAMETERS;
+  }
+  else
+  {
+    scanner_start_statement (tok.loc);
+
+    function_header = SCANNER_FUNCTION_NAME;
+  }
+} /* scanner_scan_function_keyword */
+
+/**
+ * Scan a keyword
+ */
+static void
+scanner_scan_keyword (token tok) /**< token */
+{
+  const keyword kw = (keyword) tok.uid;
+
+  if (scanner_is_reserved_word (kw))
+  {
+    PARSE_ERROR ("Usage of a reserved word", tok.loc);
+  }
+
+  switch (kw)
+  {
+    case KW_THIS:
+    {
+      scanner_start_operand (tok, false, false);
+      break;
+    }
+    case KW_FUNCTION:
+    {
+      scanner_scan_function_keyword (tok);
+      break;
+    }
+    case KW_NEW:
+    {
+      scanner_finish_operand (tok.loc);
+
+      scanner_set_position ((expr.pos == SCANNER_POS_OPERAND) ? SCANNER_POS_OPERAND : SCANNER_POS_EXPRESSION, true);
+      break;
+    }
+    case KW_DELETE:
+    case KW_TYPEOF:
+    case KW_VOID:
+    {
+      scanner_finish_operand (tok.loc);
+
+      expr.is_next_prefix_update = false;
+      expr.is_next_prefix_delete = (kw == KW_DELETE);
+
+      scanner_set_position (SCANNER_POS_OPERAND, true);
+      break;
+    }
+    case KW_IN:
+    case KW_INSTANCEOF:
+    {
+      scanner_finish_operand (tok.loc);
+      scanner_set_position (SCANNER_POS_OPERAND, true);
+      break;
+    }
+    case KW_VAR:
+    {
+      scanner_finish_operand (tok.loc);
+
+      expr.is_var_list = true;
+      scanner_set_position (SCANNER_POS_VAR_NAME, true);
+      break;
+    }
+    case KW_RETURN:
+    {
+      scanner_start_statement (tok.loc);
+      scanner_set_position (SCANNER_POS_RETURN_ARGUMENT, false);
+      break;
+    }
+    case KW_THROW:
+    {
+      scanner_start_statement (tok.loc);
+      scanner_set_position (SCANNER_POS_EXPRESSION, true);
+      break;
+    }
+    case KW_BREAK:
+    case KW_CONTINUE:
+    {
+      scanner_start_statement (tok.loc);
+
+      is_continue = (kw == KW_CONTINUE);
+      scanner_set_position (SCANNER_POS_JUMP_LABEL, false);
+      break;
+    }
+    case KW_CASE:
+    {
+      scanner_start_statement (tok.loc);
+
+      expr.is_case_expression = true;
+      scanner_set_position (SCANNER_POS_EXPRESSION, true);
+      break;
+    }
+    case KW_DEFAULT:
+    {
+      scanner_start_statement (tok.loc);
+
+      expr.is_case_expression = true;
+      scanner_set_position (SCANNER_POS_AFTER_OPERAND, false);
+      break;
+    }
+    case KW_WITH:
+    {
+      if (is_strict)
+      {
+        PARSE_ERROR ("'with' expression is not allowed in strict mode.", tok.loc);
+      }
+
+      /* FALLTHRU */
+    }
+    case KW_IF:
+    case KW_FOR:
+    case KW_WHILE:
+    case KW_SWITCH:
+    case KW_CATCH:
+    {
+      scanner_start_statement (tok.loc);
+
+      if (kw == KW_FOR || (kw == KW_WHILE && !is_after_do_loop_body))
+      {
+        expected_header = SCANNER_STATEMENT_LOOP;
+      }
+      else if (kw == KW_SWITCH)
+      {
+        expected_header = SCANNER_STATEMENT_SWITCH;
+      }
+      else if (kw == KW_CATCH)
+      {
+        expected_header = SCANNER_STATEMENT_CATCH;
+      }
+      else
+      {
+        expected_header = SCANNER_STATEMENT_OTHER;
+      }
+      break;
+    }
+    case KW_DO:
+    {
+      scanner_start_statement (tok.loc);
+
+      expected_body = SCANNER_STATEMENT_DO_LOOP;
+      break;
+    }
+    default:
+    {
+      /* 'else', 'try', 'finally', 'debugger' */
+      scanner_start_statement (tok.loc);
+      break;
+    }
+  }
+} /* scanner_scan_keyword */
+
+/**
+ * Scan an opening bracket
+ */
+static void
+scanner_scan_opening_bracket (token tok) /**< token */
+{
+  const bool is_after_operand = (expr.pos == SCANNER_POS_AFTER_OPERAND);
+
+  if (tok.type == TOK_OPEN_PAREN)
+  {
+    if (is_after_operand)
+    {
+      scanner_continue_operand ();
+      scanner_open_bracket (SCANNER_BRACKET_CALL_ARGUMENTS,
+                            SCANNER_BRACKET_FLAGS__EMPTY,
+                            SCANNER_POS_EXPRESSION,
+                            false);
+    }
+    else
+    {
+      scanner_open_bracket (SCANNER_BRACKET_GROUPING, SCANNER_BRACKET_FLAGS__EMPTY, SCANNER_POS_EXPRESSION, true);
+    }
+  }
+  else if (tok.type == TOK_OPEN_SQUARE)
+  {
+    if (is_after_operand)
+    {
+      scanner_continue_operand ();
+      scanner_open_bracket (SCANNER_BRACKET_PROPERTY_INDEX, SCANNER_BRACKET_FLAGS__EMPTY, SCANNER_POS_EXPRESSION, true);
+    }
+    else
+    {
+      scanner_open_bracket (SCANNER_BRACKET_ARRAY_LITERAL, SCANNER_BRACKET_FLAGS__EMPTY, SCANNER_POS_EXPRESSION, false);
+    }
+  }
+  else
+  {
+    JERRY_ASSERT (tok.type == TOK_OPEN_BRACE);
+
+    if (expr.pos == SCANNER_POS_EXPRESSION
+        || expr.pos == SCANNER_POS_OPERAND
+        || expr.pos == SCANNER_POS_RETURN_ARGUMENT)
+    {
+      scanner_open_bracket (SCANNER_BRACKET_OBJECT_LITERAL,
+                            SCANNER_BRACKET_FLAGS__EMPTY,
+                            SCANNER_POS_PROPERTY_NAME,
+                            false);
+    }
+    else
+    {
+      scanner_start_statement (tok.loc);
+      scanner_open_bracket (SCANNER_BRACKET_BLOCK, SCANNER_BRACKET_FLAGS__EMPTY, SCANNER_POS_STATEMENT, false);
+    }
+  }
+} /* scanner_scan_opening_bracket */
+
+/**
+ * Scan a closing bracket
+ *
+ * @return true - if the bracket closes the skipped body,
+ *         false - otherwise.
+ */
+static bool
+scanner_scan_closing_bracket (token tok) /**< token */
+{
+  const scanner_bracket_descr_t bracket = STACK_TOP (scanner_brackets);
+
+  token_type closing_type;
+  if (bracket.type == SCANNER_BRACKET_BLOCK
+      || bracket.type == SCANNER_BRACKET_FUNCTION_BODY
+      || bracket.type == SCANNER_BRACKET_OBJECT_LITERAL)
+  {
+    closing_type = TOK_CLOSE_BRACE;
+  }
+  else if (bracket.type == SCANNER_BRACKET_ARRAY_LITERAL
+           || bracket.type == SCANNER_BRACKET_PROPERTY_INDEX)
+  {
+    closing_type = TOK_CLOSE_SQUARE;
+  }
+  else
+  {
+    closing_type = TOK_CLOSE_PAREN;
+  }
+
+  if (tok.type != closing_type)
+  {
+    PARSE_ERROR ("Unmatched bracket", tok.loc);
+  }
+
+  scanner_finish_operand (tok.loc);
+
+  expr = bracket.outer_expr;
+  STACK_DROP (scanner_brackets, 1);
+
+  switch (bracket.type)
+  {
+    case SCANNER_BRACKET_BLOCK:
+    {
+      scanner_start_statement (tok.loc);
+
+      is_after_do_loop_body = ((bracket.flags & SCANNER_BRACKET_FLAGS_DO_LOOP_BODY) != 0);
+      break;
+    }
+    case SCANNER_BRACKET_FUNCTION_BODY:
+    {
+      if (STACK_SIZE (scanner_brackets) == 0)
+      {
+        return true;
+      }
+
+      if (bracket.flags & SCANNER_BRACKET_FLAGS_CHECK_PARAMETERS)
+      {
+        syntax_check_for_syntax_errors_in_formal_param_list (is_strict, tok.loc);
+      }
+
+      is_strict = ((bracket.flags & SCANNER_BRACKET_FLAGS_OUTER_STRICT) != 0);
+      lexer_set_strict_mode (is_strict);
+      break;
+    }
+    case SCANNER_BRACKET_STATEMENT_HEADER:
+    {
+      scanner_start_statement (tok.loc);
+
+      if (bracket.statement == SCANNER_STATEMENT_LOOP
+          || bracket.statement == SCANNER_STATEMENT_SWITCH)
+      {
+        expected_body = bracket.statement;
+      }
+      break;
+    }
+    case SCANNER_BRACKET_OBJECT_LITERAL:
+    case SCANNER_BRACKET_ARRAY_LITERAL:
+    {
+      scanner_start_operand (tok, false, false);
+      break;
+    }
+    case SCANNER_BRACKET_GROUPING:
+    {
+      scanner_start_operand (tok, true, false);
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (bracket.type == SCANNER_BRACKET_PROPERTY_INDEX
+                    || bracket.type == SCANNER_BRACKET_CALL_ARGUMENTS);
+      break;
+    }
+  }
+
+  return false;
+} /* scanner_scan_closing_bracket */
+
+/**
+ * Scan a token at position of an object literal's property name
+ */
+static void
+scanner_scan_property_name (token tok) /**< token */
+{
+  if (expr.pos == SCANNER_POS_PROPERTY_NAME)
+  {
+    if (!scanner_is_property_name (tok))
+    {
+      PARSE_ERROR ("Expected property name", tok.loc);
+    }
+
+    scanner_set_position (SCANNER_POS_AFTER_PROPERTY_NAME, false);
+  }
+  else if (tok.type == TOK_COLON)
+  {
+    scanner_set_position (SCANNER_POS_EXPRESSION, true);
+  }
+  else if (scanner_is_property_name (tok))
+  {
+    /* name of getter or setter */
+    scanner_start_operand (tok, false, false);
+
+    is_accessor = true;
+    function_header = SCANNER_FUNCTION_PARAMETERS;
+  }
+  else
+  {
+    PARSE_ERROR ("Expected ':'", tok.loc);
+  }
+} /* scanner_scan_property_name */
+
+/**
+ * Scan a punctuator
+ */
+static void
+scanner_scan_punctuator (token tok, /**< token */
+                         bool was_newline) /**< there was a line terminator before the token */
+{
+  const bool is_after_operand = (expr.pos == SCANNER_POS_AFTER_OPERAND);
+
+  switch (tok.type)
+  {
+    case TOK_DOUBLE_PLUS:
+    case TOK_DOUBLE_MINUS:
+    {
+      if (is_after_operand && !was_newline)
+      {
+        /* postfix operator */
+        if (!expr.is_reference)
+        {
+          PARSE_ERROR ("Invalid left-hand side expression", tok.loc);
+        }
+
+        if (is_strict && expr.is_eval_or_arguments)
+        {
+          PARSE_ERROR ("'eval' and 'arguments' are not allowed here in strict mode", tok.loc);
+        }
+
+        expr.is_reference = false;
+        expr.is_identifier = false;
+        expr.is_eval_or_arguments = false;
+        expr.is_label = false;
+      }
+      else
+      {
+        expr.is_next_prefix_update = true;
+        expr.is_next_prefix_delete = false;
+        scanner_set_position (SCANNER_POS_OPERAND, true);
+      }
+      break;
+    }
+    case TOK_DOT:
+    {
+      scanner_set_position (SCANNER_POS_MEMBER_NAME, true);
+      break;
+    }
+    case TOK_SEMICOLON:
+    {
+      scanner_start_statement (tok.loc);
+      break;
+    }
+    case TOK_QUERY:
+    {
+      scanner_finish_operand (tok.loc);
+
+      expr.conditionals_num++;
+      scanner_set_position (SCANNER_POS_EXPRESSION, true);
+      break;
+    }
+    case TOK_COLON:
+    {
+      const bool is_label = (is_after_operand && expr.is_label);
+
+      scanner_finish_operand (tok.loc);
+
+      if (expr.conditionals_num != 0)
+      {
+        expr.conditionals_num--;
+        scanner_set_position (SCANNER_POS_EXPRESSION, true);
+      }
+      else if (expr.is_case_expression)
+      {
+        expr.is_case_expression = false;
+        scanner_start_statement (tok.loc);
+      }
+      else
+      {
+        if (is_label)
+        {
+          scanner_set_bracket_flags (SCANNER_BRACKET_FLAGS_LABELLED);
+        }
+
+        scanner_start_statement (tok.loc);
+      }
+      break;
+    }
+    case TOK_COMMA:
+    {
+      scanner_finish_operand (tok.loc);
+
+      const scanner_bracket_t bracket_type = STACK_TOP (scanner_brackets).type;
+
+      if (bracket_type == SCANNER_BRACKET_OBJECT_LITERAL && expr.conditionals_num == 0)
+      {
+        scanner_set_position (SCANNER_POS_PROPERTY_NAME, false);
+      }
+      else if (expr.is_var_list && expr.conditionals_num == 0)
+      {
+        scanner_set_position (SCANNER_POS_VAR_NAME, true);
+      }
+      else
+      {
+        /* elisions are allowed in array literals */
+        scanner_set_position (SCANNER_POS_EXPRESSION, bracket_type != SCANNER_BRACKET_ARRAY_LITERAL);
+      }
+      break;
+    }
+    case TOK_PLUS:
+    case TOK_MINUS:
+    case TOK_NOT:
+    case TOK_COMPL:
+    {
+      if (!is_after_operand)
+      {
+        /* unary operator */
+        expr.is_next_prefix_update = false;
+        expr.is_next_prefix_delete = false;
+      }
+
+      scanner_finish_operand (tok.loc);
+      scanner_set_position (SCANNER_POS_OPERAND, true);
+      break;
+    }
+    default:
+    {
+      scanner_finish_operand (tok.loc);
+
+      if (scanner_is_assignment_operator (tok))
+      {
+        if (is_after_operand)
+        {
+          if (!expr.is_reference || !expr.is_assignable)
+          {
+            PARSE_ERROR ("Invalid left-hand side expression", tok.loc);
+          }
+
+          if (is_strict && expr.is_eval_or_arguments)
+          {
+            PARSE_ERROR ("'eval' and 'arguments' are not allowed here in strict mode", tok.loc);
+          }
+        }
+
+        scanner_set_position (SCANNER_POS_EXPRESSION, true);
+      }
+      else
+      {
+        /* binary operator */
+        scanner_set_position (SCANNER_POS_OPERAND, true);
+      }
+      break;
+    }
+  }
+} /* scanner_scan_punctuator */
+
+/**
+ * Scan a token
+ *
+ * @return true - if the token is closing brace of the skipped body,
+ *         false - otherwise.
+ */
+static bool
+scanner_scan_token (token tok, /**< token */
+                    bool was_newline) /**< there was a line terminator before the token */
+{
+  if (tok.type == TOK_EOF)
+  {
+    PARSE_ERROR ("Unexpected end of source", tok.loc);
+  }
+
+  if (scanner_is_identifier (tok, LIT_MAGIC_STRING_ARGUMENTS))
+  {
+    body_info_p->is_ref_arguments_identifier = true;
+  }
+  else if (scanner_is_identifier (tok, LIT_MAGIC_STRING_EVAL))
+  {
+    body_info_p->is_ref_eval_identifier = true;
+  }
+
+  if (is_function_body_start)
+  {
+    is_function_body_start = false;
+
+    if (tok.type == TOK_STRING)
+    {
+      lit_cpointer_t cp;
+      cp.packed_value = tok.uid;
+
+      if (lit_literal_equal_type_cstr (lit_get_literal_by_cp (cp), "use strict"))
+      {
+        is_strict = true;
+        lexer_set_strict_mode (true);
+
+        if (STACK_SIZE (scanner_brackets) == 1)
+        {
+          body_info_p->is_use_strict = true;
+        }
+      }
+    }
+  }
+
+  if (function_header != SCANNER_FUNCTION_NONE)
+  {
+    scanner_scan_function_header (tok);
+    return false;
+  }
+
+  if (STACK_TOP (scanner_brackets).type == SCANNER_BRACKET_FORMAL_PARAMETERS)
+  {
+    scanner_scan_formal_parameter (tok);
+    return false;
+  }
+
+  if (expected_header != SCANNER_STATEMENT_NONE)
+  {
+    if (tok.type != TOK_OPEN_PAREN)
+    {
+      PARSE_ERROR ("Expected '('", tok.loc);
+    }
+
+    const bool is_catch = (expected_header == SCANNER_STATEMENT_CATCH);
+
+    scanner_open_bracket (SCANNER_BRACKET_STATEMENT_HEADER,
+                          SCANNER_BRACKET_FLAGS__EMPTY,
+                          is_catch ? SCANNER_POS_CATCH_PARAMETER : SCANNER_POS_EXPRESSION,
+                          is_catch);
+
+    scanner_bracket_descr_t bracket = STACK_TOP (scanner_brackets);
+    bracket.statement = expected_header;
+    STACK_SET_HEAD (scanner_brackets, 1, bracket);
+
+    expected_header = SCANNER_STATEMENT_NONE;
+    return false;
+  }
+
+  if (expected_body != SCANNER_STATEMENT_NONE)
+  {
+    const scanner_statement_t statement = expected_body;
+    expected_body = SCANNER_STATEMENT_NONE;
+
+    uint8_t flags = SCANNER_BRACKET_FLAGS_BREAK_TARGET;
+    if (statement != SCANNER_STATEMENT_SWITCH)
+    {
+      flags = (uint8_t) (flags | SCANNER_BRACKET_FLAGS_CONTINUE_TARGET);
+    }
+
+    if (tok.type == TOK_OPEN_BRACE)
+    {
+      if (statement == SCANNER_STATEMENT_DO_LOOP)
+      {
+        flags = (uint8_t) (flags | SCANNER_BRACKET_FLAGS_DO_LOOP_BODY);
+      }
+
+      scanner_open_bracket (SCANNER_BRACKET_BLOCK, flags, SCANNER_POS_STATEMENT, false);
+      return false;
+    }
+
+    /* the loop's body is not a block, so jumps are allowed till end of the enclosing bracket */
+    scanner_set_bracket_flags (flags);
+  }
+
+  const bool is_after_do_loop_body_closing_brace = is_after_do_loop_body;
+  is_after_do_loop_body = false;
+
+  if (expr.pos == SCANNER_POS_JUMP_LABEL)
+  {
+    if (tok.type == TOK_NAME && !was_newline)
+    {
+      scanner_check_jump (true, tok.loc);
+
+      scanner_set_position (SCANNER_POS_AFTER_OPERAND, false);
+      return false;
+    }
+
+    scanner_check_jump (false, tok.loc);
+    scanner_set_position (SCANNER_POS_STATEMENT, false);
+  }
+
+  if (was_newline)
+  {
+    if (expr.pos == SCANNER_POS_RETURN_ARGUMENT)
+    {
+      scanner_set_position (SCANNER_POS_STATEMENT, false);
+    }
+    else if (expr.pos == SCANNER_POS_AFTER_OPERAND
+             && (tok.type == TOK_DOUBLE_PLUS
+                 || tok.type == TOK_DOUBLE_MINUS
+                 || tok.type == TOK_OPEN_BRACE
+                 || (tok.type != TOK_OPEN_PAREN
+                     && tok.type != TOK_OPEN_SQUARE
+                     && tok.type != TOK_PLUS
+                     && tok.type != TOK_MINUS
+                     && !scanner_is_not_operand_start (tok))))
+    {
+      /* automatic semicolon insertion */
+      scanner_start_statement (tok.loc);
+    }
+  }
+
+  if (expr.is_operand_required
+      && scanner_is_not_operand_start (tok)
+      && expr.pos != SCANNER_POS_MEMBER_NAME)
+  {
+    PARSE_ERROR ("Expected expression", tok.loc);
+  }
+
+  switch (expr.pos)
+  {
+    case SCANNER_POS_VAR_NAME:
+    {
+      scanner_check_declared_name (tok);
+
+      scanner_set_position (SCANNER_POS_EXPRESSION, false);
+      scanner_start_operand (tok, true, true);
+      expr.is_eval_or_arguments = false;
+      return false;
+    }
+    case SCANNER_POS_CATCH_PARAMETER:
+    {
+      scanner_check_declared_name (tok);
+
+      scanner_set_position (SCANNER_POS_AFTER_OPERAND, false);
+      return false;
+    }
+    case SCANNER_POS_MEMBER_NAME:
+    {
+      if (tok.type != TOK_NAME
+          && tok.type != TOK_KEYWORD
+          && tok.type != TOK_NULL
+          && tok.type != TOK_BOOL)
+      {
+        PARSE_ERROR ("Expected identifier", tok.loc);
+      }
+
+      scanner_set_position (SCANNER_POS_AFTER_OPERAND, false);
+      scanner_continue_operand ();
+      return false;
+    }
+    case SCANNER_POS_PROPERTY_NAME:
+    {
+      if (tok.type == TOK_CLOSE_BRACE)
+      {
+        break;
+      }
+
+      /* FALLTHRU */
+    }
+    case SCANNER_POS_AFTER_PROPERTY_NAME:
+    {
+      scanner_scan_property_name (tok);
+      return false;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  switch (tok.type)
+  {
+    case TOK_NAME:
+    {
+      scanner_start_operand (tok, true, true);
+      break;
+    }
+    case TOK_SMALL_INT:
+    case TOK_NUMBER:
+    case TOK_NULL:
+    case TOK_BOOL:
+    case TOK_STRING:
+    case TOK_REGEXP:
+    {
+      scanner_start_operand (tok, false, false);
+      break;
+    }
+    case TOK_KEYWORD:
+    {
+      if ((keyword) tok.uid == KW_WHILE && is_after_do_loop_body_closing_brace)
+      {
+        is_after_do_loop_body = true;
+      }
+
+      scanner_scan_keyword (tok);
+      break;
+    }
+    case TOK_OPEN_BRACE:
+    case TOK_OPEN_PAREN:
+    case TOK_OPEN_SQUARE:
+    {
+      scanner_scan_opening_bracket (tok);
+      break;
+    }
+    case TOK_CLOSE_BRACE:
+    case TOK_CLOSE_PAREN:
+    case TOK_CLOSE_SQUARE:
+    {
+      return scanner_scan_closing_bracket (tok);
+    }
+    default:
+    {
+      scanner_scan_punctuator (tok, was_newline);
+      break;
+    }
+  }
+
+  return false;
+} /* scanner_scan_token */
+
+/**
+ * Skip body of a function, deferring the body's compilation till the function's first call,
+ * and check the body for a subset of early errors
+ *
+ * Note:
+ *      opening brace of the body should be the last token, returned by the lexer,
+ *      when the routine is called
+ *
+ * @return closing brace of the body
+ */
+token
+scanner_skip_function_body (bool is_strict_mode, /**< the function's code inherited strict mode
+                                                  *   from code of an outer scope */
+                            scanner_function_body_info_t *out_info_p) /**< out: description of the body */
+{
+  out_info_p->is_use_strict = false;
+  out_info_p->is_ref_arguments_identifier = false;
+  out_info_p->is_ref_eval_identifier = false;
+
+  body_info_p = out_info_p;
+  is_strict = is_strict_mode;
+  function_header = SCANNER_FUNCTION_NONE;
+  is_accessor = false;
+  expected_header = SCANNER_STATEMENT_NONE;
+  expected_body = SCANNER_STATEMENT_NONE;
+  is_after_do_loop_body = false;
+  is_continue = false;
+
+  /* the stack is allocated with jsp-mm, so it is released upon a syntax error together with other
+   * parser's allocations */
+  STACK_INIT (scanner_brackets);
+
+  scanner_reset_expression (SCANNER_POS_STATEMENT, false);
+  scanner_start_function_body (SCANNER_BRACKET_FLAGS__EMPTY);
+
+  token tok;
+  bool was_newline = false;
+
+  while (true)
+  {
+    /* literals are only registered for directives and for formal parameters of nested functions */
+    lexer_set_skip_mode (!is_function_body_start
+                         && !(expr.pos == SCANNER_POS_PARAMETER && !is_accessor));
+
+    tok = lexer_next_token ();
+
+    if (tok.type == TOK_NEWLINE)
+    {
+      was_newline = true;
+      continue;
+    }
+
+    if (scanner_scan_token (tok, was_newline))
+    {
+      break;
+    }
+
+    was_newline = false;
+  }
+
+  lexer_set_skip_mode (false);
+
+  STACK_FREE (scanner_brackets);
+
+  return tok;
+} /* scanner_skip_function_body */
@@ -0,0 +1,33 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SCANNER_H
+#define SCANNER_H
+
+#include "lexer.h"
+
+/**
+ * Description of a function's body, collected by scanner_skip_function_body
+ */
+typedef struct
+{
+  bool is_use_strict; /**< the body starts with 'use strict' directive */
+  bool is_ref_arguments_identifier; /**< 'arguments' identifier is referenced in the body */
+  bool is_ref_eval_identifier; /**< 'eval' identifier is referenced in the body */
+} scanner_function_body_info_t;
+
+token scanner_skip_function_body (bool, scanner_function_body_info_t *);
+
+#endif /* SCANNER_H */
@@ -15,33 +15,140 @@
 
 #include "serializer.h"
 #include "bytecode-data.h"
+#include "jsp-eval-cache.h"
 #include "pretty-printer.h"
 #include "array-list.h"
+#include "hash-table.h"
+#include "jsp-mm.h"
+#include "lexer.h"
+#include "optimizer.h"
+
+#define OPCODE(op) (__op__idx_##op)
+#define HASH_SIZE 128
 
 static bytecode_data_t bytecode_data;
-static scopes_tree current_scope;
 static bool print_opcodes;
 
+/**
+ * Instructions of currently parsed source, in order of their placement in the byte-code array
+ */
+static array_list op_metas;
+
+/**
+ * State of conversion of the instructions to byte-code array (see also: serializer_finalize_bytecode)
+ */
+static hash_table lit_id_to_uid = null_hash;
+static opcode_counter_t global_oc;
+static idx_t next_uid;
+
+/**
+ * Literals of each block of instructions, in order of the blocks and of the literals' uids in the blocks,
+ * and number of the literals in each block (see also: change_uid)
+ */
+static array_list block_lit_ids;
+static idx_t *block_lit_ids_nums_p;
+
+/**
+ * Opcode counters of currently parsed source, that don't fit into a pair of instruction arguments
+ *
+ * See also:
+ *          OPCODE_COUNTER_LONG_IDX_FIRST
+ */
+static array_list long_opcode_counters;
+
+/**
+ * Descriptors of function bodies of currently parsed source, which compilation is deferred
+ *
+ * See also:
+ *          lazy_function_body_t
+ */
+static array_list lazy_function_bodies;
+
 static void
-serializer_print_opcodes (const opcode_t *opcodes_p,
+serializer_print_opcodes (const opcode_compact_t *opcodes_p,
                           size_t opcodes_count);
+#ifdef JERRY_ENABLE_PRETTY_PRINTER
+static void
+serializer_print_op_metas (void);
+#endif /* JERRY_ENABLE_PRETTY_PRINTER */
+
+#ifdef VM_PROFILE
+/**
+ * Get number of the source line, that is currently parsed
+ *
+ * @return line number (lines with numbers, greater than UINT16_MAX, are accounted as line UINT16_MAX)
+ */
+static uint16_t
+serializer_get_current_line (void)
+{
+  return (uint16_t) JERRY_MIN (lexer_get_current_line (), UINT16_MAX);
+} /* serializer_get_current_line */
+
+/**
+ * Get position of the instruction in the sources, that were parsed since the engine's initialization
+ *
+ * @return true - if the byte-code array is known to the serializer (the position is returned
+ *                through out_code_index_p and out_line_p),
+ *         false - otherwise.
+ */
+bool
+serializer_get_instruction_source_position (const opcode_compact_t *opcodes_p, /**< byte-code array */
+                                            opcode_counter_t oc, /**< position of the instruction
+                                                                  *   in the byte-code array */
+                                            uint32_t *out_code_index_p, /**< out: index of the byte-code array
+                                                                         *        in order of parse (0 - for
+                                                                         *        the first parsed source) */
+                                            uint32_t *out_line_p) /**< out: source line number
+                                                                   *        (counted from 1) */
+{
+  uint32_t arrays_after = 0;
+  bool is_found = false;
+
+  for (const opcode_compact_t *iter_p = bytecode_data.opcodes;
+       iter_p != NULL;
+       iter_p = MEM_CP_GET_POINTER (opcode_compact_t, GET_BYTECODE_HEADER (iter_p)->next_opcodes_cp))
+  {
+    if (is_found)
+    {
+      arrays_after++;
+    }
+    else if (iter_p == opcodes_p)
+    {
+      is_found = true;
+    }
+  }
+
+  if (!is_found)
+  {
+    return false;
+  }
+
+  const opcodes_header_t *header_p = GET_BYTECODE_HEADER (opcodes_p);
+  JERRY_ASSERT (oc < header_p->instructions_number);
+
+  *out_code_index_p = arrays_after;
+  *out_line_p = MEM_CP_GET_NON_NULL_POINTER (uint16_t, header_p->lines_cp)[oc];
+
+  return true;
+} /* serializer_get_instruction_source_position */
+#endif /* VM_PROFILE */
 
 op_meta
 serializer_get_op_meta (opcode_counter_t oc)
 {
-  JERRY_ASSERT (current_scope);
-  return scopes_tree_op_meta (current_scope, oc);
+  JERRY_ASSERT (oc < serializer_get_current_opcode_counter ());
+  return *(op_meta *) array_list_element (op_metas, oc);
 }
 
 /**
- * Get byte-code instruction from current scope, or specified byte-code array
+ * Get byte-code instruction of currently parsed source, or from specified byte-code array
  *
  * @return byte-code instruction
  */
 opcode_t
-serializer_get_opcode (const opcode_t *opcodes_p, /**< pointer to byte-code array (or NULL,
-                                                   *   if instruction should be taken from
-                                                   *   instruction list of current scope) */
+serializer_get_opcode (const opcode_compact_t *opcodes_p, /**< pointer to byte-code array (or NULL,
+                                                           *   if instruction should be taken from
+                                                           *   instruction list of currently parsed source) */
                        opcode_counter_t oc) /**< opcode counter of the intruction */
 {
   if (opcodes_p == NULL)
@@ -51,7 +158,29 @@ serializer_get_opcode (const opcode_t *opcodes_p, /**< pointer to byte-code arra
   else
   {
     JERRY_ASSERT (oc < GET_BYTECODE_HEADER (opcodes_p)->instructions_number);
-    return opcodes_p[oc];
+
+    const opcode_compact_t *compact_p = &opcodes_p[oc];
+
+    if (likely ((compact_p->op_idx & OPCODE_COMPACT_WIDE_FLAG) == 0))
+    {
+      opcode_t opcode;
+      raw_opcode *raw_p = (raw_opcode *) &opcode;
+
+      raw_p->uids[0] = compact_p->op_idx;
+      raw_p->uids[1] = compact_p->args[0];
+      raw_p->uids[2] = compact_p->args[1];
+      raw_p->uids[3] = compact_p->args[2];
+
+      return opcode;
+    }
+    else
+    {
+      const size_t index = (((size_t) compact_p->args[0] << (2 * JERRY_BITSINBYTE))
+                            | ((size_t) compact_p->args[1] << JERRY_BITSINBYTE)
+                            | compact_p->args[2]);
+
+      return MEM_CP_GET_NON_NULL_POINTER (opcode_t, GET_BYTECODE_HEADER (opcodes_p)->wide_opcodes_cp)[index];
+    }
   }
 } /* serializer_get_opcode */
 
@@ -59,14 +188,14 @@ serializer_get_opcode (const opcode_t *opcodes_p, /**< pointer to byte-code arra
  * Convert literal id (operand value of instruction) to compressed pointer to literal
  *
  * Bytecode is divided into blocks of fixed size and each block has independent encoding of variable names,
- * which are represented by 8 bit numbers - ids.
+ * which are represented by numbers - ids (see also: BLOCK_LIT_UID_WIDE_FLAG).
  * This function performs conversion from id to literal.
  *
  * @return compressed pointer to literal
  */
 lit_cpointer_t
-serializer_get_literal_cp_by_uid (uint8_t id, /**< literal idx */
-                                  const opcode_t *opcodes_p, /**< pointer to bytecode */
+serializer_get_literal_cp_by_uid (idx_t id, /**< literal idx */
+                                  const opcode_compact_t *opcodes_p, /**< pointer to bytecode */
                                   opcode_counter_t oc) /**< position in the bytecode */
 {
   lit_id_hash_table *lit_id_hash = GET_HASH_TABLE_FOR_BYTECODE (opcodes_p == NULL ? bytecode_data.opcodes : opcodes_p);
@@ -74,48 +203,658 @@ serializer_get_literal_cp_by_uid (uint8_t id, /**< literal idx */
   {
     return INVALID_LITERAL;
   }
-  return lit_id_hash_table_lookup (lit_id_hash, id, oc);
+  return lit_id_hash_table_lookup (lit_id_hash, (idx_t) (id & ~BLOCK_LIT_UID_WIDE_FLAG), oc);
 } /* serializer_get_literal_cp_by_uid */
 
+/**
+ * Register an opcode counter that doesn't fit into a pair of instruction arguments
+ *
+ * @return index of the counter in the table of long opcode counters of currently parsed source
+ */
+size_t
+serializer_register_long_opcode_counter (opcode_counter_t oc) /**< opcode counter */
+{
+  JERRY_ASSERT (oc >= OPCODE_COUNTER_MAX_SHORT_VALUE && oc != MAX_OPCODES);
+
+  if (long_opcode_counters == null_list)
+  {
+    long_opcode_counters = array_list_init (sizeof (opcode_counter_t));
+  }
+
+  const size_t counters_num = array_list_len (long_opcode_counters);
+  for (size_t index = 0; index < counters_num; index++)
+  {
+    if (*(opcode_counter_t *) array_list_element (long_opcode_counters, index) == oc)
+    {
+      return index;
+    }
+  }
+
+  long_opcode_counters = array_list_append (long_opcode_counters, &oc);
+
+  return counters_num;
+} /* serializer_register_long_opcode_counter */
+
+/**
+ * Get opcode counter from table of long opcode counters of specified byte-code array,
+ * or of currently parsed source
+ *
+ * @return opcode counter
+ */
+opcode_counter_t
+serializer_get_long_opcode_counter (const opcode_compact_t *opcodes_p, /**< pointer to byte-code array (or NULL,
+                                                                        *   if the counter should be taken from
+                                                                        *   the table of currently parsed source) */
+                                    uint16_t index) /**< index of the counter in the table */
+{
+  if (opcodes_p == NULL)
+  {
+    JERRY_ASSERT (index < array_list_len (long_opcode_counters));
+
+    return *(opcode_counter_t *) array_list_element (long_opcode_counters, index);
+  }
+  else
+  {
+    return GET_LONG_OPCODE_COUNTERS_FOR_BYTECODE (opcodes_p)[index];
+  }
+} /* serializer_get_long_opcode_counter */
+
+/**
+ * Reset table of long opcode counters before parse of a new source
+ */
+void
+serializer_reset_long_opcode_counters (void)
+{
+  /* the table is allocated with jsp-mm, that is released upon end of each parse */
+  long_opcode_counters = null_list;
+} /* serializer_reset_long_opcode_counters */
+
+/**
+ * Check whether one more lazily compiled function body can be registered for the currently parsed source
+ *
+ * @return true - if the table of lazily compiled bodies of the source is not full,
+ *         false - otherwise.
+ */
+bool
+serializer_can_register_lazy_function_body (void)
+{
+  return (lazy_function_bodies == null_list
+          || array_list_len (lazy_function_bodies) <= UINT16_MAX);
+} /* serializer_can_register_lazy_function_body */
+
+/**
+ * Register source code of a function's body, which compilation is deferred till the function's first call
+ *
+ * Note:
+ *      the source code is copied to a heap block, that is released after the body is compiled
+ *      (see also: ecma_op_function_call)
+ *
+ * Note:
+ *      the table should have room for the body (see also: serializer_can_register_lazy_function_body)
+ *
+ * @return index of the body's descriptor
+ */
+uint16_t
+serializer_register_lazy_function_body (const lit_utf8_byte_t *source_p, /**< source code of the body */
+                                        lit_utf8_size_t source_size) /**< size of the source code */
+{
+  JERRY_ASSERT (serializer_can_register_lazy_function_body ());
+
+  if (lazy_function_bodies == null_list)
+  {
+    lazy_function_bodies = array_list_init (sizeof (lazy_function_body_t));
+  }
+
+  const size_t bodies_num = array_list_len (lazy_function_bodies);
+
+  lazy_function_body_source_t *body_source_p;
+  body_source_p = (lazy_function_body_source_t *) mem_heap_alloc_block (sizeof (lazy_function_body_source_t)
+                                                                        + source_size,
+                                                                        MEM_HEAP_ALLOC_LONG_TERM);
+  body_source_p->size = source_size;
+  memcpy (body_source_p + 1, source_p, source_size);
+
+  lazy_function_body_t body;
+  MEM_CP_SET_NON_NULL_POINTER (body.source_cp, body_source_p);
+  body.bytecode_cp = MEM_CP_NULL;
+
+  lazy_function_bodies = array_list_append (lazy_function_bodies, &body);
+
+  return (uint16_t) bodies_num;
+} /* serializer_register_lazy_function_body */
+
+/**
+ * Reset table of lazily compiled function bodies before parse of a new source
+ */
+void
+serializer_reset_lazy_function_bodies (void)
+{
+  /* the table is allocated with jsp-mm, that is released upon end of each parse */
+  lazy_function_bodies = null_list;
+} /* serializer_reset_lazy_function_bodies */
+
+/**
+ * Release source code of function bodies, registered during parse of a source, that contains a syntax error
+ */
+void
+serializer_free_lazy_function_bodies (void)
+{
+  if (lazy_function_bodies == null_list)
+  {
+    return;
+  }
+
+  for (size_t index = 0; index < array_list_len (lazy_function_bodies); index++)
+  {
+    lazy_function_body_t *body_p = (lazy_function_body_t *) array_list_element (lazy_function_bodies, index);
+
+    mem_heap_free_block (MEM_CP_GET_NON_NULL_POINTER (lazy_function_body_source_t, body_p->source_cp));
+  }
+
+  array_list_free (lazy_function_bodies);
+  lazy_function_bodies = null_list;
+} /* serializer_free_lazy_function_bodies */
+
 void
 serializer_set_strings_buffer (const ecma_char_t *s)
 {
   bytecode_data.strings_buffer = s;
 }
 
+/**
+ * Start instructions list of a new source
+ */
 void
-serializer_set_scope (scopes_tree new_scope)
+serializer_reset_instructions (void)
+{
+  /* the list is allocated with jsp-mm, that is released upon end of each parse */
+  op_metas = array_list_init (sizeof (op_meta));
+} /* serializer_reset_instructions */
+
+#ifndef CONFIG_PARSER_BYTECODE_OPTIMIZER_DISABLE
+/**
+ * Optimize instructions of currently parsed source
+ */
+static void
+serializer_optimize_instructions (void)
 {
-  current_scope = new_scope;
+  opcode_counter_t ops_num = serializer_get_current_opcode_counter ();
+
+  if (ops_num >= OPCODE_COUNTER_MAX_SHORT_VALUE)
+  {
+    /* the instructions can contain long offsets, that are not supported by the optimizer */
+    return;
+  }
+
+#ifdef JERRY_ENABLE_PRETTY_PRINTER
+  if (print_opcodes)
+  {
+    printf ("// before optimization:\n");
+    serializer_print_op_metas ();
+  }
+#endif /* JERRY_ENABLE_PRETTY_PRINTER */
+
+  const bool is_optimized = optimizer_optimize_instructions ((op_meta *) array_list_element (op_metas, 0), &ops_num);
+
+  if (is_optimized)
+  {
+    array_list_truncate (op_metas, ops_num);
+
+#ifdef JERRY_ENABLE_PRETTY_PRINTER
+    if (print_opcodes)
+    {
+      printf ("// after optimization:\n");
+      serializer_print_op_metas ();
+    }
+#endif /* JERRY_ENABLE_PRETTY_PRINTER */
+  }
+} /* serializer_optimize_instructions */
+#endif /* !CONFIG_PARSER_BYTECODE_OPTIMIZER_DISABLE */
+
+static idx_t
+get_uid (op_meta *op, uint8_t i)
+{
+  JERRY_ASSERT (i < 4);
+  raw_opcode *raw = (raw_opcode *) &op->op;
+  return raw->uids[i + 1];
 }
 
-const opcode_t *
-serializer_merge_scopes_into_bytecode (void)
+static void
+set_uid (op_meta *op, uint8_t i, idx_t uid)
 {
-  bytecode_data.opcodes_count = scopes_tree_count_opcodes (current_scope);
+  JERRY_ASSERT (i < 4);
+  raw_opcode *raw = (raw_opcode *) &op->op;
+  raw->uids[i + 1] = uid;
+}
 
-  const size_t buckets_count = scopes_tree_count_literals_in_blocks (current_scope);
-  const size_t blocks_count = (size_t) bytecode_data.opcodes_count / BLOCK_SIZE + 1;
-  const opcode_counter_t opcodes_count = scopes_tree_count_opcodes (current_scope);
+static uint16_t
+lit_id_hash (void * lit_id)
+{
+  return ((lit_cpointer_t *) lit_id)->packed_value % HASH_SIZE;
+}
 
-  const size_t opcodes_array_size = JERRY_ALIGNUP (sizeof (opcodes_header_t) + opcodes_count * sizeof (opcode_t),
-                                                   MEM_ALIGNMENT);
-  const size_t lit_id_hash_table_size = JERRY_ALIGNUP (lit_id_hash_table_get_size_for_table (buckets_count,
-                                                                                             blocks_count),
-                                                       MEM_ALIGNMENT);
+static void
+start_new_block_if_necessary (void)
+{
+  if (global_oc % BLOCK_SIZE == 0)
+  {
+    next_uid = 0;
+    if (lit_id_to_uid != null_hash)
+    {
+      hash_table_free (lit_id_to_uid);
+      lit_id_to_uid = null_hash;
+    }
+    lit_id_to_uid = hash_table_init (sizeof (lit_cpointer_t), sizeof (idx_t), HASH_SIZE, lit_id_hash);
+  }
+}
 
-  uint8_t *buffer_p = (uint8_t*) mem_heap_alloc_block (opcodes_array_size + lit_id_hash_table_size,
-                                                       MEM_HEAP_ALLOC_LONG_TERM);
+static bool
+is_possible_literal (uint16_t mask, uint8_t index)
+{
+  int res;
+  switch (index)
+  {
+    case 0:
+    {
+      res = mask >> 8;
+      break;
+    }
+    case 1:
+    {
+      res = (mask & 0xF0) >> 4;
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (index = 2);
+      res = mask & 0x0F;
+    }
+  }
+  JERRY_ASSERT (res == 0 || res == 1);
+  return res == 1;
+}
 
-  lit_id_hash_table *lit_id_hash = lit_id_hash_table_init (buffer_p + opcodes_array_size,
-                                                           lit_id_hash_table_size,
-                                                           buckets_count, blocks_count);
+/**
+ * Replace literal arguments of the instruction with uids of the literals in current block of instructions
+ *
+ * Note:
+ *      literals, that are met in the block for the first time, are appended to the list of the block's literals,
+ *      so the list is ordered by the uids (see also: serializer_finalize_bytecode)
+ */
+static void
+change_uid (op_meta *om, /**< instruction */
+            uint16_t mask) /**< mask of the instruction's arguments, that can be literals */
+{
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    if (is_possible_literal (mask, i))
+    {
+      if (get_uid (om, i) == LITERAL_TO_REWRITE)
+      {
+        JERRY_ASSERT (om->lit_id[i].packed_value != MEM_CP_NULL);
+        lit_cpointer_t lit_id = om->lit_id[i];
+        idx_t *uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &lit_id);
+        if (uid == NULL)
+        {
+          hash_table_insert (lit_id_to_uid, &lit_id, &next_uid);
+          block_lit_ids = array_list_append (block_lit_ids, &lit_id);
+          uid = (idx_t *) hash_table_lookup (lit_id_to_uid, &lit_id);
+          JERRY_ASSERT (uid != NULL);
+          JERRY_ASSERT (*uid == next_uid);
+          next_uid++;
+          block_lit_ids_nums_p[global_oc / BLOCK_SIZE] = next_uid;
+        }
+        set_uid (om, i, (idx_t) (*uid <= BLOCK_LIT_UID_COMPACT_LAST ? *uid : (*uid | BLOCK_LIT_UID_WIDE_FLAG)));
+      }
+      else
+      {
+        JERRY_ASSERT (om->lit_id[i].packed_value == MEM_CP_NULL);
+      }
+    }
+    else
+    {
+      JERRY_ASSERT (om->lit_id[i].packed_value == MEM_CP_NULL);
+    }
+  }
+}
 
-  const opcode_t *opcodes_p = scopes_tree_raw_data (current_scope, buffer_p, opcodes_array_size, lit_id_hash);
+static opcode_t
+generate_opcode (op_meta *om)
+{
+  start_new_block_if_necessary ();
+  /* Now we should change uids of opcodes.
+     Since different opcodes has different literals/tmps in different places,
+     we should change only them.
+     For each case possible literal positions are shown as 0xYYY literal,
+     where Y is set to '1' when there is a possible literal in this position,
+     and '0' otherwise.  */
+  switch (om->op.op_idx)
+  {
+    case OPCODE (prop_getter):
+    case OPCODE (prop_setter):
+    case OPCODE (delete_prop):
+    case OPCODE (b_shift_left):
+    case OPCODE (b_shift_right):
+    case OPCODE (b_shift_uright):
+    case OPCODE (b_and):
+    case OPCODE (b_or):
+    case OPCODE (b_xor):
+    case OPCODE (equal_value):
+    case OPCODE (not_equal_value):
+    case OPCODE (equal_value_type):
+    case OPCODE (not_equal_value_type):
+    case OPCODE (less_than):
+    case OPCODE (greater_than):
+    case OPCODE (less_or_equal_than):
+    case OPCODE (greater_or_equal_than):
+    case OPCODE (instanceof):
+    case OPCODE (in):
+    case OPCODE (addition):
+    case OPCODE (substraction):
+    case OPCODE (division):
+    case OPCODE (multiplication):
+    case OPCODE (remainder):
+    {
+      change_uid (om, 0x111);
+      break;
+    }
+    case OPCODE (call_n):
+    case OPCODE (native_call):
+    case OPCODE (construct_n):
+    case OPCODE (func_expr_n):
+    case OPCODE (delete_var):
+    case OPCODE (typeof):
+    case OPCODE (b_not):
+    case OPCODE (logical_not):
+    case OPCODE (post_incr):
+    case OPCODE (post_decr):
+    case OPCODE (pre_incr):
+    case OPCODE (pre_decr):
+    case OPCODE (unary_plus):
+    case OPCODE (unary_minus):
+    {
+      change_uid (om, 0x110);
+      break;
+    }
+    case OPCODE (assignment):
+    {
+      switch (om->op.data.assignment.type_value_right)
+      {
+        case OPCODE_ARG_TYPE_SIMPLE:
+        case OPCODE_ARG_TYPE_SMALLINT:
+        case OPCODE_ARG_TYPE_SMALLINT_NEGATE:
+        {
+          change_uid (om, 0x100);
+          break;
+        }
+        case OPCODE_ARG_TYPE_NUMBER:
+        case OPCODE_ARG_TYPE_NUMBER_NEGATE:
+        case OPCODE_ARG_TYPE_REGEXP:
+        case OPCODE_ARG_TYPE_STRING:
+        case OPCODE_ARG_TYPE_VARIABLE:
+        {
+          change_uid (om, 0x101);
+          break;
+        }
+      }
+      break;
+    }
+    case OPCODE (func_decl_n):
+    case OPCODE (array_decl):
+    case OPCODE (obj_decl):
+    case OPCODE (this_binding):
+    case OPCODE (with):
+    case OPCODE (for_in):
+    case OPCODE (throw_value):
+    case OPCODE (is_true_jmp_up):
+    case OPCODE (is_true_jmp_down):
+    case OPCODE (is_false_jmp_up):
+    case OPCODE (is_false_jmp_down):
+    case OPCODE (var_decl):
+    case OPCODE (retval):
+    {
+      change_uid (om, 0x100);
+      break;
+    }
+    case OPCODE (ret):
+    case OPCODE (try_block):
+    case OPCODE (jmp_up):
+    case OPCODE (jmp_down):
+    case OPCODE (nop):
+    case OPCODE (reg_var_decl):
+    {
+      change_uid (om, 0x000);
+      break;
+    }
+    case OPCODE (meta):
+    {
+      switch (om->op.data.meta.type)
+      {
+        case OPCODE_META_TYPE_VARG_PROP_DATA:
+        case OPCODE_META_TYPE_VARG_PROP_GETTER:
+        case OPCODE_META_TYPE_VARG_PROP_SETTER:
+        {
+          change_uid (om, 0x011);
+          break;
+        }
+        case OPCODE_META_TYPE_VARG:
+        case OPCODE_META_TYPE_CATCH_EXCEPTION_IDENTIFIER:
+        {
+          change_uid (om, 0x010);
+          break;
+        }
+        case OPCODE_META_TYPE_UNDEFINED:
+        case OPCODE_META_TYPE_END_WITH:
+        case OPCODE_META_TYPE_FUNCTION_END:
+        case OPCODE_META_TYPE_CATCH:
+        case OPCODE_META_TYPE_FINALLY:
+        case OPCODE_META_TYPE_END_TRY_CATCH_FINALLY:
+        case OPCODE_META_TYPE_CALL_SITE_INFO:
+        case OPCODE_META_TYPE_SCOPE_CODE_FLAGS:
+        case OPCODE_META_TYPE_LAZY_FUNCTION_BODY:
+        case OPCODE_META_TYPE_SCOPE_DECLARATIONS:
+        case OPCODE_META_TYPE_FUNCTION_DECLARATION:
+        case OPCODE_META_TYPE_END_SCOPE_DECLARATIONS:
+        {
+          change_uid (om, 0x000);
+          break;
+        }
+      }
+      break;
+    }
+  }
+  return om->op;
+}
+
+/**
+ * Store the instruction at current position of byte-code array
+ *
+ * Note:
+ *      if an argument of the instruction doesn't fit into a byte, the instruction is appended
+ *      to the table of wide instructions, and the byte-code array holds index of the instruction
+ *      in the table (see also: OPCODE_COMPACT_WIDE_FLAG)
+ */
+static void
+store_opcode (opcode_compact_t *data, /**< byte-code array */
+              opcode_t opcode, /**< instruction */
+              array_list *wide_opcodes_p) /**< in-out: table of wide instructions */
+{
+  raw_opcode *raw_p = (raw_opcode *) &opcode;
+  opcode_compact_t *compact_p = &data[global_oc];
+
+  JERRY_ASSERT (raw_p->uids[0] < OPCODE_COMPACT_WIDE_FLAG);
+
+  if (raw_p->uids[1] <= UINT8_MAX
+      && raw_p->uids[2] <= UINT8_MAX
+      && raw_p->uids[3] <= UINT8_MAX)
+  {
+    compact_p->op_idx = (uint8_t) raw_p->uids[0];
+    compact_p->args[0] = (uint8_t) raw_p->uids[1];
+    compact_p->args[1] = (uint8_t) raw_p->uids[2];
+    compact_p->args[2] = (uint8_t) raw_p->uids[3];
+  }
+  else
+  {
+    if (*wide_opcodes_p == null_list)
+    {
+      *wide_opcodes_p = array_list_init (sizeof (opcode_t));
+    }
+
+    /* the index is less than MAX_OPCODES, so it fits into the three argument bytes */
+    const size_t index = array_list_len (*wide_opcodes_p);
+    JERRY_ASSERT (index < MAX_OPCODES);
+
+    *wide_opcodes_p = array_list_append (*wide_opcodes_p, &opcode);
+
+    compact_p->op_idx = (uint8_t) (raw_p->uids[0] | OPCODE_COMPACT_WIDE_FLAG);
+    compact_p->args[0] = (uint8_t) (index >> (2 * JERRY_BITSINBYTE));
+    compact_p->args[1] = (uint8_t) (index >> JERRY_BITSINBYTE);
+    compact_p->args[2] = (uint8_t) index;
+  }
+} /* store_opcode */
+
+/**
+ * Convert instructions of currently parsed source to a byte-code array
+ *
+ * Note:
+ *      the instructions are already placed in their final order (function declarations are not hoisted,
+ *      and are instantiated through the scopes' declarations tables, see also: OPCODE_META_TYPE_SCOPE_DECLARATIONS),
+ *      so they are converted to compact form in a single pass, that also replaces literal arguments
+ *      with uids of the literals in the instructions' blocks; the literal identifiers hash table
+ *      is allocated upon the pass, with the exact number of the blocks' literals.
+ *
+ * @return pointer to the byte-code array
+ */
+const opcode_compact_t *
+serializer_finalize_bytecode (void)
+{
+#ifndef CONFIG_PARSER_BYTECODE_OPTIMIZER_DISABLE
+  serializer_optimize_instructions ();
+#endif /* !CONFIG_PARSER_BYTECODE_OPTIMIZER_DISABLE */
+
+  const opcode_counter_t opcodes_count = serializer_get_current_opcode_counter ();
+  const size_t blocks_count = (size_t) opcodes_count / BLOCK_SIZE + 1;
+  bytecode_data.opcodes_count = opcodes_count;
+
+  const size_t opcodes_array_size = JERRY_ALIGNUP (sizeof (opcodes_header_t)
+                                                   + opcodes_count * sizeof (opcode_compact_t),
+                                                   MEM_ALIGNMENT);
+  const size_t long_opcode_counters_num = (long_opcode_counters == null_list
+                                           ? 0
+                                           : array_list_len (long_opcode_counters));
+  const size_t long_opcode_counters_size = JERRY_ALIGNUP (long_opcode_counters_num * sizeof (opcode_counter_t),
+                                                          MEM_ALIGNMENT);
+
+  uint8_t *buffer_p = (uint8_t*) mem_heap_alloc_block (opcodes_array_size + long_opcode_counters_size,
+                                                       MEM_HEAP_ALLOC_LONG_TERM);
+  memset (buffer_p, 0, opcodes_array_size);
 
   opcodes_header_t *header_p = (opcodes_header_t*) buffer_p;
+  opcode_compact_t *opcodes_p = (opcode_compact_t *) (buffer_p + sizeof (opcodes_header_t));
+
   MEM_CP_SET_POINTER (header_p->next_opcodes_cp, bytecode_data.opcodes);
   header_p->instructions_number = opcodes_count;
+
+  opcode_counter_t *long_opcode_counters_p = (opcode_counter_t *) (buffer_p + opcodes_array_size);
+  for (size_t index = 0; index < long_opcode_counters_num; index++)
+  {
+    long_opcode_counters_p[index] = *(opcode_counter_t *) array_list_element (long_opcode_counters, index);
+  }
+
+  if (long_opcode_counters != null_list)
+  {
+    array_list_free (long_opcode_counters);
+    long_opcode_counters = null_list;
+  }
+
+#ifdef VM_PROFILE
+  uint16_t *lines_p = (uint16_t *) mem_heap_alloc_block (opcodes_count * sizeof (uint16_t), MEM_HEAP_ALLOC_LONG_TERM);
+  MEM_CP_SET_NON_NULL_POINTER (header_p->lines_cp, lines_p);
+#endif /* VM_PROFILE */
+
+  block_lit_ids = array_list_init (sizeof (lit_cpointer_t));
+  block_lit_ids_nums_p = (idx_t *) jsp_mm_alloc (blocks_count * sizeof (idx_t));
+  memset (block_lit_ids_nums_p, 0, blocks_count * sizeof (idx_t));
+
+  array_list wide_opcodes = null_list;
+
+  for (global_oc = 0; global_oc < opcodes_count; global_oc++)
+  {
+    op_meta *om_p = (op_meta *) array_list_element (op_metas, global_oc);
+
+    store_opcode (opcodes_p, generate_opcode (om_p), &wide_opcodes);
+
+#ifdef VM_PROFILE
+    lines_p[global_oc] = om_p->line;
+#endif /* VM_PROFILE */
+  }
+
+  if (lit_id_to_uid != null_hash)
+  {
+    hash_table_free (lit_id_to_uid);
+    lit_id_to_uid = null_hash;
+  }
+
+  const size_t lit_ids_num = array_list_len (block_lit_ids);
+  const size_t lit_id_hash_table_size = lit_id_hash_table_get_size_for_table (lit_ids_num, blocks_count);
+  lit_id_hash_table *lit_id_hash = lit_id_hash_table_init ((uint8_t *) mem_heap_alloc_block (lit_id_hash_table_size,
+                                                                                             MEM_HEAP_ALLOC_LONG_TERM),
+                                                           lit_id_hash_table_size,
+                                                           lit_ids_num,
+                                                           blocks_count);
+
+  size_t lit_id_index = 0;
+  for (size_t block_id = 0; block_id < blocks_count; block_id++)
+  {
+    for (idx_t uid = 0; uid < block_lit_ids_nums_p[block_id]; uid++)
+    {
+      lit_id_hash_table_insert (lit_id_hash,
+                                uid,
+                                (opcode_counter_t) (block_id * BLOCK_SIZE),
+                                *(lit_cpointer_t *) array_list_element (block_lit_ids, lit_id_index++));
+    }
+  }
+  JERRY_ASSERT (lit_id_index == lit_ids_num);
+
+  MEM_CP_SET_NON_NULL_POINTER (header_p->lit_id_hash_cp, lit_id_hash);
+
+  jsp_mm_free (block_lit_ids_nums_p);
+  block_lit_ids_nums_p = NULL;
+  array_list_free (block_lit_ids);
+  block_lit_ids = null_list;
+
+  if (wide_opcodes != null_list)
+  {
+    const size_t wide_opcodes_num = array_list_len (wide_opcodes);
+
+    opcode_t *wide_opcodes_p = (opcode_t *) mem_heap_alloc_block (wide_opcodes_num * sizeof (opcode_t),
+                                                                  MEM_HEAP_ALLOC_LONG_TERM);
+    memcpy (wide_opcodes_p, array_list_element (wide_opcodes, 0), wide_opcodes_num * sizeof (opcode_t));
+
+    MEM_CP_SET_NON_NULL_POINTER (header_p->wide_opcodes_cp, wide_opcodes_p);
+
+    array_list_free (wide_opcodes);
+  }
+
+  if (lazy_function_bodies != null_list)
+  {
+    const size_t bodies_num = array_list_len (lazy_function_bodies);
+
+    /* the table is terminated with an empty descriptor */
+    lazy_function_body_t *bodies_p;
+    bodies_p = (lazy_function_body_t *) mem_heap_alloc_block ((bodies_num + 1) * sizeof (lazy_function_body_t),
+                                                              MEM_HEAP_ALLOC_LONG_TERM);
+    memcpy (bodies_p, array_list_element (lazy_function_bodies, 0), bodies_num * sizeof (lazy_function_body_t));
+    bodies_p[bodies_num].source_cp = MEM_CP_NULL;
+    bodies_p[bodies_num].bytecode_cp = MEM_CP_NULL;
+
+    MEM_CP_SET_NON_NULL_POINTER (header_p->lazy_function_bodies_cp, bodies_p);
+
+    array_list_free (lazy_function_bodies);
+    lazy_function_bodies = null_list;
+  }
+
+  JERRY_ASSERT (GET_LONG_OPCODE_COUNTERS_FOR_BYTECODE (opcodes_p) == long_opcode_counters_p);
   bytecode_data.opcodes = opcodes_p;
 
   if (print_opcodes)
@@ -125,45 +864,64 @@ serializer_merge_scopes_into_bytecode (void)
   }
 
   return opcodes_p;
-}
+} /* serializer_finalize_bytecode */
 
 void
 serializer_dump_op_meta (op_meta op)
 {
-  JERRY_ASSERT (scopes_tree_opcodes_num (current_scope) < MAX_OPCODES);
+  JERRY_ASSERT (serializer_get_current_opcode_counter () < MAX_OPCODES);
+
+#ifdef VM_PROFILE
+  op.line = serializer_get_current_line ();
+#endif /* VM_PROFILE */
 
-  scopes_tree_add_op_meta (current_scope, op);
+  op_metas = array_list_append (op_metas, &op);
 
 #ifdef JERRY_ENABLE_PRETTY_PRINTER
   if (print_opcodes)
   {
-    pp_op_meta (NULL, (opcode_counter_t) (scopes_tree_opcodes_num (current_scope) - 1), op, false);
+    pp_op_meta (NULL, (opcode_counter_t) (serializer_get_current_opcode_counter () - 1), op, false);
   }
 #endif
 }
 
-opcode_counter_t
-serializer_get_current_opcode_counter (void)
+#ifdef VM_PROFILE
+/**
+ * Set number of the source line, the instruction of currently parsed source was generated for
+ */
+void
+serializer_set_instruction_line (opcode_counter_t oc, /**< position of the instruction */
+                                 uint32_t line) /**< line number */
 {
-  return scopes_tree_opcodes_num (current_scope);
-}
+  op_meta op = serializer_get_op_meta (oc);
+  op.line = (uint16_t) JERRY_MIN (line, UINT16_MAX);
+
+  array_list_set_element (op_metas, oc, &op);
+} /* serializer_set_instruction_line */
+#endif /* VM_PROFILE */
 
 opcode_counter_t
-serializer_count_opcodes_in_subscopes (void)
+serializer_get_current_opcode_counter (void)
 {
-  return (opcode_counter_t) (scopes_tree_count_opcodes (current_scope) - scopes_tree_opcodes_num (current_scope));
+  return (opcode_counter_t) array_list_len (op_metas);
 }
 
 void
 serializer_set_writing_position (opcode_counter_t oc)
 {
-  scopes_tree_set_opcodes_num (current_scope, oc);
+  JERRY_ASSERT (oc <= serializer_get_current_opcode_counter ());
+  array_list_truncate (op_metas, oc);
 }
 
 void
 serializer_rewrite_op_meta (const opcode_counter_t loc, op_meta op)
 {
-  scopes_tree_set_op_meta (current_scope, loc, op);
+#ifdef VM_PROFILE
+  /* the instruction is rewritten upon parse of following code, so the original line is kept */
+  op.line = serializer_get_op_meta (loc).line;
+#endif /* VM_PROFILE */
+
+  array_list_set_element (op_metas, loc, &op);
 
 #ifdef JERRY_ENABLE_PRETTY_PRINTER
   if (print_opcodes)
@@ -174,7 +932,7 @@ serializer_rewrite_op_meta (const opcode_counter_t loc, op_meta op)
 }
 
 static void
-serializer_print_opcodes (const opcode_t *opcodes_p,
+serializer_print_opcodes (const opcode_compact_t *opcodes_p,
                           size_t opcodes_count)
 {
 #ifdef JERRY_ENABLE_PRETTY_PRINTER
@@ -182,7 +940,7 @@ serializer_print_opcodes (const opcode_t *opcodes_p,
   {
     op_meta opm;
 
-    opm.op = opcodes_p[loc];
+    opm.op = serializer_get_opcode (opcodes_p, loc);
     for (int i = 0; i < 3; i++)
     {
       opm.lit_id[i] = NOT_A_LITERAL;
@@ -196,18 +954,71 @@ serializer_print_opcodes (const opcode_t *opcodes_p,
 #endif
 }
 
+#ifdef JERRY_ENABLE_PRETTY_PRINTER
+/**
+ * Print instructions of currently parsed source
+ */
+static void
+serializer_print_op_metas (void)
+{
+  for (opcode_counter_t loc = 0; loc < serializer_get_current_opcode_counter (); loc++)
+  {
+    pp_op_meta (NULL, loc, serializer_get_op_meta (loc), false);
+  }
+} /* serializer_print_op_metas */
+#endif /* JERRY_ENABLE_PRETTY_PRINTER */
+
 void
 serializer_init ()
 {
-  current_scope = NULL;
+  op_metas = null_list;
   print_opcodes = false;
+  long_opcode_counters = null_list;
 
   bytecode_data.strings_buffer = NULL;
   bytecode_data.opcodes = NULL;
 
   lit_init ();
+  jsp_eval_cache_init ();
 }
 
+/**
+ * Save serializer's state to a heap snapshot
+ *
+ * Note:
+ *      the eval cache is flushed, as it is not stored in the snapshot
+ */
+void
+serializer_save_snapshot_state (serializer_snapshot_state_t *out_state_p) /**< out: serializer's state */
+{
+  JERRY_ASSERT (bytecode_data.strings_buffer == NULL);
+
+  jsp_eval_cache_finalize ();
+
+  out_state_p->opcodes = mem_heap_get_snapshot_pointer (bytecode_data.opcodes);
+  lit_save_snapshot_state (&out_state_p->lit);
+} /* serializer_save_snapshot_state */
+
+/**
+ * Initialize serializer from a heap snapshot
+ *
+ * Note:
+ *      the heap should be already restored from the snapshot
+ */
+void
+serializer_init_from_snapshot (const serializer_snapshot_state_t *state_p) /**< serializer's state */
+{
+  op_metas = null_list;
+  print_opcodes = false;
+  long_opcode_counters = null_list;
+
+  bytecode_data.strings_buffer = NULL;
+  bytecode_data.opcodes = (const opcode_compact_t *) mem_heap_get_pointer_from_snapshot (state_p->opcodes);
+
+  lit_init_from_snapshot (&state_p->lit);
+  jsp_eval_cache_init ();
+} /* serializer_init_from_snapshot */
+
 void serializer_set_show_opcodes (bool show_opcodes)
 {
   print_opcodes = show_opcodes;
@@ -221,12 +1032,43 @@ serializer_free (void)
     mem_heap_free_block ((uint8_t *) bytecode_data.strings_buffer);
   }
 
+  jsp_eval_cache_finalize ();
   lit_finalize ();
 
   while (bytecode_data.opcodes != NULL)
   {
     opcodes_header_t *header_p = GET_BYTECODE_HEADER (bytecode_data.opcodes);
-    bytecode_data.opcodes = MEM_CP_GET_POINTER (opcode_t, header_p->next_opcodes_cp);
+    bytecode_data.opcodes = MEM_CP_GET_POINTER (opcode_compact_t, header_p->next_opcodes_cp);
+
+    if (header_p->lazy_function_bodies_cp != MEM_CP_NULL)
+    {
+      /* byte-code of compiled bodies is released as a separate byte-code region */
+      lazy_function_body_t *bodies_p = MEM_CP_GET_NON_NULL_POINTER (lazy_function_body_t,
+                                                                    header_p->lazy_function_bodies_cp);
+
+      for (lazy_function_body_t *body_p = bodies_p;
+           body_p->source_cp != MEM_CP_NULL || body_p->bytecode_cp != MEM_CP_NULL;
+           body_p++)
+      {
+        if (body_p->source_cp != MEM_CP_NULL)
+        {
+          mem_heap_free_block (MEM_CP_GET_NON_NULL_POINTER (lazy_function_body_source_t, body_p->source_cp));
+        }
+      }
+
+      mem_heap_free_block (bodies_p);
+    }
+
+    if (header_p->wide_opcodes_cp != MEM_CP_NULL)
+    {
+      mem_heap_free_block (MEM_CP_GET_NON_NULL_POINTER (opcode_t, header_p->wide_opcodes_cp));
+    }
+
+    lit_id_hash_table_free (MEM_CP_GET_NON_NULL_POINTER (lit_id_hash_table, header_p->lit_id_hash_cp));
+
+#ifdef VM_PROFILE
+    mem_heap_free_block (MEM_CP_GET_NON_NULL_POINTER (uint16_t, header_p->lines_cp));
+#endif /* VM_PROFILE */
 
     mem_heap_free_block (header_p);
   }
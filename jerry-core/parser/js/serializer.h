@@ -18,23 +18,56 @@
 
 #include "jrt.h"
 #include "ecma-globals.h"
+#include "lexer.h"
 #include "opcodes.h"
 #include "vm.h"
-#include "scopes-tree.h"
+#include "lit-literal.h"
+
+#define NOT_A_LITERAL (lit_cpointer_t::null_cp ())
+
+typedef struct
+{
+  lit_cpointer_t lit_id[3];
+  opcode_t op;
+#ifdef VM_PROFILE
+  uint16_t line; /**< number of source line, the instruction was generated for */
+#endif /* VM_PROFILE */
+} op_meta;
+
+/**
+ * Serializer's state, stored in a heap snapshot
+ */
+typedef struct
+{
+  mem_heap_snapshot_pointer_t opcodes; /**< last byte-code array in the chain of byte-code arrays */
+  lit_snapshot_state_t lit; /**< literal storage's state */
+} serializer_snapshot_state_t;
 
 void serializer_init ();
+void serializer_save_snapshot_state (serializer_snapshot_state_t *);
+void serializer_init_from_snapshot (const serializer_snapshot_state_t *);
 void serializer_set_show_opcodes (bool show_opcodes);
 op_meta serializer_get_op_meta (opcode_counter_t);
-opcode_t serializer_get_opcode (const opcode_t*, opcode_counter_t);
-lit_cpointer_t serializer_get_literal_cp_by_uid (uint8_t, const opcode_t*, opcode_counter_t);
+opcode_t serializer_get_opcode (const opcode_compact_t*, opcode_counter_t);
+lit_cpointer_t serializer_get_literal_cp_by_uid (idx_t, const opcode_compact_t*, opcode_counter_t);
+size_t serializer_register_long_opcode_counter (opcode_counter_t);
+opcode_counter_t serializer_get_long_opcode_counter (const opcode_compact_t *, uint16_t);
+void serializer_reset_long_opcode_counters (void);
+bool serializer_can_register_lazy_function_body (void);
+uint16_t serializer_register_lazy_function_body (const lit_utf8_byte_t *, lit_utf8_size_t);
+void serializer_reset_lazy_function_bodies (void);
+void serializer_free_lazy_function_bodies (void);
 void serializer_set_strings_buffer (const ecma_char_t *);
-void serializer_set_scope (scopes_tree);
-const opcode_t *serializer_merge_scopes_into_bytecode (void);
+void serializer_reset_instructions (void);
+const opcode_compact_t *serializer_finalize_bytecode (void);
 void serializer_dump_op_meta (op_meta);
 opcode_counter_t serializer_get_current_opcode_counter (void);
-opcode_counter_t serializer_count_opcodes_in_subscopes (void);
 void serializer_set_writing_position (opcode_counter_t);
 void serializer_rewrite_op_meta (opcode_counter_t, op_meta);
 void serializer_free (void);
+#ifdef VM_PROFILE
+void serializer_set_instruction_line (opcode_counter_t, uint32_t);
+bool serializer_get_instruction_source_position (const opcode_compact_t *, opcode_counter_t, uint32_t *, uint32_t *);
+#endif /* VM_PROFILE */
 
 #endif // SERIALIZER_H
@@ -19,6 +19,7 @@
 #include "ecma-try-catch-macro.h"
 #include "jrt-libc-includes.h"
 #include "mem-heap.h"
+#include "mem-scratch.h"
 #include "re-compiler.h"
 #include "re-parser.h"
 
@@ -25,6 +25,21 @@ rcs_chunked_list_t::init (void)
   tail_p = NULL;
 } /* rcs_chunked_list_t::init */
 
+/**
+ * Constructor, attaching the list to already existing nodes (see also: jerry_init_from_heap_snapshot)
+ */
+void
+rcs_chunked_list_t::init_from_nodes (node_t *first_node_p, /**< first node of the list */
+                                     node_t *last_node_p) /**< last node of the list */
+{
+  JERRY_ASSERT ((first_node_p == NULL) == (last_node_p == NULL));
+
+  head_p = first_node_p;
+  tail_p = last_node_p;
+
+  assert_list_is_correct ();
+} /* rcs_chunked_list_t::init_from_nodes */
+
 /**
  * Destructor
  */
@@ -55,6 +55,7 @@ public:
   } node_t;
 
   void init (void);
+  void init_from_nodes (node_t *, node_t *);
   void cleanup (void);
   void free (void);
 
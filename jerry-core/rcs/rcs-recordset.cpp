@@ -57,16 +57,15 @@ rcs_recordset_t::record_t::cpointer_t::compress (rcs_record_t* pointer) /**< poi
 {
   rcs_cpointer_t cpointer;
 
+  /* unused bits of the packed value (if any) should be zero, as packed values are compared */
+  cpointer.packed_value = 0;
+
   uintptr_t base_pointer = JERRY_ALIGNDOWN ((uintptr_t) pointer, MEM_ALIGNMENT);
   uintptr_t diff = (uintptr_t) pointer - base_pointer;
 
   JERRY_ASSERT (diff < MEM_ALIGNMENT);
   JERRY_ASSERT (jrt_extract_bit_field (diff, 0, RCS_DYN_STORAGE_ALIGNMENT_LOG) == 0);
 
-  uintptr_t ext_part = (uintptr_t) jrt_extract_bit_field (diff,
-                                                          RCS_DYN_STORAGE_ALIGNMENT_LOG,
-                                                          MEM_ALIGNMENT_LOG - RCS_DYN_STORAGE_ALIGNMENT_LOG);
-
   if ((void*) base_pointer == NULL)
   {
     cpointer.value.base_cp = MEM_CP_NULL;
@@ -75,7 +74,14 @@ rcs_recordset_t::record_t::cpointer_t::compress (rcs_record_t* pointer) /**< poi
   {
     cpointer.value.base_cp = mem_compress_pointer ((void*) base_pointer) & MEM_CP_MASK;
   }
+
+#if MEM_ALIGNMENT_LOG > RCS_DYN_STORAGE_ALIGNMENT_LOG
+  uintptr_t ext_part = (uintptr_t) jrt_extract_bit_field (diff,
+                                                          RCS_DYN_STORAGE_ALIGNMENT_LOG,
+                                                          MEM_ALIGNMENT_LOG - RCS_DYN_STORAGE_ALIGNMENT_LOG);
+
   cpointer.value.ext = ext_part & ((1ull << (MEM_ALIGNMENT_LOG - RCS_DYN_STORAGE_ALIGNMENT_LOG)) - 1);
+#endif /* MEM_ALIGNMENT_LOG > RCS_DYN_STORAGE_ALIGNMENT_LOG */
 
   return cpointer;
 } /* rcs_recordset_t::record_t::cpointer_t::compress */
@@ -99,9 +105,13 @@ rcs_recordset_t::record_t::cpointer_t::decompress (rcs_cpointer_t compressed_poi
     base_pointer = (uint8_t*) mem_decompress_pointer (compressed_pointer.value.base_cp);
   }
 
+#if MEM_ALIGNMENT_LOG > RCS_DYN_STORAGE_ALIGNMENT_LOG
   uintptr_t diff = (uintptr_t) compressed_pointer.value.ext << RCS_DYN_STORAGE_ALIGNMENT_LOG;
 
   return (rcs_recordset_t::record_t*) (base_pointer + diff);
+#else /* MEM_ALIGNMENT_LOG <= RCS_DYN_STORAGE_ALIGNMENT_LOG */
+  return (rcs_recordset_t::record_t*) base_pointer;
+#endif /* MEM_ALIGNMENT_LOG <= RCS_DYN_STORAGE_ALIGNMENT_LOG */
 } /* rcs_recordset_t::record_t::cpointer_t::decompress */
 
 /**
@@ -143,10 +153,11 @@ const
 {
   check_this ();
 
-  JERRY_ASSERT (sizeof (uint32_t) == RCS_DYN_STORAGE_LENGTH_UNIT);
+  JERRY_ASSERT (sizeof (rcs_dyn_storage_unit_t) == RCS_DYN_STORAGE_LENGTH_UNIT);
   JERRY_ASSERT (field_pos + field_width <= RCS_DYN_STORAGE_LENGTH_UNIT * JERRY_BITSINBYTE);
+  JERRY_ASSERT (field_width <= sizeof (uint32_t) * JERRY_BITSINBYTE);
 
-  uint32_t value = *reinterpret_cast<const uint32_t*> (this);
+  rcs_dyn_storage_unit_t value = *reinterpret_cast<const rcs_dyn_storage_unit_t*> (this);
   return (uint32_t) jrt_extract_bit_field (value, field_pos, field_width);
 } /* rcs_recordset_t::record_t::get_field */
 
@@ -160,14 +171,14 @@ rcs_recordset_t::record_t::set_field (uint32_t field_pos, /**< offset, in bits *
 {
   check_this ();
 
-  JERRY_ASSERT (sizeof (uint32_t) == RCS_DYN_STORAGE_LENGTH_UNIT);
+  JERRY_ASSERT (sizeof (rcs_dyn_storage_unit_t) == RCS_DYN_STORAGE_LENGTH_UNIT);
   JERRY_ASSERT (field_pos + field_width <= RCS_DYN_STORAGE_LENGTH_UNIT * JERRY_BITSINBYTE);
 
-  uint32_t prev_value = *reinterpret_cast<uint32_t*> (this);
-  *reinterpret_cast<uint32_t*> (this) = (uint32_t) jrt_set_bit_field_value (prev_value,
-                                                                            value,
-                                                                            field_pos,
-                                                                            field_width);
+  rcs_dyn_storage_unit_t prev_value = *reinterpret_cast<rcs_dyn_storage_unit_t*> (this);
+  *reinterpret_cast<rcs_dyn_storage_unit_t*> (this) = (rcs_dyn_storage_unit_t) jrt_set_bit_field_value (prev_value,
+                                                                                                        value,
+                                                                                                        field_pos,
+                                                                                                        field_width);
 } /* rcs_recordset_t::record_t::set_field */
 
 /**
@@ -182,7 +193,7 @@ const
 {
   cpointer_t cpointer;
 
-  uint16_t value = (uint16_t) get_field (field_pos, field_width);
+  mem_cpointer_t value = (mem_cpointer_t) get_field (field_pos, field_width);
 
   JERRY_ASSERT (sizeof (cpointer) == sizeof (cpointer.value));
   JERRY_ASSERT (sizeof (value) == sizeof (cpointer.value));
@@ -529,6 +540,34 @@ rcs_recordset_t::get_prev (rcs_record_t* rec_p) /**< record */
   return free_rec_p->get_prev ();
 } /* rcs_recordset_t::get_prev */
 
+/**
+ * Get pointer to the specified part of the record's data, if the part is not split between chunks of the storage
+ *
+ * @return pointer to the first byte of the part - if the part is placed in the same chunk as the record's beginning,
+ *         NULL - otherwise (the part can be accessed with rcs_record_iterator_t).
+ */
+uint8_t*
+rcs_recordset_t::get_contiguous_data (rcs_record_t* rec_p, /**< record */
+                                      size_t offset, /**< offset of the part from the record's beginning */
+                                      size_t size) /**< size of the part */
+{
+  JERRY_ASSERT (offset + size <= get_record_size (rec_p));
+
+  rcs_chunked_list_t::node_t* node_p = _chunk_list.get_node_from_pointer (rec_p);
+
+  const uint8_t* data_space_end_p = _chunk_list.get_data_space (node_p) + _chunk_list.get_data_space_size ();
+  uint8_t* part_start_p = (uint8_t*) rec_p + offset;
+
+  if (part_start_p + size <= data_space_end_p)
+  {
+    return part_start_p;
+  }
+  else
+  {
+    return NULL;
+  }
+} /* rcs_recordset_t::get_contiguous_data */
+
 /**
  * Get record, next to the specified
  *
@@ -33,8 +33,15 @@
 
 /**
  * Logarithm of a dynamic storage unit alignment
+ *
+ * With 32-bit compressed pointers, records are aligned to 8 bytes, so that
+ * the records' 'previous record' pointers fit into the records' first storage unit.
  */
-#define RCS_DYN_STORAGE_ALIGNMENT_LOG (2u)
+#ifndef CONFIG_MEM_CPOINTER_32BIT
+# define RCS_DYN_STORAGE_ALIGNMENT_LOG (2u)
+#else /* !CONFIG_MEM_CPOINTER_32BIT */
+# define RCS_DYN_STORAGE_ALIGNMENT_LOG (3u)
+#endif /* CONFIG_MEM_CPOINTER_32BIT */
 
 /**
  * Dynamic storage unit alignment
@@ -45,9 +52,22 @@
  * Unit of length
  *
  * See also:
- *          rcs_dyn_storage_length_t
+ *          rcs_dyn_storage_unit_t
  */
-#define RCS_DYN_STORAGE_LENGTH_UNIT   (4u)
+#ifndef CONFIG_MEM_CPOINTER_32BIT
+# define RCS_DYN_STORAGE_LENGTH_UNIT  (4u)
+#else /* !CONFIG_MEM_CPOINTER_32BIT */
+# define RCS_DYN_STORAGE_LENGTH_UNIT  (8u)
+#endif /* CONFIG_MEM_CPOINTER_32BIT */
+
+/**
+ * Storage unit, containing header of a record
+ */
+#ifndef CONFIG_MEM_CPOINTER_32BIT
+typedef uint32_t rcs_dyn_storage_unit_t;
+#else /* !CONFIG_MEM_CPOINTER_32BIT */
+typedef uint64_t rcs_dyn_storage_unit_t;
+#endif /* CONFIG_MEM_CPOINTER_32BIT */
 
 /**
  * Dynamic storage
@@ -68,6 +88,25 @@ public:
     JERRY_ASSERT (_chunk_list.get_data_space_size () % RCS_DYN_STORAGE_LENGTH_UNIT == 0);
   } /* init */
 
+  /* Constructor, attaching the recordset to already existing chunks */
+  void init_from_chunks (rcs_chunked_list_t::node_t *first_chunk_p,
+                         rcs_chunked_list_t::node_t *last_chunk_p)
+  {
+    _chunk_list.init_from_nodes (first_chunk_p, last_chunk_p);
+  } /* init_from_chunks */
+
+  /* Get first chunk of the recordset's storage */
+  rcs_chunked_list_t::node_t *get_first_chunk (void) const
+  {
+    return _chunk_list.get_first ();
+  } /* get_first_chunk */
+
+  /* Get last chunk of the recordset's storage */
+  rcs_chunked_list_t::node_t *get_last_chunk (void) const
+  {
+    return _chunk_list.get_last ();
+  } /* get_last_chunk */
+
   /* Destructor */
   void finalize (void)
   {
@@ -108,13 +147,13 @@ public:
         {
           mem_cpointer_t base_cp : MEM_CP_WIDTH; /**< pointer to base of addressed area */
 #if MEM_ALIGNMENT_LOG > RCS_DYN_STORAGE_ALIGNMENT_LOG
-          uint16_t ext     : (MEM_ALIGNMENT_LOG - RCS_DYN_STORAGE_ALIGNMENT_LOG); /**< extension of the basic
-                                                                                   *   compressed pointer
-                                                                                   *   used for more detailed
-                                                                                   *   addressing */
+          mem_cpointer_t ext : (MEM_ALIGNMENT_LOG - RCS_DYN_STORAGE_ALIGNMENT_LOG); /**< extension of the basic
+                                                                                     *   compressed pointer
+                                                                                     *   used for more detailed
+                                                                                     *   addressing */
 #endif /* MEM_ALIGNMENT_LOG > RCS_DYN_STORAGE_ALIGNMENT_LOG */
         } value;
-        uint16_t packed_value;
+        mem_cpointer_t packed_value;
       };
 
       static cpointer_t compress (record_t *pointer_p);
@@ -153,6 +192,7 @@ public:
 
   record_t *get_first (void);
   record_t *get_next (record_t *rec_p);
+  uint8_t *get_contiguous_data (record_t *rec_p, size_t offset, size_t size);
 
 private:
   friend class rcs_record_iterator_t;
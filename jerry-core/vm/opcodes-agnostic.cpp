@@ -28,7 +28,8 @@ opfunc_is_true_jmp_down (opcode_t opdata, /**< operation data */
                          int_data_t *int_data) /**< interpreter context */
 {
   const idx_t cond_var_idx = opdata.data.is_true_jmp_down.value;
-  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (opdata.data.is_true_jmp_down.opcode_1,
+  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (int_data->opcodes_p,
+                                                                    opdata.data.is_true_jmp_down.opcode_1,
                                                                     opdata.data.is_true_jmp_down.opcode_2);
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
@@ -61,7 +62,8 @@ opfunc_is_true_jmp_up (opcode_t opdata, /**< operation data */
                        int_data_t *int_data) /**< interpreter context */
 {
   const idx_t cond_var_idx = opdata.data.is_true_jmp_up.value;
-  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (opdata.data.is_true_jmp_up.opcode_1,
+  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (int_data->opcodes_p,
+                                                                    opdata.data.is_true_jmp_up.opcode_1,
                                                                     opdata.data.is_true_jmp_up.opcode_2);
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
@@ -100,7 +102,8 @@ opfunc_is_false_jmp_down (opcode_t opdata, /**< operation data */
                           int_data_t *int_data) /**< interpreter context */
 {
   const idx_t cond_var_idx = opdata.data.is_false_jmp_down.value;
-  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (opdata.data.is_false_jmp_down.opcode_1,
+  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (int_data->opcodes_p,
+                                                                    opdata.data.is_false_jmp_down.opcode_1,
                                                                     opdata.data.is_false_jmp_down.opcode_2);
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
@@ -133,7 +136,8 @@ opfunc_is_false_jmp_up (opcode_t opdata, /**< operation data */
                         int_data_t *int_data) /**< interpreter context */
 {
   const idx_t cond_var_idx = opdata.data.is_false_jmp_up.value;
-  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (opdata.data.is_false_jmp_up.opcode_1,
+  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (int_data->opcodes_p,
+                                                                    opdata.data.is_false_jmp_up.opcode_1,
                                                                     opdata.data.is_false_jmp_up.opcode_2);
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
@@ -170,7 +174,8 @@ ecma_completion_value_t
 opfunc_jmp_down (opcode_t opdata, /**< operation data */
                  int_data_t *int_data) /**< interpreter context */
 {
-  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (opdata.data.jmp_down.opcode_1,
+  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (int_data->opcodes_p,
+                                                                    opdata.data.jmp_down.opcode_1,
                                                                     opdata.data.jmp_down.opcode_2);
 
   JERRY_ASSERT (((uint32_t) int_data->pos + offset < MAX_OPCODES));
@@ -190,7 +195,8 @@ ecma_completion_value_t
 opfunc_jmp_up (opcode_t opdata, /**< operation data */
                int_data_t *int_data) /**< interpreter context */
 {
-  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (opdata.data.jmp_up.opcode_1,
+  const opcode_counter_t offset = calc_opcode_counter_from_idx_idx (int_data->opcodes_p,
+                                                                    opdata.data.jmp_up.opcode_1,
                                                                     opdata.data.jmp_up.opcode_2);
   JERRY_ASSERT ((uint32_t) int_data->pos >= offset);
 
@@ -210,7 +216,8 @@ opfunc_jmp_break_continue (opcode_t opdata, /**< operation data */
                            int_data_t *int_data) /**< interpreter context */
 {
   opcode_counter_t target = int_data->pos;
-  target = (opcode_counter_t) (target + calc_opcode_counter_from_idx_idx (opdata.data.jmp_down.opcode_1,
+  target = (opcode_counter_t) (target + calc_opcode_counter_from_idx_idx (int_data->opcodes_p,
+                                                                          opdata.data.jmp_down.opcode_1,
                                                                           opdata.data.jmp_down.opcode_2));
 
   return ecma_make_jump_completion_value (target);
@@ -31,6 +31,7 @@
 #include "ecma-reference.h"
 #include "ecma-regexp-object.h"
 #include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
 #include "serializer.h"
 
 bool is_reg_variable (int_data_t *int_data, idx_t var_idx);
@@ -33,7 +33,9 @@ opfunc_try_block (opcode_t opdata, /**< operation data */
   const idx_t block_end_oc_idx_1 = opdata.data.try_block.oc_idx_1;
   const idx_t block_end_oc_idx_2 = opdata.data.try_block.oc_idx_2;
   const opcode_counter_t try_end_oc = (opcode_counter_t) (
-    calc_opcode_counter_from_idx_idx (block_end_oc_idx_1, block_end_oc_idx_2) + int_data->pos);
+    calc_opcode_counter_from_idx_idx (int_data->opcodes_p,
+                                      block_end_oc_idx_1,
+                                      block_end_oc_idx_2) + int_data->pos);
 
   int_data->pos++;
 
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include "ecma-for-in-cache.h"
 #include "jrt.h"
 #include "opcodes.h"
 #include "opcodes-ecma-support.h"
@@ -172,6 +173,179 @@ vm_helper_for_in_enumerate_properties_names (ecma_object_t *obj_p) /**< starting
   return ret_p;
 } /* vm_helper_for_in_enumerate_properties_names */
 
+/**
+ * Get name of the object's named property
+ *
+ * @return pointer to the property's name
+ */
+static ecma_string_t *
+vm_helper_for_in_get_property_name (ecma_property_t *prop_p) /**< named data or named accessor property */
+{
+  if (prop_p->type == ECMA_PROPERTY_NAMEDDATA)
+  {
+    return ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_p->u.named_data_property.name_p);
+  }
+  else
+  {
+    JERRY_ASSERT (prop_p->type == ECMA_PROPERTY_NAMEDACCESSOR);
+
+    return ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_p->u.named_accessor_property.name_p);
+  }
+} /* vm_helper_for_in_get_property_name */
+
+/**
+ * Construct collection of names of properties to iterate in for-in opcode handler,
+ * taking names of the prototype chain's enumerable properties from the for-in cache.
+ *
+ * Only own properties of the object are enumerated upon each call; the prototype chain is enumerated
+ * with vm_helper_for_in_enumerate_properties_names only if it is not in the cache yet.
+ *
+ * Note:
+ *      the object is marked with 'for-in cached' flag, so any change of its set of properties
+ *      changes generation of the for-in cache (see also: ecma_for_in_cache_get_generation)
+ *
+ * @return header of constructed strings collection (should be freed with ecma_free_values_collection),
+ *         or NULL - if there are no properties to enumerate in for-in.
+ */
+static ecma_collection_header_t *
+vm_helper_for_in_get_properties_names (ecma_object_t *obj_p) /**< starting object - result of ToObject
+                                                              *   conversion (ECMA-262 v5, 12.6.4, step 4) */
+{
+  ecma_set_object_is_for_in_cached (obj_p, true);
+
+  ecma_object_t *prototype_p = ecma_get_object_prototype (obj_p);
+
+  ecma_collection_header_t *prototype_names_p = NULL;
+  bool is_prototype_names_cached = false;
+
+  if (prototype_p != NULL)
+  {
+    is_prototype_names_cached = ecma_for_in_cache_lookup (prototype_p, &prototype_names_p);
+
+    if (!is_prototype_names_cached)
+    {
+      prototype_names_p = vm_helper_for_in_enumerate_properties_names (prototype_p);
+      is_prototype_names_cached = ecma_for_in_cache_insert (prototype_p, prototype_names_p);
+    }
+  }
+
+  ecma_length_t own_properties_count = 0;
+
+  for (ecma_property_t *prop_iter_p = ecma_get_property_list (obj_p);
+       prop_iter_p != NULL;
+       prop_iter_p = ECMA_GET_POINTER (ecma_property_t, prop_iter_p->next_property_p))
+  {
+    if (prop_iter_p->type != ECMA_PROPERTY_INTERNAL)
+    {
+      own_properties_count++;
+    }
+  }
+
+  const ecma_length_t prototype_names_count = (prototype_names_p != NULL ? prototype_names_p->unit_number : 0);
+  const ecma_length_t all_names_count = (ecma_length_t) (own_properties_count + prototype_names_count);
+
+  ecma_collection_header_t *ret_p = NULL;
+
+  if (all_names_count != 0)
+  {
+    const size_t bitmap_row_size = sizeof (uint32_t) * JERRY_BITSINBYTE;
+    uint32_t names_hashes_bitmap[(1u << LIT_STRING_HASH_BITS) / bitmap_row_size];
+
+    memset (names_hashes_bitmap, 0, sizeof (names_hashes_bitmap));
+
+    /*
+     * Own enumerable properties' names are put to the array's beginning,
+     * and non-enumerable properties' names - to the array's end.
+     */
+    MEM_DEFINE_LOCAL_ARRAY (names_p, all_names_count, ecma_string_t*);
+
+    ecma_length_t enumerated_names_count = 0;
+    ecma_length_t non_enumerated_names_count = 0;
+
+    for (ecma_property_t *prop_iter_p = ecma_get_property_list (obj_p);
+         prop_iter_p != NULL;
+         prop_iter_p = ECMA_GET_POINTER (ecma_property_t, prop_iter_p->next_property_p))
+    {
+      if (prop_iter_p->type == ECMA_PROPERTY_INTERNAL)
+      {
+        continue;
+      }
+
+      ecma_string_t *prop_name_p = vm_helper_for_in_get_property_name (prop_iter_p);
+
+      lit_string_hash_t hash = prop_name_p->hash;
+      names_hashes_bitmap[hash / bitmap_row_size] |= (1u << (hash % bitmap_row_size));
+
+      if (ecma_is_property_enumerable (prop_iter_p))
+      {
+        names_p[enumerated_names_count++] = prop_name_p;
+      }
+      else
+      {
+        names_p[all_names_count - non_enumerated_names_count++ - 1] = prop_name_p;
+      }
+    }
+
+    JERRY_ASSERT (enumerated_names_count + non_enumerated_names_count == own_properties_count);
+
+    const ecma_length_t own_enumerated_names_count = enumerated_names_count;
+
+    if (prototype_names_p != NULL)
+    {
+      ecma_collection_iterator_t prototype_names_iterator;
+      ecma_collection_iterator_init (&prototype_names_iterator, prototype_names_p);
+
+      while (ecma_collection_iterator_next (&prototype_names_iterator))
+      {
+        ecma_string_t *prop_name_p = ecma_get_string_from_value (*prototype_names_iterator.current_value_p);
+
+        lit_string_hash_t hash = prop_name_p->hash;
+        bool is_shadowed = false;
+
+        if ((names_hashes_bitmap[hash / bitmap_row_size] & (1u << (hash % bitmap_row_size))) != 0)
+        {
+          /* an own property with same name hash exists */
+          for (uint32_t index = 0;
+               !is_shadowed && index < own_enumerated_names_count;
+               index++)
+          {
+            is_shadowed = ecma_compare_ecma_strings (prop_name_p, names_p[index]);
+          }
+
+          for (uint32_t index = 0;
+               !is_shadowed && index < non_enumerated_names_count;
+               index++)
+          {
+            is_shadowed = ecma_compare_ecma_strings (prop_name_p, names_p[all_names_count - index - 1]);
+          }
+        }
+
+        if (!is_shadowed)
+        {
+          names_p[enumerated_names_count++] = prop_name_p;
+        }
+
+        JERRY_ASSERT (enumerated_names_count + non_enumerated_names_count <= all_names_count);
+      }
+    }
+
+    if (enumerated_names_count != 0)
+    {
+      ret_p = ecma_new_strings_collection (names_p, enumerated_names_count);
+    }
+
+    MEM_FINALIZE_LOCAL_ARRAY (names_p);
+  }
+
+  if (!is_prototype_names_cached
+      && prototype_names_p != NULL)
+  {
+    ecma_free_values_collection (prototype_names_p, true);
+  }
+
+  return ret_p;
+} /* vm_helper_for_in_get_properties_names */
+
 /**
  * 'for-in' opcode handler
  *
@@ -189,7 +363,8 @@ opfunc_for_in (opcode_t opdata, /**< operation data */
   const idx_t block_end_oc_idx_1 = opdata.data.for_in.oc_idx_1;
   const idx_t block_end_oc_idx_2 = opdata.data.for_in.oc_idx_2;
   const opcode_counter_t for_in_end_oc = (opcode_counter_t) (
-    calc_opcode_counter_from_idx_idx (block_end_oc_idx_1,
+    calc_opcode_counter_from_idx_idx (int_data_p->opcodes_p,
+                                      block_end_oc_idx_1,
                                       block_end_oc_idx_2) + int_data_p->pos);
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
@@ -219,7 +394,13 @@ opfunc_for_in (opcode_t opdata, /**< operation data */
     ecma_object_t *obj_p = ecma_get_object_from_value (obj_expr_value);
 
     ecma_collection_iterator_t names_iterator;
-    ecma_collection_header_t *names_p = vm_helper_for_in_enumerate_properties_names (obj_p);
+    ecma_collection_header_t *names_p = vm_helper_for_in_get_properties_names (obj_p);
+
+    /*
+     * The object and its prototype chain are marked with 'for-in cached' flag at the moment,
+     * so while the for-in cache's generation is not changed, none of the names could have been deleted.
+     */
+    const uint32_t for_in_cache_generation = ecma_for_in_cache_get_generation ();
 
     if (names_p != NULL)
     {
@@ -234,7 +415,8 @@ opfunc_for_in (opcode_t opdata, /**< operation data */
 
         ecma_string_t *name_p = ecma_get_string_from_value (name_value);
 
-        if (ecma_op_object_get_property (obj_p, name_p) != NULL)
+        if (ecma_for_in_cache_get_generation () == for_in_cache_generation
+            || ecma_op_object_get_property (obj_p, name_p) != NULL)
         {
           ecma_completion_value_t completion = set_variable_value (int_data_p,
                                                                    int_data_p->pos,
@@ -496,21 +496,43 @@ opfunc_var_decl (opcode_t opdata, /**< operation data */
 /**
  * Function declaration helper
  *
+ * Note:
+ *      the function is declared upon entering the scope, containing the declaration,
+ *      through the scope's declarations table (see also: OPCODE_META_TYPE_FUNCTION_DECLARATION)
+ *
  * @return completion value
  *         returned value must be freed with ecma_free_completion_value.
  */
 static ecma_completion_value_t
 function_declaration (int_data_t *int_data, /**< interpreter context */
-                      lit_cpointer_t function_name_lit_cp, /**< compressed pointer to literal with function name */
-                      ecma_string_t* args_names[], /**< names of arguments */
-                      ecma_length_t args_number) /**< number of arguments */
+                      opcode_counter_t func_decl_oc) /**< position of 'func_decl_n' instruction */
 {
+  const opcode_counter_t saved_pos = int_data->pos;
+  int_data->pos = func_decl_oc;
+
+  const opcode_t opdata = vm_get_opcode (int_data->opcodes_p, func_decl_oc);
+  JERRY_ASSERT (opdata.op_idx == __op__idx_func_decl_n);
+
+  const idx_t function_name_idx = opdata.data.func_decl_n.name_lit_idx;
+  const ecma_length_t params_number = opdata.data.func_decl_n.arg_list;
+
+  lit_cpointer_t function_name_lit_cp = serializer_get_literal_cp_by_uid (function_name_idx,
+                                                                          int_data->opcodes_p,
+                                                                          int_data->pos);
+
+  int_data->pos++;
+
+  ecma_completion_value_t ret_value;
+
+  MEM_DEFINE_LOCAL_ARRAY (params_names, params_number, ecma_string_t*);
+
+  fill_params_list (int_data, params_number, params_names);
+
   bool is_strict = int_data->is_strict;
   bool do_instantiate_arguments_object = true;
   const bool is_configurable_bindings = int_data->is_eval_code;
 
-  const opcode_counter_t function_code_end_oc = (opcode_counter_t) (
-    read_meta_opcode_counter (OPCODE_META_TYPE_FUNCTION_END, int_data) + int_data->pos);
+  /* skip 'meta' instruction for the function's end */
   int_data->pos++;
 
   opcode_scope_code_flags_t scope_flags = vm_get_scope_flags (int_data->opcodes_p, int_data->pos++);
@@ -530,18 +552,27 @@ function_declaration (int_data_t *int_data, /**< interpreter context */
 
   ecma_string_t *function_name_string_p = ecma_new_ecma_string_from_lit_cp (function_name_lit_cp);
 
-  ecma_completion_value_t ret_value = ecma_op_function_declaration (int_data->lex_env_p,
-                                                                    function_name_string_p,
-                                                                    int_data->opcodes_p,
-                                                                    int_data->pos,
-                                                                    args_names,
-                                                                    args_number,
-                                                                    is_strict,
-                                                                    do_instantiate_arguments_object,
-                                                                    is_configurable_bindings);
+  ret_value = ecma_op_function_declaration (int_data->lex_env_p,
+                                            function_name_string_p,
+                                            int_data->opcodes_p,
+                                            int_data->pos,
+                                            params_names,
+                                            params_number,
+                                            is_strict,
+                                            do_instantiate_arguments_object,
+                                            is_configurable_bindings);
   ecma_deref_ecma_string (function_name_string_p);
 
-  int_data->pos = function_code_end_oc;
+  for (uint32_t param_index = 0;
+       param_index < params_number;
+       param_index++)
+  {
+    ecma_deref_ecma_string (params_names[param_index]);
+  }
+
+  MEM_FINALIZE_LOCAL_ARRAY (params_names);
+
+  int_data->pos = saved_pos;
 
   return ret_value;
 } /* function_declaration */
@@ -549,6 +580,10 @@ function_declaration (int_data_t *int_data, /**< interpreter context */
 /**
  * 'Function declaration' opcode handler.
  *
+ * Note:
+ *      the function is already declared upon entering the scope (see also: function_declaration),
+ *      so the handler just skips the function's code
+ *
  * @return completion value
  *         returned value must be freed with ecma_free_completion_value.
  */
@@ -556,36 +591,16 @@ ecma_completion_value_t
 opfunc_func_decl_n (opcode_t opdata, /**< operation data */
                     int_data_t *int_data) /**< interpreter context */
 {
-  const idx_t function_name_idx = opdata.data.func_decl_n.name_lit_idx;
   const ecma_length_t params_number = opdata.data.func_decl_n.arg_list;
 
-  lit_cpointer_t function_name_lit_cp = serializer_get_literal_cp_by_uid (function_name_idx,
-                                                                          int_data->opcodes_p,
-                                                                          int_data->pos);
-
-  int_data->pos++;
-
-  ecma_completion_value_t ret_value;
+  int_data->pos = (opcode_counter_t) (int_data->pos + 1 + params_number);
 
-  MEM_DEFINE_LOCAL_ARRAY (params_names, params_number, ecma_string_t*);
-
-  fill_params_list (int_data, params_number, params_names);
-
-  ret_value = function_declaration (int_data,
-                                    function_name_lit_cp,
-                                    params_names,
-                                    params_number);
-
-  for (uint32_t param_index = 0;
-       param_index < params_number;
-       param_index++)
-  {
-    ecma_deref_ecma_string (params_names[param_index]);
-  }
+  const opcode_counter_t function_code_end_oc = (opcode_counter_t) (
+    read_meta_opcode_counter (OPCODE_META_TYPE_FUNCTION_END, int_data) + int_data->pos);
 
-  MEM_FINALIZE_LOCAL_ARRAY (params_names);
+  int_data->pos = function_code_end_oc;
 
-  return ret_value;
+  return ecma_make_empty_completion_value ();
 } /* opfunc_func_decl_n */
 
 /**
@@ -1221,26 +1236,49 @@ opfunc_prop_getter (opcode_t opdata __attr_unused___, /**< operation data */
   ECMA_TRY_CATCH (prop_name_value,
                   get_variable_value (int_data, prop_name_var_idx, false),
                   ret_value);
-  ECMA_TRY_CATCH (check_coercible_ret,
-                  ecma_op_check_object_coercible (base_value),
-                  ret_value);
-  ECMA_TRY_CATCH (prop_name_str_value,
-                  ecma_op_to_string (prop_name_value),
-                  ret_value);
 
-  ecma_string_t *prop_name_string_p = ecma_get_string_from_value (prop_name_str_value);
-  ecma_reference_t ref = ecma_make_reference (base_value, prop_name_string_p, int_data->is_strict);
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+  uint32_t element_index;
 
-  ECMA_TRY_CATCH (prop_value, ecma_op_get_value_object_base (ref), ret_value);
+  if (ecma_is_value_number (prop_name_value)
+      && ecma_op_is_typed_array (base_value)
+      && ecma_op_typed_array_is_element_index (ecma_get_object_from_value (base_value),
+                                               *ecma_get_number_from_value (prop_name_value),
+                                               &element_index))
+  {
+    /* typed array's element is accessed by number, so conversion of the index to string is skipped */
+    ecma_number_t *element_num_p = ecma_alloc_number ();
+    *element_num_p = ecma_op_typed_array_get_element (ecma_get_object_from_value (base_value), element_index);
 
-  ret_value = set_variable_value (int_data, int_data->pos, lhs_var_idx, prop_value);
+    ret_value = set_variable_value (int_data, int_data->pos, lhs_var_idx, ecma_make_number_value (element_num_p));
 
-  ECMA_FINALIZE (prop_value);
+    ecma_dealloc_number (element_num_p);
+  }
+  else
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+  {
+    ECMA_TRY_CATCH (check_coercible_ret,
+                    ecma_op_check_object_coercible (base_value),
+                    ret_value);
+    ECMA_TRY_CATCH (prop_name_str_value,
+                    ecma_op_to_string (prop_name_value),
+                    ret_value);
 
-  ecma_free_reference (ref);
+    ecma_string_t *prop_name_string_p = ecma_get_string_from_value (prop_name_str_value);
+    ecma_reference_t ref = ecma_make_reference (base_value, prop_name_string_p, int_data->is_strict);
+
+    ECMA_TRY_CATCH (prop_value, ecma_op_get_value_object_base (ref), ret_value);
+
+    ret_value = set_variable_value (int_data, int_data->pos, lhs_var_idx, prop_value);
+
+    ECMA_FINALIZE (prop_value);
+
+    ecma_free_reference (ref);
+
+    ECMA_FINALIZE (prop_name_str_value);
+    ECMA_FINALIZE (check_coercible_ret);
+  }
 
-  ECMA_FINALIZE (prop_name_str_value);
-  ECMA_FINALIZE (check_coercible_ret);
   ECMA_FINALIZE (prop_name_value);
   ECMA_FINALIZE (base_value);
 
@@ -1274,26 +1312,48 @@ opfunc_prop_setter (opcode_t opdata __attr_unused___, /**< operation data */
   ECMA_TRY_CATCH (prop_name_value,
                   get_variable_value (int_data, prop_name_var_idx, false),
                   ret_value);
-  ECMA_TRY_CATCH (check_coercible_ret,
-                  ecma_op_check_object_coercible (base_value),
-                  ret_value);
-  ECMA_TRY_CATCH (prop_name_str_value,
-                  ecma_op_to_string (prop_name_value),
-                  ret_value);
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS
+  uint32_t element_index;
+
+  if (ecma_is_value_number (prop_name_value)
+      && ecma_op_is_typed_array (base_value)
+      && ecma_op_typed_array_is_element_index (ecma_get_object_from_value (base_value),
+                                               *ecma_get_number_from_value (prop_name_value),
+                                               &element_index))
+  {
+    /* typed array's element is accessed by number, so conversion of the index to string is skipped */
+    ECMA_TRY_CATCH (rhs_value, get_variable_value (int_data, rhs_var_idx, false), ret_value);
+    ECMA_OP_TO_NUMBER_TRY_CATCH (rhs_num, rhs_value, ret_value);
 
-  ecma_string_t *prop_name_string_p = ecma_get_string_from_value (prop_name_str_value);
-  ecma_reference_t ref = ecma_make_reference (base_value,
-                                              prop_name_string_p,
-                                              int_data->is_strict);
+    ecma_op_typed_array_set_element (ecma_get_object_from_value (base_value), element_index, rhs_num);
 
-  ECMA_TRY_CATCH (rhs_value, get_variable_value (int_data, rhs_var_idx, false), ret_value);
-  ret_value = ecma_op_put_value_object_base (ref, rhs_value);
-  ECMA_FINALIZE (rhs_value);
+    ECMA_OP_TO_NUMBER_FINALIZE (rhs_num);
+    ECMA_FINALIZE (rhs_value);
+  }
+  else
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPED_ARRAY_BUILTINS */
+  {
+    ECMA_TRY_CATCH (check_coercible_ret,
+                    ecma_op_check_object_coercible (base_value),
+                    ret_value);
+    ECMA_TRY_CATCH (prop_name_str_value,
+                    ecma_op_to_string (prop_name_value),
+                    ret_value);
 
-  ecma_free_reference (ref);
+    ecma_string_t *prop_name_string_p = ecma_get_string_from_value (prop_name_str_value);
+    ecma_reference_t ref = ecma_make_reference (base_value,
+                                                prop_name_string_p,
+                                                int_data->is_strict);
 
-  ECMA_FINALIZE (prop_name_str_value);
-  ECMA_FINALIZE (check_coercible_ret);
+    ECMA_TRY_CATCH (rhs_value, get_variable_value (int_data, rhs_var_idx, false), ret_value);
+    ret_value = ecma_op_put_value_object_base (ref, rhs_value);
+    ECMA_FINALIZE (rhs_value);
+
+    ecma_free_reference (ref);
+
+    ECMA_FINALIZE (prop_name_str_value);
+    ECMA_FINALIZE (check_coercible_ret);
+  }
   ECMA_FINALIZE (prop_name_value);
   ECMA_FINALIZE (base_value);
 
@@ -1382,7 +1442,9 @@ opfunc_with (opcode_t opdata, /**< operation data */
   const idx_t block_end_oc_idx_1 = opdata.data.with.oc_idx_1;
   const idx_t block_end_oc_idx_2 = opdata.data.with.oc_idx_2;
   const opcode_counter_t with_end_oc = (opcode_counter_t) (
-    calc_opcode_counter_from_idx_idx (block_end_oc_idx_1, block_end_oc_idx_2) + int_data->pos);
+    calc_opcode_counter_from_idx_idx (int_data->opcodes_p,
+                                      block_end_oc_idx_1,
+                                      block_end_oc_idx_2) + int_data->pos);
 
   ecma_completion_value_t ret_value = ecma_make_empty_completion_value ();
 
@@ -1739,12 +1801,24 @@ opfunc_delete_prop (opcode_t opdata, /**< operation data */
  */
 ecma_completion_value_t
 opfunc_meta (opcode_t opdata, /**< operation data */
-             int_data_t *int_data __attr_unused___) /**< interpreter context */
+             int_data_t *int_data) /**< interpreter context */
 {
   const opcode_meta_type type = (opcode_meta_type) opdata.data.meta.type;
 
   switch (type)
   {
+    case OPCODE_META_TYPE_FUNCTION_DECLARATION:
+    {
+      const opcode_counter_t func_decl_oc = (opcode_counter_t) (
+        int_data->pos - read_meta_opcode_counter (OPCODE_META_TYPE_FUNCTION_DECLARATION, int_data));
+
+      ecma_completion_value_t ret_value = function_declaration (int_data, func_decl_oc);
+
+      int_data->pos++;
+
+      return ret_value;
+    }
+
     case OPCODE_META_TYPE_VARG:
     case OPCODE_META_TYPE_VARG_PROP_DATA:
     case OPCODE_META_TYPE_VARG_PROP_GETTER:
@@ -1754,6 +1828,7 @@ opfunc_meta (opcode_t opdata, /**< operation data */
     case OPCODE_META_TYPE_FINALLY:
     case OPCODE_META_TYPE_END_TRY_CATCH_FINALLY:
     case OPCODE_META_TYPE_END_FOR_IN:
+    case OPCODE_META_TYPE_END_SCOPE_DECLARATIONS:
     {
       return ecma_make_meta_completion_value ();
     }
@@ -1763,6 +1838,8 @@ opfunc_meta (opcode_t opdata, /**< operation data */
     case OPCODE_META_TYPE_CALL_SITE_INFO:
     case OPCODE_META_TYPE_FUNCTION_END:
     case OPCODE_META_TYPE_CATCH_EXCEPTION_IDENTIFIER:
+    case OPCODE_META_TYPE_LAZY_FUNCTION_BODY:
+    case OPCODE_META_TYPE_SCOPE_DECLARATIONS:
     {
       JERRY_UNREACHABLE ();
     }
@@ -1774,19 +1851,36 @@ opfunc_meta (opcode_t opdata, /**< operation data */
 /**
  * Calculate opcode counter from 'meta' opcode's data arguments.
  *
+ * See also:
+ *          OPCODE_COUNTER_LONG_IDX_FIRST
+ *
  * @return opcode counter
  */
 opcode_counter_t
-calc_opcode_counter_from_idx_idx (const idx_t oc_idx_1, /**< first idx */
+calc_opcode_counter_from_idx_idx (const opcode_compact_t *opcodes_p, /**< byte-code array (or NULL,
+                                                                      *   if the counter is decoded
+                                                                      *   during parse of current scope) */
+                                  const idx_t oc_idx_1, /**< first idx */
                                   const idx_t oc_idx_2) /**< second idx */
 {
-  opcode_counter_t counter;
+  uint32_t counter;
 
   counter = oc_idx_1;
-  counter = (opcode_counter_t) (counter << (sizeof (idx_t) * JERRY_BITSINBYTE));
-  counter = (opcode_counter_t) (counter | oc_idx_2);
+  counter = (uint32_t) (counter << JERRY_BITSINBYTE);
+  counter = (uint32_t) (counter | oc_idx_2);
 
-  return counter;
+  if (counter < OPCODE_COUNTER_MAX_SHORT_VALUE)
+  {
+    return (opcode_counter_t) counter;
+  }
+  else if (counter == (1u << (2 * JERRY_BITSINBYTE)) - 1u)
+  {
+    return MAX_OPCODES;
+  }
+  else
+  {
+    return serializer_get_long_opcode_counter (opcodes_p, (uint16_t) (counter - OPCODE_COUNTER_MAX_SHORT_VALUE));
+  }
 } /* calc_meta_opcode_counter_from_meta_data */
 
 /**
@@ -1803,13 +1897,14 @@ read_meta_opcode_counter (opcode_meta_type expected_type, /**< expected type of
   const idx_t data_1 = meta_opcode.data.meta.data_1;
   const idx_t data_2 = meta_opcode.data.meta.data_2;
 
-  return calc_opcode_counter_from_idx_idx (data_1, data_2);
+  return calc_opcode_counter_from_idx_idx (int_data->opcodes_p, data_1, data_2);
 } /* read_meta_opcode_counter */
 
 #define GETOP_DEF_1(a, name, field1) \
         opcode_t getop_##name (idx_t arg1) \
         { \
           opcode_t opdata; \
+          memset (&opdata, 0, sizeof (opdata)); \
           opdata.op_idx = __op__idx_##name; \
           opdata.data.name.field1 = arg1; \
           return opdata; \
@@ -1819,6 +1914,7 @@ read_meta_opcode_counter (opcode_meta_type expected_type, /**< expected type of
         opcode_t getop_##name (idx_t arg1, idx_t arg2) \
         { \
           opcode_t opdata; \
+          memset (&opdata, 0, sizeof (opdata)); \
           opdata.op_idx = __op__idx_##name; \
           opdata.data.name.field1 = arg1; \
           opdata.data.name.field2 = arg2; \
@@ -1829,6 +1925,7 @@ read_meta_opcode_counter (opcode_meta_type expected_type, /**< expected type of
         opcode_t getop_##name (idx_t arg1, idx_t arg2, idx_t arg3) \
         { \
           opcode_t opdata; \
+          memset (&opdata, 0, sizeof (opdata)); \
           opdata.op_idx = __op__idx_##name; \
           opdata.data.name.field1 = arg1; \
           opdata.data.name.field2 = arg2; \
@@ -20,8 +20,21 @@
 #include "ecma-stack.h"
 #include "jrt.h"
 
-/* Maximum opcodes number in bytecode.  */
-#define MAX_OPCODES (256*256 - 1)
+/* Maximum opcodes number in bytecode (limited by width of break / continue target in ecma_completion_value_t).  */
+#define MAX_OPCODES ((1u << 24) - 1u)
+
+/**
+ * Opcode counters (jump offsets, block end offsets, etc.) are encoded in a pair of instruction's arguments.
+ *
+ * Counters less than OPCODE_COUNTER_MAX_SHORT_VALUE are stored in the pair directly. For greater counters
+ * the pair's first argument is in [OPCODE_COUNTER_LONG_IDX_FIRST, 0xFF] range, and the pair holds index
+ * of the counter in the byte-code's table of long opcode counters (see also: serializer_get_long_opcode_counter).
+ *
+ * The pair (0xFF, 0xFF) is reserved for MAX_OPCODES value, that is used as end of jump chain marker.
+ */
+#define OPCODE_COUNTER_LONG_IDX_FIRST (0xF0)
+#define OPCODE_COUNTER_MAX_SHORT_VALUE (OPCODE_COUNTER_LONG_IDX_FIRST << JERRY_BITSINBYTE)
+#define OPCODE_COUNTER_MAX_LONG_COUNTERS_NUMBER ((0x100 - OPCODE_COUNTER_LONG_IDX_FIRST) * 0x100 - 1)
 
 #define OP_0(action, name) \
         __##action (name, void, void, void)
@@ -35,8 +48,27 @@
 #define OP_3(action, name, field1, field2, field3) \
         __##action (name, field1, field2, field3)
 
-typedef uint16_t opcode_counter_t; /** opcode counters */
-typedef uint8_t idx_t; /** index values */
+typedef uint32_t opcode_counter_t; /** opcode counters */
+typedef uint16_t idx_t; /** index values */
+
+/**
+ * Flag of opcode index in compact form of instruction, indicating that the instruction is stored
+ * in the byte-code's table of wide instructions (see also: opcode_compact_t)
+ */
+#define OPCODE_COMPACT_WIDE_FLAG (0x80u)
+
+/**
+ * Instruction, in the form it is stored in a byte-code array
+ *
+ * If all arguments of an instruction fit into a byte, the instruction is stored with the arguments.
+ * Otherwise, OPCODE_COMPACT_WIDE_FLAG is set in the opcode index and the argument bytes hold index
+ * of the instruction in the byte-code's table of wide instructions (see also: serializer_get_opcode).
+ */
+typedef struct
+{
+  uint8_t op_idx; /**< opcode index */
+  uint8_t args[3]; /**< arguments, or index of the instruction in the table of wide instructions */
+} opcode_compact_t;
 
 /**
  * Descriptor of assignment's second argument
@@ -74,7 +106,15 @@ typedef enum
   OPCODE_META_TYPE_END_TRY_CATCH_FINALLY, /**< mark of end of try-catch, try-finally, try-catch-finally blocks */
   OPCODE_META_TYPE_SCOPE_CODE_FLAGS, /**< set of flags indicating various properties of the scope's code
                                       *   (See also: opcode_scope_code_flags_t) */
-  OPCODE_META_TYPE_END_FOR_IN /**< end of for-in statement */
+  OPCODE_META_TYPE_END_FOR_IN, /**< end of for-in statement */
+  OPCODE_META_TYPE_LAZY_FUNCTION_BODY, /**< index (in two data arguments) of descriptor of function's body,
+                                        *   which compilation is deferred till the function's first call
+                                        *   (see also: lazy_function_body_t) */
+  OPCODE_META_TYPE_SCOPE_DECLARATIONS, /**< offset to the scope's table of declarations, that follows the scope's code
+                                        *   (zero - if the scope has no declarations), placed after 'reg_var_decl' */
+  OPCODE_META_TYPE_FUNCTION_DECLARATION, /**< entry of the scope's table of declarations, containing offset
+                                          *   back to 'func_decl_n' instruction of a declared function */
+  OPCODE_META_TYPE_END_SCOPE_DECLARATIONS /**< end of the scope's table of declarations */
 } opcode_meta_type;
 
 typedef enum : idx_t
@@ -113,21 +153,20 @@ typedef enum : idx_t
   OPCODE_REG_SPECIAL_FOR_IN_PROPERTY_NAME, /**< variable, containing property name,
                                             *   at start of for-in loop body */
   OPCODE_REG_GENERAL_FIRST, /** identifier of first non-special register */
-  OPCODE_REG_GENERAL_LAST = 253, /** identifier of last non-special register */
+  OPCODE_REG_GENERAL_COMPACT_LAST = 253, /** identifier of last non-special register, that fits into a byte
+                                          *   (254 and 255 are reserved for parser's markers,
+                                          *   see also: INVALID_VALUE, LITERAL_TO_REWRITE) */
+  OPCODE_REG_GENERAL_WIDE_FIRST = 256, /** identifier of first non-special register, that doesn't fit into a byte */
+  OPCODE_REG_GENERAL_LAST = 0x7FFF, /** identifier of last non-special register */
   OPCODE_REG_LAST = OPCODE_REG_GENERAL_FIRST /**< identifier of last register */
 } opcode_special_reg_t;
 
-/**
- * Forward declaration of opcode structure
- */
-struct opcode_t;
-
 /**
  * Interpreter context
  */
 typedef struct
 {
-  const opcode_t *opcodes_p; /**< pointer to array containing currently executed bytecode */
+  const opcode_compact_t *opcodes_p; /**< pointer to array containing currently executed bytecode */
   opcode_counter_t pos; /**< current opcode to execute */
   ecma_value_t this_binding; /**< this binding for current context */
   ecma_object_t *lex_env_p; /**< current lexical environment */
@@ -167,7 +206,9 @@ typedef struct
   const opcode_counter_t end_oc; /**< opcode counter of the last instruction of the scope */
 } vm_run_scope_t;
 
-opcode_counter_t calc_opcode_counter_from_idx_idx (const idx_t oc_idx_1, const idx_t oc_idx_2);
+opcode_counter_t calc_opcode_counter_from_idx_idx (const opcode_compact_t *opcodes_p,
+                                                   const idx_t oc_idx_1,
+                                                   const idx_t oc_idx_2);
 opcode_counter_t read_meta_opcode_counter (opcode_meta_type expected_type, int_data_t *int_data);
 
 #define OP_CALLS_AND_ARGS(p, a)                                              \
@@ -335,6 +376,7 @@ typedef ecma_completion_value_t (*opfunc) (opcode_t, int_data_t *);
         opcode_t getop_##name (void) \
         { \
           opcode_t opdata; \
+          memset (&opdata, 0, sizeof (opdata)); \
           opdata.op_idx = __op__idx_##name; \
           return opdata; \
         }
@@ -347,7 +389,7 @@ OP_ARGS_LIST (GETOP_DECL)
 
 typedef struct
 {
-  uint8_t uids[4];
+  idx_t uids[4];
 } raw_opcode;
 
 #endif /* OPCODES_H */
@@ -24,6 +24,7 @@
 #include "ecma-globals.h"
 #include "serializer.h"
 #include "lit-literal.h"
+#include "bytecode-data.h"
 
 #define NAME_TO_ID(op) (__op__idx_##op)
 
@@ -31,7 +32,7 @@
   #name,
 
 #define __OPCODE_SIZE(name, arg1, arg2, arg3) \
-  (uint8_t) (sizeof (__op_##name) + 1),
+  (uint8_t) (sizeof (__op_##name) / sizeof (idx_t) + 1),
 
 static const char* opcode_names[] =
 {
@@ -67,20 +68,17 @@ tmp_id_to_str (idx_t id)
   JERRY_ASSERT (id >= 128);
   clear_temp_buffer ();
   strncpy (buff, "tmp", 3);
-  if (id / 100 != 0)
-  {
-    buff[3] = (char) (id / 100 + '0');
-    buff[4] = (char) ((id % 100) / 10 + '0');
-    buff[5] = (char) (id % 10 + '0');
-  }
-  else if (id / 10 != 0)
+
+  size_t digits_num = 1;
+  for (idx_t rest = (idx_t) (id / 10); rest != 0; rest = (idx_t) (rest / 10))
   {
-    buff[3] = (char) (id / 10 + '0');
-    buff[4] = (char) (id % 10 + '0');
+    digits_num++;
   }
-  else
+
+  for (size_t i = digits_num; i > 0; i--)
   {
-    buff[3] = (char) (id + '0');
+    buff[3 + i - 1] = (char) (id % 10 + '0');
+    id = (idx_t) (id / 10);
   }
   return buff;
 }
@@ -98,7 +96,8 @@ var_to_str (opcode_t opcode, lit_cpointer_t lit_ids[], opcode_counter_t oc, uint
     JERRY_ASSERT (lit_ids[current_arg - 1].packed_value != MEM_CP_NULL);
     return lit_cp_to_str (lit_ids[current_arg - 1]);
   }
-  else if (raw.uids[current_arg] >= 128)
+  else if (raw.uids[current_arg] >= OPCODE_REG_FIRST
+           && raw.uids[current_arg] <= OPCODE_REG_GENERAL_LAST)
   {
     return tmp_id_to_str (raw.uids[current_arg]);
   }
@@ -153,7 +152,7 @@ pp_printf (const char *format, opcode_t opcode, lit_cpointer_t lit_ids[], opcode
   case NAME_TO_ID (op_name): pp_printf (format, opm.op, opm.lit_id, oc, 1); break;
 #define VAR(i) var_to_str (opm.op, opm.lit_id, oc, i)
 #define OC(i, j) __extension__({ raw_opcode* raw = (raw_opcode *) &opm.op; \
-                                 calc_opcode_counter_from_idx_idx (raw->uids[i], raw->uids[j]); })
+                                 calc_opcode_counter_from_idx_idx (opcodes_p, raw->uids[i], raw->uids[j]); })
 
 static int vargs_num = 0;
 static int seen_vargs = 0;
@@ -162,7 +161,7 @@ static void
 dump_asm (opcode_counter_t oc, opcode_t opcode)
 {
   uint8_t i = 0;
-  uint8_t opcode_id = opcode.op_idx;
+  idx_t opcode_id = opcode.op_idx;
   printf ("%3d: %20s ", oc, opcode_names[opcode_id]);
   if (opcode_id != NAME_TO_ID (nop) && opcode_id != NAME_TO_ID (ret))
   {
@@ -179,7 +178,7 @@ dump_asm (opcode_counter_t oc, opcode_t opcode)
 }
 
 void
-pp_op_meta (const opcode_t *opcodes_p,
+pp_op_meta (const opcode_compact_t *opcodes_p,
             opcode_counter_t oc,
             op_meta opm,
             bool rewrite)
@@ -615,6 +614,34 @@ pp_op_meta (const opcode_t *opcodes_p,
 
           break;
         }
+        case OPCODE_META_TYPE_LAZY_FUNCTION_BODY:
+        {
+          printf ("function body #%d, compiled upon first call;",
+                  (opm.op.data.meta.data_1 << JERRY_BITSINBYTE) | opm.op.data.meta.data_2);
+          break;
+        }
+        case OPCODE_META_TYPE_SCOPE_DECLARATIONS:
+        {
+          if (OC (2, 3) == 0)
+          {
+            printf ("no declarations;");
+          }
+          else
+          {
+            printf ("declarations: %d;", oc + OC (2, 3));
+          }
+          break;
+        }
+        case OPCODE_META_TYPE_FUNCTION_DECLARATION:
+        {
+          printf ("function declaration: %d;", oc - OC (2, 3));
+          break;
+        }
+        case OPCODE_META_TYPE_END_SCOPE_DECLARATIONS:
+        {
+          printf ("end declarations;");
+          break;
+        }
         default:
         {
           JERRY_UNREACHABLE ();
@@ -19,10 +19,10 @@
 #include "jrt.h"
 #ifdef JERRY_ENABLE_PRETTY_PRINTER
 #include "vm.h"
-#include "scopes-tree.h"
+#include "serializer.h"
 
 void pp_opcode (opcode_counter_t, opcode_t, bool);
-void pp_op_meta (const opcode_t*, opcode_counter_t, op_meta, bool);
+void pp_op_meta (const opcode_compact_t*, opcode_counter_t, op_meta, bool);
 #endif // JERRY_ENABLE_PRETTY_PRINTER
 
 #endif // PRETTY_PRINTER
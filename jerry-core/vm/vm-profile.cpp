@@ -0,0 +1,451 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jrt-libc-includes.h"
+#include "serializer.h"
+#include "vm-profile.h"
+
+#ifdef VM_PROFILE
+
+/*
+ * The profiler counts executions and cycles, spent in each instruction, per opcode and per position
+ * of instruction in byte-code.
+ *
+ * Two cycle counts are accumulated:
+ *  - total cycles - from start to end of the instruction's execution;
+ *  - self cycles - the same, excluding cycles of instructions, that were executed by the instruction
+ *    (for example, instructions of a called function's body, or of a try block).
+ */
+
+/**
+ * Number of entries in the table of per-instruction counters
+ */
+#define VM_PROFILE_INSTRUCTIONS_NUMBER (1u << CONFIG_VM_PROFILE_INSTRUCTIONS_NUMBER_LOG)
+
+/**
+ * Maximum number of entries of the per-instruction counters table, checked during lookup of an instruction
+ */
+#define VM_PROFILE_INSTRUCTIONS_MAX_PROBES (16)
+
+/**
+ * Counters of executions
+ */
+typedef struct
+{
+  uint64_t executions; /**< number of executions */
+  uint64_t self_cycles; /**< cycles, spent in the executions, excluding nested instructions */
+  uint64_t total_cycles; /**< cycles, spent in the executions, including nested instructions */
+} vm_profile_counters_t;
+
+/**
+ * Entry of the table of per-instruction counters
+ */
+typedef struct
+{
+  const opcode_compact_t *opcodes_p; /**< byte-code array, containing the instruction (NULL - if the entry is empty) */
+  opcode_counter_t oc; /**< position of the instruction in the byte-code array */
+  vm_profile_counters_t counters; /**< the instruction's counters */
+} vm_profile_instruction_entry_t;
+
+#define __OP_FUNC_NAME(name, arg1, arg2, arg3) #name,
+static const char *vm_profile_op_names[LAST_OP] =
+{
+  OP_LIST (OP_FUNC_NAME)
+};
+#undef __OP_FUNC_NAME
+
+/**
+ * Flag, indicating whether the profile is collected
+ */
+static bool vm_profile_enabled = false;
+
+/**
+ * Cycles, spent in instructions, that were executed by currently executed instruction
+ */
+static uint64_t vm_profile_nested_cycles;
+
+/**
+ * Per-opcode counters
+ */
+static vm_profile_counters_t vm_profile_opcode_counters[LAST_OP];
+
+/**
+ * Per-instruction counters
+ */
+static vm_profile_instruction_entry_t vm_profile_instruction_entries[VM_PROFILE_INSTRUCTIONS_NUMBER];
+
+/**
+ * Number of executions of instructions, that didn't fit into the table of per-instruction counters
+ */
+static uint64_t vm_profile_untracked_executions;
+
+/**
+ * Read the processor's cycle counter
+ *
+ * @return cycle counter's value,
+ *         or 0 - if there is no cycle counter, accessible on the platform.
+ */
+static uint64_t __attr_always_inline___
+vm_profile_get_cycles (void)
+{
+#if defined (__x86_64__) || defined (__i386__)
+  return __builtin_ia32_rdtsc ();
+#else /* !__x86_64__ && !__i386__ */
+  return 0;
+#endif /* !__x86_64__ && !__i386__ */
+} /* vm_profile_get_cycles */
+
+/**
+ * Check whether cycles are counted on the platform
+ *
+ * @return true - if there is a cycle counter,
+ *         false - if only executions are counted.
+ */
+static bool
+vm_profile_is_cycle_counter_available (void)
+{
+#if defined (__x86_64__) || defined (__i386__)
+  return true;
+#else /* !__x86_64__ && !__i386__ */
+  return false;
+#endif /* !__x86_64__ && !__i386__ */
+} /* vm_profile_is_cycle_counter_available */
+
+/**
+ * Initialize the profiler
+ */
+void
+vm_profile_init (bool is_enabled) /**< true - if the profile should be collected,
+                                   *   false - otherwise */
+{
+  vm_profile_enabled = is_enabled;
+  vm_profile_nested_cycles = 0;
+  vm_profile_untracked_executions = 0;
+
+  memset (vm_profile_opcode_counters, 0, sizeof (vm_profile_opcode_counters));
+  memset (vm_profile_instruction_entries, 0, sizeof (vm_profile_instruction_entries));
+} /* vm_profile_init */
+
+/**
+ * Notify the profiler about start of an instruction's execution
+ */
+void
+vm_profile_instruction_enter (vm_profile_mark_t *out_mark_p) /**< out: profiler's state, that should be passed
+                                                              *        to vm_profile_instruction_exit */
+{
+  if (likely (!vm_profile_enabled))
+  {
+    return;
+  }
+
+  out_mark_p->outer_nested_cycles = vm_profile_nested_cycles;
+  vm_profile_nested_cycles = 0;
+
+  out_mark_p->start_cycles = vm_profile_get_cycles ();
+} /* vm_profile_instruction_enter */
+
+/**
+ * Find entry of the instruction in the table of per-instruction counters, or allocate the entry
+ *
+ * @return pointer to the entry,
+ *         or NULL - if there is no space for the instruction in the table.
+ */
+static vm_profile_instruction_entry_t *
+vm_profile_find_instruction_entry (const opcode_compact_t *opcodes_p, /**< byte-code array */
+                                   opcode_counter_t oc) /**< position of the instruction */
+{
+  uint32_t hash = (uint32_t) (((uintptr_t) opcodes_p) >> MEM_ALIGNMENT_LOG) + oc;
+  hash *= 2654435761u;
+
+  uint32_t index = hash >> (32u - CONFIG_VM_PROFILE_INSTRUCTIONS_NUMBER_LOG);
+
+  for (uint32_t probe = 0; probe < VM_PROFILE_INSTRUCTIONS_MAX_PROBES; probe++)
+  {
+    vm_profile_instruction_entry_t *entry_p = &vm_profile_instruction_entries[index];
+
+    if (entry_p->opcodes_p == opcodes_p
+        && entry_p->oc == oc)
+    {
+      return entry_p;
+    }
+    else if (entry_p->opcodes_p == NULL)
+    {
+      entry_p->opcodes_p = opcodes_p;
+      entry_p->oc = oc;
+
+      return entry_p;
+    }
+
+    index = (index + 1u) & (VM_PROFILE_INSTRUCTIONS_NUMBER - 1u);
+  }
+
+  return NULL;
+} /* vm_profile_find_instruction_entry */
+
+/**
+ * Add an execution to the counters
+ */
+static void __attr_always_inline___
+vm_profile_account_execution (vm_profile_counters_t *counters_p, /**< counters */
+                              uint64_t self_cycles, /**< self cycles of the execution */
+                              uint64_t total_cycles) /**< total cycles of the execution */
+{
+  counters_p->executions++;
+  counters_p->self_cycles += self_cycles;
+  counters_p->total_cycles += total_cycles;
+} /* vm_profile_account_execution */
+
+/**
+ * Notify the profiler about end of an instruction's execution
+ */
+void
+vm_profile_instruction_exit (const vm_profile_mark_t *mark_p, /**< profiler's state,
+                                                               *   saved by vm_profile_instruction_enter */
+                             const opcode_compact_t *opcodes_p, /**< byte-code array */
+                             opcode_counter_t oc) /**< position of the executed instruction */
+{
+  if (likely (!vm_profile_enabled))
+  {
+    return;
+  }
+
+  const uint64_t total_cycles = vm_profile_get_cycles () - mark_p->start_cycles;
+  const uint64_t self_cycles = (total_cycles > vm_profile_nested_cycles
+                                ? total_cycles - vm_profile_nested_cycles
+                                : 0);
+
+  vm_profile_nested_cycles = mark_p->outer_nested_cycles + total_cycles;
+
+  vm_profile_account_execution (&vm_profile_opcode_counters[opcodes_p[oc].op_idx], self_cycles, total_cycles);
+
+  vm_profile_instruction_entry_t *entry_p = vm_profile_find_instruction_entry (opcodes_p, oc);
+
+  if (entry_p != NULL)
+  {
+    vm_profile_account_execution (&entry_p->counters, self_cycles, total_cycles);
+  }
+  else
+  {
+    vm_profile_untracked_executions++;
+  }
+} /* vm_profile_instruction_exit */
+
+/**
+ * Get the value, by which counters are ordered in the report
+ *
+ * @return self cycles - if cycles are counted,
+ *         number of executions - otherwise.
+ */
+static uint64_t
+vm_profile_get_cost (const vm_profile_counters_t *counters_p) /**< counters */
+{
+  return (vm_profile_is_cycle_counter_available () ? counters_p->self_cycles : counters_p->executions);
+} /* vm_profile_get_cost */
+
+/**
+ * Print 64-bit unsigned number, right-justified in a field of the specified width
+ *
+ * Note:
+ *      libc's printf is not required to support 64-bit arguments
+ */
+static void
+vm_profile_print_number (uint64_t value, /**< the number */
+                         uint32_t width) /**< width of the field */
+{
+  char buffer[21];
+  char *str_p = buffer + sizeof (buffer) - 1;
+  *str_p = '\0';
+
+  do
+  {
+    *--str_p = (char) ('0' + (char) (value % 10u));
+    value /= 10u;
+  }
+  while (value != 0);
+
+  for (uint32_t length = (uint32_t) (buffer + sizeof (buffer) - 1 - str_p); length < width; length++)
+  {
+    putchar (' ');
+  }
+
+  printf ("%s", str_p);
+} /* vm_profile_print_number */
+
+/**
+ * Print share of the cost in total cost, in percents with one decimal digit
+ */
+static void
+vm_profile_print_share (uint64_t cost, /**< cost */
+                        uint64_t total_cost) /**< total cost */
+{
+  const uint32_t permille = (total_cost == 0) ? 0 : (uint32_t) ((cost * 1000u) / total_cost);
+
+  printf (" %5u.%u", permille / 10u, permille % 10u);
+} /* vm_profile_print_share */
+
+/**
+ * Print row of counters: executions, self cycles, share of the counters' cost in total cost, total cycles
+ */
+static void
+vm_profile_print_counters (const vm_profile_counters_t *counters_p, /**< counters */
+                           uint64_t total_cost) /**< total cost */
+{
+  vm_profile_print_number (counters_p->executions, 15);
+  vm_profile_print_number (counters_p->self_cycles, 17);
+  vm_profile_print_share (vm_profile_get_cost (counters_p), total_cost);
+  vm_profile_print_number (counters_p->total_cycles, 17);
+  printf ("\n");
+} /* vm_profile_print_counters */
+
+/**
+ * Print the profile, collected since the engine's initialization
+ *
+ * Opcodes and the most expensive instructions are listed in order of decreasing cost: self cycles,
+ * or number of executions, if there is no cycle counter on the platform. Instructions are identified
+ * by index of byte-code (sources are indexed in order of parse, starting from 0 for the first parsed source,
+ * so that eval code and bodies of functions, created with Function constructor, have separate indices),
+ * position in the byte-code, and line in the corresponding source (for lazily compiled function bodies,
+ * see also: JERRY_FLAG_PARSE_FUNCTIONS_LAZILY, lines are counted from start of the body).
+ *
+ * Note:
+ *      the report should be printed before the byte-code is freed
+ */
+void
+vm_profile_print_report (void)
+{
+  if (!vm_profile_enabled)
+  {
+    return;
+  }
+
+  const bool is_cycles = vm_profile_is_cycle_counter_available ();
+
+  uint64_t total_cost = 0;
+  uint64_t total_executions = 0;
+
+  for (uint32_t op_idx = 0; op_idx < LAST_OP; op_idx++)
+  {
+    total_cost += vm_profile_get_cost (&vm_profile_opcode_counters[op_idx]);
+    total_executions += vm_profile_opcode_counters[op_idx].executions;
+  }
+
+  printf ("VM profile: ");
+  vm_profile_print_number (total_executions, 0);
+  printf (" executed instructions");
+  if (is_cycles)
+  {
+    printf (", ");
+    vm_profile_print_number (total_cost, 0);
+    printf (" cycles\n");
+  }
+  else
+  {
+    printf (" (cycles are not counted on the platform)\n");
+  }
+
+  /* opcodes, sorted by cost */
+  uint8_t op_order[LAST_OP];
+  uint32_t ops_num = 0;
+
+  for (uint32_t op_idx = 0; op_idx < LAST_OP; op_idx++)
+  {
+    if (vm_profile_opcode_counters[op_idx].executions == 0)
+    {
+      continue;
+    }
+
+    const uint64_t cost = vm_profile_get_cost (&vm_profile_opcode_counters[op_idx]);
+
+    uint32_t pos = ops_num++;
+    while (pos > 0
+           && vm_profile_get_cost (&vm_profile_opcode_counters[op_order[pos - 1]]) < cost)
+    {
+      op_order[pos] = op_order[pos - 1];
+      pos--;
+    }
+    op_order[pos] = (uint8_t) op_idx;
+  }
+
+  printf ("\n%-24s %14s %16s %7s %16s\n", "Opcode", "Executions", "Self cycles", "Share,%", "Total cycles");
+
+  for (uint32_t i = 0; i < ops_num; i++)
+  {
+    const vm_profile_counters_t *counters_p = &vm_profile_opcode_counters[op_order[i]];
+
+    printf ("%-24s", vm_profile_op_names[op_order[i]]);
+    vm_profile_print_counters (counters_p, total_cost);
+  }
+
+  /* the most expensive instructions */
+  const vm_profile_instruction_entry_t *hot_spots[CONFIG_VM_PROFILE_REPORT_HOT_SPOTS_NUMBER];
+  uint32_t hot_spots_num = 0;
+
+  for (uint32_t index = 0; index < VM_PROFILE_INSTRUCTIONS_NUMBER; index++)
+  {
+    const vm_profile_instruction_entry_t *entry_p = &vm_profile_instruction_entries[index];
+
+    if (entry_p->opcodes_p == NULL)
+    {
+      continue;
+    }
+
+    const uint64_t cost = vm_profile_get_cost (&entry_p->counters);
+
+    if (hot_spots_num == CONFIG_VM_PROFILE_REPORT_HOT_SPOTS_NUMBER
+        && vm_profile_get_cost (&hot_spots[hot_spots_num - 1]->counters) >= cost)
+    {
+      continue;
+    }
+
+    uint32_t pos = (hot_spots_num < CONFIG_VM_PROFILE_REPORT_HOT_SPOTS_NUMBER) ? hot_spots_num++ : hot_spots_num - 1;
+    while (pos > 0
+           && vm_profile_get_cost (&hot_spots[pos - 1]->counters) < cost)
+    {
+      hot_spots[pos] = hot_spots[pos - 1];
+      pos--;
+    }
+    hot_spots[pos] = entry_p;
+  }
+
+  printf ("\n%5s %8s %6s %-24s %14s %16s %7s %16s\n",
+          "Code", "Position", "Line", "Opcode", "Executions", "Self cycles", "Share,%", "Total cycles");
+
+  for (uint32_t i = 0; i < hot_spots_num; i++)
+  {
+    const vm_profile_instruction_entry_t *entry_p = hot_spots[i];
+
+    uint32_t code_index, line;
+    if (serializer_get_instruction_source_position (entry_p->opcodes_p, entry_p->oc, &code_index, &line))
+    {
+      printf ("%5u %8u %6u", code_index, (uint32_t) entry_p->oc, line);
+    }
+    else
+    {
+      printf ("%5s %8u %6s", "?", (uint32_t) entry_p->oc, "?");
+    }
+
+    printf (" %-24s", vm_profile_op_names[entry_p->opcodes_p[entry_p->oc].op_idx]);
+    vm_profile_print_counters (&entry_p->counters, total_cost);
+  }
+
+  if (vm_profile_untracked_executions != 0)
+  {
+    printf ("\n");
+    vm_profile_print_number (vm_profile_untracked_executions, 0);
+    printf (" executions of instructions, that didn't fit into the profiler's table, are not listed\n");
+  }
+} /* vm_profile_print_report */
+
+#endif /* VM_PROFILE */
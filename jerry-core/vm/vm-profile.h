@@ -0,0 +1,42 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_PROFILE_H
+#define VM_PROFILE_H
+
+#ifdef VM_PROFILE
+
+#include "opcodes.h"
+
+/**
+ * Profiler's state, saved upon start of an instruction's execution
+ */
+typedef struct
+{
+  uint64_t start_cycles; /**< value of cycle counter upon start of the instruction's execution */
+  uint64_t outer_nested_cycles; /**< cycles, spent in instructions that were executed by the enclosing instruction
+                                 *   (for example, by a call instruction) before start of the instruction */
+} vm_profile_mark_t;
+
+extern void vm_profile_init (bool is_enabled);
+extern void vm_profile_instruction_enter (vm_profile_mark_t *out_mark_p);
+extern void vm_profile_instruction_exit (const vm_profile_mark_t *mark_p,
+                                         const opcode_compact_t *opcodes_p,
+                                         opcode_counter_t oc);
+extern void vm_profile_print_report (void);
+
+#endif /* VM_PROFILE */
+
+#endif /* VM_PROFILE_H */
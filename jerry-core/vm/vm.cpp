@@ -22,8 +22,10 @@
 #include "ecma-stack.h"
 #include "jrt.h"
 #include "vm.h"
+#include "vm-profile.h"
 #include "jrt-libc-includes.h"
 #include "mem-allocator.h"
+#include "serializer.h"
 
 /**
  * Top (current) interpreter context
@@ -37,9 +39,10 @@ static const opfunc __opfuncs[LAST_OP] =
 };
 #undef __INIT_OP_FUNC
 
-JERRY_STATIC_ASSERT (sizeof (opcode_t) <= 4);
+JERRY_STATIC_ASSERT (sizeof (opcode_compact_t) == 4);
+JERRY_STATIC_ASSERT (LAST_OP <= OPCODE_COMPACT_WIDE_FLAG);
 
-const opcode_t *__program = NULL;
+const opcode_compact_t *__program = NULL;
 
 #ifdef MEM_STATS
 #define __OP_FUNC_NAME(name, arg1, arg2, arg3) #name,
@@ -214,7 +217,7 @@ interp_mem_stats_context_exit (int_data_t *int_data_p,
 }
 
 static void
-interp_mem_stats_opcode_enter (const opcode_t *opcodes_p,
+interp_mem_stats_opcode_enter (const opcode_compact_t *opcodes_p,
                                opcode_counter_t opcode_position,
                                mem_heap_stats_t *out_heap_stats_p,
                                mem_pools_stats_t *out_pools_stats_p)
@@ -337,7 +340,7 @@ interp_mem_stats_opcode_exit (int_data_t *int_data_p,
  * Initialize interpreter.
  */
 void
-vm_init (const opcode_t *program_p, /**< pointer to byte-code program */
+vm_init (const opcode_compact_t *program_p, /**< pointer to byte-code program */
          bool dump_mem_stats) /** dump per-opcode memory usage change statistics */
 {
 #ifdef MEM_STATS
@@ -452,7 +455,7 @@ vm_loop (int_data_t *int_data_p, /**< interpreter context */
                     || (run_scope_p->start_oc <= int_data_p->pos
                         && int_data_p->pos <= run_scope_p->end_oc));
 
-      const opcode_t *curr = &int_data_p->opcodes_p[int_data_p->pos];
+      const opcode_t curr = vm_get_opcode (int_data_p->opcodes_p, int_data_p->pos);
 
 #ifdef MEM_STATS
       const opcode_counter_t opcode_pos = int_data_p->pos;
@@ -463,7 +466,20 @@ vm_loop (int_data_t *int_data_p, /**< interpreter context */
                                      &pools_stats_before);
 #endif /* MEM_STATS */
 
-      completion = __opfuncs[curr->op_idx] (*curr, int_data_p);
+#ifdef VM_PROFILE
+      const opcode_counter_t profile_pos = int_data_p->pos;
+
+      vm_profile_mark_t profile_mark;
+      vm_profile_instruction_enter (&profile_mark);
+#endif /* VM_PROFILE */
+
+      completion = __opfuncs[curr.op_idx] (curr, int_data_p);
+
+#ifdef VM_PROFILE
+      vm_profile_instruction_exit (&profile_mark,
+                                   int_data_p->opcodes_p,
+                                   profile_pos);
+#endif /* VM_PROFILE */
 
 #ifdef CONFIG_VM_RUN_GC_AFTER_EACH_OPCODE
       ecma_gc_run ();
@@ -511,9 +527,13 @@ vm_loop (int_data_t *int_data_p, /**< interpreter context */
 
 /**
  * Run the code, starting from specified opcode
+ *
+ * Note:
+ *      declarations of the scope (see also: OPCODE_META_TYPE_SCOPE_DECLARATIONS) are instantiated
+ *      before the scope's code is run
  */
 ecma_completion_value_t
-vm_run_from_pos (const opcode_t *opcodes_p, /**< byte-code array */
+vm_run_from_pos (const opcode_compact_t *opcodes_p, /**< byte-code array */
                  opcode_counter_t start_pos, /**< identifier of starting opcode */
                  ecma_value_t this_binding_value, /**< value of 'ThisBinding' */
                  ecma_object_t *lex_env_p, /**< lexical environment to use */
@@ -522,11 +542,11 @@ vm_run_from_pos (const opcode_t *opcodes_p, /**< byte-code array */
 {
   ecma_completion_value_t completion;
 
-  const opcode_t *curr = &opcodes_p[start_pos];
-  JERRY_ASSERT (curr->op_idx == __op__idx_reg_var_decl);
+  const opcode_t curr = vm_get_opcode (opcodes_p, start_pos);
+  JERRY_ASSERT (curr.op_idx == __op__idx_reg_var_decl);
 
-  const idx_t min_reg_num = curr->data.reg_var_decl.min;
-  const idx_t max_reg_num = curr->data.reg_var_decl.max;
+  const idx_t min_reg_num = curr.data.reg_var_decl.min;
+  const idx_t max_reg_num = curr.data.reg_var_decl.max;
   JERRY_ASSERT (max_reg_num >= min_reg_num);
 
   const int32_t regs_num = max_reg_num - min_reg_num + 1;
@@ -553,7 +573,26 @@ vm_run_from_pos (const opcode_t *opcodes_p, /**< byte-code array */
   interp_mem_stats_context_enter (&int_data, start_pos);
 #endif /* MEM_STATS */
 
-  completion = vm_loop (&int_data, NULL);
+  const opcode_counter_t scope_decls_offset = read_meta_opcode_counter (OPCODE_META_TYPE_SCOPE_DECLARATIONS,
+                                                                        &int_data);
+  completion = ecma_make_empty_completion_value ();
+
+  if (scope_decls_offset != 0)
+  {
+    int_data.pos = (opcode_counter_t) (int_data.pos + scope_decls_offset);
+
+    completion = vm_loop (&int_data, NULL);
+
+    JERRY_ASSERT (ecma_is_completion_value_empty (completion)
+                  || ecma_is_completion_value_throw (completion));
+  }
+
+  if (!ecma_is_completion_value_throw (completion))
+  {
+    int_data.pos = (opcode_counter_t) (start_pos + 2);
+
+    completion = vm_loop (&int_data, NULL);
+  }
 
   JERRY_ASSERT (ecma_is_completion_value_throw (completion)
                 || ecma_is_completion_value_return (completion));
@@ -577,10 +616,10 @@ vm_run_from_pos (const opcode_t *opcodes_p, /**< byte-code array */
  * Get specified opcode from the program.
  */
 opcode_t
-vm_get_opcode (const opcode_t *opcodes_p, /**< byte-code array */
+vm_get_opcode (const opcode_compact_t *opcodes_p, /**< byte-code array */
                opcode_counter_t counter) /**< opcode counter */
 {
-  return opcodes_p[ counter ];
+  return serializer_get_opcode (opcodes_p, counter);
 } /* vm_get_opcode */
 
 /**
@@ -589,7 +628,7 @@ vm_get_opcode (const opcode_t *opcodes_p, /**< byte-code array */
  * @return mask of scope code flags
  */
 opcode_scope_code_flags_t
-vm_get_scope_flags (const opcode_t *opcodes_p, /**< byte-code array */
+vm_get_scope_flags (const opcode_compact_t *opcodes_p, /**< byte-code array */
                     opcode_counter_t counter) /**< opcode counter */
 {
   opcode_t flags_opcode = vm_get_opcode (opcodes_p, counter);
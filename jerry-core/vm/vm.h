@@ -20,19 +20,19 @@
 #include "jrt.h"
 #include "opcodes.h"
 
-extern void vm_init (const opcode_t* program_p, bool dump_mem_stats);
+extern void vm_init (const opcode_compact_t* program_p, bool dump_mem_stats);
 extern void vm_finalize (void);
 extern jerry_completion_code_t vm_run_global (void);
 extern ecma_completion_value_t vm_loop (int_data_t *int_data, vm_run_scope_t *run_scope_p);
-extern ecma_completion_value_t vm_run_from_pos (const opcode_t *opcodes_p,
+extern ecma_completion_value_t vm_run_from_pos (const opcode_compact_t *opcodes_p,
                                                 opcode_counter_t start_pos,
                                                 ecma_value_t this_binding_value,
                                                 ecma_object_t *lex_env_p,
                                                 bool is_strict,
                                                 bool is_eval_code);
 
-extern opcode_t vm_get_opcode (const opcode_t*, opcode_counter_t counter);
-extern opcode_scope_code_flags_t vm_get_scope_flags (const opcode_t*, opcode_counter_t counter);
+extern opcode_t vm_get_opcode (const opcode_compact_t*, opcode_counter_t counter);
+extern opcode_scope_code_flags_t vm_get_scope_flags (const opcode_compact_t*, opcode_counter_t counter);
 
 extern bool vm_is_strict_mode (void);
 extern bool vm_is_direct_eval_form_call (void);
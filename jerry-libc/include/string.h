@@ -24,6 +24,7 @@
 # define EXTERN_C
 #endif /* !__cplusplus */
 
+extern EXTERN_C void*  memchr (const void *s, int c, size_t n);
 extern EXTERN_C int    memcmp (const void *s1, const void *s2, size_t n);
 extern EXTERN_C void*  memcpy (void *dest, const void *src, size_t n);
 extern EXTERN_C void*  memset (void *s, int c, size_t n);
@@ -27,6 +27,7 @@
 #define __attr_used___     __attribute__((used))
 #define __attr_noreturn___ __attribute__((noreturn))
 #define __attr_noinline___ __attribute__((noinline))
+#define __attr_always_inline___ __attribute__((always_inline))
 
 /**
  * Assertions
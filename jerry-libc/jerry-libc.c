@@ -51,6 +51,55 @@ CALL_PRAGMA (GCC push_options)
 CALL_PRAGMA (GCC optimize ("-fno-tree-loop-distribute-patterns"))
 #endif /* __GNUC__ */
 
+/**
+ * Machine word, used by the memory routines for word-at-a-time processing
+ */
+typedef uintptr_t __attribute__ ((__may_alias__)) libc_word_t;
+
+/**
+ * Size of machine word
+ */
+#define LIBC_WORD_SIZE (sizeof (libc_word_t))
+
+/**
+ * Check whether the pointer is aligned to machine word size
+ */
+#define LIBC_IS_WORD_ALIGNED(p) (((uintptr_t) (p) % LIBC_WORD_SIZE) == 0)
+
+/**
+ * Word with all bytes equal to the specified byte value
+ */
+#define LIBC_WORD_REPEAT_BYTE(b) ((libc_word_t) (b) * (UINTPTR_MAX / 0xffu))
+
+/**
+ * Check whether the word contains a zero byte
+ */
+#define LIBC_WORD_HAS_ZERO_BYTE(w) ((((w) - LIBC_WORD_REPEAT_BYTE (0x01u)) \
+                                     & ~(w) \
+                                     & LIBC_WORD_REPEAT_BYTE (0x80u)) != 0)
+
+/**
+ * Minimum size of area, starting from which the memory routines process the area by words
+ *
+ * Shorter areas are processed by bytes, as aligning their start would cost more than word accesses save.
+ */
+#define LIBC_MEM_WORD_ACCESS_MIN_SIZE (2 * LIBC_WORD_SIZE)
+
+#if defined (__TARGET_HOST_x64) || defined (__TARGET_HOST_x86)
+/**
+ * Unaligned machine word
+ *
+ * x86 architectures access unaligned words without penalty comparable to byte-by-byte processing,
+ * so areas that can't be aligned simultaneously (i.e. source and destination of a copy) are processed
+ * by words, with destination aligned and source accessed through the unaligned type.
+ *
+ * On other architectures (ARM), such areas are processed by bytes.
+ */
+typedef uintptr_t __attribute__ ((__may_alias__, __aligned__ (1))) libc_unaligned_word_t;
+
+# define LIBC_MEM_UNALIGNED_WORD_ACCESS
+#endif /* __TARGET_HOST_x64 || __TARGET_HOST_x86 */
+
 /**
  * memset
  *
@@ -62,6 +111,26 @@ memset (void *s,  /**< area to set values in */
         size_t n) /**< area size */
 {
   uint8_t *area_p = (uint8_t *) s;
+
+  if (n >= LIBC_MEM_WORD_ACCESS_MIN_SIZE)
+  {
+    while (!LIBC_IS_WORD_ALIGNED (area_p))
+    {
+      *area_p++ = (uint8_t) c;
+      n--;
+    }
+
+    const libc_word_t word = LIBC_WORD_REPEAT_BYTE ((uint8_t) c);
+    libc_word_t *area_word_p = (libc_word_t *) (void *) area_p;
+
+    for (; n >= LIBC_WORD_SIZE; n -= LIBC_WORD_SIZE)
+    {
+      *area_word_p++ = word;
+    }
+
+    area_p = (uint8_t *) area_word_p;
+  }
+
   for (size_t index = 0; index < n; index++)
   {
     area_p[ index ] = (uint8_t) c;
@@ -70,6 +139,62 @@ memset (void *s,  /**< area to set values in */
   return s;
 } /* memset */
 
+/**
+ * memchr
+ *
+ * @return pointer to first byte, equal to @c, in the area,
+ *         or NULL - if there is no such byte
+ */
+void *
+memchr (const void *s, /**< area to search in */
+        int c, /**< value to search for */
+        size_t n) /**< area size */
+{
+  const uint8_t *area_p = (const uint8_t *) s;
+
+  if (n >= LIBC_MEM_WORD_ACCESS_MIN_SIZE)
+  {
+    while (!LIBC_IS_WORD_ALIGNED (area_p))
+    {
+      if (*area_p == (uint8_t) c)
+      {
+        return (void *) area_p;
+      }
+
+      area_p++;
+      n--;
+    }
+
+    const libc_word_t pattern = LIBC_WORD_REPEAT_BYTE ((uint8_t) c);
+    const libc_word_t *area_word_p = (const libc_word_t *) (const void *) area_p;
+
+    /* skip words without the byte, the word containing the byte is scanned by the byte loop below */
+    for (; n >= LIBC_WORD_SIZE; n -= LIBC_WORD_SIZE)
+    {
+      const libc_word_t word = *area_word_p ^ pattern;
+
+      if (LIBC_WORD_HAS_ZERO_BYTE (word))
+      {
+        break;
+      }
+
+      area_word_p++;
+    }
+
+    area_p = (const uint8_t *) area_word_p;
+  }
+
+  for (size_t index = 0; index < n; index++)
+  {
+    if (area_p[ index ] == (uint8_t) c)
+    {
+      return (void *) (area_p + index);
+    }
+  }
+
+  return NULL;
+} /* memchr */
+
 /**
  * memcmp
  *
@@ -83,6 +208,52 @@ memcmp (const void *s1, /**< first area */
         size_t n) /**< area size */
 {
   const uint8_t *area1_p = (uint8_t *) s1, *area2_p = (uint8_t *) s2;
+
+  if (n >= LIBC_MEM_WORD_ACCESS_MIN_SIZE)
+  {
+    /* skip equal words, the first differing word is compared by the byte loop below */
+    if (((uintptr_t) area1_p - (uintptr_t) area2_p) % LIBC_WORD_SIZE == 0)
+    {
+      while (!LIBC_IS_WORD_ALIGNED (area1_p) && *area1_p == *area2_p)
+      {
+        area1_p++;
+        area2_p++;
+        n--;
+      }
+
+      if (LIBC_IS_WORD_ALIGNED (area1_p))
+      {
+        const libc_word_t *area1_word_p = (const libc_word_t *) (const void *) area1_p;
+        const libc_word_t *area2_word_p = (const libc_word_t *) (const void *) area2_p;
+
+        for (; n >= LIBC_WORD_SIZE && *area1_word_p == *area2_word_p; n -= LIBC_WORD_SIZE)
+        {
+          area1_word_p++;
+          area2_word_p++;
+        }
+
+        area1_p = (const uint8_t *) area1_word_p;
+        area2_p = (const uint8_t *) area2_word_p;
+      }
+    }
+#ifdef LIBC_MEM_UNALIGNED_WORD_ACCESS
+    else
+    {
+      const libc_unaligned_word_t *area1_word_p = (const libc_unaligned_word_t *) (const void *) area1_p;
+      const libc_unaligned_word_t *area2_word_p = (const libc_unaligned_word_t *) (const void *) area2_p;
+
+      for (; n >= LIBC_WORD_SIZE && *area1_word_p == *area2_word_p; n -= LIBC_WORD_SIZE)
+      {
+        area1_word_p++;
+        area2_word_p++;
+      }
+
+      area1_p = (const uint8_t *) area1_word_p;
+      area2_p = (const uint8_t *) area2_word_p;
+    }
+#endif /* LIBC_MEM_UNALIGNED_WORD_ACCESS */
+  }
+
   for (size_t index = 0; index < n; index++)
   {
     if (area1_p[ index ] < area2_p[ index ])
@@ -98,6 +269,120 @@ memcmp (const void *s1, /**< first area */
   return 0;
 } /* memcmp */
 
+/**
+ * Copy the area from begin to end
+ *
+ * Note:
+ *      the areas can overlap if destination is placed before source
+ */
+static inline void __attr_always_inline___
+libc_mem_copy_forward (uint8_t *dest_p, /**< destination */
+                       const uint8_t *src_p, /**< source */
+                       size_t n) /**< bytes number */
+{
+  if (n >= LIBC_MEM_WORD_ACCESS_MIN_SIZE)
+  {
+    while (!LIBC_IS_WORD_ALIGNED (dest_p))
+    {
+      *dest_p++ = *src_p++;
+      n--;
+    }
+
+    libc_word_t *dest_word_p = (libc_word_t *) (void *) dest_p;
+
+    if (LIBC_IS_WORD_ALIGNED (src_p))
+    {
+      const libc_word_t *src_word_p = (const libc_word_t *) (const void *) src_p;
+
+      for (; n >= LIBC_WORD_SIZE; n -= LIBC_WORD_SIZE)
+      {
+        *dest_word_p++ = *src_word_p++;
+      }
+
+      src_p = (const uint8_t *) src_word_p;
+    }
+#ifdef LIBC_MEM_UNALIGNED_WORD_ACCESS
+    else
+    {
+      const libc_unaligned_word_t *src_word_p = (const libc_unaligned_word_t *) (const void *) src_p;
+
+      for (; n >= LIBC_WORD_SIZE; n -= LIBC_WORD_SIZE)
+      {
+        *dest_word_p++ = *src_word_p++;
+      }
+
+      src_p = (const uint8_t *) src_word_p;
+    }
+#endif /* LIBC_MEM_UNALIGNED_WORD_ACCESS */
+
+    dest_p = (uint8_t *) dest_word_p;
+  }
+
+  for (size_t index = 0; index < n; index++)
+  {
+    dest_p[ index ] = src_p[ index ];
+  }
+} /* libc_mem_copy_forward */
+
+/**
+ * Copy the area from end to begin
+ *
+ * Note:
+ *      the areas can overlap if destination is placed after source
+ */
+static inline void __attr_always_inline___
+libc_mem_copy_backward (uint8_t *dest_p, /**< destination */
+                        const uint8_t *src_p, /**< source */
+                        size_t n) /**< bytes number */
+{
+  /* pointers to ends of the areas */
+  dest_p += n;
+  src_p += n;
+
+  if (n >= LIBC_MEM_WORD_ACCESS_MIN_SIZE)
+  {
+    while (!LIBC_IS_WORD_ALIGNED (dest_p))
+    {
+      *--dest_p = *--src_p;
+      n--;
+    }
+
+    libc_word_t *dest_word_p = (libc_word_t *) (void *) dest_p;
+
+    if (LIBC_IS_WORD_ALIGNED (src_p))
+    {
+      const libc_word_t *src_word_p = (const libc_word_t *) (const void *) src_p;
+
+      for (; n >= LIBC_WORD_SIZE; n -= LIBC_WORD_SIZE)
+      {
+        *--dest_word_p = *--src_word_p;
+      }
+
+      src_p = (const uint8_t *) src_word_p;
+    }
+#ifdef LIBC_MEM_UNALIGNED_WORD_ACCESS
+    else
+    {
+      const libc_unaligned_word_t *src_word_p = (const libc_unaligned_word_t *) (const void *) src_p;
+
+      for (; n >= LIBC_WORD_SIZE; n -= LIBC_WORD_SIZE)
+      {
+        *--dest_word_p = *--src_word_p;
+      }
+
+      src_p = (const uint8_t *) src_word_p;
+    }
+#endif /* LIBC_MEM_UNALIGNED_WORD_ACCESS */
+
+    dest_p = (uint8_t *) dest_word_p;
+  }
+
+  while (n-- > 0)
+  {
+    *--dest_p = *--src_p;
+  }
+} /* libc_mem_copy_backward */
+
 /**
  * memcpy
  */
@@ -106,13 +391,7 @@ memcpy (void *s1, /**< destination */
         const void *s2, /**< source */
         size_t n) /**< bytes number */
 {
-  uint8_t *area1_p = (uint8_t *) s1;
-  const uint8_t *area2_p = (const uint8_t *) s2;
-
-  for (size_t index = 0; index < n; index++)
-  {
-    area1_p[ index ] = area2_p[ index ];
-  }
+  libc_mem_copy_forward ((uint8_t *) s1, (const uint8_t *) s2, n);
 
   return s1;
 } /* memcpy */
@@ -132,17 +411,11 @@ memmove (void *s1, /**< destination */
 
   if (dest_p < src_p)
   { /* from begin to end */
-    for (size_t index = 0; index < n; index++)
-    {
-      dest_p[ index ] = src_p[ index ];
-    }
+    libc_mem_copy_forward (dest_p, src_p, n);
   }
   else if (dest_p > src_p)
   { /* from end to begin */
-    for (size_t index = 1; index <= n; index++)
-    {
-      dest_p[ n - index ] = src_p[ n - index ];
-    }
+    libc_mem_copy_backward (dest_p, src_p, n);
   }
 
   return s1;
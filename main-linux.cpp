@@ -26,9 +26,10 @@
 #define JERRY_MAX_COMMAND_LINE_ARGS (64)
 
 /**
- * Maximum size of source code buffer
+ * Size of buffer for a window of source code, that is read from script files during parse
+ * (see also: jerry_parse_from_reader)
  */
-#define JERRY_SOURCE_BUFFER_SIZE (1048576)
+#define JERRY_SOURCE_WINDOW_SIZE (16384)
 
 /**
  * Standalone Jerry exit codes
@@ -36,76 +37,81 @@
 #define JERRY_STANDALONE_EXIT_CODE_OK   (0)
 #define JERRY_STANDALONE_EXIT_CODE_FAIL (1)
 
-static uint8_t source_buffer[ JERRY_SOURCE_BUFFER_SIZE ];
+static uint8_t source_window[ JERRY_SOURCE_WINDOW_SIZE ];
 
-static const jerry_api_char_t *
-read_sources (const char *script_file_names[],
-              int files_count,
-              size_t *out_source_size_p)
+/**
+ * State of reader of script files, specified in command line
+ */
+typedef struct
 {
-  int i;
-  uint8_t *source_buffer_tail = source_buffer;
+  const char **file_names_p; /**< names of script files */
+  int files_count; /**< number of script files */
+  int current_file_index; /**< index of currently read file */
+  FILE *current_file_p; /**< currently read file (or NULL - if next file is not open yet) */
+  bool is_failed; /**< flag, indicating that one of the files could not be read */
+} script_files_reader_t;
 
-  for (i = 0; i < files_count; i++)
-  {
-    const char *script_file_name = script_file_names[i];
+/**
+ * Open current script file of the reader
+ *
+ * @return true - if the file was opened successfully,
+ *         false - otherwise.
+ */
+static bool
+script_files_reader_open_current (script_files_reader_t *reader_p) /**< reader state */
+{
+  reader_p->current_file_p = fopen (reader_p->file_names_p[reader_p->current_file_index], "r");
 
-    FILE *file = fopen (script_file_name, "r");
+  if (reader_p->current_file_p == NULL)
+  {
+    reader_p->is_failed = true;
 
-    if (file == NULL)
-    {
-      break;
-    }
+    JERRY_ERROR_MSG ("Failed to read script N%d\n", reader_p->current_file_index + 1);
 
-    int fseek_status = fseek (file, 0, SEEK_END);
+    return false;
+  }
 
-    if (fseek_status != 0)
-    {
-      break;
-    }
+  return true;
+} /* script_files_reader_open_current */
 
-    long script_len = ftell (file);
+/**
+ * Source reader callback, that reads script files one after another
+ *
+ * See also:
+ *          jerry_parse_from_reader
+ *
+ * @return number of bytes read (0 - if all files were read, or a file could not be read)
+ */
+static size_t
+script_files_reader_read (jerry_api_char_t *buffer_p, /**< buffer to read to */
+                          size_t buffer_size, /**< size of the buffer */
+                          void *user_p) /**< reader state (script_files_reader_t) */
+{
+  script_files_reader_t *reader_p = (script_files_reader_t *) user_p;
 
-    if (script_len < 0)
+  while (!reader_p->is_failed
+         && reader_p->current_file_index < reader_p->files_count)
+  {
+    if (reader_p->current_file_p == NULL
+        && !script_files_reader_open_current (reader_p))
     {
       break;
     }
 
-    rewind (file);
+    size_t bytes_read = fread (buffer_p, 1, buffer_size, reader_p->current_file_p);
 
-    const size_t current_source_size = (size_t)script_len;
-
-    if (source_buffer_tail + current_source_size >= source_buffer + sizeof (source_buffer))
-    {
-      break;
-    }
-
-    size_t bytes_read = fread (source_buffer_tail, 1, current_source_size, file);
-    if (bytes_read < current_source_size)
+    if (bytes_read != 0)
     {
-      break;
+      return bytes_read;
     }
 
-    fclose (file);
-
-    source_buffer_tail += current_source_size;
-  }
-
-  if (i < files_count)
-  {
-    JERRY_ERROR_MSG ("Failed to read script N%d\n", i + 1);
-
-    return NULL;
+    fclose (reader_p->current_file_p);
+    reader_p->current_file_p = NULL;
+    reader_p->current_file_index++;
   }
-  else
-  {
-    const size_t source_size = (size_t) (source_buffer_tail - source_buffer);
-
-    *out_source_size_p = source_size;
 
-    return (const jerry_api_char_t *) source_buffer;
-  }
-}
+  return 0;
+} /* script_files_reader_read */
 
 /**
  * Provide the 'assert' implementation for the engine.
@@ -178,6 +184,10 @@ main (int argc,
     {
       flags |= JERRY_FLAG_MEM_STATS_SEPARATE;
     }
+    else if (!strcmp ("--vm-profile", argv[i]))
+    {
+      flags |= JERRY_FLAG_VM_PROFILE;
+    }
     else if (!strcmp ("--parse-only", argv[i]))
     {
       flags |= JERRY_FLAG_PARSE_ONLY;
@@ -186,6 +196,10 @@ main (int argc,
     {
       flags |= JERRY_FLAG_SHOW_OPCODES;
     }
+    else if (!strcmp ("--parse-functions-lazily", argv[i]))
+    {
+      flags |= JERRY_FLAG_PARSE_FUNCTIONS_LAZILY;
+    }
     else if (!strcmp ("--log-level", argv[i]))
     {
       flags |= JERRY_FLAG_ENABLE_LOG;
@@ -232,10 +246,13 @@ main (int argc,
   }
   else
   {
-    size_t source_size;
-    const jerry_api_char_t *source_p = read_sources (file_names, files_counter, &source_size);
+    script_files_reader_t files_reader;
+    files_reader.file_names_p = file_names;
+    files_reader.files_count = files_counter;
+    files_reader.current_file_index = 0;
+    files_reader.is_failed = false;
 
-    if (source_p == NULL)
+    if (!script_files_reader_open_current (&files_reader))
     {
       return JERRY_STANDALONE_EXIT_CODE_FAIL;
     }
@@ -279,9 +296,19 @@ main (int argc,
 
       jerry_completion_code_t ret_code = JERRY_COMPLETION_CODE_OK;
 
-      if (!jerry_parse (source_p, source_size))
+      bool is_parsed = jerry_parse_from_reader (script_files_reader_read,
+                                                &files_reader,
+                                                source_window,
+                                                sizeof (source_window));
+
+      if (files_reader.current_file_p != NULL)
+      {
+        fclose (files_reader.current_file_p);
+      }
+
+      if (!is_parsed || files_reader.is_failed)
       {
-        /* unhandled SyntaxError */
+        /* unhandled SyntaxError, or a script file could not be read */
         ret_code = JERRY_COMPLETION_CODE_UNHANDLED_EXCEPTION;
       }
       else
@@ -159,6 +159,10 @@ int jerry_main (int argc, char *argv[])
     {
       flags |= JERRY_FLAG_MEM_STATS_SEPARATE;
     }
+    else if (!strcmp ("--vm-profile", argv[i]))
+    {
+      flags |= JERRY_FLAG_VM_PROFILE;
+    }
     else if (!strcmp ("--parse-only", argv[i]))
     {
       flags |= JERRY_FLAG_PARSE_ONLY;
@@ -167,6 +171,10 @@ int jerry_main (int argc, char *argv[])
     {
       flags |= JERRY_FLAG_SHOW_OPCODES;
     }
+    else if (!strcmp ("--parse-functions-lazily", argv[i]))
+    {
+      flags |= JERRY_FLAG_PARSE_FUNCTIONS_LAZILY;
+    }
     else if (!strcmp ("--abort-on-fail", argv[i]))
     {
       flags |= JERRY_FLAG_ABORT_ON_FAIL;
@@ -0,0 +1,67 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Jumps and function ends over more than 0xF000 instructions,
+// i.e. opcode counters that are stored in the long opcode counters table.
+// Each 'n++;' statement is a single instruction.
+var statements_num = 65536;
+
+var body = "n++;";
+while (body.length < statements_num * 4)
+{
+  body = body + body;
+}
+
+// forward conditional jump over the body (if), backward jump over it (do-while),
+// 'continue' and 'break' over it, and a function declared after it
+eval ("function loop (cond) {"
+      + "  var n = 0, iters = 0;"
+      + "  do {"
+      + "    iters++;"
+      + "    if (iters == 2) { continue; }"
+      + "    if (cond) {" + body + "} else { n = -1; break; }"
+      + "    if (iters == 3) { break; }"
+      + "  } while (true);"
+      + "  function get_n () { return n; }"
+      + "  return get_n ();"
+      + "}");
+
+assert (loop (true) === 2 * statements_num);
+assert (loop (false) === -1);
+
+// the same jumps in a loop, that is not the first statement of the scope
+eval ("function loop_for () {"
+      + "  var n = 0;"
+      + "  for (var i = 0; i < 3; i++) {"
+      + "    if (i == 1) { continue; }"
+      + body
+      + "  }"
+      + "  return n;"
+      + "}");
+
+assert (loop_for () === 2 * statements_num);
+
+// nested function with the long body, followed by another nested function
+eval ("function outer () {"
+      + "  function inner () { var n = 0;" + body + " return n; }"
+      + "  function after () { return 1; }"
+      + "  return inner () + after ();"
+      + "}");
+
+assert (outer () === statements_num + 1);
+
+// function expression in a function, created with Function constructor
+var f = new Function ("n", "var g = function () {" + body + " return n; }; return g () + 1;");
+
+assert (f (1) === statements_num + 2);
@@ -81,3 +81,92 @@ try {
 	assert(e.message === "foo");
 	assert(e instanceof ReferenceError);
 }
+
+// Sorting is performed in place
+var array = [3, 1, 2];
+assert(array.sort() === array);
+assert(array[0] === 1 && array[1] === 2 && array[2] === 3);
+
+// Default comparison of numbers uses their string representations
+var array = [10, 9, 1, 100, 25, 0, 2, 4294967295, 11, -1, 0.5];
+array.sort();
+assert(array.join() === "-1,0,0.5,1,10,100,11,2,25,4294967295,9");
+
+// Undefined values and non-existent properties are sorted to the end
+var array = [];
+array[0] = "b";
+array[2] = "a";
+array[4] = undefined;
+array.length = 6;
+array.sort();
+assert(array[0] === "a" && array[1] === "b" && array[2] === undefined);
+assert(2 in array && !(3 in array) && !(4 in array) && !(5 in array));
+assert(array.length === 6);
+
+// Sorting is stable
+var array = [];
+for (i = 0; i < 100; i++) {
+	array.push({ key : i % 7, index : i });
+}
+
+array.sort(function (a, b) { return a.key - b.key; });
+for (i = 1; i < array.length; i++) {
+	assert(array[i - 1].key < array[i].key
+	       || (array[i - 1].key === array[i].key && array[i - 1].index < array[i].index));
+}
+
+// Long arrays with ascending and descending runs
+var array = [];
+for (i = 0; i < 300; i++) {
+	array.push(i < 150 ? i : 450 - i);
+}
+
+array.sort(function (a, b) { return a - b; });
+assert(array.length === 300);
+for (i = 1; i < array.length; i++) {
+	assert(array[i - 1] <= array[i]);
+}
+
+var array = [];
+for (i = 0; i < 300; i++) {
+	array.push("s" + ((i * 31) % 300));
+}
+
+array.sort();
+for (i = 1; i < array.length; i++) {
+	assert(array[i - 1] < array[i]);
+}
+
+// Checking behavior when comparefn throws
+var array = [5, 4, 3, 2, 1, 0, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 9, 8, 7, 6, 5];
+var count = 0;
+try {
+	array.sort(function (a, b) {
+		if (++count > 20) {
+			throw new ReferenceError ("foo");
+		}
+		return a - b;
+	});
+	assert(false);
+} catch (e) {
+	assert(e.message === "foo");
+	assert(e instanceof ReferenceError);
+}
+
+// Array-like objects
+var obj = { 0 : "b", 1 : "a", length : 2, sort : Array.prototype.sort };
+assert(obj.sort() === obj);
+assert(obj[0] === "a" && obj[1] === "b");
+
+// Merging of a long run with a shorter one is stable
+var array = [];
+for (i = 0; i < 120; i++) {
+	array.push({ key : i < 100 ? i : (i * 37) % 100, index : i });
+}
+
+array.sort(function (a, b) { return a.key - b.key; });
+assert(array.length === 120);
+for (i = 1; i < array.length; i++) {
+	assert(array[i - 1].key < array[i].key
+	       || (array[i - 1].key === array[i].key && array[i - 1].index < array[i].index));
+}
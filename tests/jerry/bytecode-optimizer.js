@@ -0,0 +1,141 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Constant folding */
+assert (1 + 2 * 3 === 7);
+assert (7 / 2 === 3.5);
+assert (1000 * 1000 === 1000000);
+assert (5 - 7 === -2);
+assert (1 / (0 - 0) === Infinity);
+assert (1 / (0 * -1) === -Infinity);
+assert (isNaN (0 / 0));
+assert (7 % 3 === 1);
+assert (-7 % 3 === -1);
+assert ((5 & 3) === 1);
+assert ((5 | 3) === 7);
+assert ((5 ^ 3) === 6);
+assert ((1 << 31) === -2147483648);
+assert ((-16 >> 2) === -4);
+assert ((-1 >>> 28) === 15);
+assert ((1 << 33) === 2);
+assert (1.5 + 1.5 === 3);
+assert (255 + 1 === 256);
+
+var a = 2 + 3;
+assert (a === 5);
+var b = a + 2 * 4;
+assert (b === 13);
+
+/* Forwarding of variable reads and merging of moves */
+var x = 1, y = 2;
+var z = x + y;
+assert (z === 3);
+x = x - 1;
+assert (x === 0);
+z = x < y;
+assert (z === true);
+var o = { p: 10 };
+z = o.p + 1;
+assert (z === 11);
+
+function getter_order ()
+{
+  var log = '';
+  var obj = {
+    valueOf: function () { log += 'v'; return 1; }
+  };
+  var v = obj + 2;
+  assert (v === 3);
+  assert (log === 'v');
+}
+getter_order ();
+
+/* Jump threading */
+var sum = 0;
+for (var i = 0; i < 10; i++)
+{
+  if (i > 5)
+  {
+    continue;
+  }
+  sum += i;
+}
+assert (sum === 15);
+
+var k = 10;
+while (k > 0)
+{
+  k = k - 1;
+  if (k == 3)
+  {
+    break;
+  }
+}
+assert (k === 3);
+
+var c = 0;
+for (var j = 0; j < 5; j++)
+{
+  if (j % 2)
+  {
+    c += 10;
+  }
+  else
+  {
+    c += 1;
+  }
+}
+assert (c === 23);
+
+function nested (n)
+{
+  var r = 0;
+  outer: for (var p = 0; p < n; p++)
+  {
+    for (var q = 0; q < n; q++)
+    {
+      if (q > p)
+      {
+        continue outer;
+      }
+      r += 1 + 1;
+    }
+  }
+  return r;
+}
+assert (nested (4) === 20);
+
+var f = function (v)
+{
+  try
+  {
+    if (v)
+    {
+      throw 1 + 1;
+    }
+    return 3 * 3;
+  }
+  catch (e)
+  {
+    return e;
+  }
+  finally
+  {
+    v = 0;
+  }
+};
+assert (f (true) === 2);
+assert (f (false) === 9);
+
+assert (eval ('2 * 21') === 42);
@@ -0,0 +1,65 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Repeated eval of the same code */
+var funcs = [];
+for (var i = 0; i < 5; i++)
+{
+  assert (eval ('i * 2') === i * 2);
+
+  funcs.push (eval ('(function () { return i; })'));
+}
+
+assert (funcs[0] !== funcs[1]);
+assert (funcs[3] () === 5);
+
+/* The same code evaluated in strict and non-strict mode */
+var code = 'var strict_var = 1; typeof strict_var';
+
+function f_strict ()
+{
+  'use strict';
+
+  return eval (code);
+}
+
+assert (eval (code) === 'number');
+assert (f_strict () === 'number');
+assert (eval (code) === 'number');
+
+/* Syntax errors are reported for each attempt */
+for (var i = 0; i < 2; i++)
+{
+  try
+  {
+    eval ('var');
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+/* Repeated construction of functions with the same body */
+var adder = new Function ('a', 'b', 'return a + b;');
+var concat = new Function ('a', 'b', 'return a + b;');
+var other = new Function ('x', 'y', 'return a + b;');
+var a = 'A', b = 'B';
+
+assert (adder !== concat);
+assert (adder (1, 2) === 3);
+assert (concat ('1', '2') === '12');
+assert (other (1, 2) === 'AB');
@@ -0,0 +1,87 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function collect_keys (obj)
+{
+  var keys = [];
+  for (var k in obj)
+  {
+    keys.push (k);
+  }
+  return keys.sort ().join (',');
+}
+
+function P () {}
+P.prototype.inherited = 1;
+P.prototype.shadowed = 2;
+
+// 1. inherited names are enumerated once, own names shadow inherited ones
+var obj1 = new P ();
+obj1.a = 1;
+obj1.shadowed = 3;
+assert (collect_keys (obj1) === 'a,inherited,shadowed');
+
+// 2. objects with the same prototype reuse the prototype chain's names
+var obj2 = new P ();
+assert (collect_keys (obj2) === 'inherited,shadowed');
+
+// 3. changes of the prototype are noticed
+P.prototype.added = 4;
+assert (collect_keys (obj2) === 'added,inherited,shadowed');
+
+delete P.prototype.added;
+assert (collect_keys (obj2) === 'inherited,shadowed');
+
+Object.defineProperty (P.prototype, 'inherited', { enumerable: false });
+assert (collect_keys (obj2) === 'shadowed');
+Object.defineProperty (P.prototype, 'inherited', { enumerable: true });
+
+// 4. non-enumerable own property shadows enumerable inherited one
+var obj3 = new P ();
+Object.defineProperty (obj3, 'shadowed', { value: 1, enumerable: false });
+assert (collect_keys (obj3) === 'inherited');
+
+// 5. properties, deleted during the iteration, are not visited
+var obj4 = new P ();
+obj4.a = 1;
+obj4.b = 2;
+var visited = [];
+for (var k in obj4)
+{
+  visited.push (k);
+  delete obj4.a;
+  delete obj4.b;
+  delete P.prototype.inherited;
+  delete P.prototype.shadowed;
+}
+assert (visited.length === 1);
+
+// 6. many objects of the same layout
+function R (i)
+{
+  this.x = i;
+  this.y = i * 2;
+}
+R.prototype.z = 0;
+
+var count = 0;
+for (var i = 0; i < 100; i++)
+{
+  var rec = new R (i);
+  for (var k in rec)
+  {
+    count++;
+  }
+}
+assert (count === 300);
@@ -76,3 +76,23 @@ var i = {x: 0};
 }
 
 assert (s === '01');
+
+// 7. condition and increment are evaluated after the body, with the body's values
+s = '';
+for (var i = 0, j = 10; i < j; i += 2)
+{
+  s += i;
+  j = i + 1;
+}
+
+assert (s === '0');
+
+s = '';
+var n = 0;
+while ((n += 1) < 4)
+{
+  s += n;
+  n++;
+}
+
+assert (s === '13');
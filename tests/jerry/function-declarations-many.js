@@ -0,0 +1,26 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* More than 255 function declarations in a single scope */
+var src = '';
+for (var i = 0; i < 300; i++)
+{
+  src += 'function f' + i + ' () { return ' + i + '; }\n';
+}
+src += 'f0 () + f150 () + f299 ();';
+
+assert (eval (src) === 449);
+assert (f255 () === 255);
+assert (f299 () === 299);
@@ -0,0 +1,72 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var base = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+// short and long slices are stored differently, but should behave the same
+for (var len = 1; len <= base.length; len++)
+{
+  var s1 = base.slice (0, len);
+  var s2 = ("_" + base).slice (1, len + 1);
+
+  assert (s1.length === len);
+  assert (s1 === s2);
+  assert (s1[len - 1] === base[len - 1]);
+  assert (s1 + "!" === s2 + "!");
+  assert (s1.slice (len - 1) === base[len - 1]);
+}
+
+var long_str = base.slice (1);
+assert (long_str !== base.slice (2));
+assert (long_str.slice (0, 10) === "123456789a");
+assert (long_str.trim () === long_str);
+assert (Number ((" " + base.slice (0, 9)).slice (1) + "                                        ") === 12345678);
+
+// non-ascii characters
+var non_ascii = "\u00e1\u00e9\u00ed\u00f3\u00fa\u0410\u0411\u0412\u0413\u0414\u4e00\u4e01\u4e02\u4e03\u4e04";
+var long_non_ascii = (non_ascii + non_ascii).slice (3);
+assert (long_non_ascii.length === 27);
+assert (long_non_ascii[0] === "\u00f3");
+assert (long_non_ascii[7] === "\u4e00");
+assert (long_non_ascii[26] === "\u4e04");
+
+// heap-allocated strings as property names
+var obj = {};
+obj[long_str] = 1;
+obj[base.slice (1, 30) + base.slice (30)] = 2;
+assert (obj[long_str] === 2);
+assert (Object.keys (obj).length === 1);
+
+// indexed access to long non-ascii strings
+var pieces = ["a", "\u00e9", "\u4e00", "b", "\u0430"];
+var expected = [];
+var long_mixed = "";
+for (var i = 0; i < 100; i++)
+{
+  var piece = pieces[i % pieces.length];
+  long_mixed = long_mixed + piece;
+  expected.push (piece);
+}
+long_mixed = ("_" + long_mixed).slice (1);
+
+assert (long_mixed.length === expected.length);
+for (var i = 0; i < expected.length; i++)
+{
+  assert (long_mixed[i] === expected[i]);
+}
+for (var i = expected.length - 1; i >= 0; i -= 7)
+{
+  assert (long_mixed[i] === expected[i]);
+}
+assert (long_mixed.slice (90, 93) === expected[90] + expected[91] + expected[92]);
@@ -0,0 +1,53 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var str = "universe";
+
+assert (str.charAt (0) === "u");
+assert (str.charAt (7) === "e");
+assert (str.charAt () === "u");
+assert (str.charAt ("2") === "i");
+assert (str.charAt (1.9) === "n");
+assert (str.charAt (-0.5) === "u");
+assert (str.charAt (NaN) === "u");
+assert (str.charAt (-1) === "");
+assert (str.charAt (8) === "");
+assert (str.charAt (Infinity) === "");
+assert ("".charAt (0) === "");
+
+assert (String.prototype.charAt.call (12345, 2) === "3");
+assert (String.prototype.charAt.length === 1);
+
+try
+{
+  String.prototype.charAt.call (undefined, 0);
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof TypeError);
+}
+
+// non-ascii characters of a long concatenated string
+var pieces = ["a", "\u00e9", "\u4e00", "b", "\u0430"];
+var long_str = "";
+for (var i = 0; i < 300; i++)
+{
+  long_str = long_str + pieces[i % pieces.length];
+}
+
+for (var i = 0; i < long_str.length; i++)
+{
+  assert (long_str.charAt (i) === pieces[i % pieces.length]);
+}
@@ -0,0 +1,58 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var str = "universe";
+
+assert (str.charCodeAt (0) === 117);
+assert (str.charCodeAt (7) === 101);
+assert (str.charCodeAt () === 117);
+assert (str.charCodeAt ("1") === 110);
+assert (str.charCodeAt (-0.5) === 117);
+assert (isNaN (str.charCodeAt (-1)));
+assert (isNaN (str.charCodeAt (8)));
+assert (isNaN ("".charCodeAt (0)));
+
+assert ("\u00e9\u4e00".charCodeAt (1) === 0x4e00);
+assert (String.prototype.charCodeAt.call (true, 0) === 116);
+assert (String.prototype.charCodeAt.length === 1);
+
+try
+{
+  String.prototype.charCodeAt.call (null, 0);
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof TypeError);
+}
+
+// code units of long strings, built by concatenation and by join
+var codes = [0x61, 0xe9, 0x4e00, 0x62, 0x430];
+var concatenated = "";
+var parts = [];
+for (var i = 0; i < 300; i++)
+{
+  var ch = String.fromCharCode (codes[i % codes.length]);
+  concatenated = concatenated + ch;
+  parts.push (ch);
+}
+var joined = parts.join ("");
+
+assert (concatenated.length === 300 && joined.length === 300);
+for (var i = 0; i < 300; i++)
+{
+  assert (concatenated.charCodeAt (i) === codes[i % codes.length]);
+  assert (joined.charCodeAt (i) === codes[i % codes.length]);
+}
+assert (concatenated === joined);
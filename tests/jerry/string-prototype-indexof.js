@@ -0,0 +1,91 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+// Copyright 2015 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// check properties
+assert(String.prototype.indexOf.length === 1);
+
+assert("Hello world, welcome to the universe.".indexOf("welcome") === 13);
+assert("Hello world, welcome to the universe.".indexOf("Hello world, welcome to the universe.") === 0);
+assert("Hello world, welcome to the universe.".indexOf("Hello world, welcome to the universe.!") === -1);
+assert("Hello world, welcome to the universe.".indexOf("o") === 4);
+assert("Hello world, welcome to the universe.".indexOf("o", 5) === 7);
+assert("Hello world, welcome to the universe.".indexOf("o", 100) === -1);
+assert("Hello world, welcome to the universe.".indexOf("o", -100) === 4);
+assert("Hello world, welcome to the universe.".indexOf("o", NaN) === 4);
+assert("Hello world, welcome to the universe.".indexOf("o", 4.9) === 4);
+assert("Hello world, welcome to the universe.".indexOf("moon") === -1);
+assert("Hello world, welcome to the universe.".indexOf("universe.") === 28);
+assert("Hello world, welcome to the universe.".indexOf("universe!") === -1);
+
+// empty strings
+assert("abc".indexOf("") === 0);
+assert("abc".indexOf("", 2) === 2);
+assert("abc".indexOf("", 10) === 3);
+assert("".indexOf("") === 0);
+assert("".indexOf("a") === -1);
+
+// conversions
+assert("abcundefined".indexOf() === 3);
+assert("a1b2".indexOf(2) === 3);
+assert("a1b2".indexOf("b", "1") === 2);
+assert(String.prototype.indexOf.call(12345, 34) === 2);
+assert(String.prototype.indexOf.call({}, "Object") === 8);
+
+// non-ASCII characters
+assert("\u00e1rv\u00edzt\u0171r\u0151 t\u00fck\u00f6rf\u00far\u00f3g\u00e9p".indexOf("t\u00fck") === 10);
+assert("\u00e1rv\u00edzt\u0171r\u0151 t\u00fck\u00f6rf\u00far\u00f3g\u00e9p".indexOf("r", 3) === 7);
+assert("\u4e2d\u6587 \u4e2d\u6587".indexOf("\u6587", 2) === 4);
+
+// long strings
+var str = "";
+for (var i = 0; i < 200; i++) {
+  str += "abcdefghij";
+}
+str += "needle in a haystack";
+assert(str.indexOf("needle in a haystack") === 2000);
+assert(str.indexOf("needle in a haystacks") === -1);
+assert(str.indexOf("jabcdefghija") === 9);
+assert(str.indexOf("ja", 1985) === 1989);
+assert(str.indexOf("ja", 1990) === -1);
+assert(str.indexOf("ghijabcdefghijabcd", 1000) === 1006);
+
+// check this value
+try {
+  String.prototype.indexOf.call(undefined, "a");
+  assert(false);
+} catch(e) {
+  assert(e instanceof TypeError);
+}
+
+try {
+  String.prototype.indexOf.call(null, "a");
+  assert(false);
+} catch(e) {
+  assert(e instanceof TypeError);
+}
+
+// strings of different representations
+var short_str = ("_" + "0123456789abcdefghij").slice(1);
+assert(short_str.indexOf("9a") === 9);
+assert(short_str.indexOf(("x" + "bcd").slice(1)) === 11);
+
+var non_ascii = "";
+for (var i = 0; i < 50; i++) {
+  non_ascii += "\u00e9\u4e00a";
+}
+non_ascii += "needle";
+assert(non_ascii.indexOf("needle") === 150);
+assert(non_ascii.indexOf("a\u00e9", 100) === 101);
+assert(non_ascii.lastIndexOf("\u4e00a") === 148);
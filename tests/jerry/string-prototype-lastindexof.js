@@ -0,0 +1,64 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+// Copyright 2015 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// check properties
+assert(String.prototype.lastIndexOf.length === 1);
+
+assert("Hello world, welcome to the universe.".lastIndexOf("welcome") === 13);
+assert("Hello world, welcome to the universe.".lastIndexOf("Hello world, welcome to the universe.") === 0);
+assert("Hello world, welcome to the universe.".lastIndexOf("o") === 22);
+assert("Hello world, welcome to the universe.".lastIndexOf("o", 21) === 17);
+assert("Hello world, welcome to the universe.".lastIndexOf("o", 22) === 22);
+assert("Hello world, welcome to the universe.".lastIndexOf("o", 3) === -1);
+assert("Hello world, welcome to the universe.".lastIndexOf("o", -100) === -1);
+assert("Hello world, welcome to the universe.".lastIndexOf("H", -100) === 0);
+assert("Hello world, welcome to the universe.".lastIndexOf("o", NaN) === 22);
+assert("Hello world, welcome to the universe.".lastIndexOf("o", Infinity) === 22);
+assert("Hello world, welcome to the universe.".lastIndexOf("moon") === -1);
+assert("Hello world, welcome to the universe.".lastIndexOf("universe.") === 28);
+
+// empty strings
+assert("abc".lastIndexOf("") === 3);
+assert("abc".lastIndexOf("", 1) === 1);
+assert("".lastIndexOf("") === 0);
+assert("".lastIndexOf("a") === -1);
+
+// conversions
+assert("undefinedundefined".lastIndexOf() === 9);
+assert("a1b1".lastIndexOf(1) === 3);
+assert("a1b1".lastIndexOf(1, "2") === 1);
+assert(String.prototype.lastIndexOf.call(12345, 34) === 2);
+
+// non-ASCII characters
+assert("\u00e1rv\u00edzt\u0171r\u0151 t\u00fck\u00f6rf\u00far\u00f3g\u00e9p".lastIndexOf("r") === 17);
+assert("\u00e1rv\u00edzt\u0171r\u0151 t\u00fck\u00f6rf\u00far\u00f3g\u00e9p".lastIndexOf("r", 15) === 14);
+assert("\u4e2d\u6587 \u4e2d\u6587".lastIndexOf("\u4e2d", 2) === 0);
+
+// long strings
+var str = "needle in a haystack";
+for (var i = 0; i < 200; i++) {
+  str += "abcdefghij";
+}
+assert(str.lastIndexOf("needle in a haystack") === 0);
+assert(str.lastIndexOf("ja") === 2009);
+assert(str.lastIndexOf("ja", 2008) === 1999);
+
+// check this value
+try {
+  String.prototype.lastIndexOf.call(undefined, "a");
+  assert(false);
+} catch(e) {
+  assert(e instanceof TypeError);
+}
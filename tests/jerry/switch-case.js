@@ -95,3 +95,58 @@ switch ("var") {
 }
 
 assert (flow === '123a4');
+
+// no clause is executed, if there is no matching clause and no default clause
+flow = '';
+
+switch (3) {
+  case 1:
+    flow += '1';
+  case 2:
+    flow += '2';
+}
+
+assert (flow === '');
+
+// clause expressions are evaluated in order, till the matching one, before any of the bodies
+flow = '';
+
+function clause (value) {
+  flow += value;
+  return value;
+}
+
+var x = 2;
+switch (x + 0) {
+  case clause (1):
+    flow += 'a';
+  default:
+    flow += 'd';
+  case clause (2):
+    flow += 'b';
+    break;
+  case clause (3):
+    flow += 'c';
+}
+
+assert (flow === '12b');
+
+flow = '';
+switch (x + 2) {
+  case clause (1):
+    flow += 'a';
+  default:
+    flow += 'd';
+  case clause (2):
+    flow += 'b';
+  case clause (3):
+    flow += 'c';
+}
+
+assert (flow === '123dbc');
+
+// statement, following the switch statement on the same line
+flow = '';
+switch (x) { case 2: flow += 'a'; } flow += 'b';
+
+assert (flow === 'ab');
@@ -0,0 +1,161 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ArrayBuffer
+var buffer = new ArrayBuffer (16);
+assert (buffer.byteLength === 16);
+assert (ArrayBuffer.length === 1);
+assert (new ArrayBuffer (0).byteLength === 0);
+
+try
+{
+  ArrayBuffer (4);
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof TypeError);
+}
+
+// views, sharing one buffer
+var u8 = new Uint8Array (buffer);
+assert (u8.length === 16);
+assert (u8.buffer === buffer);
+assert (u8[0] === 0 && u8[15] === 0);
+
+u8[0] = 257;
+assert (u8[0] === 1);
+
+var i8 = new Int8Array (buffer, 1, 2);
+assert (i8.length === 2 && i8.byteOffset === 1 && i8.byteLength === 2);
+i8[0] = -1;
+assert (u8[1] === 255);
+
+var u16 = new Uint16Array (buffer, 2);
+assert (u16.length === 7);
+u16[0] = 0x0102;
+assert ((u8[2] === 2 && u8[3] === 1) || (u8[2] === 1 && u8[3] === 2));
+
+try
+{
+  new Int16Array (buffer, 1);
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof RangeError);
+}
+
+try
+{
+  new Int32Array (buffer, 0, 5);
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof RangeError);
+}
+
+// conversions of stored values
+assert (new Uint32Array ([-1])[0] === 4294967295);
+assert (new Int16Array ([32768])[0] === -32768);
+assert (new Int8Array ([1.9, -1.9])[1] === -1);
+
+var clamped = new Uint8ClampedArray ([1.5, 2.5, -3, 300, 0.5]);
+assert (clamped[0] === 2 && clamped[1] === 2 && clamped[2] === 0 && clamped[3] === 255 && clamped[4] === 0);
+
+var f64 = new Float64Array (3);
+f64[1] = 0.1;
+assert (f64[1] === 0.1);
+assert (f64[0] === 0);
+
+var f32 = new Float32Array ([0.5, NaN]);
+assert (f32[0] === 0.5 && isNaN (f32[1]));
+
+// indexed access
+var i32 = new Int32Array (4);
+i32.set ([7, 8], 2);
+assert (i32[2] === 7 && i32[3] === 8);
+
+var sum = 0;
+for (var i = 0; i < i32.length; i++)
+{
+  sum += i32[i];
+}
+assert (sum === 15);
+
+assert (i32[10] === undefined);
+i32[10] = 5;
+assert (i32[10] === undefined);
+assert (i32["3"] === 8);
+
+var desc = Object.getOwnPropertyDescriptor (i32, 2);
+assert (desc.value === 7 && desc.writable && desc.enumerable && !desc.configurable);
+i32[2] = 9;
+assert (Object.getOwnPropertyDescriptor (i32, "2").value === 9);
+
+assert (!delete i32[2]);
+assert (i32[2] === 9);
+
+i32.foo = 3;
+assert (i32.foo === 3);
+
+// constructors and prototypes
+assert (Int8Array.BYTES_PER_ELEMENT === 1);
+assert (Uint16Array.BYTES_PER_ELEMENT === 2);
+assert (Float64Array.prototype.BYTES_PER_ELEMENT === 8);
+assert (Int32Array.prototype.constructor === Int32Array);
+assert (Object.prototype.toString.call (i32) === "[object Int32Array]");
+assert (Object.prototype.toString.call (clamped) === "[object Uint8ClampedArray]");
+assert (i32 instanceof Int32Array);
+assert (!(i32 instanceof Uint32Array));
+
+try
+{
+  Int8Array (3);
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof TypeError);
+}
+
+// subarray, slice, isView
+var i16 = new Int16Array ([1, 2, 3, 4]);
+var sub = i16.subarray (1, 3);
+assert (sub.length === 2 && sub[0] === 2 && sub.byteOffset === 2);
+sub[0] = 20;
+assert (i16[1] === 20);
+assert (i16.subarray (-1).length === 1);
+
+var sliced = buffer.slice (1, 3);
+assert (sliced.byteLength === 2);
+assert (new Uint8Array (sliced)[0] === 255);
+u8[1] = 0;
+assert (new Uint8Array (sliced)[0] === 255);
+
+assert (ArrayBuffer.isView (i32));
+assert (!ArrayBuffer.isView (buffer));
+assert (!ArrayBuffer.isView ([]));
+
+// set from overlapping view of different type
+var bytes = new Uint8Array (8);
+for (var i = 0; i < bytes.length; i++)
+{
+  bytes[i] = i + 1;
+}
+var halves = new Uint16Array (bytes.buffer).subarray (0, 2);
+var expected = [halves[0] & 0xff, halves[1] & 0xff];
+bytes.set (halves, 1);
+assert (bytes[0] === 1 && bytes[1] === expected[0] && bytes[2] === expected[1]);
@@ -19,6 +19,10 @@ assert (i === undefined);
 assert (j === undefined);
 assert (q === undefined);
 assert (v === undefined);
+assert (w === undefined);
+assert (arr === undefined);
+assert (obj === undefined);
+assert (last === undefined);
 
 eval ('var n');
 eval ('var m = 1');
@@ -49,3 +53,34 @@ for (var q in {})
 }
 
 { var v = 1 }
+
+var w = function () {
+  var w1;
+}
+var arr = [1, [2, 3], { a: 4 }]
+var obj = { get prop () { return 1; }, set prop (v) { } }, last = 1;
+
+function f ()
+{
+  assert (f_v === undefined);
+  assert (f_w === undefined);
+
+  var g = function () {
+    var f_w;
+  }
+
+  { var f_v = 1 }
+
+  try
+  {
+    f_w = f_x;
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof ReferenceError);
+  }
+  var f_w = 2;
+}
+
+f ();
@@ -0,0 +1,99 @@
+// Copyright 2015 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Operands, that don't fit into a byte
+
+var i, src;
+
+// more registers in one statement, than fit into a byte
+src = "var o0 = {}";
+for (i = 1; i < 300; i++)
+{
+  src += ", o" + i + " = { v: " + i + " }";
+}
+src += "; return o299.v + o128.v;";
+assert (new Function (src) () === 427);
+
+src = "return x";
+for (i = 1; i < 300; i++)
+{
+  src += " + (x";
+}
+for (i = 1; i < 300; i++)
+{
+  src += ")";
+}
+assert (new Function ("x", src) (2) === 600);
+
+// more literals in one block of instructions, than fit into a byte
+src = "var s = 0;";
+for (i = 0; i < 64; i++)
+{
+  src += "a" + i + " = b" + i + " + c" + i + ";";
+}
+for (i = 0; i < 64; i++)
+{
+  src += "s += a" + i + ";";
+}
+src += "return s;";
+
+var args = [];
+for (i = 0; i < 64; i++)
+{
+  args.push ("b" + i, "c" + i);
+  src = "var a" + i + ";" + src;
+}
+var f = Function.apply (null, args.concat (src));
+
+var values = [];
+for (i = 0; i < 64; i++)
+{
+  values.push (i, 1);
+}
+assert (f.apply (null, values) === 64 * 63 / 2 + 64);
+
+// more elements in a list, than fit into a byte
+src = "[0";
+for (i = 1; i < 300; i++)
+{
+  src += ", " + i;
+}
+src += "]";
+var arr = eval (src);
+assert (arr.length === 300);
+assert (arr[0] === 0);
+assert (arr[299] === 299);
+
+src = "(function () { return arguments.length + arguments[299]; }) (0";
+for (i = 1; i < 300; i++)
+{
+  src += ", " + i;
+}
+src += ")";
+assert (eval (src) === 599);
+
+src = "({ p0: 0";
+for (i = 1; i < 300; i++)
+{
+  src += ", p" + i + ": " + i;
+}
+src += "})";
+assert (eval (src).p299 === 299);
+
+src = "return x";
+for (i = 1; i < 300; i++)
+{
+  src += " && x";
+}
+assert (new Function ("x", src) (1) === 1);
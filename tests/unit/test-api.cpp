@@ -54,10 +54,26 @@ const char *test_source = (
                            "function throw_reference_error() { "
                            " throw new ReferenceError ();"
                            "} "
+                           "function call_number_external () { "
+                           "  var obj = { valueOf : function () { return 3; } }; "
+                           "  assert (this.sum_squares () === 0); "
+                           "  assert (isNaN (this.sum_squares (1, 'x'))); "
+                           "  var caught = false; "
+                           "  try { "
+                           "    this.sum_squares ({ valueOf : function () { throw new RangeError (); } }); "
+                           "  } catch (e) { "
+                           "    caught = (e instanceof RangeError); "
+                           "  } "
+                           "  assert (caught); "
+                           "  return this.sum_squares (1, '2', obj); "
+                           "} "
                            );
 
 bool test_api_is_free_callback_was_called = false;
 
+const char *test_external_string = "external string buffer";
+uint32_t test_api_external_string_free_callbacks_count = 0;
+
 /**
  * Initialize Jerry API value with specified boolean value
  */
@@ -152,6 +168,20 @@ handler_throw_test (const jerry_api_object_t *function_obj_p,
   return false;
 }
 
+static double
+handler_number (const double args_p[],
+                const jerry_api_length_t args_cnt)
+{
+  double sum = 0;
+
+  for (jerry_api_length_t i = 0; i < args_cnt; i++)
+  {
+    sum += args_p[i] * args_p[i];
+  }
+
+  return sum;
+} /* handler_number */
+
 static void
 handler_construct_freecb (uintptr_t native_p)
 {
@@ -161,6 +191,17 @@ handler_construct_freecb (uintptr_t native_p)
   test_api_is_free_callback_was_called = true;
 } /* handler_construct_freecb */
 
+static void
+external_string_freecb (const jerry_api_char_t *chars_p,
+                        jerry_api_size_t size)
+{
+  JERRY_ASSERT ((chars_p == (const jerry_api_char_t *) test_external_string
+                 && size == strlen (test_external_string))
+                || (!memcmp (chars_p, "length", 6) && size == 6));
+
+  test_api_external_string_free_callbacks_count++;
+} /* external_string_freecb */
+
 static bool
 handler_construct (const jerry_api_object_t *function_obj_p,
                    const jerry_api_value_t *this_p,
@@ -299,7 +340,16 @@ main (void)
   JERRY_ASSERT (sz == -5);
   sz = jerry_api_string_to_char_buffer (res.v_string, (jerry_api_char_t *) buffer, -sz);
   JERRY_ASSERT (sz == 5);
+
+  // Lock characters of the returned string, which are either accessed directly or copied
+  jerry_api_string_chars_t chars;
+  jerry_api_string_lock_chars (res.v_string, &chars);
+  JERRY_ASSERT (chars.size == 4
+                && !memcmp (chars.chars_p, "abcd", 4));
   jerry_api_release_value (&res);
+  JERRY_ASSERT (chars.chars_p[0] == 'a');
+  jerry_api_string_unlock_chars (&chars);
+
   JERRY_ASSERT (!strcmp (buffer, "abcd"));
 
   // Get global.A
@@ -446,6 +496,34 @@ main (void)
   jerry_api_release_value (&val_t);
   jerry_api_release_value (&res);
 
+  // Test: External function with numeric native handler
+  external_func_p = jerry_api_create_external_number_function (handler_number);
+  JERRY_ASSERT (external_func_p != NULL
+                && jerry_api_is_function (external_func_p));
+
+  test_api_init_api_value_object (&val_external, external_func_p);
+  is_ok = jerry_api_set_object_field_value (global_obj_p,
+                                            (jerry_api_char_t *) "sum_squares",
+                                            &val_external);
+  JERRY_ASSERT (is_ok);
+  jerry_api_release_value (&val_external);
+  jerry_api_release_object (external_func_p);
+
+  is_ok = jerry_api_get_object_field_value (global_obj_p,
+                                            (jerry_api_char_t *) "call_number_external",
+                                            &val_call_external);
+  JERRY_ASSERT (is_ok
+                && val_call_external.type == JERRY_API_DATA_TYPE_OBJECT);
+  is_ok = jerry_api_call_function (val_call_external.v_object,
+                                   global_obj_p,
+                                   &res,
+                                   NULL, 0);
+  jerry_api_release_value (&val_call_external);
+  JERRY_ASSERT (is_ok
+                && res.type == JERRY_API_DATA_TYPE_FLOAT64
+                && res.v_float64 == 14.0);
+  jerry_api_release_value (&res);
+
   // Test: Unhandled exception in called function
   is_ok = jerry_api_get_object_field_value (global_obj_p, (jerry_api_char_t *) "throw_reference_error", &val_t);
   JERRY_ASSERT (is_ok
@@ -532,12 +610,118 @@ main (void)
 
   jerry_api_release_value (&val_t);
 
+  // Test: locking characters of literal and number strings
+  const char *eval_literal_src_p = "'literal string'";
+  status = jerry_api_eval ((jerry_api_char_t *) eval_literal_src_p,
+                           strlen (eval_literal_src_p),
+                           false,
+                           false,
+                           &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK
+                && res.type == JERRY_API_DATA_TYPE_STRING);
+  jerry_api_string_lock_chars (res.v_string, &chars);
+  JERRY_ASSERT (chars.size == 14
+                && !memcmp (chars.chars_p, "literal string", 14));
+  jerry_api_string_unlock_chars (&chars);
+  jerry_api_release_value (&res);
+
+  const char *eval_number_src_p = "String (12345)";
+  status = jerry_api_eval ((jerry_api_char_t *) eval_number_src_p,
+                           strlen (eval_number_src_p),
+                           false,
+                           false,
+                           &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK
+                && res.type == JERRY_API_DATA_TYPE_STRING);
+  jerry_api_string_lock_chars (res.v_string, &chars);
+  JERRY_ASSERT (chars.is_copy
+                && chars.size == 5
+                && !memcmp (chars.chars_p, "12345", 5));
+  jerry_api_string_unlock_chars (&chars);
+  jerry_api_release_value (&res);
+
+  // Test: external strings
+  jerry_api_string_t *ext_str_p = jerry_api_create_external_string ((const jerry_api_char_t *) test_external_string,
+                                                                    (jerry_api_size_t) strlen (test_external_string),
+                                                                    external_string_freecb);
+  jerry_api_string_lock_chars (ext_str_p, &chars);
+  JERRY_ASSERT (!chars.is_copy
+                && chars.chars_p == (const jerry_api_char_t *) test_external_string);
+  jerry_api_string_unlock_chars (&chars);
+
+  val_t.type = JERRY_API_DATA_TYPE_STRING;
+  val_t.v_string = ext_str_p;
+  is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) "ext_str", &val_t);
+  JERRY_ASSERT (is_ok);
+  jerry_api_release_value (&val_t);
+
+  const char *eval_ext_str_src_p = ("ext_str.length === 22 "
+                                    "&& ext_str === 'external string buffer' "
+                                    "&& ext_str[9] === 's' "
+                                    "&& ext_str.slice (16) === 'buffer' "
+                                    "&& (ext_str + '!').length === 23 "
+                                    "&& ext_str < 'f'");
+  status = jerry_api_eval ((jerry_api_char_t *) eval_ext_str_src_p,
+                           strlen (eval_ext_str_src_p),
+                           false,
+                           false,
+                           &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK
+                && res.type == JERRY_API_DATA_TYPE_BOOLEAN
+                && res.v_bool);
+  JERRY_ASSERT (test_api_external_string_free_callbacks_count == 0);
+
+  // External string, equal to a magic string, doesn't reference the buffer
+  ext_str_p = jerry_api_create_external_string ((const jerry_api_char_t *) "length", 6, external_string_freecb);
+  JERRY_ASSERT (test_api_external_string_free_callbacks_count == 1);
+  jerry_api_release_string (ext_str_p);
+
+  // Test: external ArrayBuffer
+  uint8_t ext_buffer[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+  jerry_api_object_t *ext_buffer_obj_p = jerry_api_create_external_array_buffer (ext_buffer, sizeof (ext_buffer));
+  JERRY_ASSERT (ext_buffer_obj_p != NULL);
+
+  uint8_t *buffer_data_p;
+  jerry_api_size_t buffer_size;
+  is_ok = jerry_api_get_array_buffer_data (ext_buffer_obj_p, &buffer_data_p, &buffer_size);
+  JERRY_ASSERT (is_ok && buffer_data_p == ext_buffer && buffer_size == sizeof (ext_buffer));
+
+  val_t.type = JERRY_API_DATA_TYPE_OBJECT;
+  val_t.v_object = ext_buffer_obj_p;
+  is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) "ext_buffer", &val_t);
+  JERRY_ASSERT (is_ok);
+  jerry_api_release_value (&val_t);
+
+  const char *eval_ext_buffer_src_p = ("var ext_view = new Uint8Array (ext_buffer, 2, 4); "
+                                       "ext_view[0] = ext_view[3] + 10; "
+                                       "ext_view");
+  status = jerry_api_eval ((jerry_api_char_t *) eval_ext_buffer_src_p,
+                           strlen (eval_ext_buffer_src_p),
+                           false,
+                           false,
+                           &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK
+                && res.type == JERRY_API_DATA_TYPE_OBJECT);
+  JERRY_ASSERT (ext_buffer[2] == 16);
+
+  is_ok = jerry_api_get_array_buffer_data (res.v_object, &buffer_data_p, &buffer_size);
+  JERRY_ASSERT (is_ok && buffer_data_p == ext_buffer + 2 && buffer_size == 4);
+  jerry_api_release_value (&res);
+
+  JERRY_ASSERT (!jerry_api_get_array_buffer_data (global_obj_p, &buffer_data_p, &buffer_size));
+
+  jerry_api_object_t *buffer_obj_p = jerry_api_create_array_buffer (4);
+  is_ok = jerry_api_get_array_buffer_data (buffer_obj_p, &buffer_data_p, &buffer_size);
+  JERRY_ASSERT (is_ok && buffer_size == 4 && buffer_data_p[0] == 0 && buffer_data_p[3] == 0);
+  jerry_api_release_object (buffer_obj_p);
+
   // cleanup.
   jerry_api_release_object (global_obj_p);
 
   jerry_cleanup ();
 
   JERRY_ASSERT (test_api_is_free_callback_was_called);
+  JERRY_ASSERT (test_api_external_string_free_callbacks_count == 2);
 
   // External Magic String
   jerry_init (JERRY_FLAG_SHOW_OPCODES);
@@ -70,17 +70,39 @@ main (int __attr_unused___ argc,
   JERRY_ASSERT (ecma_date_year_from_time (MS_PER_DAY * (ecma_number_t) (365.25 * (2015 - 1970)))
                 == 2015);
 
+  JERRY_ASSERT (ecma_date_year_from_time (-1) == 1969);
+  JERRY_ASSERT (ecma_date_year_from_time (MS_PER_DAY * (ecma_number_t) 10957) == 2000);
+  JERRY_ASSERT (ecma_date_year_from_time (MS_PER_DAY * (ecma_number_t) -135140) == 1600);
+  JERRY_ASSERT (ecma_date_year_from_time (8.64e15) == 275760);
+  JERRY_ASSERT (ecma_date_year_from_time (-8.64e15) == -271821);
+
   /* int ecma_date_day_within_year (time) */
 
-  /* FIXME: Implement */
+  JERRY_ASSERT (ecma_date_day_within_year (0) == 0);
+  JERRY_ASSERT (ecma_date_day_within_year (-1) == 364);
+  JERRY_ASSERT (ecma_date_day_within_year (MS_PER_DAY * (ecma_number_t) (10957 + 365)) == 365);
+
+  /* int ecma_date_in_leap_year (time) */
+
+  JERRY_ASSERT (ecma_date_in_leap_year (0) == 0);
+  JERRY_ASSERT (ecma_date_in_leap_year (MS_PER_DAY * (ecma_number_t) 10957) == 1);
 
   /* int ecma_date_month_from_time  (time) */
 
-  /* FIXME: Implement */
+  JERRY_ASSERT (ecma_date_month_from_time (0) == 0);
+  JERRY_ASSERT (ecma_date_month_from_time (-1) == 11);
+  JERRY_ASSERT (ecma_date_month_from_time (MS_PER_DAY * (ecma_number_t) 58) == 1);
+  JERRY_ASSERT (ecma_date_month_from_time (MS_PER_DAY * (ecma_number_t) 59) == 2);
+  JERRY_ASSERT (ecma_date_month_from_time (MS_PER_DAY * (ecma_number_t) (10957 + 59)) == 1);
+  JERRY_ASSERT (ecma_date_month_from_time (MS_PER_DAY * (ecma_number_t) 16861) == 2);
 
   /* int ecma_date_date_from_time  (time) */
 
-  /* FIXME: Implement */
+  JERRY_ASSERT (ecma_date_date_from_time (0) == 1);
+  JERRY_ASSERT (ecma_date_date_from_time (-1) == 31);
+  JERRY_ASSERT (ecma_date_date_from_time (MS_PER_DAY * (ecma_number_t) (10957 + 59)) == 29);
+  JERRY_ASSERT (ecma_date_date_from_time (MS_PER_DAY * (ecma_number_t) (10957 + 60)) == 1);
+  JERRY_ASSERT (ecma_date_date_from_time (MS_PER_DAY * (ecma_number_t) 16861) == 1);
 
   /* int ecma_date_week_day (ecma_number_t time) */
 
@@ -129,6 +151,10 @@ main (int __attr_unused___ argc,
   JERRY_ASSERT (ecma_date_make_day (1970, 1, 35) == 65);
   JERRY_ASSERT (ecma_date_make_day (1970, 13, 35) == 430);
   JERRY_ASSERT (ecma_date_make_day (2016, 2, 1) == 16861);
+  JERRY_ASSERT (ecma_date_make_day (1970, -1, 1) == -31);
+  JERRY_ASSERT (ecma_date_make_day (2000, 2, 1) == 10957 + 60);
+  JERRY_ASSERT (ecma_date_make_day (1900, 2, 1) == -25508);
+  JERRY_ASSERT (ecma_date_make_day (275760, 8, 13) == 1e8);
 
   /* ecma_number_t ecma_date_make_date (day, time) */
 
@@ -0,0 +1,154 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Unit test for heap snapshots.
+ */
+
+#include "config.h"
+#include "jerry.h"
+#include "jerry-api.h"
+
+#include "test-common.h"
+
+const char *warm_up_source = (
+                              "var counter = 10; "
+                              "function inc (v) { "
+                              "  counter += v; "
+                              "  return counter; "
+                              "} "
+                              "var obj = { s : 'str' + counter, a : [1, 2, 3] }; "
+                              "eval ('var from_eval = 5'); "
+                              );
+
+const char *check_source = (
+                            "inc (from_eval) === 15 "
+                            "&& obj.s === 'str10' "
+                            "&& obj.a.length === 3 "
+                            "&& Math.max.apply (null, obj.a) === 3"
+                            );
+
+const char *script_source = (
+                             "function assert (arg) { "
+                             "  if (!arg) { "
+                             "    throw Error ('Assert failed'); "
+                             "  } "
+                             "} "
+                             "assert (inc (1) === 16); "
+                             "assert (obj.a.join () === '1,2,3'); "
+                             );
+
+/**
+ * Buffer for the heap snapshot
+ */
+static uint8_t snapshot_buffer[CONFIG_MEM_HEAP_AREA_SIZE + 4096];
+
+/**
+ * External function handler
+ */
+static bool
+handler (const jerry_api_object_t *function_obj_p __attr_unused___, /**< function object */
+         const jerry_api_value_t *this_p __attr_unused___, /**< this arg */
+         jerry_api_value_t *ret_val_p __attr_unused___, /**< return argument */
+         const jerry_api_value_t args_p[] __attr_unused___, /**< function arguments */
+         const jerry_api_length_t args_cnt __attr_unused___) /**< function arguments count */
+{
+  return true;
+} /* handler */
+
+/**
+ * Evaluate the source and check that the result is boolean true
+ */
+static void
+check_eval_is_true (const char *source_p) /**< source code */
+{
+  jerry_api_value_t res;
+  jerry_completion_code_t status = jerry_api_eval ((const jerry_api_char_t *) source_p,
+                                                   strlen (source_p),
+                                                   false,
+                                                   false,
+                                                   &res);
+
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_BOOLEAN && res.v_bool);
+
+  jerry_api_release_value (&res);
+} /* check_eval_is_true */
+
+int
+main (int __attr_unused___ argc,
+      char __attr_unused___ **argv)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_FLAG_EMPTY);
+
+  bool is_ok = jerry_parse ((const jerry_api_char_t *) warm_up_source, strlen (warm_up_source));
+  JERRY_ASSERT (is_ok);
+  JERRY_ASSERT (jerry_run () == JERRY_COMPLETION_CODE_OK);
+
+  /* objects with external pointers can't be stored in a snapshot */
+  jerry_api_object_t *external_func_p = jerry_api_create_external_function (handler);
+  JERRY_ASSERT (external_func_p != NULL);
+  JERRY_ASSERT (jerry_save_heap_snapshot (NULL, 0) == 0);
+  jerry_api_release_object (external_func_p);
+
+  /* neither can external strings */
+  jerry_api_string_t *external_str_p = jerry_api_create_external_string ((const jerry_api_char_t *) check_source,
+                                                                        (jerry_api_size_t) strlen (check_source),
+                                                                        NULL);
+  JERRY_ASSERT (jerry_save_heap_snapshot (NULL, 0) == 0);
+  jerry_api_release_string (external_str_p);
+
+  /* nor ArrayBuffer objects, referencing external data */
+  uint8_t external_data[4];
+  jerry_api_object_t *external_buffer_p = jerry_api_create_external_array_buffer (external_data,
+                                                                                 sizeof (external_data));
+  JERRY_ASSERT (external_buffer_p != NULL);
+  JERRY_ASSERT (jerry_save_heap_snapshot (NULL, 0) == 0);
+  jerry_api_release_object (external_buffer_p);
+
+  size_t snapshot_size = jerry_save_heap_snapshot (NULL, 0);
+  JERRY_ASSERT (snapshot_size != 0 && snapshot_size <= sizeof (snapshot_buffer));
+  JERRY_ASSERT (jerry_save_heap_snapshot (snapshot_buffer, snapshot_size - 1) == 0);
+  JERRY_ASSERT (jerry_save_heap_snapshot (snapshot_buffer, sizeof (snapshot_buffer)) == snapshot_size);
+
+  /* the engine continues working after the snapshot is taken */
+  check_eval_is_true (check_source);
+
+  jerry_cleanup ();
+
+  for (uint32_t i = 0; i < 2; i++)
+  {
+    is_ok = jerry_init_from_heap_snapshot (JERRY_FLAG_EMPTY, snapshot_buffer, snapshot_size);
+    JERRY_ASSERT (is_ok);
+
+    check_eval_is_true (check_source);
+
+    is_ok = jerry_parse ((const jerry_api_char_t *) script_source, strlen (script_source));
+    JERRY_ASSERT (is_ok);
+    JERRY_ASSERT (jerry_run () == JERRY_COMPLETION_CODE_OK);
+
+    jerry_cleanup ();
+  }
+
+  /* truncated or corrupted snapshots are rejected */
+  JERRY_ASSERT (!jerry_init_from_heap_snapshot (JERRY_FLAG_EMPTY, snapshot_buffer, snapshot_size - 1));
+
+  snapshot_buffer[0] ^= 0xff;
+  JERRY_ASSERT (!jerry_init_from_heap_snapshot (JERRY_FLAG_EMPTY, snapshot_buffer, snapshot_size));
+
+  return 0;
+} /* main */
@@ -0,0 +1,236 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Unit test for libc's memory routines (memset, memchr, memcmp, memcpy, memmove).
+ *
+ * The routines are checked for all combinations of areas' alignments and for sizes
+ * around the routines' word-at-a-time processing thresholds.
+ */
+
+#include "test-common.h"
+
+// Maximum offset of an area from a word-aligned address
+const size_t test_max_offset = 2 * sizeof (uintptr_t);
+
+// Maximum size of an area
+const size_t test_max_size = 8 * sizeof (uintptr_t) + 3;
+
+// Size of test buffers
+const size_t test_buffer_size = 2 * test_max_offset + test_max_size;
+
+uintptr_t buffer1[test_buffer_size / sizeof (uintptr_t) + 1];
+uintptr_t buffer2[test_buffer_size / sizeof (uintptr_t) + 1];
+
+/**
+ * Initial value of the test buffer's byte
+ *
+ * @return byte value
+ */
+static uint8_t
+test_initial_byte (size_t index, /**< index of byte in the buffer */
+                   uint8_t salt) /**< value, distinguishing buffers */
+{
+  return (uint8_t) (index * 7u + salt);
+} /* test_initial_byte */
+
+/**
+ * Fill the buffer with initial values
+ */
+static void
+test_init_buffer (uint8_t *buffer_p, /**< buffer */
+                  uint8_t salt) /**< value, distinguishing buffers */
+{
+  for (size_t i = 0; i < test_buffer_size; i++)
+  {
+    buffer_p[i] = test_initial_byte (i, salt);
+  }
+} /* test_init_buffer */
+
+/**
+ * Check memset and memchr
+ */
+static void
+test_memset_memchr (size_t offset, /**< area's offset */
+                    size_t size) /**< area's size */
+{
+  uint8_t *buffer_p = (uint8_t *) buffer1;
+  const uint8_t values[] = { 0x00, 0x01, 0x7f, 0x80, 0xff };
+
+  for (size_t k = 0; k < sizeof (values) / sizeof (values[0]); k++)
+  {
+    test_init_buffer (buffer_p, 1);
+
+    JERRY_ASSERT (memset (buffer_p + offset, values[k], size) == buffer_p + offset);
+
+    for (size_t i = 0; i < test_buffer_size; i++)
+    {
+      if (i >= offset && i < offset + size)
+      {
+        JERRY_ASSERT (buffer_p[i] == values[k]);
+      }
+      else
+      {
+        JERRY_ASSERT (buffer_p[i] == test_initial_byte (i, 1));
+      }
+    }
+
+    /* search for the value at each position of the area, with all other bytes being different */
+    const uint8_t other_value = (uint8_t) (values[k] ^ 0x80u);
+    memset (buffer_p, other_value, test_buffer_size);
+
+    JERRY_ASSERT (memchr (buffer_p + offset, values[k], size) == NULL);
+
+    for (size_t pos = 0; pos < size; pos++)
+    {
+      buffer_p[offset + pos] = values[k];
+      buffer_p[offset + size - 1] = values[k];
+
+      JERRY_ASSERT (memchr (buffer_p + offset, values[k], size) == buffer_p + offset + pos);
+
+      buffer_p[offset + pos] = other_value;
+      buffer_p[offset + size - 1] = other_value;
+    }
+
+    /* bytes, that are out of the area, are not matched */
+    buffer_p[offset + size] = values[k];
+    JERRY_ASSERT (memchr (buffer_p + offset, values[k], size) == NULL);
+  }
+} /* test_memset_memchr */
+
+/**
+ * Check memcmp
+ */
+static void
+test_memcmp (size_t offset1, /**< first area's offset */
+             size_t offset2, /**< second area's offset */
+             size_t size) /**< areas' size */
+{
+  uint8_t *buffer1_p = (uint8_t *) buffer1;
+  uint8_t *buffer2_p = (uint8_t *) buffer2;
+
+  for (size_t i = 0; i < size; i++)
+  {
+    buffer1_p[offset1 + i] = buffer2_p[offset2 + i] = test_initial_byte (i, 1);
+  }
+
+  /* bytes, that are out of the areas, are not compared */
+  buffer1_p[offset1 + size] = 0x00;
+  buffer2_p[offset2 + size] = 0xff;
+
+  JERRY_ASSERT (memcmp (buffer1_p + offset1, buffer2_p + offset2, size) == 0);
+
+  for (size_t pos = 0; pos < size; pos++)
+  {
+    const uint8_t value = buffer1_p[offset1 + pos];
+
+    /* the first difference determines the result, regardless of following differences */
+    if (pos + 1 < size)
+    {
+      buffer2_p[offset2 + size - 1] = (uint8_t) (value + 1u);
+    }
+
+    buffer2_p[offset2 + pos] = (uint8_t) (value ^ 0x80u);
+
+    int expected = (value < buffer2_p[offset2 + pos]) ? -1 : 1;
+    JERRY_ASSERT (memcmp (buffer1_p + offset1, buffer2_p + offset2, size) == expected);
+    JERRY_ASSERT (memcmp (buffer2_p + offset2, buffer1_p + offset1, size) == -expected);
+
+    buffer2_p[offset2 + pos] = value;
+    buffer2_p[offset2 + size - 1] = buffer1_p[offset1 + size - 1];
+  }
+} /* test_memcmp */
+
+/**
+ * Check memcpy
+ */
+static void
+test_memcpy (size_t dest_offset, /**< destination's offset */
+             size_t src_offset, /**< source's offset */
+             size_t size) /**< areas' size */
+{
+  uint8_t *dest_p = (uint8_t *) buffer1;
+  uint8_t *src_p = (uint8_t *) buffer2;
+
+  test_init_buffer (dest_p, 1);
+  test_init_buffer (src_p, 2);
+
+  JERRY_ASSERT (memcpy (dest_p + dest_offset, src_p + src_offset, size) == dest_p + dest_offset);
+
+  for (size_t i = 0; i < test_buffer_size; i++)
+  {
+    if (i >= dest_offset && i < dest_offset + size)
+    {
+      JERRY_ASSERT (dest_p[i] == test_initial_byte (i - dest_offset + src_offset, 2));
+    }
+    else
+    {
+      JERRY_ASSERT (dest_p[i] == test_initial_byte (i, 1));
+    }
+
+    JERRY_ASSERT (src_p[i] == test_initial_byte (i, 2));
+  }
+} /* test_memcpy */
+
+/**
+ * Check memmove of overlapping areas
+ */
+static void
+test_memmove (size_t dest_offset, /**< destination's offset */
+              size_t src_offset, /**< source's offset */
+              size_t size) /**< areas' size */
+{
+  uint8_t *buffer_p = (uint8_t *) buffer1;
+
+  test_init_buffer (buffer_p, 1);
+
+  JERRY_ASSERT (memmove (buffer_p + dest_offset, buffer_p + src_offset, size) == buffer_p + dest_offset);
+
+  for (size_t i = 0; i < test_buffer_size; i++)
+  {
+    if (i >= dest_offset && i < dest_offset + size)
+    {
+      JERRY_ASSERT (buffer_p[i] == test_initial_byte (i - dest_offset + src_offset, 1));
+    }
+    else
+    {
+      JERRY_ASSERT (buffer_p[i] == test_initial_byte (i, 1));
+    }
+  }
+} /* test_memmove */
+
+int
+main (int __attr_unused___ argc,
+      char __attr_unused___ **argv)
+{
+  TEST_INIT ();
+
+  for (size_t size = 0; size <= test_max_size; size++)
+  {
+    for (size_t offset1 = 0; offset1 <= test_max_offset; offset1++)
+    {
+      test_memset_memchr (offset1, size);
+
+      for (size_t offset2 = 0; offset2 <= test_max_offset; offset2++)
+      {
+        test_memcmp (offset1, offset2, size);
+        test_memcpy (offset1, offset2, size);
+        test_memmove (offset1, offset2, size);
+      }
+    }
+  }
+
+  return 0;
+} /* main */
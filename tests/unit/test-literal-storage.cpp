@@ -68,6 +68,28 @@ main (int __attr_unused___ argc,
   mem_init ();
   lit_init ();
 
+  // Check lookup of magic strings
+  for (uint32_t id = 0; id < LIT_MAGIC_STRING__COUNT; id++)
+  {
+    const lit_utf8_byte_t *magic_p = lit_get_magic_string_utf8 ((lit_magic_string_id_t) id);
+    const lit_utf8_size_t magic_size = lit_get_magic_string_size ((lit_magic_string_id_t) id);
+
+    lit_magic_string_id_t found_id;
+    JERRY_ASSERT (lit_is_utf8_string_magic (magic_p, magic_size, &found_id));
+    JERRY_ASSERT (found_id == (lit_magic_string_id_t) id);
+
+    if (magic_size != 0)
+    {
+      memcpy (strings[0], magic_p, magic_size);
+      strings[0][magic_size] = (lit_utf8_byte_t) '#';
+
+      JERRY_ASSERT (!lit_is_utf8_string_magic (strings[0], magic_size + 1, &found_id));
+      JERRY_ASSERT (found_id == LIT_MAGIC_STRING__COUNT);
+
+      strings[0][magic_size - 1] = (lit_utf8_byte_t) '#';
+      JERRY_ASSERT (!lit_is_utf8_string_magic (strings[0], magic_size, &found_id));
+    }
+  }
 
   for (uint32_t i = 0; i < test_iters; i++)
   {
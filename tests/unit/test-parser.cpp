@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include "bytecode-data.h"
 #include "mem-allocator.h"
 #include "opcodes.h"
 #include "parser.h"
@@ -23,7 +24,7 @@
 #define NAME_TO_ID(op) (__op__idx_##op)
 
 #define __OPCODE_SIZE(name, arg1, arg2, arg3) \
-  (uint8_t) (sizeof (__op_##name) + 1),
+  (uint8_t) (sizeof (__op_##name) / sizeof (idx_t) + 1),
 
 static uint8_t opcode_sizes[] =
 {
@@ -32,12 +33,13 @@ static uint8_t opcode_sizes[] =
 };
 
 static bool
-opcodes_equal (const opcode_t *opcodes1, opcode_t *opcodes2, uint16_t size)
+opcodes_equal (const opcode_compact_t *opcodes1, opcode_t *opcodes2, uint16_t size)
 {
   uint16_t i;
   for (i = 0; i < size; i++)
   {
-    uint8_t opcode_num1 = opcodes1[i].op_idx, opcode_num2 = opcodes2[i].op_idx;
+    opcode_t opcode1 = serializer_get_opcode (opcodes1, i);
+    idx_t opcode_num1 = opcode1.op_idx, opcode_num2 = opcodes2[i].op_idx;
     uint8_t j;
 
     if (opcode_num1 != opcode_num2)
@@ -45,14 +47,14 @@ opcodes_equal (const opcode_t *opcodes1, opcode_t *opcodes2, uint16_t size)
       return false;
     }
 
-    if (opcode_num1 == NAME_TO_ID (nop) || opcode_num1 == NAME_TO_ID (ret))
+    if (opcode_num1 == NAME_TO_ID (nop))
     {
       return true;
     }
 
     for (j = 1; j < opcode_sizes[opcode_num1]; j++)
     {
-      if (((uint8_t*)&opcodes1[i])[j] != ((uint8_t*)&opcodes2[i])[j])
+      if (((raw_opcode *) &opcode1)->uids[j] != ((raw_opcode *) &opcodes2[i])->uids[j])
       {
         return false;
       }
@@ -62,6 +64,35 @@ opcodes_equal (const opcode_t *opcodes1, opcode_t *opcodes2, uint16_t size)
   return true;
 }
 
+/**
+ * State of the test source reader
+ */
+typedef struct
+{
+  const char *source_p; /**< source to read */
+  size_t source_size; /**< source size */
+  size_t pos; /**< current read position */
+} test_source_reader_t;
+
+/**
+ * Source reader, returning source by three-byte chunks
+ *
+ * @return number of bytes, put to the buffer
+ */
+static size_t
+test_source_reader (jerry_api_char_t *buffer_p, /**< buffer to put source to */
+                    size_t buffer_size, /**< size of the buffer */
+                    void *user_p) /**< reader state */
+{
+  test_source_reader_t *reader_p = (test_source_reader_t *) user_p;
+
+  size_t size = JERRY_MIN (JERRY_MIN (buffer_size, (size_t) 3), reader_p->source_size - reader_p->pos);
+  memcpy (buffer_p, reader_p->source_p + reader_p->pos, size);
+  reader_p->pos += size;
+
+  return size;
+} /* test_source_reader */
+
 /**
  * Unit test's main function.
  */
@@ -71,7 +102,7 @@ main (int __attr_unused___ argc,
 {
   TEST_INIT ();
 
-  const opcode_t *opcodes_p;
+  const opcode_compact_t *opcodes_p;
   bool is_syntax_correct;
 
   mem_init ();
@@ -92,13 +123,20 @@ main (int __attr_unused___ argc,
                 | OPCODE_SCOPE_CODE_FLAGS_NOT_REF_EVAL_IDENTIFIER,
                 INVALID_VALUE),
     getop_reg_var_decl (OPCODE_REG_FIRST, OPCODE_REG_GENERAL_FIRST),
-    getop_var_decl (0),             // var a;
+#ifndef CONFIG_PARSER_BYTECODE_OPTIMIZER_DISABLE
+    getop_meta (OPCODE_META_TYPE_SCOPE_DECLARATIONS, 0, 3), // declarations: 5;
+    getop_assignment (0, 1, 1),     // a = 1;
+#else /* CONFIG_PARSER_BYTECODE_OPTIMIZER_DISABLE */
+    getop_meta (OPCODE_META_TYPE_SCOPE_DECLARATIONS, 0, 4), // declarations: 6;
     getop_assignment (130, 1, 1),   // $tmp0 = 1;
     getop_assignment (0, 6, 130),   // a = $tmp0;
-    getop_ret ()                    // return;
+#endif /* CONFIG_PARSER_BYTECODE_OPTIMIZER_DISABLE */
+    getop_ret (),                   // return;
+    getop_var_decl (0),             // var a;
+    getop_meta (OPCODE_META_TYPE_END_SCOPE_DECLARATIONS, INVALID_VALUE, INVALID_VALUE)
   };
 
-  JERRY_ASSERT (opcodes_equal (opcodes_p, opcodes, 5));
+  JERRY_ASSERT (opcodes_equal (opcodes_p, opcodes, (uint16_t) (sizeof (opcodes) / sizeof (opcodes[0]))));
 
   serializer_free ();
 
@@ -113,6 +151,177 @@ main (int __attr_unused___ argc,
 
   serializer_free ();
 
+  // #3
+  char program3[] = "var a = 1;\nfor (var i = 0; i < 10; i++)\n{\n  a += i;\n}\n";
+  test_source_reader_t reader;
+  reader.source_p = program3;
+  reader.source_size = strlen (program3);
+  reader.pos = 0;
+
+  jerry_api_char_t program3_buffer[64];
+
+  serializer_init ();
+  parser_set_show_opcodes (true);
+  is_syntax_correct = parser_parse_script_from_reader (test_source_reader,
+                                                       &reader,
+                                                       program3_buffer,
+                                                       sizeof (program3_buffer),
+                                                       &opcodes_p);
+
+  JERRY_ASSERT (is_syntax_correct && opcodes_p != NULL);
+  JERRY_ASSERT (reader.pos == reader.source_size);
+
+  serializer_free ();
+
+  // #4
+  /* the buffer holds a window of the source, which is smaller than the source, and than the lazily compiled body */
+  char program4[] = "function f (a) { var b = a + 1; return b * 2; }\n"
+                    "var n = 0;\n"
+                    "while (f (n) < 10) { switch (n) { case 1: n += 2; break; default: n++; } }\n";
+  reader.source_p = program4;
+  reader.source_size = strlen (program4);
+  reader.pos = 0;
+
+  serializer_init ();
+  parser_set_show_opcodes (true);
+  parser_set_parse_functions_lazily (true);
+  is_syntax_correct = parser_parse_script_from_reader (test_source_reader,
+                                                       &reader,
+                                                       program3_buffer,
+                                                       24,
+                                                       &opcodes_p);
+
+  JERRY_ASSERT (is_syntax_correct && opcodes_p != NULL);
+  JERRY_ASSERT (reader.pos == reader.source_size);
+
+  const char *body4_p = " var b = a + 1; return b * 2; ";
+  const lazy_function_body_source_t *body4_source_p;
+  body4_source_p = MEM_CP_GET_NON_NULL_POINTER (lazy_function_body_source_t,
+                                                GET_LAZY_FUNCTION_BODY_FOR_BYTECODE (opcodes_p, 0)->source_cp);
+
+  JERRY_ASSERT (body4_source_p->size == strlen (body4_p)
+                && memcmp (body4_source_p + 1, body4_p, strlen (body4_p)) == 0);
+
+  parser_set_parse_functions_lazily (false);
+  serializer_free ();
+
+  /* a token, and a header of for statement, that are larger than the buffer, are parsed in a grown buffer */
+  char program4_long[] = "var s = 'a string literal, that does not fit into the buffer';\n"
+                         "for (var index = 0; index < s.length; index = index + 1) { s += index; }\n";
+  reader.source_p = program4_long;
+  reader.source_size = strlen (program4_long);
+  reader.pos = 0;
+
+  serializer_init ();
+  parser_set_show_opcodes (true);
+  is_syntax_correct = parser_parse_script_from_reader (test_source_reader,
+                                                       &reader,
+                                                       program3_buffer,
+                                                       16,
+                                                       &opcodes_p);
+
+  JERRY_ASSERT (is_syntax_correct && opcodes_p != NULL);
+  JERRY_ASSERT (reader.pos == reader.source_size);
+
+  serializer_free ();
+
+  // #5
+  char program5[] = "function f (a) { 'use strict'; return a + 1; }";
+
+  serializer_init ();
+  parser_set_show_opcodes (true);
+  parser_set_parse_functions_lazily (true);
+  is_syntax_correct = parser_parse_script ((jerry_api_char_t *) program5, strlen (program5), &opcodes_p);
+
+  JERRY_ASSERT (is_syntax_correct && opcodes_p != NULL);
+
+  opcode_t opcodes5[] =
+  {
+    getop_meta (OPCODE_META_TYPE_SCOPE_CODE_FLAGS, // [ ]
+                OPCODE_SCOPE_CODE_FLAGS_NOT_REF_ARGUMENTS_IDENTIFIER
+                | OPCODE_SCOPE_CODE_FLAGS_NOT_REF_EVAL_IDENTIFIER,
+                INVALID_VALUE),
+    getop_reg_var_decl (OPCODE_REG_FIRST, OPCODE_REG_GENERAL_FIRST),
+    getop_meta (OPCODE_META_TYPE_SCOPE_DECLARATIONS, 0, 7),          // declarations: 9;
+    getop_func_decl_n (0, 1),                                        // function f (
+    getop_meta (OPCODE_META_TYPE_VARG, 1, INVALID_VALUE),            //   a)
+    getop_meta (OPCODE_META_TYPE_FUNCTION_END, 0, 3),                // {
+    getop_meta (OPCODE_META_TYPE_SCOPE_CODE_FLAGS,                   //   [use strict, no 'arguments', no 'eval']
+                OPCODE_SCOPE_CODE_FLAGS_STRICT
+                | OPCODE_SCOPE_CODE_FLAGS_NOT_REF_ARGUMENTS_IDENTIFIER
+                | OPCODE_SCOPE_CODE_FLAGS_NOT_REF_EVAL_IDENTIFIER,
+                INVALID_VALUE),
+    getop_meta (OPCODE_META_TYPE_LAZY_FUNCTION_BODY, 0, 0),          // 'use strict'; return a + 1;
+                                                                     // }
+    getop_ret (),                                                    // return;
+    getop_meta (OPCODE_META_TYPE_FUNCTION_DECLARATION, 0, 6),        // function declaration: 3;
+    getop_meta (OPCODE_META_TYPE_END_SCOPE_DECLARATIONS, INVALID_VALUE, INVALID_VALUE)
+  };
+
+  JERRY_ASSERT (opcodes_equal (opcodes_p, opcodes5, (uint16_t) (sizeof (opcodes5) / sizeof (opcodes5[0]))));
+
+  const char *body5_p = " 'use strict'; return a + 1; ";
+  is_syntax_correct = parser_parse_lazy_function_body ((jerry_api_char_t *) body5_p,
+                                                       strlen (body5_p),
+                                                       true,
+                                                       &opcodes_p);
+
+  JERRY_ASSERT (is_syntax_correct && opcodes_p != NULL);
+
+  /* early errors of a lazily compiled body are reported during the parse */
+  char program6[] = "var ran = true; function f () { var = 1; }";
+
+  is_syntax_correct = parser_parse_script ((jerry_api_char_t *) program6, strlen (program6), &opcodes_p);
+
+  JERRY_ASSERT (!is_syntax_correct && opcodes_p == NULL);
+
+  /* source code of the bodies, registered before a syntax error, is released */
+  char program7[] = "var f = function () { function g () { return; } }; var h = function () { return +; };";
+
+  is_syntax_correct = parser_parse_script ((jerry_api_char_t *) program7, strlen (program7), &opcodes_p);
+
+  JERRY_ASSERT (!is_syntax_correct && opcodes_p == NULL);
+
+  /* early errors, detected by the scan of a lazily compiled body */
+  const char *programs8_fail[] =
+  {
+    "function f () { while (true) { } break; }",
+    "function f () { for (;;) { continue M; } }",
+    "function f () { var o = 1; o + 1 = 2; }",
+    "function f () { ++this; }",
+    "function f () { var class; }",
+    "function f () { 'use strict'; var o = function (a, b, a) { }; }",
+    "function f () { 'use strict'; eval = 1; }",
+    "function f () { var a = [ 1, 2 ); }",
+    "function f () { if (a) { }"
+  };
+
+  for (size_t i = 0; i < sizeof (programs8_fail) / sizeof (programs8_fail[0]); i++)
+  {
+    is_syntax_correct = parser_parse_script ((jerry_api_char_t *) programs8_fail[i],
+                                             strlen (programs8_fail[i]),
+                                             &opcodes_p);
+
+    JERRY_ASSERT (!is_syntax_correct && opcodes_p == NULL);
+  }
+
+  /* valid bodies are not rejected by the scan */
+  char program9[] = "function f (a, b) {\n"
+                    "  L: for (var i in a) { do { if (i) { continue L; } break; } while (b)\n"
+                    "  }\n"
+                    "  switch (a) { case 1: return /x+/g.test (a) ? b / 2 : 0; default: break; }\n"
+                    "  var o = { get: 1, set x (v) { }, get x () { return arguments }, if: 2 }\n"
+                    "  var c = a\n"
+                    "  ++c\n"
+                    "  return function (a, a) { a++; return o.x-- }\n"
+                    "}";
+  is_syntax_correct = parser_parse_script ((jerry_api_char_t *) program9, strlen (program9), &opcodes_p);
+
+  JERRY_ASSERT (is_syntax_correct && opcodes_p != NULL);
+
+  parser_set_parse_functions_lazily (false);
+  serializer_free ();
+
   mem_finalize (false);
 
   return 0;
@@ -0,0 +1,128 @@
+/* Copyright 2015 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Unit test for scratch stack.
+ */
+
+#include "mem-allocator.h"
+
+#include "test-common.h"
+
+// Iterations count
+const uint32_t test_iters = 16384;
+
+// Subiterations count
+const uint32_t test_max_sub_iters = 32;
+
+// Threshold size of region to allocate
+const size_t test_threshold_region_size = MEM_SCRATCH_AREA_SIZE / 4;
+
+uint8_t *ptrs[test_max_sub_iters];
+size_t sizes[test_max_sub_iters];
+
+/**
+ * Fill the local arrays with a value, dependent on nesting depth, and check that outer arrays are kept intact
+ */
+static void
+test_local_arrays (uint32_t depth) /**< nesting depth */
+{
+  if (depth == 0)
+  {
+    return;
+  }
+
+  const size_t number = (size_t) rand () % test_threshold_region_size;
+
+  MEM_DEFINE_LOCAL_ARRAY (values, number, uint32_t);
+
+  JERRY_ASSERT (number == 0 || values != NULL);
+
+  for (size_t i = 0; i < number; i++)
+  {
+    values[i] = depth;
+  }
+
+  test_local_arrays (depth - 1);
+
+  for (size_t i = 0; i < number; i++)
+  {
+    JERRY_ASSERT (values[i] == depth);
+  }
+
+  MEM_FINALIZE_LOCAL_ARRAY (values);
+} /* test_local_arrays */
+
+int
+main (int __attr_unused___ argc,
+      char __attr_unused___ **argv)
+{
+  TEST_INIT ();
+
+  mem_init ();
+
+  for (uint32_t i = 0; i < test_iters; i++)
+  {
+    const size_t subiters = ((size_t) rand () % test_max_sub_iters) + 1;
+
+    for (size_t j = 0; j < subiters; j++)
+    {
+      sizes[j] = (size_t) rand () % test_threshold_region_size;
+      ptrs[j] = (uint8_t *) mem_scratch_alloc (sizes[j]);
+
+      JERRY_ASSERT ((sizes[j] == 0) == (ptrs[j] == NULL));
+      JERRY_ASSERT ((uintptr_t) ptrs[j] % MEM_ALIGNMENT == 0);
+
+      memset (ptrs[j], (int) j, sizes[j]);
+    }
+
+    for (size_t j = subiters; j-- > 0;)
+    {
+      for (size_t k = 0; k < sizes[j]; k++)
+      {
+        JERRY_ASSERT (ptrs[j][k] == (uint8_t) j);
+      }
+
+      if (ptrs[j] != NULL)
+      {
+        mem_scratch_free (ptrs[j], sizes[j]);
+      }
+    }
+
+    test_local_arrays ((uint32_t) rand () % test_max_sub_iters);
+  }
+
+#ifdef MEM_STATS
+  mem_scratch_stats_t stats;
+  mem_scratch_get_stats (&stats);
+
+  JERRY_ASSERT (stats.allocated_bytes == 0);
+  JERRY_ASSERT (stats.peak_allocated_bytes <= stats.size);
+
+  printf ("Scratch stack stats:\n");
+  printf ("  Size: %lu\n"
+          "  Peak allocated bytes: %lu\n"
+          "  Allocations: %lu\n"
+          "  Heap fallbacks: %lu\n\n",
+          stats.size,
+          stats.peak_allocated_bytes,
+          stats.allocations,
+          stats.heap_fallbacks);
+#endif /* MEM_STATS */
+
+  mem_finalize (false);
+
+  return 0;
+} /* main */
@@ -27,11 +27,26 @@ do
  ENGINE=${OUT_DIR}/${TARGET}/jerry
  LOGS_PATH_FULL=${OUT_DIR}/${TARGET}/check
 
+ # Profiling builds are smoke-tested with profile collection and report turned on
+ TESTS_OPTS=""
+ if [[ "${TARGET}" == *vm_profile* ]]
+ then
+   TESTS_OPTS="--vm-profile"
+ fi
+
  # Full testing
  INDEX=0
- for TESTS_PATH in "./tests/jerry" "./tests/jerry-test-suite/precommit_test_list"
+ TESTS_PATHS="./tests/jerry ./tests/jerry-test-suite/precommit_test_list"
+
+ # Tests of large scripts, that don't fit into heap of the default profile
+ if [[ "${TARGET}" == *cpointer_32bit* ]]
+ then
+   TESTS_PATHS="${TESTS_PATHS} ./tests/jerry-cpointer_32bit"
+ fi
+
+ for TESTS_PATH in ${TESTS_PATHS}
  do
-   ./tools/runners/run-precommit-check-for-target.sh "${ENGINE}" "${LOGS_PATH_FULL}"/"${INDEX}" "${TESTS_PATH}" &
+   ./tools/runners/run-precommit-check-for-target.sh "${ENGINE}" "${LOGS_PATH_FULL}"/"${INDEX}" "${TESTS_PATH}" "${TESTS_OPTS}" &
    RUN_IDS="${RUN_IDS} $!";
    INDEX=$((INDEX + 1))
  done
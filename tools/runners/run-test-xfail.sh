@@ -34,7 +34,7 @@ ECHO_PROGRESS=1
 JERRY_ARGS=
 while (( "$#" ))
 do
-  if [ "$1" = "--parse-only" ]
+  if [ "$1" = "--parse-only" ] || [ "$1" = "--vm-profile" ]
   then
     JERRY_ARGS="$JERRY_ARGS $1"
   fi